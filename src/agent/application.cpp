@@ -37,6 +37,8 @@
 #include <systemd/sd-daemon.h>
 #endif
 
+#include <openthread/dataset.h>
+
 #include "agent/application.hpp"
 #include "common/code_utils.hpp"
 #include "common/mainloop_manager.hpp"
@@ -52,7 +54,10 @@ Application::Application(const std::string               &aInterfaceName,
                          const std::vector<const char *> &aRadioUrls,
                          bool                             aEnableAutoAttach,
                          const std::string               &aRestListenAddress,
-                         int                              aRestListenPort)
+                         int                              aRestListenPort,
+                         uint32_t                         aRestWorkerThreads,
+                         bool                             aDeferredInit,
+                         const std::string               &aSnapshotPath)
     : mInterfaceName(aInterfaceName)
 #if __linux__
     , mInfraLinkSelector(aBackboneInterfaceNames)
@@ -62,7 +67,8 @@ Application::Application(const std::string               &aInterfaceName,
 #endif
     , mNcp(mInterfaceName.c_str(), aRadioUrls, mBackboneInterfaceName, /* aDryRun */ false, aEnableAutoAttach)
 #if OTBR_ENABLE_MDNS
-    , mPublisher(Mdns::Publisher::Create([this](Mdns::Publisher::State aState) { this->HandleMdnsState(aState); }))
+    , mPublisher(Mdns::Publisher::Create([this](Mdns::Publisher::State aState) { this->HandleMdnsState(aState); },
+                                         mBackboneInterfaceName))
 #endif
 #if OTBR_ENABLE_BORDER_AGENT
     , mBorderAgent(mNcp, *mPublisher)
@@ -83,60 +89,149 @@ Application::Application(const std::string               &aInterfaceName,
     , mUbusAgent(mNcp)
 #endif
 #if OTBR_ENABLE_REST_SERVER
-    , mRestWebServer(mNcp, aRestListenAddress, aRestListenPort)
+    , mRestWebServer(mNcp, *mPublisher, aRestListenAddress, aRestListenPort, aRestWorkerThreads)
 #endif
 #if OTBR_ENABLE_DBUS_SERVER && OTBR_ENABLE_BORDER_AGENT
-    , mDBusAgent(mNcp, *mPublisher)
+    , mDBusAgent(mNcp, *mPublisher, mStartupProfiler)
 #endif
 #if OTBR_ENABLE_VENDOR_SERVER
     , mVendorServer(vendor::VendorServer::newInstance(*this))
 #endif
+    , mDeferredInit(aDeferredInit)
+    , mServicesInitialized(false)
+    , mIsAttached(false)
+    , mSnapshotPath(aSnapshotPath)
 {
     OTBR_UNUSED_VARIABLE(aRestListenAddress);
     OTBR_UNUSED_VARIABLE(aRestListenPort);
+    OTBR_UNUSED_VARIABLE(aRestWorkerThreads);
+
+#if OTBR_ENABLE_REST_SERVER && OTBR_ENABLE_BACKBONE_ROUTER && OTBR_ENABLE_DUA_ROUTING
+    mRestWebServer.GetMetricsExporter().SetBackboneAgent(&mBackboneAgent);
+#endif
+#if OTBR_ENABLE_REST_SERVER && OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    mRestWebServer.GetMetricsExporter().SetAdvertisingProxy(&mAdvertisingProxy);
+#endif
+#if OTBR_ENABLE_REST_SERVER && OTBR_ENABLE_BORDER_AGENT
+    mRestWebServer.GetMetricsExporter().SetBorderAgent(&mBorderAgent);
+#endif
 }
 
 void Application::Init(void)
 {
-    mNcp.Init();
+    if (!mSnapshotPath.empty())
+    {
+        // Restored before the NCP is initialized, as the NCP brings up TREL which uses the restored peers.
+        RestoreSnapshot();
+        mTaskRunner.Post(Milliseconds(OTBR_SNAPSHOT_INTERVAL), [this]() { HandleSnapshotTimer(); });
+    }
+
+    mStartupProfiler.Run("ncp", [this]() { mNcp.Init(); });
+
+    mAttachStartTime = Clock::now();
+    mNcp.GetThreadHelper()->AddDeviceRoleHandler([this](otDeviceRole aRole) { HandleDeviceRoleChanged(aRole); });
 
 #if OTBR_ENABLE_MDNS
-    mPublisher->Start();
+    mStartupProfiler.Run("mdns", [this]() { mPublisher->Start(); });
 #endif
 #if OTBR_ENABLE_BORDER_AGENT
 // This is for delaying publishing the MeshCoP service until the correct
 // vendor name and OUI etc. are correctly set by BorderAgent::SetMeshCopServiceValues()
 #if OTBR_STOP_BORDER_AGENT_ON_INIT
-    mBorderAgent.SetEnabled(false);
+    mStartupProfiler.Run("border-agent", [this]() { mBorderAgent.SetEnabled(false); });
 #else
-    mBorderAgent.SetEnabled(true);
+    mStartupProfiler.Run("border-agent", [this]() { mBorderAgent.SetEnabled(true); });
 #endif
 #endif
 #if OTBR_ENABLE_BACKBONE_ROUTER
-    mBackboneAgent.Init();
+    mStartupProfiler.Run("backbone-router", [this]() { mBackboneAgent.Init(); });
 #endif
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
-    mAdvertisingProxy.SetEnabled(true);
+    mStartupProfiler.Run("advertising-proxy", [this]() { mAdvertisingProxy.SetEnabled(true); });
 #endif
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
-    mDiscoveryProxy.SetEnabled(true);
+    mStartupProfiler.Run("discovery-proxy", [this]() { mDiscoveryProxy.SetEnabled(true); });
 #endif
+
+    // There is nothing to attach to without an active dataset, so the services are not deferred then.
+    if (mDeferredInit && otDatasetIsCommissioned(mNcp.GetInstance()))
+    {
+        otbrLogInfo("Defer initializing services until Thread is attached");
+        mTaskRunner.Post(Milliseconds(OTBR_DEFERRED_INIT_TIMEOUT), [this]() { InitServices(); });
+    }
+    else
+    {
+        InitServices();
+    }
+}
+
+void Application::InitServices(void)
+{
+    VerifyOrExit(!mServicesInitialized);
+    mServicesInitialized = true;
+
 #if OTBR_ENABLE_OPENWRT
-    mUbusAgent.Init();
+    mStartupProfiler.Run("ubus", [this]() { mUbusAgent.Init(); });
 #endif
 #if OTBR_ENABLE_REST_SERVER
-    mRestWebServer.Init();
+    mStartupProfiler.Run("rest", [this]() { mRestWebServer.Init(); });
 #endif
 #if OTBR_ENABLE_DBUS_SERVER
-    mDBusAgent.Init();
+    if (mDeferredInit)
+    {
+        Timepoint startTime = Clock::now();
+
+        // Waits for the system bus on the mainloop instead of blocking it.
+        mDBusAgent.InitAsync([this, startTime]() {
+            mStartupProfiler.AddPhase("dbus", startTime);
+            InitVendorServer();
+        });
+    }
+    else
+    {
+        mStartupProfiler.Run("dbus", [this]() { mDBusAgent.Init(); });
+        InitVendorServer();
+    }
+#else
+    InitVendorServer();
 #endif
+
+exit:
+    return;
+}
+
+void Application::InitVendorServer(void)
+{
 #if OTBR_ENABLE_VENDOR_SERVER
-    mVendorServer->Init();
+    mStartupProfiler.Run("vendor", [this]() { mVendorServer->Init(); });
 #endif
 }
 
+void Application::HandleDeviceRoleChanged(otDeviceRole aRole)
+{
+    VerifyOrExit(!mIsAttached);
+    VerifyOrExit(aRole == OT_DEVICE_ROLE_CHILD || aRole == OT_DEVICE_ROLE_ROUTER || aRole == OT_DEVICE_ROLE_LEADER);
+
+    mIsAttached = true;
+    mStartupProfiler.AddPhase("thread-attach", mAttachStartTime);
+
+    if (mDeferredInit)
+    {
+        // Not initialized right away as this is called back by OpenThread.
+        mTaskRunner.Post([this]() { InitServices(); });
+    }
+
+exit:
+    return;
+}
+
 void Application::Deinit(void)
 {
+    if (!mSnapshotPath.empty())
+    {
+        SaveSnapshot();
+    }
+
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
     mAdvertisingProxy.SetEnabled(false);
 #endif
@@ -164,6 +259,7 @@ otbrError Application::Run(void)
     {
         otbrLogInfo("Notify systemd the service is ready.");
 
+        // With deferred initialization, the DBus, REST and UBus services are not initialized yet.
         // Ignored return value as systemd recommends.
         // See https://www.freedesktop.org/software/systemd/man/sd_notify.html
         sd_notify(0, "READY=1");
@@ -206,6 +302,7 @@ otbrError Application::Run(void)
             MainloopManager::GetInstance().Process(mainloop);
 
 #if __linux__
+            if (mInfraLinkSelector.IsReselectPending())
             {
                 const char *newInfraLink = mInfraLinkSelector.Select();
 
@@ -228,6 +325,47 @@ otbrError Application::Run(void)
     return error;
 }
 
+void Application::RestoreSnapshot(void)
+{
+    otbrError error = mSnapshot.Load(mSnapshotPath);
+
+    VerifyOrExit(error == OTBR_ERROR_NONE,
+                 otbrLogInfo("No snapshot restored from %s: %s", mSnapshotPath.c_str(), otbrErrorString(error)));
+
+    otbrLogInfo("Restoring snapshot from %s", mSnapshotPath.c_str());
+#if OTBR_ENABLE_TREL
+    mTrelDnssd.RestoreSnapshot(mSnapshot);
+#endif
+
+exit:
+    return;
+}
+
+void Application::SaveSnapshot(void)
+{
+    otbrError error;
+
+    // A component which has nothing to save yet, as TREL DNS-SD before it is initialized, leaves its section
+    // untouched, so the previously loaded or saved value is written again instead of being lost.
+#if OTBR_ENABLE_TREL
+    mTrelDnssd.SaveSnapshot(mSnapshot);
+#endif
+
+    error = mSnapshot.Save(mSnapshotPath);
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to save snapshot to %s: %s", mSnapshotPath.c_str(), otbrErrorString(error));
+    }
+}
+
+void Application::HandleSnapshotTimer(void)
+{
+    // Saved periodically as well, so the snapshot is not lost when the agent crashes.
+    SaveSnapshot();
+    mTaskRunner.Post(Milliseconds(OTBR_SNAPSHOT_INTERVAL), [this]() { HandleSnapshotTimer(); });
+}
+
 void Application::HandleMdnsState(Mdns::Publisher::State aState)
 {
     OTBR_UNUSED_VARIABLE(aState);
@@ -44,6 +44,8 @@
 #if OTBR_ENABLE_BORDER_AGENT
 #include "border_agent/border_agent.hpp"
 #endif
+#include "common/startup_profiler.hpp"
+#include "common/task_runner.hpp"
 #include "ncp/ncp_openthread.hpp"
 #if OTBR_ENABLE_BACKBONE_ROUTER
 #include "backbone_router/backbone_agent.hpp"
@@ -61,6 +63,15 @@
 #include "agent/vendor.hpp"
 #endif
 #include "utils/infra_link_selector.hpp"
+#include "utils/snapshot.hpp"
+
+#ifndef OTBR_DEFERRED_INIT_TIMEOUT
+#define OTBR_DEFERRED_INIT_TIMEOUT 10000
+#endif
+
+#ifndef OTBR_SNAPSHOT_INTERVAL
+#define OTBR_SNAPSHOT_INTERVAL 300000
+#endif
 
 namespace otbr {
 
@@ -97,6 +108,9 @@ public:
      * @param[in] aEnableAutoAttach      Whether or not to automatically attach to the saved network.
      * @param[in] aRestListenAddress     Network address to listen on.
      * @param[in] aRestListenPort        Network port to listen on.
+     * @param[in] aRestWorkerThreads     Number of worker threads of the REST server.
+     * @param[in] aDeferredInit          Whether or not to defer initializing the non-critical services.
+     * @param[in] aSnapshotPath          Path of the warm-restart snapshot file, empty to disable the snapshot.
      *
      */
     explicit Application(const std::string               &aInterfaceName,
@@ -104,17 +118,29 @@ public:
                          const std::vector<const char *> &aRadioUrls,
                          bool                             aEnableAutoAttach,
                          const std::string               &aRestListenAddress,
-                         int                              aRestListenPort);
+                         int                              aRestListenPort,
+                         uint32_t                         aRestWorkerThreads,
+                         bool                             aDeferredInit,
+                         const std::string               &aSnapshotPath);
 
     /**
      * This method initializes the Application instance.
      *
+     * With deferred initialization, only the NCP and the Thread-facing services are initialized here. The UBus
+     * agent, the REST server, the DBus agent and the vendor server are initialized on the mainloop once Thread is
+     * attached, or after OTBR_DEFERRED_INIT_TIMEOUT milliseconds at the latest.
+     *
+     * The service manager is notified of readiness by `Run()` before the deferred services exist, so a client must
+     * wait for the DBus name or the `Ready` signal rather than for the service to start.
+     *
      */
     void Init(void);
 
     /**
      * This method de-initializes the Application instance.
      *
+     * The warm-restart snapshot, if enabled, is saved before anything is de-initialized.
+     *
      */
     void Deinit(void);
 
@@ -242,6 +268,13 @@ public:
     }
 #endif
 
+    /**
+     * Get the profiler of the startup phases.
+     *
+     * @returns The startup profiler.
+     */
+    const StartupProfiler &GetStartupProfiler(void) const { return mStartupProfiler; }
+
     /**
      * This method handles mDNS publisher's state changes.
      *
@@ -256,7 +289,15 @@ private:
 
     static void HandleSignal(int aSignal);
 
-    std::string mInterfaceName;
+    void InitServices(void);
+    void InitVendorServer(void);
+    void HandleDeviceRoleChanged(otDeviceRole aRole);
+    void RestoreSnapshot(void);
+    void SaveSnapshot(void);
+    void HandleSnapshotTimer(void);
+
+    StartupProfiler mStartupProfiler;
+    std::string     mInterfaceName;
 #if __linux__
     otbr::Utils::InfraLinkSelector mInfraLinkSelector;
 #endif
@@ -292,6 +333,13 @@ private:
 #if OTBR_ENABLE_VENDOR_SERVER
     std::shared_ptr<vendor::VendorServer> mVendorServer;
 #endif
+    bool            mDeferredInit;
+    bool            mServicesInitialized;
+    bool            mIsAttached;
+    Timepoint       mAttachStartTime;
+    std::string     mSnapshotPath;
+    Utils::Snapshot mSnapshot;
+    TaskRunner      mTaskRunner;
 
     static std::atomic_bool sShouldTerminate;
 };
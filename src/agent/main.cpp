@@ -63,6 +63,13 @@ static const char kDefaultInterfaceName[] = "wpan0";
 // Port number used by Rest server.
 static const uint32_t kPortNumber = 8081;
 
+#ifndef OTBR_REST_WORKER_THREADS
+#define OTBR_REST_WORKER_THREADS 2
+#endif
+
+// Maximum number of worker threads of the Rest server.
+static const long kMaxRestWorkerThreads = 64;
+
 enum
 {
     OTBR_OPT_BACKBONE_INTERFACE_NAME = 'B',
@@ -77,6 +84,9 @@ enum
     OTBR_OPT_AUTO_ATTACH,
     OTBR_OPT_REST_LISTEN_ADDR,
     OTBR_OPT_REST_LISTEN_PORT,
+    OTBR_OPT_REST_WORKER_THREADS,
+    OTBR_OPT_DEFERRED_INIT,
+    OTBR_OPT_SNAPSHOT_FILE,
 };
 
 #ifndef __ANDROID__
@@ -97,6 +107,9 @@ static const struct option kOptions[] = {
     {"auto-attach", optional_argument, nullptr, OTBR_OPT_AUTO_ATTACH},
     {"rest-listen-address", required_argument, nullptr, OTBR_OPT_REST_LISTEN_ADDR},
     {"rest-listen-port", required_argument, nullptr, OTBR_OPT_REST_LISTEN_PORT},
+    {"rest-worker-threads", required_argument, nullptr, OTBR_OPT_REST_WORKER_THREADS},
+    {"deferred-init", no_argument, nullptr, OTBR_OPT_DEFERRED_INIT},
+    {"snapshot-file", required_argument, nullptr, OTBR_OPT_SNAPSHOT_FILE},
     {0, 0, 0, 0}};
 
 static bool ParseInteger(const char *aStr, long &aOutResult)
@@ -141,8 +154,12 @@ static void PrintHelp(const char *aProgramName)
             "Usage: %s [-I interfaceName] [-B backboneIfName] [-d DEBUG_LEVEL] [-v] [-s] [--auto-attach[=0/1]] "
             "RADIO_URL [RADIO_URL]\n"
             "    --auto-attach defaults to 1\n"
+            "    --rest-worker-threads defaults to %d\n"
+            "    --deferred-init initializes the REST, DBus and UBus services after Thread is attached,\n"
+            "      readiness is still notified to the service manager right away\n"
+            "    --snapshot-file keeps the discovered TREL peers across restarts in the given file\n"
             "    -s disables syslog and prints to standard out\n",
-            aProgramName);
+            aProgramName, OTBR_REST_WORKER_THREADS);
     fprintf(stderr, "%s", otSysGetRadioUrlHelpString());
 }
 
@@ -203,6 +220,9 @@ static int realmain(int argc, char *argv[])
     bool                      enableAutoAttach  = true;
     const char               *restListenAddress = "";
     int                       restListenPort    = kPortNumber;
+    uint32_t                  restWorkerThreads = OTBR_REST_WORKER_THREADS;
+    bool                      deferredInit      = false;
+    const char               *snapshotFile      = "";
     std::vector<const char *> radioUrls;
     std::vector<const char *> backboneInterfaceNames;
     long                      parseResult;
@@ -270,6 +290,20 @@ static int realmain(int argc, char *argv[])
             restListenPort = parseResult;
             break;
 
+        case OTBR_OPT_REST_WORKER_THREADS:
+            VerifyOrExit(ParseInteger(optarg, parseResult), ret = EXIT_FAILURE);
+            VerifyOrExit(1 <= parseResult && parseResult <= kMaxRestWorkerThreads, ret = EXIT_FAILURE);
+            restWorkerThreads = static_cast<uint32_t>(parseResult);
+            break;
+
+        case OTBR_OPT_DEFERRED_INIT:
+            deferredInit = true;
+            break;
+
+        case OTBR_OPT_SNAPSHOT_FILE:
+            snapshotFile = optarg;
+            break;
+
         default:
             PrintHelp(argv[0]);
             ExitNow(ret = EXIT_FAILURE);
@@ -301,7 +335,7 @@ static int realmain(int argc, char *argv[])
 
     {
         otbr::Application app(interfaceName, backboneInterfaceNames, radioUrls, enableAutoAttach, restListenAddress,
-                              restListenPort);
+                              restListenPort, restWorkerThreads, deferredInit, snapshotFile);
 
         gApp = &app;
         app.Init();
@@ -82,6 +82,16 @@ public:
      */
     void Init(void);
 
+#if OTBR_ENABLE_DUA_ROUTING
+    /**
+     * This method returns the ND Proxy manager.
+     *
+     * @returns A reference to the ND Proxy manager.
+     *
+     */
+    const NdProxyManager &GetNdProxyManager(void) const { return mNdProxyManager; }
+#endif
+
 private:
     void        OnBecomePrimary(void);
     void        OnResignPrimary(void);
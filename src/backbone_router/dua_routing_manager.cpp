@@ -35,38 +35,286 @@
 
 #if OTBR_ENABLE_DUA_ROUTING
 
+#if __linux__
+#include <errno.h>
+#include <linux/fib_rules.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <net/if.h>
+#include <string.h>
+#include <unistd.h>
+#endif
+
 #include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#if __linux__
+#include "utils/socket_utils.hpp"
+#endif
 
 namespace otbr {
 
 namespace BackboneRouter {
 
+#if __linux__
+namespace {
+
+// The "openthread" routing table, as installed into /etc/iproute2/rt_tables by script/_rt_tables.
+constexpr uint32_t kOpenThreadRouteTable = 88;
+constexpr uint32_t kThreadRouteMetric    = 1;
+
+/**
+ * This class accumulates rtnetlink route and rule requests and commits them in one transaction.
+ *
+ * All requests are sent in a single datagram, each asking for an ACK, so that the whole batch costs
+ * one `send()` and the outcome of every request can be checked individually.
+ *
+ */
+class RouteBatch
+{
+public:
+    explicit RouteBatch(bool aAdd)
+        : mAdd(aAdd)
+        , mLength(0)
+        , mNumRequests(0)
+    {
+    }
+
+    otbrError AddRoute(const Ip6Prefix &aPrefix, uint32_t aIfIndex, uint32_t aTable, uint32_t aMetric)
+    {
+        otbrError error = OTBR_ERROR_NONE;
+        rtmsg     rtm;
+        nlmsghdr *header;
+
+        memset(&rtm, 0, sizeof(rtm));
+        rtm.rtm_family   = AF_INET6;
+        rtm.rtm_dst_len  = aPrefix.mLength;
+        rtm.rtm_table    = aTable < 256 ? aTable : RT_TABLE_UNSPEC;
+        rtm.rtm_protocol = RTPROT_STATIC;
+        rtm.rtm_scope    = RT_SCOPE_UNIVERSE;
+        rtm.rtm_type     = RTN_UNICAST;
+
+        VerifyOrExit((header = AppendRequest(mAdd ? RTM_NEWROUTE : RTM_DELROUTE, &rtm, sizeof(rtm))) != nullptr,
+                     errno = ENOBUFS, error = OTBR_ERROR_ERRNO);
+        SuccessOrExit(error = AppendAttr(*header, RTA_DST, aPrefix.mPrefix.m8, sizeof(aPrefix.mPrefix.m8)));
+        SuccessOrExit(error = AppendAttr(*header, RTA_OIF, &aIfIndex, sizeof(aIfIndex)));
+        SuccessOrExit(error = AppendAttr(*header, RTA_TABLE, &aTable, sizeof(aTable)));
+
+        if (aMetric != 0)
+        {
+            SuccessOrExit(error = AppendAttr(*header, RTA_PRIORITY, &aMetric, sizeof(aMetric)));
+        }
+
+    exit:
+        return error;
+    }
+
+    otbrError AddRule(const std::string &aInputInterfaceName, uint32_t aTable)
+    {
+        otbrError    error = OTBR_ERROR_NONE;
+        fib_rule_hdr frh;
+        nlmsghdr    *header;
+
+        memset(&frh, 0, sizeof(frh));
+        frh.family = AF_INET6;
+        frh.table  = aTable < 256 ? aTable : RT_TABLE_UNSPEC;
+        frh.action = FR_ACT_TO_TBL;
+
+        VerifyOrExit((header = AppendRequest(mAdd ? RTM_NEWRULE : RTM_DELRULE, &frh, sizeof(frh))) != nullptr,
+                     errno = ENOBUFS, error = OTBR_ERROR_ERRNO);
+        SuccessOrExit(error = AppendAttr(*header, FRA_IIFNAME, aInputInterfaceName.c_str(),
+                                         aInputInterfaceName.size() + 1));
+        SuccessOrExit(error = AppendAttr(*header, FRA_TABLE, &aTable, sizeof(aTable)));
+
+    exit:
+        return error;
+    }
+
+    otbrError Commit(void)
+    {
+        otbrError error    = OTBR_ERROR_NONE;
+        int       sock     = -1;
+        uint32_t  numAcked = 0;
+        int       failure  = 0;
+
+        VerifyOrExit(mNumRequests > 0);
+        VerifyOrExit((sock = CreateNetLinkRouteSocket(0)) != -1, error = OTBR_ERROR_ERRNO);
+        VerifyOrExit(send(sock, mBuffer.mData, mLength, 0) == static_cast<ssize_t>(mLength), error = OTBR_ERROR_ERRNO);
+
+        // rtnetlink handles the requests synchronously within `send()`, so all ACKs are queued by now.
+        while (numAcked < mNumRequests)
+        {
+            union
+            {
+                nlmsghdr mHeader;
+                uint8_t  mData[4096];
+            } reply;
+            ssize_t len = recv(sock, reply.mData, sizeof(reply.mData), MSG_DONTWAIT);
+
+            VerifyOrExit(len > 0, error = OTBR_ERROR_ERRNO);
+
+            for (nlmsghdr *header = &reply.mHeader; NLMSG_OK(header, static_cast<size_t>(len));
+                 header           = NLMSG_NEXT(header, len))
+            {
+                const nlmsgerr *errMsg;
+
+                if (header->nlmsg_type != NLMSG_ERROR)
+                {
+                    continue;
+                }
+
+                errMsg = reinterpret_cast<const nlmsgerr *>(NLMSG_DATA(header));
+                numAcked++;
+
+                if (errMsg->error != 0 && !IsBenignError(-errMsg->error))
+                {
+                    otbrLogWarning("DuaRoutingManager: netlink request %u failed: %s", header->nlmsg_seq,
+                                   strerror(-errMsg->error));
+                    failure = -errMsg->error;
+                }
+            }
+        }
+
+        if (failure != 0)
+        {
+            errno = failure;
+            error = OTBR_ERROR_ERRNO;
+        }
+
+    exit:
+        if (sock != -1)
+        {
+            close(sock);
+        }
+
+        return error;
+    }
+
+private:
+    static constexpr size_t kBufferSize = 1024;
+
+    bool IsBenignError(int aErrno) const
+    {
+        // Installing what is already there or removing what is already gone keeps Enable()/Disable() idempotent.
+        return mAdd ? (aErrno == EEXIST) : (aErrno == ENOENT || aErrno == ESRCH);
+    }
+
+    nlmsghdr *AppendRequest(uint16_t aType, const void *aBody, size_t aBodyLength)
+    {
+        nlmsghdr *header = nullptr;
+        size_t    length = NLMSG_LENGTH(aBodyLength);
+
+        VerifyOrExit(mLength + NLMSG_ALIGN(length) <= kBufferSize);
+
+        header = reinterpret_cast<nlmsghdr *>(mBuffer.mData + mLength);
+        memset(header, 0, NLMSG_ALIGN(length));
+        header->nlmsg_len   = length;
+        header->nlmsg_type  = aType;
+        header->nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | (mAdd ? NLM_F_CREATE | NLM_F_EXCL : 0);
+        header->nlmsg_seq   = ++mNumRequests;
+        memcpy(NLMSG_DATA(header), aBody, aBodyLength);
+
+        mLength += NLMSG_ALIGN(length);
+
+    exit:
+        return header;
+    }
+
+    otbrError AppendAttr(nlmsghdr &aHeader, uint16_t aType, const void *aData, size_t aDataLength)
+    {
+        otbrError error  = OTBR_ERROR_NONE;
+        size_t    length = RTA_LENGTH(aDataLength);
+        rtattr   *attr;
+
+        VerifyOrExit(mLength + RTA_ALIGN(length) <= kBufferSize, errno = ENOBUFS, error = OTBR_ERROR_ERRNO);
+
+        attr           = reinterpret_cast<rtattr *>(mBuffer.mData + mLength);
+        attr->rta_type = aType;
+        attr->rta_len  = length;
+        memcpy(RTA_DATA(attr), aData, aDataLength);
+        memset(static_cast<uint8_t *>(RTA_DATA(attr)) + aDataLength, 0, RTA_ALIGN(length) - length);
+
+        aHeader.nlmsg_len += RTA_ALIGN(length);
+        mLength += RTA_ALIGN(length);
+
+    exit:
+        return error;
+    }
+
+    bool     mAdd;
+    size_t   mLength;
+    uint32_t mNumRequests;
+    union
+    {
+        nlmsghdr mHeader;
+        uint8_t  mData[kBufferSize];
+    } mBuffer;
+};
+
+} // namespace
+#endif // __linux__
+
 void DuaRoutingManager::Enable(const Ip6Prefix &aDomainPrefix)
 {
+    otbrError error = OTBR_ERROR_NONE;
+
     VerifyOrExit(!mEnabled);
     mEnabled = true;
 
     mDomainPrefix = aDomainPrefix;
 
+#if __linux__
+    error = UpdateRoutes(/* aAdd */ true);
+#else
     AddDefaultRouteToThread();
     AddPolicyRouteToBackbone();
+#endif
 
 exit:
-    otbrLogResult(OTBR_ERROR_NONE, "DuaRoutingManager: %s", __FUNCTION__);
+    otbrLogResult(error, "DuaRoutingManager: %s", __FUNCTION__);
 }
 
 void DuaRoutingManager::Disable(void)
 {
+    otbrError error = OTBR_ERROR_NONE;
+
     VerifyOrExit(mEnabled);
     mEnabled = false;
 
+#if __linux__
+    error = UpdateRoutes(/* aAdd */ false);
+#else
     DelDefaultRouteToThread();
     DelPolicyRouteToBackbone();
+#endif
 
 exit:
-    otbrLogResult(OTBR_ERROR_NONE, "DuaRoutingManager: %s", __FUNCTION__);
+    otbrLogResult(error, "DuaRoutingManager: %s", __FUNCTION__);
 }
 
+#if __linux__
+otbrError DuaRoutingManager::UpdateRoutes(bool aAdd)
+{
+    otbrError  error = OTBR_ERROR_NONE;
+    RouteBatch batch(aAdd);
+    uint32_t   threadIfIndex   = if_nametoindex(mInterfaceName.c_str());
+    uint32_t   backboneIfIndex = if_nametoindex(mBackboneInterfaceName.c_str());
+
+    VerifyOrExit(threadIfIndex != 0 && backboneIfIndex != 0, error = OTBR_ERROR_ERRNO);
+
+    // Equivalent to:
+    //   ip -6 route add <domain prefix> dev <thread> proto static metric 1
+    //   ip -6 rule add iif <thread> table openthread
+    //   ip -6 route add <domain prefix> dev <backbone> proto static table openthread
+    // Packets from the Thread interface use route table "openthread".
+    SuccessOrExit(error = batch.AddRoute(mDomainPrefix, threadIfIndex, RT_TABLE_MAIN, kThreadRouteMetric));
+    SuccessOrExit(error = batch.AddRule(mInterfaceName, kOpenThreadRouteTable));
+    SuccessOrExit(error = batch.AddRoute(mDomainPrefix, backboneIfIndex, kOpenThreadRouteTable, 0));
+    error = batch.Commit();
+
+exit:
+    return error;
+}
+#else
 void DuaRoutingManager::AddDefaultRouteToThread(void)
 {
     SystemUtils::ExecuteCommand("ip -6 route add %s dev %s proto static metric 1", mDomainPrefix.ToString().c_str(),
@@ -93,6 +341,7 @@ void DuaRoutingManager::DelPolicyRouteToBackbone(void)
     SystemUtils::ExecuteCommand("ip -6 route del %s dev %s proto static table openthread",
                                 mDomainPrefix.ToString().c_str(), mBackboneInterfaceName.c_str());
 }
+#endif // __linux__
 
 } // namespace BackboneRouter
 } // namespace otbr
@@ -89,10 +89,14 @@ public:
     void Disable(void);
 
 private:
+#if __linux__
+    otbrError UpdateRoutes(bool aAdd);
+#else
     void AddDefaultRouteToThread(void);
     void DelDefaultRouteToThread(void);
     void AddPolicyRouteToBackbone(void);
     void DelPolicyRouteToBackbone(void);
+#endif
 
     Ip6Prefix   mDomainPrefix;
     bool        mEnabled : 1;
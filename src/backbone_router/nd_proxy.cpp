@@ -40,13 +40,20 @@
 #include <openthread/backbone_router_ftd.h>
 
 #include <assert.h>
+#include <errno.h>
 #include <net/if.h>
 #include <netinet/icmp6.h>
 #include <netinet/ip6.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
 #include <sys/ioctl.h>
 #include <unistd.h>
 
+#include <vector>
+
 #if __linux__
+#include <linux/filter.h>
 #include <linux/netfilter.h>
 #else
 #error "Platform not supported"
@@ -70,10 +77,17 @@ void NdProxyManager::Enable(const Ip6Prefix &aDomainPrefix)
     assert(aDomainPrefix.IsValid());
     mDomainPrefix = aDomainPrefix;
 
+    mCounters            = {};
+    mNeighborSolicitBase = ReadNeighborSolicitCount();
+
     SuccessOrExit(error = InitIcmp6RawSocket());
     SuccessOrExit(error = UpdateMacAddress());
     SuccessOrExit(error = InitNetfilterQueue());
 
+    // The groups of DUAs proxied before are joined again on the new socket.
+    mPendingJoins = mNdProxySet;
+    ScheduleFlush();
+
     // Add ip6tables rule for unicast ICMPv6 messages
     VerifyOrExit(SystemUtils::ExecuteCommand(
                      "ip6tables -t raw -A PREROUTING -6 -d %s -p icmpv6 --icmpv6-type neighbor-solicitation -i %s -j "
@@ -175,16 +189,18 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
     len = recvmsg(mIcmp6RawSock, &msghdr, 0);
 
     VerifyOrExit(len >= static_cast<ssize_t>(sizeof(struct icmp6_hdr)), error = OTBR_ERROR_ERRNO);
+    mCounters.mDelivered++;
 
     {
         Ip6Address &src = *reinterpret_cast<Ip6Address *>(&sin6.sin6_addr);
+        char        srcString[Ip6Address::kStringSize];
 
         icmp6header = reinterpret_cast<icmp6_hdr *>(packet);
 
         // only process neighbor solicit
         VerifyOrExit(icmp6header->icmp6_type == ND_NEIGHBOR_SOLICIT, error = OTBR_ERROR_PARSE);
 
-        otbrLogDebug("NdProxyManager: Received ND-NS from %s", src.ToString().c_str());
+        otbrLogDebug("NdProxyManager: Received ND-NS from %s", src.ToString(srcString));
 
         for (cmsghdr = CMSG_FIRSTHDR(&msghdr); cmsghdr; cmsghdr = CMSG_NXTHDR(&msghdr, cmsghdr))
         {
@@ -201,6 +217,7 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
                     struct in6_pktinfo *pktinfo = (struct in6_pktinfo *)CMSG_DATA(cmsghdr);
                     Ip6Address         &dst     = *reinterpret_cast<Ip6Address *>(&pktinfo->ipi6_addr);
                     uint32_t            ifindex = pktinfo->ipi6_ifindex;
+                    char                dstString[Ip6Address::kStringSize];
 
                     for (const Ip6Address &ipaddr : mNdProxySet)
                     {
@@ -211,7 +228,7 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
                         }
                     }
 
-                    otbrLogDebug("NdProxyManager: dst=%s, ifindex=%d, proxying=%s", dst.ToString().c_str(), ifindex,
+                    otbrLogDebug("NdProxyManager: dst=%s, ifindex=%d, proxying=%s", dst.ToString(dstString), ifindex,
                                  found ? "Y" : "N");
                 }
                 break;
@@ -229,14 +246,19 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
             }
         }
 
-        VerifyOrExit(found, error = OTBR_ERROR_NOT_FOUND);
+        if (!found)
+        {
+            mCounters.mUserSpaceFiltered++;
+            ExitNow(error = OTBR_ERROR_NOT_FOUND);
+        }
 
         {
             struct nd_neighbor_solicit *ns     = reinterpret_cast<struct nd_neighbor_solicit *>(packet);
             Ip6Address                 &target = *reinterpret_cast<Ip6Address *>(&ns->nd_ns_target);
+            char                        targetString[Ip6Address::kStringSize];
 
-            otbrLogInfo("NdProxyManager: send solicited NA for multicast NS: src=%s, target=%s", src.ToString().c_str(),
-                        target.ToString().c_str());
+            otbrLogInfo("NdProxyManager: send solicited NA for multicast NS: src=%s, target=%s",
+                        src.ToString(srcString), target.ToString(targetString));
 
             SendNeighborAdvertisement(target, src);
         }
@@ -280,61 +302,212 @@ void NdProxyManager::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEve
 
         if (isNewInsert)
         {
-            JoinSolicitedNodeMulticastGroup(target);
+            mPendingJoins.insert(target);
+            mSocketFilterOutdated = true;
         }
 
-        SendNeighborAdvertisement(target, Ip6Address::GetLinkLocalAllNodesMulticastAddress());
+        mPendingAdvertisements.insert(target);
         break;
     }
     case OT_BACKBONE_ROUTER_NDPROXY_REMOVED:
-        mNdProxySet.erase(target);
-        LeaveSolicitedNodeMulticastGroup(target);
+        if (mNdProxySet.erase(target) > 0)
+        {
+            if (mPendingJoins.erase(target) == 0)
+            {
+                LeaveSolicitedNodeMulticastGroup(target);
+            }
+            mSocketFilterOutdated = true;
+        }
+        mPendingAdvertisements.erase(target);
         break;
     case OT_BACKBONE_ROUTER_NDPROXY_CLEARED:
         for (const Ip6Address &proxingTarget : mNdProxySet)
         {
-            LeaveSolicitedNodeMulticastGroup(proxingTarget);
+            if (mPendingJoins.count(proxingTarget) == 0)
+            {
+                LeaveSolicitedNodeMulticastGroup(proxingTarget);
+            }
         }
         mNdProxySet.clear();
+        mPendingJoins.clear();
+        mPendingAdvertisements.clear();
+        mSocketFilterOutdated = true;
         break;
     }
+
+    ScheduleFlush();
 }
 
-void NdProxyManager::SendNeighborAdvertisement(const Ip6Address &aTarget, const Ip6Address &aDst)
+void NdProxyManager::UpdateSocketFilter(void)
+{
+    // On an IPv6 raw socket the packet data starts at the ICMPv6 header, the IPv6 destination address is reached
+    // relative to the network header. The last word of a solicited-node multicast address is 0xff and the low 24
+    // bits of the target address.
+    static constexpr uint32_t kDstOffset    = SKF_NET_OFF + static_cast<int>(offsetof(struct ip6_hdr, ip6_dst));
+    static constexpr uint32_t kGroupPrefix0 = 0xff020000;
+    static constexpr uint32_t kGroupPrefix2 = 0x00000001;
+    static constexpr uint32_t kGroupMarker  = 0xff000000;
+    static constexpr size_t   kHeaderLength = 9; // Instructions before matching the last word.
+
+    static_assert(kHeaderLength + kMaxFilterTargets + 2 <= UINT8_MAX, "BPF jump offsets must fit in 8 bits");
+
+    otbrError                error = OTBR_ERROR_NONE;
+    std::set<uint32_t>       groups;
+    std::vector<sock_filter> program;
+    struct sock_fprog        fprog;
+    size_t                   reject;
+    size_t                   accept;
+    auto                     jumpTo = [&program](size_t aIndex) {
+        return static_cast<uint8_t>(aIndex - program.size() - 1);
+    };
+
+    VerifyOrExit(IsEnabled());
+
+    for (const Ip6Address &target : mNdProxySet)
+    {
+        groups.insert(kGroupMarker | (static_cast<uint32_t>(target.m8[13]) << 16) |
+                      (static_cast<uint32_t>(target.m8[14]) << 8) | target.m8[15]);
+    }
+
+    // Too many groups for the jump offsets, only filter to solicited-node groups and match them in user space.
+    mCounters.mUserSpaceMatching = (groups.size() > kMaxFilterTargets);
+
+    reject = kHeaderLength + (mCounters.mUserSpaceMatching ? 2 : groups.size());
+    accept = reject + 1;
+
+    program.push_back(BPF_STMT(BPF_LD | BPF_B | BPF_ABS, 0));
+    program.push_back(BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, ND_NEIGHBOR_SOLICIT, 0, jumpTo(reject)));
+    program.push_back(BPF_STMT(BPF_LD | BPF_W | BPF_ABS, kDstOffset));
+    program.push_back(BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, kGroupPrefix0, 0, jumpTo(reject)));
+    program.push_back(BPF_STMT(BPF_LD | BPF_W | BPF_ABS, kDstOffset + 4));
+    program.push_back(BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, 0, 0, jumpTo(reject)));
+    program.push_back(BPF_STMT(BPF_LD | BPF_W | BPF_ABS, kDstOffset + 8));
+    program.push_back(BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, kGroupPrefix2, 0, jumpTo(reject)));
+    program.push_back(BPF_STMT(BPF_LD | BPF_W | BPF_ABS, kDstOffset + 12));
+    assert(program.size() == kHeaderLength);
+
+    if (mCounters.mUserSpaceMatching)
+    {
+        program.push_back(BPF_STMT(BPF_ALU | BPF_AND | BPF_K, kGroupMarker));
+        program.push_back(BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, kGroupMarker, jumpTo(accept), jumpTo(reject)));
+    }
+    else
+    {
+        for (uint32_t group : groups)
+        {
+            program.push_back(BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, group, jumpTo(accept), 0));
+        }
+    }
+
+    assert(program.size() == reject);
+    program.push_back(BPF_STMT(BPF_RET | BPF_K, 0));
+    program.push_back(BPF_STMT(BPF_RET | BPF_K, UINT32_MAX));
+
+    fprog.len    = static_cast<unsigned short>(program.size());
+    fprog.filter = program.data();
+
+    if (setsockopt(mIcmp6RawSock, SOL_SOCKET, SO_ATTACH_FILTER, &fprog, sizeof(fprog)) != 0)
+    {
+        error = OTBR_ERROR_ERRNO;
+
+        // Never keep a stale filter which may drop NS for new DUAs.
+        setsockopt(mIcmp6RawSock, SOL_SOCKET, SO_DETACH_FILTER, nullptr, 0);
+        mCounters.mUserSpaceMatching = true;
+        ExitNow();
+    }
+
+    mCounters.mFilterUpdates++;
+
+exit:
+    otbrLogResult(error, "NdProxyManager: Update socket filter for %zu DUAs%s", mNdProxySet.size(),
+                  mCounters.mUserSpaceMatching ? ", matching in user space" : "");
+}
+
+NdProxyManager::Counters NdProxyManager::GetCounters(void) const
+{
+    Counters counters = mCounters;
+    uint64_t received = ReadNeighborSolicitCount() - mNeighborSolicitBase;
+
+    counters.mKernelFiltered = (received > counters.mDelivered) ? received - counters.mDelivered : 0;
+
+    return counters;
+}
+
+uint64_t NdProxyManager::ReadNeighborSolicitCount(void) const
 {
-    uint8_t                    packet[kMaxICMP6PacketSize];
-    uint16_t                   len = 0;
-    struct nd_neighbor_advert &na  = *reinterpret_cast<struct nd_neighbor_advert *>(packet);
-    struct nd_opt_hdr         &opt = *reinterpret_cast<struct nd_opt_hdr *>(packet + sizeof(struct nd_neighbor_advert));
-    bool                       isSolicited = !aDst.IsMulticast();
-    sockaddr_in6               dst;
-    otbrError                  error = OTBR_ERROR_NONE;
+    std::string        path  = "/proc/net/dev_snmp6/" + mBackboneInterfaceName;
+    FILE              *file  = fopen(path.c_str(), "r");
+    uint64_t           count = 0;
+    char               name[64];
+    unsigned long long value;
+
+    VerifyOrExit(file != nullptr);
+
+    while (fscanf(file, "%63s %llu", name, &value) == 2)
+    {
+        if (strcmp(name, "Icmp6InNeighborSolicits") == 0)
+        {
+            count = value;
+            break;
+        }
+    }
+
+    fclose(file);
+
+exit:
+    return count;
+}
+
+otbrError NdProxyManager::BuildNeighborAdvertisement(const Ip6Address &aTarget,
+                                                     bool              aIsSolicited,
+                                                     uint8_t          *aPacket,
+                                                     uint16_t         &aLength)
+{
+    struct nd_neighbor_advert  &na    = *reinterpret_cast<struct nd_neighbor_advert *>(aPacket);
+    struct nd_opt_hdr          &opt   = *reinterpret_cast<struct nd_opt_hdr *>(&na + 1);
+    otbrError                   error = OTBR_ERROR_NONE;
     otBackboneRouterNdProxyInfo aNdProxyInfo;
 
+    static_assert(sizeof(struct nd_neighbor_advert) + sizeof(struct nd_opt_hdr) + sizeof(mMacAddress.m8) ==
+                      kNeighborAdvertisementLength,
+                  "kNeighborAdvertisementLength does not match the NA layout");
+
     VerifyOrExit(otBackboneRouterGetNdProxyInfo(mNcp.GetInstance(), reinterpret_cast<const otIp6Address *>(&aTarget),
                                                 &aNdProxyInfo) == OT_ERROR_NONE,
                  error = OTBR_ERROR_OPENTHREAD);
 
-    memset(packet, 0, sizeof(packet));
+    memset(aPacket, 0, kNeighborAdvertisementLength);
 
     na.nd_na_type = ND_NEIGHBOR_ADVERT;
     na.nd_na_code = 0;
     // set Solicited
-    na.nd_na_flags_reserved = isSolicited ? ND_NA_FLAG_SOLICITED : 0;
+    na.nd_na_flags_reserved = aIsSolicited ? ND_NA_FLAG_SOLICITED : 0;
     // set Router
     na.nd_na_flags_reserved |= ND_NA_FLAG_ROUTER;
     // set Override
     na.nd_na_flags_reserved |= aNdProxyInfo.mTimeSinceLastTransaction <= kDuaRecentTime ? ND_NA_FLAG_OVERRIDE : 0;
 
     memcpy(&na.nd_na_target, aTarget.m8, sizeof(Ip6Address));
-    len += sizeof(struct nd_neighbor_advert);
 
     opt.nd_opt_type = ND_OPT_TARGET_LINKADDR;
     opt.nd_opt_len  = 1;
 
     memcpy(reinterpret_cast<uint8_t *>(&opt) + 2, mMacAddress.m8, sizeof(mMacAddress));
 
-    len += (opt.nd_opt_len * 8);
+    aLength = kNeighborAdvertisementLength;
+
+exit:
+    return error;
+}
+
+void NdProxyManager::SendNeighborAdvertisement(const Ip6Address &aTarget, const Ip6Address &aDst)
+{
+    uint8_t      packet[kNeighborAdvertisementLength];
+    uint16_t     len;
+    sockaddr_in6 dst;
+    otbrError    error;
+
+    SuccessOrExit(error = BuildNeighborAdvertisement(aTarget, !aDst.IsMulticast(), packet, len));
 
     aDst.CopyTo(dst);
 
@@ -345,6 +518,107 @@ exit:
     otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
 }
 
+void NdProxyManager::ScheduleFlush(void)
+{
+    // Events reported in the same mainloop iteration, as on a takeover, go out in the same batches.
+    if (mFlushTaskId == 0)
+    {
+        mFlushTaskId = mTaskRunner.Post(Milliseconds(0), [this]() { FlushPendingAdvertisements(); });
+    }
+}
+
+void NdProxyManager::FlushPendingAdvertisements(void)
+{
+    uint8_t        packets[kMaxAdvertisementBatchSize][kNeighborAdvertisementLength];
+    struct iovec   iovecs[kMaxAdvertisementBatchSize];
+    struct mmsghdr messages[kMaxAdvertisementBatchSize];
+    Ip6Address     targets[kMaxAdvertisementBatchSize];
+    sockaddr_in6   dst;
+    unsigned int   count = 0;
+    unsigned int   sent  = 0;
+    otbrError      error = OTBR_ERROR_NONE;
+    int            rval;
+
+    mFlushTaskId = 0;
+
+    VerifyOrExit(IsEnabled());
+
+    for (auto it = mPendingJoins.begin(); it != mPendingJoins.end() && count < kMaxAdvertisementBatchSize; count++)
+    {
+        JoinSolicitedNodeMulticastGroup(*it);
+        it = mPendingJoins.erase(it);
+    }
+
+    if (mSocketFilterOutdated)
+    {
+        mSocketFilterOutdated = false;
+        UpdateSocketFilter();
+    }
+
+    Ip6Address::GetLinkLocalAllNodesMulticastAddress().CopyTo(dst);
+    memset(messages, 0, sizeof(messages));
+    count = 0;
+
+    while (!mPendingAdvertisements.empty() && count < kMaxAdvertisementBatchSize)
+    {
+        Ip6Address target = *mPendingAdvertisements.begin();
+        uint16_t   length;
+
+        mPendingAdvertisements.erase(mPendingAdvertisements.begin());
+
+        if (BuildNeighborAdvertisement(target, /* aIsSolicited */ false, packets[count], length) != OTBR_ERROR_NONE)
+        {
+            continue;
+        }
+
+        targets[count]                      = target;
+        iovecs[count].iov_base              = packets[count];
+        iovecs[count].iov_len               = length;
+        messages[count].msg_hdr.msg_name    = &dst;
+        messages[count].msg_hdr.msg_namelen = sizeof(dst);
+        messages[count].msg_hdr.msg_iov     = &iovecs[count];
+        messages[count].msg_hdr.msg_iovlen  = 1;
+        count++;
+    }
+
+    VerifyOrExit(count > 0);
+
+    rval = sendmmsg(mIcmp6RawSock, messages, count, 0);
+
+    if (rval >= 0)
+    {
+        sent = static_cast<unsigned int>(rval);
+    }
+    else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != ENOBUFS && errno != EINTR)
+    {
+        // A persistent error would fail every retry, so the batch is dropped.
+        otbrLogWarning("NdProxyManager: Failed to send unsolicited NAs, drop %u NAs: %s", count, strerror(errno));
+        ExitNow(error = OTBR_ERROR_ERRNO);
+    }
+
+    // Unsent NAs are queued again for the next paced batch.
+    for (unsigned int i = sent; i < count; i++)
+    {
+        mPendingAdvertisements.insert(targets[i]);
+    }
+
+    VerifyOrExit(sent == count, error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (count > 0)
+    {
+        otbrLogResult(error, "NdProxyManager: Send %u of %u unsolicited NAs, %zu NAs and %zu joins pending", sent,
+                      count, mPendingAdvertisements.size(), mPendingJoins.size());
+    }
+
+    if (IsEnabled() && (!mPendingJoins.empty() || !mPendingAdvertisements.empty()))
+    {
+        Milliseconds delay(kMaxAdvertisementBatchSize * 1000 / OTBR_ND_PROXY_ADVERTISEMENT_RATE);
+
+        mFlushTaskId = mTaskRunner.Post(delay, [this]() { FlushPendingAdvertisements(); });
+    }
+}
+
 otbrError NdProxyManager::UpdateMacAddress(void)
 {
     otbrError error = OTBR_ERROR_NONE;
@@ -399,6 +673,10 @@ otbrError NdProxyManager::InitIcmp6RawSocket(void)
 
     VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_ICMPV6, ICMP6_FILTER, &filter, sizeof(filter)) == 0,
                  error = OTBR_ERROR_ERRNO);
+
+    // Only wake up for NS to the solicited-node groups of proxied DUAs.
+    UpdateSocketFilter();
+
 exit:
     if (error != OTBR_ERROR_NONE)
     {
@@ -415,6 +693,13 @@ void NdProxyManager::FiniIcmp6RawSocket(void)
         close(mIcmp6RawSock);
         mIcmp6RawSock = -1;
     }
+
+    // Closing the socket leaves all its groups.
+    mJoinedGroups.clear();
+    mPendingJoins.clear();
+    mPendingAdvertisements.clear();
+    mTaskRunner.Cancel(mFlushTaskId);
+    mFlushTaskId = 0;
 }
 
 otbrError NdProxyManager::InitNetfilterQueue(void)
@@ -486,6 +771,8 @@ int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
 
     Ip6Address        dst;
     Ip6Address        src;
+    char              dstString[Ip6Address::kStringSize];
+    char              srcString[Ip6Address::kStringSize];
     struct icmp6_hdr *icmp6header = nullptr;
     struct ip6_hdr   *ip6header   = nullptr;
     otbrError         error       = OTBR_ERROR_NONE;
@@ -504,8 +791,8 @@ int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
 
     VerifyOrExit(ip6header->ip6_nxt == IPPROTO_ICMPV6);
 
-    otbrLogDebug("NdProxyManager: Handle Neighbor Solicitation: from %s to %s", src.ToString().c_str(),
-                 dst.ToString().c_str());
+    otbrLogDebug("NdProxyManager: Handle Neighbor Solicitation: from %s to %s", src.ToString(srcString),
+                 dst.ToString(dstString));
 
     icmp6header = reinterpret_cast<struct icmp6_hdr *>(data + sizeof(struct ip6_hdr));
     VerifyOrExit(icmp6header->icmp6_type == ND_NEIGHBOR_SOLICIT);
@@ -515,8 +802,9 @@ int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
     {
         struct nd_neighbor_solicit &ns = *reinterpret_cast<struct nd_neighbor_solicit *>(data + sizeof(struct ip6_hdr));
         Ip6Address                 &target = *reinterpret_cast<Ip6Address *>(&ns.nd_ns_target);
+        char                        targetString[Ip6Address::kStringSize];
 
-        otbrLogDebug("NdProxyManager: %s: target: %s, hoplimit %d", __FUNCTION__, target.ToString().c_str(),
+        otbrLogDebug("NdProxyManager: %s: target: %s, hoplimit %d", __FUNCTION__, target.ToString(targetString),
                      ip6header->ip6_hlim);
         VerifyOrExit(ip6header->ip6_hlim == 255, error = OTBR_ERROR_PARSE);
         SendNeighborAdvertisement(target, src);
@@ -532,27 +820,39 @@ exit:
     return ret;
 }
 
-void NdProxyManager::JoinSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const
+void NdProxyManager::JoinSolicitedNodeMulticastGroup(const Ip6Address &aTarget)
 {
     ipv6_mreq  mreq;
     otbrError  error                     = OTBR_ERROR_NONE;
     Ip6Address solicitedMulticastAddress = aTarget.ToSolicitedNodeMulticastAddress();
 
+    // DUAs with the same low 24 bits share a group, which is only joined once.
+    VerifyOrExit(mJoinedGroups[solicitedMulticastAddress]++ == 0);
+
     mreq.ipv6mr_interface = mBackboneIfIndex;
     solicitedMulticastAddress.CopyTo(mreq.ipv6mr_multiaddr);
 
-    VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, IPV6_JOIN_GROUP, &mreq, sizeof(mreq)) == 0,
-                 error = OTBR_ERROR_ERRNO);
+    if (setsockopt(mIcmp6RawSock, IPPROTO_IPV6, IPV6_JOIN_GROUP, &mreq, sizeof(mreq)) != 0)
+    {
+        error = OTBR_ERROR_ERRNO;
+        mJoinedGroups.erase(solicitedMulticastAddress);
+    }
+
 exit:
     otbrLogResult(error, "NdProxyManager: JoinSolicitedNodeMulticastGroup of %s: %s", aTarget.ToString().c_str(),
                   solicitedMulticastAddress.ToString().c_str());
 }
 
-void NdProxyManager::LeaveSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const
+void NdProxyManager::LeaveSolicitedNodeMulticastGroup(const Ip6Address &aTarget)
 {
     ipv6_mreq  mreq;
     otbrError  error                     = OTBR_ERROR_NONE;
     Ip6Address solicitedMulticastAddress = aTarget.ToSolicitedNodeMulticastAddress();
+    auto       joinedGroup               = mJoinedGroups.find(solicitedMulticastAddress);
+
+    VerifyOrExit(joinedGroup != mJoinedGroups.end(), error = OTBR_ERROR_NOT_FOUND);
+    VerifyOrExit(--joinedGroup->second == 0);
+    mJoinedGroups.erase(joinedGroup);
 
     mreq.ipv6mr_interface = mBackboneIfIndex;
     solicitedMulticastAddress.CopyTo(mreq.ipv6mr_multiaddr);
@@ -54,9 +54,25 @@
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
 #include "common/types.hpp"
 #include "ncp/ncp_openthread.hpp"
 
+/**
+ * The max number of unsolicited Neighbor Advertisements per second.
+ *
+ * The unsolicited NAs and the solicited-node multicast group joins of added or renewed DUAs are queued, and sent in
+ * batches with `sendmmsg()` at no more than this rate, so that a Backbone Router takeover with many DUAs doesn't
+ * block the mainloop. Set with the `OTBR_ND_PROXY_ADVERTISEMENT_RATE` CMake option.
+ *
+ */
+#ifndef OTBR_ND_PROXY_ADVERTISEMENT_RATE
+#define OTBR_ND_PROXY_ADVERTISEMENT_RATE 1000
+#endif
+
+static_assert(OTBR_ND_PROXY_ADVERTISEMENT_RATE > 0, "OTBR_ND_PROXY_ADVERTISEMENT_RATE must be positive");
+
 namespace otbr {
 namespace BackboneRouter {
 
@@ -76,6 +92,19 @@ namespace BackboneRouter {
 class NdProxyManager : public MainloopProcessor, private NonCopyable
 {
 public:
+    /**
+     * This structure represents the counters of multicast Neighbor Solicitations on the backbone interface.
+     *
+     */
+    struct Counters
+    {
+        uint64_t mKernelFiltered;    ///< The number of NS dropped by the socket filter in the kernel.
+        uint64_t mDelivered;         ///< The number of NS delivered to the ND Proxy manager.
+        uint64_t mUserSpaceFiltered; ///< The number of delivered NS which are not for any proxied DUA.
+        uint64_t mFilterUpdates;     ///< The number of times the socket filter has been regenerated.
+        bool     mUserSpaceMatching; ///< Whether the proxied DUAs exceed the capacity of the socket filter.
+    };
+
     /**
      * This constructor initializes a NdProxyManager instance.
      *
@@ -87,6 +116,8 @@ public:
         , mUnicastNsQueueSock(-1)
         , mNfqHandler(nullptr)
         , mNfqQueueHandler(nullptr)
+        , mSocketFilterOutdated(false)
+        , mFlushTaskId(0)
     {
     }
 
@@ -131,13 +162,35 @@ public:
      */
     bool IsEnabled(void) const { return mIcmp6RawSock >= 0; }
 
+    /**
+     * This method returns the counters of multicast Neighbor Solicitations since the ND Proxy manager was enabled.
+     *
+     * The number of NS dropped in the kernel is derived from the ICMPv6 statistics of the backbone interface, so it
+     * also includes unicast NS which are not proxied.
+     *
+     * @returns The counters of multicast Neighbor Solicitations.
+     *
+     */
+    Counters GetCounters(void) const;
+
 private:
     enum
     {
-        kMaxICMP6PacketSize = 1500, ///< Max size of an ICMP6 packet in bytes.
+        kMaxICMP6PacketSize          = 1500, ///< Max size of an ICMP6 packet in bytes.
+        kMaxFilterTargets            = 200,  ///< Max number of solicited-node groups matched by the socket filter.
+        kMaxAdvertisementBatchSize   = 64,   ///< Max number of unsolicited NAs or group joins in a batch.
+        kNeighborAdvertisementLength = 32,   ///< Size of an NA with the Target Link-Layer Address option.
     };
 
+    otbrError  BuildNeighborAdvertisement(const Ip6Address &aTarget,
+                                          bool              aIsSolicited,
+                                          uint8_t          *aPacket,
+                                          uint16_t         &aLength);
     void       SendNeighborAdvertisement(const Ip6Address &aTarget, const Ip6Address &aDst);
+    void       ScheduleFlush(void);
+    void       FlushPendingAdvertisements(void);
+    void       UpdateSocketFilter(void);
+    uint64_t   ReadNeighborSolicitCount(void) const;
     otbrError  UpdateMacAddress(void);
     otbrError  InitIcmp6RawSocket(void);
     void       FiniIcmp6RawSocket(void);
@@ -145,8 +198,8 @@ private:
     void       FiniNetfilterQueue(void);
     void       ProcessMulticastNeighborSolicition(void);
     void       ProcessUnicastNeighborSolicition(void);
-    void       JoinSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const;
-    void       LeaveSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const;
+    void       JoinSolicitedNodeMulticastGroup(const Ip6Address &aTarget);
+    void       LeaveSolicitedNodeMulticastGroup(const Ip6Address &aTarget);
     static int HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
                                     struct nfgenmsg     *aNfMsg,
                                     struct nfq_data     *aNfData,
@@ -163,6 +216,14 @@ private:
     struct nfq_q_handle             *mNfqQueueHandler; ///< A pointer to a newly created queue.
     MacAddress                       mMacAddress;
     Ip6Prefix                        mDomainPrefix;
+    Counters                         mCounters            = {};
+    uint64_t                         mNeighborSolicitBase = 0;
+    std::map<Ip6Address, uint32_t>   mJoinedGroups; ///< The number of proxied DUAs of each solicited-node group.
+    std::set<Ip6Address>             mPendingJoins;
+    std::set<Ip6Address>             mPendingAdvertisements;
+    bool                             mSocketFilterOutdated;
+    TaskRunner                       mTaskRunner;
+    TaskRunner::TaskId               mFlushTaskId;
 };
 
 /**
@@ -142,6 +142,7 @@ BorderAgent::BorderAgent(otbr::Ncp::ControllerOpenThread &aNcp, Mdns::Publisher
     , mVendorName(OTBR_VENDOR_NAME)
     , mProductName(OTBR_PRODUCT_NAME)
     , mBaseServiceInstanceName(OTBR_MESHCOP_SERVICE_INSTANCE_NAME)
+    , mRepublisher([this]() { HandleRepublishTimer(); })
 {
     mNcp.AddThreadStateChangedCallback([this](otChangedFlags aFlags) { HandleThreadStateChanged(aFlags); });
 }
@@ -205,6 +206,7 @@ void BorderAgent::Start(void)
 void BorderAgent::Stop(void)
 {
     otbrLogInfo("Stop Thread Border Agent");
+    mRepublisher.Cancel();
     UnpublishMeshCopService();
 }
 
@@ -215,6 +217,8 @@ void BorderAgent::HandleMdnsState(Mdns::Publisher::State aState)
     switch (aState)
     {
     case Mdns::Publisher::State::kReady:
+        // The mDNS publisher starts without any registrations.
+        mRepublisher.ForgetPublished();
         UpdateMeshCopService();
         break;
     default:
@@ -437,6 +441,12 @@ void BorderAgent::PublishMeshCopService(void)
     error = Mdns::Publisher::EncodeTxtData(txtList, txtData);
     assert(error == OTBR_ERROR_NONE);
 
+    if (!mRepublisher.ShouldPublish(txtData, port))
+    {
+        otbrLogDebug("Meshcop service %s.%s.local is unchanged", mServiceInstanceName.c_str(), kBorderAgentServiceType);
+        ExitNow();
+    }
+
     mPublisher.PublishService(/* aHostName */ "", mServiceInstanceName, kBorderAgentServiceType,
                               Mdns::Publisher::SubTypeList{}, port, txtData, [this](otbrError aError) {
                                   if (aError == OTBR_ERROR_ABORTED)
@@ -452,6 +462,11 @@ void BorderAgent::PublishMeshCopService(void)
                                       otbrLogResult(aError, "Result of publish meshcop service %s.%s.local",
                                                     mServiceInstanceName.c_str(), kBorderAgentServiceType);
                                   }
+                                  if (aError != OTBR_ERROR_NONE && aError != OTBR_ERROR_ABORTED)
+                                  {
+                                      // Make sure the next update publishes the service again.
+                                      mRepublisher.ForgetPublished();
+                                  }
                                   if (aError == OTBR_ERROR_DUPLICATED)
                                   {
                                       // Try to unpublish current service in case we are trying to register
@@ -462,12 +477,16 @@ void BorderAgent::PublishMeshCopService(void)
                                       PublishMeshCopService();
                                   }
                               });
+
+exit:
+    return;
 }
 
 void BorderAgent::UnpublishMeshCopService(void)
 {
     otbrLogInfo("Unpublish meshcop service %s.%s.local", mServiceInstanceName.c_str(), kBorderAgentServiceType);
 
+    mRepublisher.ForgetPublished();
     mPublisher.UnpublishService(mServiceInstanceName, kBorderAgentServiceType, [this](otbrError aError) {
         otbrLogResult(aError, "Result of unpublish meshcop service %s.%s.local", mServiceInstanceName.c_str(),
                       kBorderAgentServiceType);
@@ -475,6 +494,17 @@ void BorderAgent::UnpublishMeshCopService(void)
 }
 
 void BorderAgent::UpdateMeshCopService(void)
+{
+    VerifyOrExit(IsEnabled());
+    VerifyOrExit(mPublisher.IsStarted());
+
+    mRepublisher.Update();
+
+exit:
+    return;
+}
+
+void BorderAgent::HandleRepublishTimer(void)
 {
     VerifyOrExit(IsEnabled());
     VerifyOrExit(mPublisher.IsStarted());
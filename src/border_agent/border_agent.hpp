@@ -36,7 +36,7 @@
 
 #include "openthread-br/config.h"
 
-#if !(OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO)
+#if !(OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO || OTBR_ENABLE_MDNS_NATIVE)
 #error "Border Agent feature requires at least one `OTBR_MDNS` implementation"
 #endif
 
@@ -45,6 +45,7 @@
 #include <stdint.h>
 
 #include "backbone_router/backbone_agent.hpp"
+#include "border_agent/meshcop_republisher.hpp"
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
 #include "mdns/mdns.hpp"
@@ -83,6 +84,8 @@ namespace otbr {
 class BorderAgent : private NonCopyable
 {
 public:
+    typedef MeshCopRepublisher::Counters Counters;
+
     /**
      * The constructor to initialize the Thread border agent.
      *
@@ -132,6 +135,14 @@ public:
      */
     void HandleMdnsState(Mdns::Publisher::State aState);
 
+    /**
+     * This method returns the counters of MeshCoP service republishing.
+     *
+     * @returns  The counters of MeshCoP service republishing.
+     *
+     */
+    const Counters &GetCounters(void) const { return mRepublisher.GetCounters(); }
+
 private:
     void Start(void);
     void Stop(void);
@@ -139,6 +150,7 @@ private:
     void PublishMeshCopService(void);
     void UpdateMeshCopService(void);
     void UnpublishMeshCopService(void);
+    void HandleRepublishTimer(void);
 #if OTBR_ENABLE_DBUS_SERVER
     void HandleUpdateVendorMeshCoPTxtEntries(std::map<std::string, std::vector<uint8_t>> aUpdate);
 #endif
@@ -172,6 +184,8 @@ private:
     // conflicts. For example, this value can be "OpenThread Border Router #7AC3" or
     // "OpenThread Border Router #7AC3 (14379)".
     std::string mServiceInstanceName;
+
+    MeshCopRepublisher mRepublisher;
 };
 
 /**
@@ -0,0 +1,109 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements debouncing the republishing of the MeshCoP service.
+ */
+
+#include "border_agent/meshcop_republisher.hpp"
+
+namespace otbr {
+
+constexpr Milliseconds MeshCopRepublisher::kRepublishDelay;
+
+MeshCopRepublisher::MeshCopRepublisher(RepublishHandler aRepublishHandler)
+    : mRepublishHandler(std::move(aRepublishHandler))
+    , mPublishedPort(0)
+    , mRepublishTaskId(0)
+    , mCounters()
+{
+}
+
+void MeshCopRepublisher::Update(void)
+{
+    // Thread state changes often come in bursts, e.g. network data changes in a large network, so they are merged
+    // into one republish.
+    if (mRepublishTaskId != 0)
+    {
+        mCounters.mCoalescedUpdates++;
+        ExitNow();
+    }
+
+    mRepublishTaskId = ScheduleRepublish(kRepublishDelay);
+
+exit:
+    return;
+}
+
+void MeshCopRepublisher::Cancel(void)
+{
+    VerifyOrExit(mRepublishTaskId != 0);
+
+    CancelRepublish(mRepublishTaskId);
+    mRepublishTaskId = 0;
+
+exit:
+    return;
+}
+
+bool MeshCopRepublisher::ShouldPublish(const Mdns::Publisher::TxtData &aTxtData, int aPort)
+{
+    bool shouldPublish = (aTxtData != mPublishedTxtData || aPort != mPublishedPort);
+
+    if (shouldPublish)
+    {
+        mPublishedTxtData = aTxtData;
+        mPublishedPort    = aPort;
+        mCounters.mIssuedRepublishes++;
+    }
+    else
+    {
+        mCounters.mSuppressedRepublishes++;
+    }
+
+    return shouldPublish;
+}
+
+TaskRunner::TaskId MeshCopRepublisher::ScheduleRepublish(Milliseconds aDelay)
+{
+    return mTaskRunner.Post(aDelay, [this]() { HandleRepublishTimer(); });
+}
+
+void MeshCopRepublisher::CancelRepublish(TaskRunner::TaskId aTaskId)
+{
+    mTaskRunner.Cancel(aTaskId);
+}
+
+void MeshCopRepublisher::HandleRepublishTimer(void)
+{
+    mRepublishTaskId = 0;
+    mRepublishHandler();
+}
+
+} // namespace otbr
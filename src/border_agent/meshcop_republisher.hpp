@@ -0,0 +1,158 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for debouncing the republishing of the MeshCoP service.
+ */
+
+#ifndef OTBR_AGENT_MESHCOP_REPUBLISHER_HPP_
+#define OTBR_AGENT_MESHCOP_REPUBLISHER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stdint.h>
+
+#include <functional>
+
+#include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
+#include "mdns/mdns.hpp"
+
+namespace otbr {
+
+/**
+ * This class merges the updates of the MeshCoP service over a short window into one republish, and skips a republish
+ * which doesn't change the TXT data or port last sent to the mDNS publisher.
+ *
+ */
+class MeshCopRepublisher : private NonCopyable
+{
+public:
+    /**
+     * This structure represents the counters of MeshCoP service republishing.
+     *
+     */
+    struct Counters
+    {
+        uint32_t mCoalescedUpdates;      ///< The number of updates merged into a pending republish.
+        uint32_t mSuppressedRepublishes; ///< The number of republishes skipped as the service was unchanged.
+        uint32_t mIssuedRepublishes;     ///< The number of republishes sent to the mDNS publisher.
+    };
+
+    /**
+     * The window over which updates of the MeshCoP service are merged into one republish.
+     *
+     */
+    static constexpr auto kRepublishDelay = Milliseconds(200);
+
+    /**
+     * This function republishes the MeshCoP service once the window of merged updates ends.
+     *
+     */
+    typedef std::function<void(void)> RepublishHandler;
+
+    /**
+     * The constructor initializes the republisher.
+     *
+     * @param[in] aRepublishHandler  The function which republishes the MeshCoP service.
+     *
+     */
+    explicit MeshCopRepublisher(RepublishHandler aRepublishHandler);
+
+    virtual ~MeshCopRepublisher(void) = default;
+
+    /**
+     * This method requests a republish, which is merged into the pending one if any.
+     *
+     */
+    void Update(void);
+
+    /**
+     * This method cancels the pending republish if any.
+     *
+     */
+    void Cancel(void);
+
+    /**
+     * This method tells whether the MeshCoP service must be sent to the mDNS publisher, and records it as published
+     * if so.
+     *
+     * @param[in] aTxtData  The encoded TXT data of the MeshCoP service.
+     * @param[in] aPort     The port of the MeshCoP service.
+     *
+     * @returns Whether the TXT data or port differ from those last sent to the mDNS publisher.
+     *
+     */
+    bool ShouldPublish(const Mdns::Publisher::TxtData &aTxtData, int aPort);
+
+    /**
+     * This method forgets the published MeshCoP service, so that the next republish is sent to the mDNS publisher.
+     *
+     */
+    void ForgetPublished(void) { mPublishedTxtData.clear(); }
+
+    /**
+     * This method returns the counters of MeshCoP service republishing.
+     *
+     * @returns The counters of MeshCoP service republishing.
+     *
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+protected:
+    /**
+     * This method schedules the end of the window of merged updates.
+     *
+     * @param[in] aDelay  The length of the window.
+     *
+     * @returns The ID of the task, which is passed to `CancelRepublish()`.
+     *
+     */
+    virtual TaskRunner::TaskId ScheduleRepublish(Milliseconds aDelay);
+    virtual void               CancelRepublish(TaskRunner::TaskId aTaskId);
+
+    void HandleRepublishTimer(void);
+
+private:
+    RepublishHandler mRepublishHandler;
+
+    // The TXT data and port of the MeshCoP service which was last sent to the mDNS publisher. The TXT data is empty
+    // when the service isn't published.
+    Mdns::Publisher::TxtData mPublishedTxtData;
+    int                      mPublishedPort;
+
+    TaskRunner         mTaskRunner;
+    TaskRunner::TaskId mRepublishTaskId;
+    Counters           mCounters;
+};
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_MESHCOP_REPUBLISHER_HPP_
@@ -28,68 +28,131 @@
 
 #include "common/dns_utils.hpp"
 
-#include <assert.h>
+#include <string.h>
 
 #include "common/code_utils.hpp"
 
-static bool NameEndsWithDot(const std::string &aName)
+namespace {
+
+constexpr size_t kTransportLength = 5; // Length of "._tcp" or "._udp".
+
+inline char ToLowerAscii(char aChar)
 {
-    return !aName.empty() && aName.back() == '.';
+    return (aChar >= 'A' && aChar <= 'Z') ? static_cast<char>(aChar - 'A' + 'a') : aChar;
 }
 
-DnsNameInfo SplitFullDnsName(const std::string &aName)
+// Finds the last "._udp" or "._tcp" label, as `rfind("._udp.")` would on the name with its trailing dot.
+size_t FindLastTransport(const char *aName, size_t aLength, const char *aTransport)
+{
+    size_t pos = aLength;
+
+    VerifyOrExit(aLength >= kTransportLength);
+
+    for (pos = aLength - kTransportLength + 1; pos-- > 0;)
+    {
+        if (memcmp(aName + pos, aTransport, kTransportLength) == 0 &&
+            (pos + kTransportLength == aLength || aName[pos + kTransportLength] == '.'))
+        {
+            ExitNow();
+        }
+    }
+
+    pos = aLength;
+
+exit:
+    return pos;
+}
+
+} // namespace
+
+bool DnsNameView::EqualsCaseInsensitive(const DnsNameView &aOther) const
+{
+    bool equal = (mLength == aOther.mLength);
+
+    for (size_t i = 0; equal && i < mLength; i++)
+    {
+        equal = (ToLowerAscii(mData[i]) == ToLowerAscii(aOther.mData[i]));
+    }
+
+    return equal;
+}
+
+DnsNameParts ParseFullDnsName(const char *aName, size_t aLength)
 {
-    size_t      transportPos;
-    DnsNameInfo nameInfo;
-    std::string fullName = aName;
+    DnsNameParts parts;
+    size_t       transportPos;
 
-    if (!NameEndsWithDot(fullName))
+    if (aLength > 0 && aName[aLength - 1] == '.')
     {
-        fullName += '.';
+        aLength--;
     }
 
-    transportPos = fullName.rfind("._udp.");
+    transportPos = FindLastTransport(aName, aLength, "._udp");
 
-    if (transportPos == std::string::npos)
+    if (transportPos == aLength)
     {
-        transportPos = fullName.rfind("._tcp.");
+        transportPos = FindLastTransport(aName, aLength, "._tcp");
     }
 
-    if (transportPos == std::string::npos)
+    if (transportPos == aLength)
     {
         // host.domain or domain
-        size_t dotPos = fullName.find_first_of('.');
+        const char *dot    = static_cast<const char *>(memchr(aName, '.', aLength));
+        size_t      dotPos = (dot != nullptr) ? static_cast<size_t>(dot - aName) : aLength;
 
-        assert(dotPos != std::string::npos);
+        parts.mHostName = DnsNameView(aName, dotPos);
 
-        // host.domain
-        nameInfo.mHostName = fullName.substr(0, dotPos);
-        nameInfo.mDomain   = fullName.substr(dotPos + 1, fullName.length() - dotPos - 1);
+        if (dotPos < aLength)
+        {
+            parts.mDomain = DnsNameView(aName + dotPos + 1, aLength - dotPos - 1);
+        }
     }
     else
     {
         // service or service instance
-        size_t dotPos = transportPos > 0 ? fullName.find_last_of('.', transportPos - 1) : std::string::npos;
+        size_t serviceEnd = transportPos + kTransportLength;
+        size_t dotPos     = transportPos;
 
-        nameInfo.mDomain = fullName.substr(transportPos + 6); // 6 is the length of "._tcp." or "._udp."
+        if (serviceEnd + 1 < aLength)
+        {
+            parts.mDomain = DnsNameView(aName + serviceEnd + 1, aLength - serviceEnd - 1);
+        }
+
+        while (dotPos > 0 && aName[dotPos - 1] != '.')
+        {
+            dotPos--;
+        }
 
-        if (dotPos == std::string::npos)
+        if (dotPos == 0)
         {
             // service.domain
-            nameInfo.mServiceName = fullName.substr(0, transportPos + 5);
+            parts.mServiceName = DnsNameView(aName, serviceEnd);
         }
         else
         {
             // instance.service.domain
-            nameInfo.mInstanceName = fullName.substr(0, dotPos);
-            nameInfo.mServiceName  = fullName.substr(dotPos + 1, transportPos + 4 - dotPos);
+            parts.mInstanceName = DnsNameView(aName, dotPos - 1);
+            parts.mServiceName  = DnsNameView(aName + dotPos, serviceEnd - dotPos);
         }
     }
 
-    if (!NameEndsWithDot(nameInfo.mDomain))
-    {
-        nameInfo.mDomain += '.';
-    }
+    return parts;
+}
+
+DnsNameParts ParseFullDnsName(const char *aName)
+{
+    return ParseFullDnsName(aName, strlen(aName));
+}
+
+DnsNameInfo SplitFullDnsName(const std::string &aName)
+{
+    DnsNameParts parts = ParseFullDnsName(aName);
+    DnsNameInfo  nameInfo;
+
+    nameInfo.mInstanceName = parts.mInstanceName.ToString();
+    nameInfo.mServiceName  = parts.mServiceName.ToString();
+    nameInfo.mHostName     = parts.mHostName.ToString();
+    nameInfo.mDomain       = parts.GetDomainWithDot();
 
     return nameInfo;
 }
@@ -99,14 +162,14 @@ otbrError SplitFullServiceInstanceName(const std::string &aFullName,
                                        std::string       &aType,
                                        std::string       &aDomain)
 {
-    otbrError   error    = OTBR_ERROR_NONE;
-    DnsNameInfo nameInfo = SplitFullDnsName(aFullName);
+    otbrError    error = OTBR_ERROR_NONE;
+    DnsNameParts parts = ParseFullDnsName(aFullName);
 
-    VerifyOrExit(nameInfo.IsServiceInstance(), error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(parts.IsServiceInstance(), error = OTBR_ERROR_INVALID_ARGS);
 
-    aInstanceName = std::move(nameInfo.mInstanceName);
-    aType         = std::move(nameInfo.mServiceName);
-    aDomain       = std::move(nameInfo.mDomain);
+    aInstanceName.assign(parts.mInstanceName.GetData(), parts.mInstanceName.GetLength());
+    aType.assign(parts.mServiceName.GetData(), parts.mServiceName.GetLength());
+    aDomain = parts.GetDomainWithDot();
 
 exit:
     return error;
@@ -114,13 +177,13 @@ exit:
 
 otbrError SplitFullServiceName(const std::string &aFullName, std::string &aType, std::string &aDomain)
 {
-    otbrError   error    = OTBR_ERROR_NONE;
-    DnsNameInfo nameInfo = SplitFullDnsName(aFullName);
+    otbrError    error = OTBR_ERROR_NONE;
+    DnsNameParts parts = ParseFullDnsName(aFullName);
 
-    VerifyOrExit(nameInfo.IsService(), error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(parts.IsService(), error = OTBR_ERROR_INVALID_ARGS);
 
-    aType   = std::move(nameInfo.mServiceName);
-    aDomain = std::move(nameInfo.mDomain);
+    aType.assign(parts.mServiceName.GetData(), parts.mServiceName.GetLength());
+    aDomain = parts.GetDomainWithDot();
 
 exit:
     return error;
@@ -128,13 +191,13 @@ exit:
 
 otbrError SplitFullHostName(const std::string &aFullName, std::string &aHostName, std::string &aDomain)
 {
-    otbrError   error    = OTBR_ERROR_NONE;
-    DnsNameInfo nameInfo = SplitFullDnsName(aFullName);
+    otbrError    error = OTBR_ERROR_NONE;
+    DnsNameParts parts = ParseFullDnsName(aFullName);
 
-    VerifyOrExit(nameInfo.IsHost(), error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(parts.IsHost(), error = OTBR_ERROR_INVALID_ARGS);
 
-    aHostName = std::move(nameInfo.mHostName);
-    aDomain   = std::move(nameInfo.mDomain);
+    aHostName.assign(parts.mHostName.GetData(), parts.mHostName.GetLength());
+    aDomain = parts.GetDomainWithDot();
 
 exit:
     return error;
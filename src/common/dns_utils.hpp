@@ -36,8 +36,163 @@
 
 #include "openthread-br/config.h"
 
+#include <stddef.h>
+#include <string.h>
+
 #include "common/types.hpp"
 
+/**
+ * This class represents a non-owning view of a part of a DNS name.
+ *
+ * The view refers to the buffer of the parsed name, which must outlive it.
+ *
+ */
+class DnsNameView
+{
+public:
+    /**
+     * This constructor initializes an empty view.
+     *
+     */
+    DnsNameView(void)
+        : mData("")
+        , mLength(0)
+    {
+    }
+
+    /**
+     * This constructor initializes a view of @p aLength characters at @p aData.
+     *
+     * @param[in] aData    A pointer to the first character.
+     * @param[in] aLength  The number of characters.
+     *
+     */
+    DnsNameView(const char *aData, size_t aLength)
+        : mData(aData)
+        , mLength(aLength)
+    {
+    }
+
+    /**
+     * This constructor initializes a view of a null-terminated string.
+     *
+     * @param[in] aString  A pointer to the null-terminated string.
+     *
+     */
+    explicit DnsNameView(const char *aString)
+        : mData(aString)
+        , mLength(strlen(aString))
+    {
+    }
+
+    /**
+     * This method returns a pointer to the first character, which is not null-terminated.
+     *
+     * @returns A pointer to the first character.
+     *
+     */
+    const char *GetData(void) const { return mData; }
+
+    /**
+     * This method returns the number of characters.
+     *
+     * @returns The number of characters.
+     *
+     */
+    size_t GetLength(void) const { return mLength; }
+
+    /**
+     * This method returns if the view is empty.
+     *
+     * @returns Whether the view is empty.
+     *
+     */
+    bool IsEmpty(void) const { return mLength == 0; }
+
+    /**
+     * This method copies the viewed characters into a string.
+     *
+     * @returns A string of the viewed characters.
+     *
+     */
+    std::string ToString(void) const { return std::string(mData, mLength); }
+
+    /**
+     * This method compares the view with another one in a case-insensitive manner.
+     *
+     * Only ASCII letters are folded, as DNS labels are compared, and no lowercase copy is made.
+     *
+     * @param[in] aOther  The view to compare with.
+     *
+     * @returns Whether the two views are equal in a case-insensitive manner.
+     *
+     */
+    bool EqualsCaseInsensitive(const DnsNameView &aOther) const;
+
+    /**
+     * This method compares the view with a string in a case-insensitive manner.
+     *
+     * @param[in] aOther  The string to compare with.
+     *
+     * @returns Whether the view and the string are equal in a case-insensitive manner.
+     *
+     */
+    bool EqualsCaseInsensitive(const std::string &aOther) const
+    {
+        return EqualsCaseInsensitive(DnsNameView(aOther.data(), aOther.length()));
+    }
+
+private:
+    const char *mData;
+    size_t      mLength;
+};
+
+/**
+ * This structure represents the parts of a DNS name as views into the parsed name.
+ *
+ * @sa ParseFullDnsName
+ *
+ */
+struct DnsNameParts
+{
+    DnsNameView mInstanceName; ///< Instance name, or empty if the DNS name is not a service instance.
+    DnsNameView mServiceName;  ///< Service name, or empty if the DNS name is not a service or service instance.
+    DnsNameView mHostName;     ///< Host name, or empty if the DNS name is not a host name.
+    DnsNameView mDomain;       ///< Domain name without the trailing dot, empty for the root domain.
+
+    /**
+     * This method returns if the DNS name is a service instance.
+     *
+     * @returns Whether the DNS name is a service instance.
+     *
+     */
+    bool IsServiceInstance(void) const { return !mInstanceName.IsEmpty(); }
+
+    /**
+     * This method returns if the DNS name is a service.
+     *
+     * @returns Whether the DNS name is a service.
+     *
+     */
+    bool IsService(void) const { return !mServiceName.IsEmpty() && mInstanceName.IsEmpty(); }
+
+    /**
+     * This method returns if the DNS name is a host.
+     *
+     * @returns Whether the DNS name is a host.
+     *
+     */
+    bool IsHost(void) const { return mServiceName.IsEmpty(); }
+
+    /**
+     * This method returns the domain name with its trailing dot, as `DnsNameInfo::mDomain`.
+     *
+     * @returns The domain name ending with a dot.
+     *
+     */
+    std::string GetDomainWithDot(void) const { return mDomain.ToString() + '.'; }
+};
+
 /**
  * This structure represents DNS Name information.
  *
@@ -76,6 +231,42 @@ struct DnsNameInfo
     bool IsHost(void) const { return mServiceName.empty(); }
 };
 
+/**
+ * This function parses a full DNS name into name components without copying them.
+ *
+ * This gives the same components as `SplitFullDnsName()`, except that the domain has no trailing dot.
+ *
+ * @param[in] aName    A pointer to the full DNS name, with or without the trailing dot.
+ * @param[in] aLength  The length of @p aName.
+ *
+ * @returns A `DnsNameParts` structure viewing the components in @p aName.
+ *
+ */
+DnsNameParts ParseFullDnsName(const char *aName, size_t aLength);
+
+/**
+ * This function parses a full DNS name into name components without copying them.
+ *
+ * @param[in] aName  The full DNS name to parse, which must outlive the returned views.
+ *
+ * @returns A `DnsNameParts` structure viewing the components in @p aName.
+ *
+ */
+inline DnsNameParts ParseFullDnsName(const std::string &aName)
+{
+    return ParseFullDnsName(aName.data(), aName.length());
+}
+
+/**
+ * This function parses a null-terminated full DNS name into name components without copying them.
+ *
+ * @param[in] aName  The full DNS name to parse, which must outlive the returned views.
+ *
+ * @returns A `DnsNameParts` structure viewing the components in @p aName.
+ *
+ */
+DnsNameParts ParseFullDnsName(const char *aName);
+
 /**
  * This method splits a full DNS name into name components.
  *
@@ -0,0 +1,71 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the profiler of the startup phases of the agent.
+ */
+
+#define OTBR_LOG_TAG "STARTUP"
+
+#include "common/startup_profiler.hpp"
+
+#include "common/logging.hpp"
+
+namespace otbr {
+
+StartupProfiler::StartupProfiler(void)
+    : mStartTime(Clock::now())
+{
+}
+
+void StartupProfiler::AddPhase(const std::string &aName, Timepoint aStartTime)
+{
+    Timepoint now = Clock::now();
+    Phase     phase;
+
+    phase.mName      = aName;
+    phase.mStartTime = std::chrono::duration_cast<Milliseconds>(aStartTime - mStartTime);
+    phase.mDuration  = std::chrono::duration_cast<Milliseconds>(now - aStartTime);
+
+    otbrLogInfo("Startup phase %s took %lld ms, finished %lld ms after start", aName.c_str(),
+                static_cast<long long>(phase.mDuration.count()),
+                static_cast<long long>(std::chrono::duration_cast<Milliseconds>(now - mStartTime).count()));
+
+    mPhases.push_back(phase);
+}
+
+void StartupProfiler::Run(const std::string &aName, const std::function<void(void)> &aPhase)
+{
+    Timepoint startTime = Clock::now();
+
+    aPhase();
+    AddPhase(aName, startTime);
+}
+
+} // namespace otbr
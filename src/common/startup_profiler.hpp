@@ -0,0 +1,105 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the profiler of the startup phases of the agent.
+ */
+
+#ifndef OTBR_COMMON_STARTUP_PROFILER_HPP_
+#define OTBR_COMMON_STARTUP_PROFILER_HPP_
+
+#include <openthread-br/config.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+
+/**
+ * This class records how long each startup phase of the agent takes.
+ *
+ */
+class StartupProfiler : private NonCopyable
+{
+public:
+    /**
+     * This structure represents a finished startup phase.
+     *
+     */
+    struct Phase
+    {
+        std::string  mName;      ///< The name of the phase.
+        Milliseconds mStartTime; ///< The start time of the phase, relative to the start of the agent.
+        Milliseconds mDuration;  ///< The duration of the phase.
+    };
+
+    /**
+     * This constructor initializes the profiler and takes the current time as the start of the agent.
+     *
+     */
+    StartupProfiler(void);
+
+    /**
+     * This method records a phase which started at @p aStartTime and ends now.
+     *
+     * @param[in] aName       The name of the phase.
+     * @param[in] aStartTime  The start time of the phase.
+     *
+     */
+    void AddPhase(const std::string &aName, Timepoint aStartTime);
+
+    /**
+     * This method runs a phase and records how long it takes.
+     *
+     * @param[in] aName   The name of the phase.
+     * @param[in] aPhase  The phase to run.
+     *
+     */
+    void Run(const std::string &aName, const std::function<void(void)> &aPhase);
+
+    /**
+     * This method returns the recorded phases, in the order they finished.
+     *
+     * @returns The recorded phases.
+     *
+     */
+    const std::vector<Phase> &GetPhases(void) const { return mPhases; }
+
+private:
+    Timepoint          mStartTime;
+    std::vector<Phase> mPhases;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_STARTUP_PROFILER_HPP_
@@ -27,7 +27,7 @@
  */
 
 #include <arpa/inet.h>
-#include <sstream>
+#include <stdio.h>
 #include <sys/socket.h>
 
 #include "common/code_utils.hpp"
@@ -43,12 +43,17 @@ Ip6Address::Ip6Address(const uint8_t (&aAddress)[16])
 
 std::string Ip6Address::ToString() const
 {
-    char strbuf[INET6_ADDRSTRLEN];
+    char strbuf[kStringSize];
 
-    VerifyOrDie(inet_ntop(AF_INET6, this->m8, strbuf, sizeof(strbuf)) != nullptr,
+    return std::string(ToString(strbuf));
+}
+
+const char *Ip6Address::ToString(char (&aBuffer)[kStringSize]) const
+{
+    VerifyOrDie(inet_ntop(AF_INET6, this->m8, aBuffer, sizeof(aBuffer)) != nullptr,
                 "Failed to convert Ip6 address to string");
 
-    return std::string(strbuf);
+    return aBuffer;
 }
 
 Ip6Address Ip6Address::ToSolicitedNodeMulticastAddress(void) const
@@ -111,28 +116,51 @@ void Ip6Prefix::Set(const otIp6Prefix &aPrefix)
 
 std::string Ip6Prefix::ToString() const
 {
-    std::stringbuf strBuilder;
-    char           strbuf[INET6_ADDRSTRLEN];
+    char strbuf[kStringSize];
 
-    VerifyOrDie(inet_ntop(AF_INET6, mPrefix.m8, strbuf, sizeof(strbuf)) != nullptr,
-                "Failed to convert Ip6 prefix to string");
+    return std::string(ToString(strbuf));
+}
+
+const char *Ip6Prefix::ToString(char (&aBuffer)[kStringSize]) const
+{
+    size_t length;
 
-    strBuilder.sputn(strbuf, strlen(strbuf));
-    strBuilder.sputc('/');
+    VerifyOrDie(inet_ntop(AF_INET6, mPrefix.m8, aBuffer, Ip6Address::kStringSize) != nullptr,
+                "Failed to convert Ip6 prefix to string");
 
-    snprintf(strbuf, sizeof(strbuf), "%d", mLength);
-    strBuilder.sputn(strbuf, strlen(strbuf));
+    length = strlen(aBuffer);
+    snprintf(aBuffer + length, sizeof(aBuffer) - length, "/%u", mLength);
 
-    return strBuilder.str();
+    return aBuffer;
 }
 
 std::string MacAddress::ToString(void) const
 {
-    char strbuf[sizeof(m8) * 3];
+    char strbuf[kStringSize];
+
+    return std::string(ToString(strbuf));
+}
+
+const char *MacAddress::ToString(char (&aBuffer)[kStringSize]) const
+{
+    static constexpr char kHexDigits[] = "0123456789abcdef";
+
+    char *cur = aBuffer;
+
+    for (uint8_t byte : m8)
+    {
+        if (cur != aBuffer)
+        {
+            *cur++ = ':';
+        }
+
+        *cur++ = kHexDigits[byte >> 4];
+        *cur++ = kHexDigits[byte & 0x0f];
+    }
 
-    snprintf(strbuf, sizeof(strbuf), "%02x:%02x:%02x:%02x:%02x:%02x", m8[0], m8[1], m8[2], m8[3], m8[4], m8[5]);
+    *cur = '\0';
 
-    return std::string(strbuf);
+    return aBuffer;
 }
 
 } // namespace otbr
@@ -177,6 +177,8 @@ public:
      */
     Ip6Address ToSolicitedNodeMulticastAddress(void) const;
 
+    static constexpr size_t kStringSize = INET6_ADDRSTRLEN; ///< Size of a buffer for the string representation.
+
     /**
      * This method returns the string representation for the Ip6 address.
      *
@@ -185,6 +187,16 @@ public:
      */
     std::string ToString(void) const;
 
+    /**
+     * This method writes the string representation for the Ip6 address into a buffer.
+     *
+     * @param[out] aBuffer  A buffer to receive the null-terminated string representation.
+     *
+     * @returns A pointer to @p aBuffer.
+     *
+     */
+    const char *ToString(char (&aBuffer)[kStringSize]) const;
+
     /**
      * This method indicates whether or not the Ip6 address is the Unspecified Address.
      *
@@ -322,6 +334,8 @@ public:
      */
     void Set(const otIp6Prefix &aPrefix);
 
+    static constexpr size_t kStringSize = Ip6Address::kStringSize + 4; ///< Size of a buffer, with "/128".
+
     /**
      * This method returns the string representation for the Ip6 prefix.
      *
@@ -330,6 +344,16 @@ public:
      */
     std::string ToString(void) const;
 
+    /**
+     * This method writes the string representation for the Ip6 prefix into a buffer.
+     *
+     * @param[out] aBuffer  A buffer to receive the null-terminated string representation.
+     *
+     * @returns A pointer to @p aBuffer.
+     *
+     */
+    const char *ToString(char (&aBuffer)[kStringSize]) const;
+
     /**
      * This method clears the Ip6 prefix to be unspecified.
      *
@@ -365,6 +389,8 @@ public:
         m16[2] = 0;
     }
 
+    static constexpr size_t kStringSize = 18; ///< Size of a buffer for the string representation.
+
     /**
      * This method returns the string representation for the MAC address.
      *
@@ -373,6 +399,16 @@ public:
      */
     std::string ToString(void) const;
 
+    /**
+     * This method writes the string representation for the MAC address into a buffer.
+     *
+     * @param[out] aBuffer  A buffer to receive the null-terminated string representation.
+     *
+     * @returns A pointer to @p aBuffer.
+     *
+     */
+    const char *ToString(char (&aBuffer)[kStringSize]) const;
+
     union
     {
         uint8_t  m8[6];
@@ -85,26 +85,34 @@ bool IsThreadActive(DeviceRole aRole)
 ThreadApiDBus::ThreadApiDBus(DBusConnection *aConnection)
     : mInterfaceName("wpan0")
     , mConnection(aConnection)
+    , mPropertyCacheEnabled(false)
 {
-    SubscribeDeviceRoleSignal();
+    SubscribeSignals();
 }
 
 ThreadApiDBus::ThreadApiDBus(DBusConnection *aConnection, const std::string &aInterfaceName)
     : mInterfaceName(aInterfaceName)
     , mConnection(aConnection)
+    , mPropertyCacheEnabled(false)
 {
-    SubscribeDeviceRoleSignal();
+    SubscribeSignals();
 }
 
-ClientError ThreadApiDBus::SubscribeDeviceRoleSignal(void)
+ClientError ThreadApiDBus::SubscribeSignals(void)
 {
-    std::string matchRule = "type='signal',interface='" DBUS_INTERFACE_PROPERTIES "'";
+    std::string matchRule      = "type='signal',interface='" DBUS_INTERFACE_PROPERTIES "'";
+    std::string ownerMatchRule = "type='signal',sender='" DBUS_SERVICE_DBUS "',interface='" DBUS_INTERFACE_DBUS
+                                 "',member='NameOwnerChanged',arg0='" OTBR_DBUS_SERVER_PREFIX +
+                                 mInterfaceName + "'";
     DBusError   error;
     ClientError ret = ClientError::ERROR_NONE;
 
     dbus_error_init(&error);
     dbus_bus_add_match(mConnection, matchRule.c_str(), &error);
+    VerifyOrExit(!dbus_error_is_set(&error), ret = ClientError::OT_ERROR_FAILED);
 
+    // The cached properties are unknown once the agent exits.
+    dbus_bus_add_match(mConnection, ownerMatchRule.c_str(), &error);
     VerifyOrExit(!dbus_error_is_set(&error), ret = ClientError::OT_ERROR_FAILED);
 
     dbus_connection_add_filter(mConnection, sDBusMessageFilter, this, nullptr);
@@ -131,7 +139,20 @@ DBusHandlerResult ThreadApiDBus::DBusMessageFilter(DBusConnection *aConnection,
     std::string     interfaceName, propertyName, val;
     DeviceRole      role = OTBR_DEVICE_ROLE_DISABLED;
 
+    if (dbus_message_is_signal(aMessage, DBUS_INTERFACE_DBUS, "NameOwnerChanged"))
+    {
+        std::string serviceName;
+
+        if (dbus_message_iter_init(aMessage, &iter) && DBusMessageExtract(&iter, serviceName) == OTBR_ERROR_NONE &&
+            serviceName == OTBR_DBUS_SERVER_PREFIX + mInterfaceName)
+        {
+            mPropertyCache.clear();
+        }
+        ExitNow();
+    }
+
     VerifyOrExit(dbus_message_is_signal(aMessage, DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL));
+    UpdatePropertyCache(aMessage);
     VerifyOrExit(dbus_message_iter_init(aMessage, &iter));
     SuccessOrExit(DBusMessageExtract(&iter, interfaceName));
     VerifyOrExit(interfaceName == OTBR_DBUS_THREAD_INTERFACE);
@@ -163,6 +184,158 @@ void ThreadApiDBus::AddDeviceRoleHandler(const DeviceRoleHandler &aHandler)
     mDeviceRoleHandlers.push_back(aHandler);
 }
 
+void ThreadApiDBus::SetPropertyCacheEnabled(bool aEnabled)
+{
+    mPropertyCacheEnabled = aEnabled;
+    mPropertyCache.clear();
+}
+
+void ThreadApiDBus::UpdatePropertyCache(DBusMessage *aMessage)
+{
+    DBusMessageIter          iter, subIter, dictEntryIter;
+    std::string              interfaceName, propertyName;
+    std::vector<std::string> invalidatedProperties;
+
+    VerifyOrExit(mPropertyCacheEnabled);
+    VerifyOrExit(dbus_message_has_path(aMessage, (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str()));
+    VerifyOrExit(dbus_message_iter_init(aMessage, &iter));
+    SuccessOrExit(DBusMessageExtract(&iter, interfaceName));
+    VerifyOrExit(interfaceName == OTBR_DBUS_THREAD_INTERFACE);
+
+    VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY);
+    dbus_message_iter_recurse(&iter, &subIter);
+    for (; dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY; dbus_message_iter_next(&subIter))
+    {
+        dbus_message_iter_recurse(&subIter, &dictEntryIter);
+        SuccessOrExit(DBusMessageExtract(&dictEntryIter, propertyName));
+        VerifyOrExit(dbus_message_iter_get_arg_type(&dictEntryIter) == DBUS_TYPE_VARIANT);
+
+        // A property which is not signalled on every change could be served stale from the cache.
+        if (!IsSignalledProperty(propertyName))
+        {
+            continue;
+        }
+
+        // The signal is kept alive as long as it carries a cached value.
+        mPropertyCache[propertyName].mMessage = UniqueDBusMessage(dbus_message_ref(aMessage));
+        mPropertyCache[propertyName].mIter    = dictEntryIter;
+    }
+
+    dbus_message_iter_next(&iter);
+    SuccessOrExit(DBusMessageExtract(&iter, invalidatedProperties));
+    for (const std::string &name : invalidatedProperties)
+    {
+        mPropertyCache.erase(name);
+    }
+
+exit:
+    return;
+}
+
+bool ThreadApiDBus::IsSignalledProperty(const std::string &aPropertyName)
+{
+    return aPropertyName == OTBR_DBUS_PROPERTY_DEVICE_ROLE || aPropertyName == OTBR_DBUS_PROPERTY_ACTIVE_DATASET_TLVS;
+}
+
+bool ThreadApiDBus::FindCachedProperty(const std::string &aPropertyName, DBusMessageIter &aIter) const
+{
+    auto it    = mPropertyCache.find(aPropertyName);
+    bool found = (it != mPropertyCache.end());
+
+    if (found)
+    {
+        // Reading from a copy keeps the cached iterator at the start of the value.
+        aIter = it->second.mIter;
+    }
+
+    return found;
+}
+
+ClientError ThreadApiDBus::CallGetProperties(const std::vector<std::string> &aPropertyNames,
+                                             UniqueDBusMessage              &aReply,
+                                             DBusMessageIter                &aIter)
+{
+    UniqueDBusMessage message(dbus_message_new_method_call(
+        (OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(), (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+        OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_PROPERTIES_METHOD));
+    ClientError       ret = ClientError::ERROR_NONE;
+    DBusError         error;
+    DBusMessageIter   iter;
+
+    dbus_error_init(&error);
+    VerifyOrExit(message != nullptr, ret = ClientError::OT_ERROR_FAILED);
+    VerifyOrExit(TupleToDBusMessage(*message, std::tie(aPropertyNames)) == OTBR_ERROR_NONE,
+                 ret = ClientError::ERROR_DBUS);
+    aReply = UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(mConnection, message.get(), DBUS_TIMEOUT_USE_DEFAULT, &error));
+
+    VerifyOrExit(!dbus_error_is_set(&error), ret = ConvertFromDBusErrorName(error.message));
+    VerifyOrExit(aReply != nullptr, ret = ClientError::ERROR_DBUS);
+    SuccessOrExit(ret = CheckErrorMessage(aReply.get()));
+    VerifyOrExit(dbus_message_iter_init(aReply.get(), &iter), ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY, ret = ClientError::ERROR_DBUS);
+    dbus_message_iter_recurse(&iter, &aIter);
+
+exit:
+    dbus_error_free(&error);
+    return ret;
+}
+
+ClientError ThreadApiDBus::CallGetPropertyAsync(const std::string &aPropertyName, const VariantHandler &aHandler)
+{
+    UniqueDBusMessage message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
+                                                           (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+                                                           DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_GET_METHOD));
+    DBusPendingCall  *pending = nullptr;
+    ClientError       ret     = ClientError::ERROR_NONE;
+    DBusMessageIter   iter;
+
+    if (FindCachedProperty(aPropertyName, iter))
+    {
+        aHandler(ClientError::ERROR_NONE, &iter);
+        ExitNow();
+    }
+
+    VerifyOrExit(message != nullptr, ret = ClientError::OT_ERROR_FAILED);
+    VerifyOrExit(TupleToDBusMessage(*message, std::tie(OTBR_DBUS_THREAD_INTERFACE, aPropertyName)) == OTBR_ERROR_NONE,
+                 ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(dbus_connection_send_with_reply(mConnection, message.get(), &pending, DBUS_TIMEOUT_USE_DEFAULT) &&
+                     pending != nullptr,
+                 ret = ClientError::ERROR_DBUS);
+
+    // The pending call owns the handler from now on.
+    if (!dbus_pending_call_set_notify(pending, sHandleGetPropertyReply, new VariantHandler(aHandler),
+                                      sFreeVariantHandler))
+    {
+        dbus_pending_call_cancel(pending);
+        ret = ClientError::ERROR_DBUS;
+    }
+    dbus_pending_call_unref(pending);
+
+exit:
+    return ret;
+}
+
+void ThreadApiDBus::sHandleGetPropertyReply(DBusPendingCall *aPending, void *aHandler)
+{
+    const VariantHandler &handler = *static_cast<VariantHandler *>(aHandler);
+    UniqueDBusMessage     reply(dbus_pending_call_steal_reply(aPending));
+    ClientError           error = ClientError::ERROR_NONE;
+    DBusMessageIter       iter;
+
+    VerifyOrExit(reply != nullptr, error = ClientError::ERROR_DBUS);
+    SuccessOrExit(error = CheckErrorMessage(reply.get()));
+    VerifyOrExit(dbus_message_iter_init(reply.get(), &iter), error = ClientError::ERROR_DBUS);
+
+exit:
+    handler(error, error == ClientError::ERROR_NONE ? &iter : nullptr);
+}
+
+void ThreadApiDBus::sFreeVariantHandler(void *aHandler)
+{
+    delete static_cast<VariantHandler *>(aHandler);
+}
+
 ClientError ThreadApiDBus::Scan(const ScanHandler &aHandler)
 {
     ClientError error = ClientError::ERROR_NONE;
@@ -671,6 +844,11 @@ ClientError ThreadApiDBus::GetMdnsTelemetryInfo(MdnsTelemetryInfo &aMdnsTelemetr
     return GetProperty(OTBR_DBUS_PROPERTY_MDNS_TELEMETRY_INFO, aMdnsTelemetryInfo);
 }
 
+ClientError ThreadApiDBus::GetStartupPhases(std::vector<StartupPhase> &aPhases)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_STARTUP_PHASES, aPhases);
+}
+
 ClientError ThreadApiDBus::GetNat64State(Nat64ComponentState &aState)
 {
     return GetProperty(OTBR_DBUS_PROPERTY_NAT64_STATE, aState);
@@ -703,6 +881,31 @@ ClientError ThreadApiDBus::GetTelemetryData(std::vector<uint8_t> &aTelemetryData
     return GetProperty(OTBR_DBUS_PROPERTY_TELEMETRY_DATA, aTelemetryData);
 }
 
+ClientError ThreadApiDBus::GetTelemetryData(uint32_t aSections, std::vector<uint8_t> &aTelemetryData)
+{
+    UniqueDBusMessage message(dbus_message_new_method_call(
+        (OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(), (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+        OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_TELEMETRY_DATA_SECTIONS_METHOD));
+    UniqueDBusMessage reply = nullptr;
+    ClientError       ret   = ClientError::ERROR_NONE;
+    auto              args  = std::tie(aTelemetryData);
+    DBusError         error;
+
+    dbus_error_init(&error);
+    VerifyOrExit(message != nullptr, ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(TupleToDBusMessage(*message, std::tie(aSections)) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+    reply = UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(mConnection, message.get(), DBUS_TIMEOUT_USE_DEFAULT, &error));
+    VerifyOrExit(!dbus_error_is_set(&error), ret = ConvertFromDBusErrorName(error.message));
+    VerifyOrExit(reply != nullptr, ret = ClientError::ERROR_DBUS);
+    SuccessOrExit(ret = CheckErrorMessage(reply.get()));
+    VerifyOrExit(DBusMessageToTuple(*reply, args) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+
+exit:
+    dbus_error_free(&error);
+    return ret;
+}
+
 ClientError ThreadApiDBus::GetCapabilities(std::vector<uint8_t> &aCapabilities)
 {
     return GetProperty(OTBR_DBUS_PROPERTY_CAPABILITIES, aCapabilities);
@@ -814,6 +1017,9 @@ ClientError ThreadApiDBus::SetProperty(const std::string &aPropertyName, const V
     dbus_error_init(&error);
     VerifyOrExit(message != nullptr, ret = ClientError::OT_ERROR_FAILED);
 
+    // The new value is cached again when its `PropertiesChanged` signal arrives.
+    mPropertyCache.erase(aPropertyName);
+
     dbus_message_iter_init_append(message.get(), &iter);
     VerifyOrExit(DBus::DBusMessageEncode(&iter, OTBR_DBUS_THREAD_INTERFACE) == OTBR_ERROR_NONE,
                  ret = ClientError::ERROR_DBUS);
@@ -843,6 +1049,14 @@ template <typename ValType> ClientError ThreadApiDBus::GetProperty(const std::st
     DBusMessageIter iter;
 
     dbus_error_init(&error);
+
+    if (FindCachedProperty(aPropertyName, iter))
+    {
+        VerifyOrExit(DBus::DBusMessageExtractFromVariant(&iter, aValue) == OTBR_ERROR_NONE,
+                     ret = ClientError::ERROR_DBUS);
+        ExitNow();
+    }
+
     VerifyOrExit(message != nullptr, ret = ClientError::OT_ERROR_FAILED);
     otbr::DBus::TupleToDBusMessage(*message, std::tie(OTBR_DBUS_THREAD_INTERFACE, aPropertyName));
     reply = DBus::UniqueDBusMessage(
@@ -37,11 +37,15 @@
 #include "openthread-br/config.h"
 
 #include <functional>
+#include <map>
 
 #include <dbus/dbus.h>
 
+#include "common/code_utils.hpp"
 #include "common/types.hpp"
 #include "dbus/common/constants.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
+#include "dbus/common/dbus_resources.hpp"
 #include "dbus/common/error.hpp"
 #include "dbus/common/types.hpp"
 
@@ -58,6 +62,8 @@ public:
     using EnergyScanHandler = std::function<void(const std::vector<EnergyScanResult> &)>;
     using OtResultHandler   = std::function<void(ClientError)>;
 
+    template <typename ValType> using PropertyHandler = std::function<void(ClientError, const ValType &)>;
+
     /**
      * The constructor of a d-bus object.
      *
@@ -85,6 +91,89 @@ public:
      */
     void AddDeviceRoleHandler(const DeviceRoleHandler &aHandler);
 
+    /**
+     * This method enables/disables the cache of property values.
+     *
+     * When enabled, the values carried by `PropertiesChanged` signals are kept and later reads of these properties
+     * are served without a d-bus call. The cache is only updated when the connection is dispatched, so it should
+     * only be enabled by clients which dispatch their connection, e.g. with `dbus_connection_read_write_dispatch()`.
+     *
+     * Only properties which the server signals on every change are cached, that is `DeviceRole` and
+     * `ActiveDatasetTlvs`. All other properties are always read with a d-bus call.
+     *
+     * @param[in] aEnabled  Whether to enable the property cache.
+     *
+     */
+    void SetPropertyCacheEnabled(bool aEnabled);
+
+    /**
+     * This method gets multiple properties with one d-bus call.
+     *
+     * Example:
+     * @code
+     *     uint16_t    channel;
+     *     std::string networkName;
+     *
+     *     api->GetProperties({OTBR_DBUS_PROPERTY_CHANNEL, OTBR_DBUS_PROPERTY_NETWORK_NAME}, channel, networkName);
+     * @endcode
+     *
+     * @param[in]  aPropertyNames  The names of the properties.
+     * @param[out] aValues         The values of the properties, in the same order as @p aPropertyNames.
+     *
+     * @retval ERROR_NONE             Successfully performed the dbus function call
+     * @retval ERROR_DBUS             dbus encode/decode error
+     * @retval OT_ERROR_INVALID_ARGS  The numbers of property names and values are different.
+     * @retval ...                    OpenThread defined error value otherwise
+     *
+     */
+    template <typename... ValTypes>
+    ClientError GetProperties(const std::vector<std::string> &aPropertyNames, ValTypes &...aValues)
+    {
+        UniqueDBusMessage reply;
+        DBusMessageIter   iter;
+        ClientError       error;
+
+        VerifyOrExit(aPropertyNames.size() == sizeof...(aValues), error = ClientError::OT_ERROR_INVALID_ARGS);
+        SuccessOrExit(error = CallGetProperties(aPropertyNames, reply, iter));
+        error = ExtractVariants(&iter, aValues...);
+
+    exit:
+        return error;
+    }
+
+    /**
+     * This method gets a property without blocking.
+     *
+     * The handler is called when the reply arrives, or before this method returns if the value is cached.
+     *
+     * Example:
+     * @code
+     *     api->GetPropertyAsync<uint16_t>(OTBR_DBUS_PROPERTY_CHANNEL, [](ClientError aError, uint16_t aChannel) {
+     *         ...
+     *     });
+     * @endcode
+     *
+     * @param[in] aPropertyName  The name of the property.
+     * @param[in] aHandler       The handler of the result.
+     *
+     * @retval ERROR_NONE  Successfully sent the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     *
+     */
+    template <typename ValType>
+    ClientError GetPropertyAsync(const std::string &aPropertyName, const PropertyHandler<ValType> &aHandler)
+    {
+        return CallGetPropertyAsync(aPropertyName, [aHandler](ClientError aError, DBusMessageIter *aIter) {
+            ValType value{};
+
+            if (aError == ClientError::ERROR_NONE && DBusMessageExtractFromVariant(aIter, value) != OTBR_ERROR_NONE)
+            {
+                aError = ClientError::ERROR_DBUS;
+            }
+            aHandler(aError, value);
+        });
+    }
+
     /**
      * This method permits unsecure join on port.
      *
@@ -795,6 +884,18 @@ public:
      */
     ClientError GetMdnsTelemetryInfo(MdnsTelemetryInfo &aMdnsTelemetryInfo);
 
+    /**
+     * This method gets the startup phases of the agent finished so far.
+     *
+     * @param[out] aPhases  The startup phases, in the order they finished.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetStartupPhases(std::vector<StartupPhase> &aPhases);
+
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
     /**
      * This method gets the DNS-SD counters.
@@ -897,6 +998,20 @@ public:
      */
     ClientError GetTelemetryData(std::vector<uint8_t> &aTelemetryData);
 
+    /**
+     * This method gets the selected sections of the telemetry data proto serialized byte data.
+     *
+     * @param[in]  aSections       A bit mask of OTBR_DBUS_TELEMETRY_SECTION_* values.
+     * @param[out] aTelemetryData  The telemetry data proto serialized
+     *                             byte data (see proto/thread_telemetry.proto)
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetTelemetryData(uint32_t aSections, std::vector<uint8_t> &aTelemetryData);
+
     /**
      * This method gets the capabilities data proto serialized byte data.
      *
@@ -911,6 +1026,44 @@ public:
     ClientError GetCapabilities(std::vector<uint8_t> &aCapabilities);
 
 private:
+    using VariantHandler = std::function<void(ClientError, DBusMessageIter *)>;
+
+    struct CachedProperty
+    {
+        UniqueDBusMessage mMessage; // The signal carrying the value.
+        DBusMessageIter   mIter;    // The position of the value variant in `mMessage`.
+    };
+
+    ClientError CallGetProperties(const std::vector<std::string> &aPropertyNames,
+                                  UniqueDBusMessage              &aReply,
+                                  DBusMessageIter                &aIter);
+    ClientError CallGetPropertyAsync(const std::string &aPropertyName, const VariantHandler &aHandler);
+    static void sHandleGetPropertyReply(DBusPendingCall *aPending, void *aHandler);
+    static void sFreeVariantHandler(void *aHandler);
+    static bool IsSignalledProperty(const std::string &aPropertyName);
+    bool        FindCachedProperty(const std::string &aPropertyName, DBusMessageIter &aIter) const;
+    void        UpdatePropertyCache(DBusMessage *aMessage);
+
+    static ClientError ExtractVariants(DBusMessageIter *aIter)
+    {
+        OTBR_UNUSED_VARIABLE(aIter);
+
+        return ClientError::ERROR_NONE;
+    }
+
+    template <typename ValType, typename... ValTypes>
+    static ClientError ExtractVariants(DBusMessageIter *aIter, ValType &aValue, ValTypes &...aValues)
+    {
+        ClientError error = ClientError::ERROR_NONE;
+
+        VerifyOrExit(DBusMessageExtractFromVariant(aIter, aValue) == OTBR_ERROR_NONE, error = ClientError::ERROR_DBUS);
+        dbus_message_iter_next(aIter);
+        error = ExtractVariants(aIter, aValues...);
+
+    exit:
+        return error;
+    }
+
     ClientError CallDBusMethodSync(const std::string &aMethodName);
     ClientError CallDBusMethodAsync(const std::string &aMethodName, DBusPendingCallNotifyFunction aFunction);
 
@@ -925,7 +1078,7 @@ private:
 
     template <typename ValType> ClientError GetProperty(const std::string &aPropertyName, ValType &aValue);
 
-    ClientError              SubscribeDeviceRoleSignal(void);
+    ClientError              SubscribeSignals(void);
     static DBusHandlerResult sDBusMessageFilter(DBusConnection *aConnection, DBusMessage *aMessage, void *aData);
     DBusHandlerResult        DBusMessageFilter(DBusConnection *aConnection, DBusMessage *aMessage);
 
@@ -956,6 +1109,9 @@ private:
     OtResultHandler   mJoinerHandler;
 
     std::vector<DeviceRoleHandler> mDeviceRoleHandlers;
+
+    bool                                  mPropertyCacheEnabled;
+    std::map<std::string, CachedProperty> mPropertyCache;
 };
 
 } // namespace DBus
@@ -62,6 +62,9 @@
 #define OTBR_DBUS_GET_PROPERTIES_METHOD "GetProperties"
 #define OTBR_DBUS_LEAVE_NETWORK_METHOD "LeaveNetwork"
 #define OTBR_DBUS_SET_NAT64_ENABLED_METHOD "SetNat64Enabled"
+#define OTBR_DBUS_GET_TELEMETRY_SAMPLES_METHOD "GetTelemetrySamples"
+#define OTBR_DBUS_GET_TELEMETRY_CHANGED_SINCE_METHOD "GetTelemetryChangedSince"
+#define OTBR_DBUS_GET_TELEMETRY_DATA_SECTIONS_METHOD "GetTelemetryDataSections"
 
 #define OTBR_DBUS_PROPERTY_MESH_LOCAL_PREFIX "MeshLocalPrefix"
 #define OTBR_DBUS_PROPERTY_LINK_MODE "LinkMode"
@@ -119,6 +122,16 @@
 #define OTBR_DBUS_PROPERTY_DNS_UPSTREAM_QUERY_STATE "DnsUpstreamQueryState"
 #define OTBR_DBUS_PROPERTY_TELEMETRY_DATA "TelemetryData"
 #define OTBR_DBUS_PROPERTY_CAPABILITIES "Capabilities"
+#define OTBR_DBUS_PROPERTY_TELEMETRY_SAMPLE_INTERVAL "TelemetrySampleInterval"
+#define OTBR_DBUS_PROPERTY_STARTUP_PHASES "StartupPhases"
+
+#define OTBR_DBUS_TELEMETRY_SECTION_WPAN_STATS (1u << 0)
+#define OTBR_DBUS_TELEMETRY_SECTION_WPAN_TOPO_FULL (1u << 1)
+#define OTBR_DBUS_TELEMETRY_SECTION_TOPO_ENTRIES (1u << 2)
+#define OTBR_DBUS_TELEMETRY_SECTION_WPAN_BORDER_ROUTER (1u << 3)
+#define OTBR_DBUS_TELEMETRY_SECTION_WPAN_RCP (1u << 4)
+#define OTBR_DBUS_TELEMETRY_SECTION_COEX_METRICS (1u << 5)
+#define OTBR_DBUS_TELEMETRY_SECTION_LOW_POWER_METRICS (1u << 6)
 
 #define OTBR_NAT64_STATE_NAME_DISABLED "disabled"
 #define OTBR_NAT64_STATE_NAME_NOT_RUNNING "not_running"
@@ -119,6 +119,10 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const TrelInfo &aTrelInfo);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, TrelInfo &aTrelInfo);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const TrelInfo::TrelPacketCounters &aCounters);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, TrelInfo::TrelPacketCounters &aCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const TelemetrySample &aSample);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, TelemetrySample &aSample);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const StartupPhase &aPhase);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, StartupPhase &aPhase);
 
 template <typename T> struct DBusTypeTrait;
 
@@ -407,6 +411,18 @@ template <> struct DBusTypeTrait<InfraLinkInfo>
     static constexpr const char *TYPE_AS_STRING = "(sbbbuuu)";
 };
 
+template <> struct DBusTypeTrait<TelemetrySample>
+{
+    // struct of { uint64, uint64, array of int64 }
+    static constexpr const char *TYPE_AS_STRING = "(ttax)";
+};
+
+template <> struct DBusTypeTrait<StartupPhase>
+{
+    // struct of { string, uint32, uint32 }
+    static constexpr const char *TYPE_AS_STRING = "(suu)";
+};
+
 template <> struct DBusTypeTrait<int8_t>
 {
     static constexpr int         TYPE           = DBUS_TYPE_BYTE;
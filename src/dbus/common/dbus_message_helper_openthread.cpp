@@ -1258,5 +1258,69 @@ exit:
     return error;
 }
 
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const TelemetrySample &aSample)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aSample.mSequence));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aSample.mTimestamp));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aSample.mValues));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, TelemetrySample &aSample)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aSample.mSequence));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aSample.mTimestamp));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aSample.mValues));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const StartupPhase &aPhase)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aPhase.mName));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aPhase.mStartTime));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aPhase.mDuration));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, StartupPhase &aPhase)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aPhase.mName));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aPhase.mStartTime));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aPhase.mDuration));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
 } // namespace DBus
 } // namespace otbr
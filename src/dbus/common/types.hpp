@@ -719,6 +719,20 @@ struct TrelInfo
     TrelPacketCounters mTrelCounters; ///< The TREL counters.
 };
 
+struct TelemetrySample
+{
+    uint64_t             mSequence;  ///< The sequence number of the sample.
+    uint64_t             mTimestamp; ///< The sample time in milliseconds since sampling started.
+    std::vector<int64_t> mValues;    ///< Absolute counter values for the first sample, deltas for the others.
+};
+
+struct StartupPhase
+{
+    std::string mName;      ///< The name of the startup phase.
+    uint32_t    mStartTime; ///< The start time of the phase in milliseconds since the agent started.
+    uint32_t    mDuration;  ///< The duration of the phase in milliseconds.
+};
+
 } // namespace DBus
 } // namespace otbr
 
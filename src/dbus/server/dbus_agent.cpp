@@ -43,30 +43,63 @@ namespace DBus {
 
 const struct timeval           DBusAgent::kPollTimeout = {0, 0};
 constexpr std::chrono::seconds DBusAgent::kDBusWaitAllowance;
+constexpr Milliseconds         DBusAgent::kDBusRetryInterval;
 
-DBusAgent::DBusAgent(otbr::Ncp::ControllerOpenThread &aNcp, Mdns::Publisher &aPublisher)
+DBusAgent::DBusAgent(otbr::Ncp::ControllerOpenThread &aNcp,
+                     Mdns::Publisher                 &aPublisher,
+                     const StartupProfiler           &aStartupProfiler)
     : mInterfaceName(aNcp.GetInterfaceName())
     , mNcp(aNcp)
     , mPublisher(aPublisher)
+    , mStartupProfiler(aStartupProfiler)
 {
 }
 
 void DBusAgent::Init(void)
 {
-    otbrError error = OTBR_ERROR_NONE;
-
     auto connection_deadline = Clock::now() + kDBusWaitAllowance;
 
     while ((mConnection = PrepareDBusConnection()) == nullptr && Clock::now() < connection_deadline)
     {
         otbrLogWarning("Failed to setup DBus connection, will retry after 1 second");
-        std::this_thread::sleep_for(std::chrono::seconds(1));
+        std::this_thread::sleep_for(kDBusRetryInterval);
     }
 
     VerifyOrDie(mConnection != nullptr, "Failed to get DBus connection");
 
-    mThreadObject =
-        std::unique_ptr<DBusThreadObject>(new DBusThreadObject(mConnection.get(), mInterfaceName, &mNcp, &mPublisher));
+    InitThreadObject();
+}
+
+void DBusAgent::InitAsync(InitHandler aHandler)
+{
+    Connect(Clock::now() + kDBusWaitAllowance, std::move(aHandler));
+}
+
+void DBusAgent::Connect(Clock::time_point aDeadline, InitHandler aHandler)
+{
+    mConnection = PrepareDBusConnection();
+
+    if (mConnection == nullptr)
+    {
+        VerifyOrDie(Clock::now() < aDeadline, "Failed to get DBus connection");
+        otbrLogWarning("Failed to setup DBus connection, will retry after 1 second");
+        mTaskRunner.Post(kDBusRetryInterval, [this, aDeadline, aHandler]() { Connect(aDeadline, aHandler); });
+        ExitNow();
+    }
+
+    InitThreadObject();
+    aHandler();
+
+exit:
+    return;
+}
+
+void DBusAgent::InitThreadObject(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    mThreadObject = std::unique_ptr<DBusThreadObject>(
+        new DBusThreadObject(mConnection.get(), mInterfaceName, &mNcp, &mPublisher, &mStartupProfiler));
     error = mThreadObject->Init();
     VerifyOrDie(error == OTBR_ERROR_NONE, "Failed to initialize DBus Agent");
 }
@@ -123,6 +156,9 @@ void DBusAgent::Update(MainloopContext &aMainloop)
     unsigned int flags;
     int          fd;
 
+    // The connection is not set up yet while `InitAsync()` waits for the system bus.
+    VerifyOrExit(mConnection != nullptr);
+
     if (dbus_connection_get_dispatch_status(mConnection.get()) == DBUS_DISPATCH_DATA_REMAINS)
     {
         aMainloop.mTimeout = {0, 0};
@@ -157,6 +193,9 @@ void DBusAgent::Update(MainloopContext &aMainloop)
 
         aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
     }
+
+exit:
+    return;
 }
 
 void DBusAgent::Process(const MainloopContext &aMainloop)
@@ -164,6 +203,8 @@ void DBusAgent::Process(const MainloopContext &aMainloop)
     unsigned int flags;
     int          fd;
 
+    VerifyOrExit(mConnection != nullptr);
+
     for (const auto &watch : mWatches)
     {
         if (!dbus_watch_get_enabled(watch))
@@ -199,6 +240,9 @@ void DBusAgent::Process(const MainloopContext &aMainloop)
 
     while (DBUS_DISPATCH_DATA_REMAINS == dbus_connection_dispatch(mConnection.get()))
         ;
+
+exit:
+    return;
 }
 
 } // namespace DBus
@@ -43,6 +43,8 @@
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/startup_profiler.hpp"
+#include "common/task_runner.hpp"
 #include "dbus/common/dbus_message_helper.hpp"
 #include "dbus/common/dbus_resources.hpp"
 #include "dbus/server/dbus_object.hpp"
@@ -56,32 +58,57 @@ namespace DBus {
 class DBusAgent : public MainloopProcessor, private NonCopyable
 {
 public:
+    /**
+     * This type represents the handler called once the dbus agent is initialized.
+     *
+     */
+    using InitHandler = std::function<void(void)>;
+
     /**
      * The constructor of dbus agent.
      *
-     * @param[in] aNcp  A reference to the NCP controller.
+     * @param[in] aNcp              A reference to the NCP controller.
+     * @param[in] aPublisher        A reference to the mDNS publisher.
+     * @param[in] aStartupProfiler  A reference to the profiler of the agent startup phases.
      *
      */
-    DBusAgent(otbr::Ncp::ControllerOpenThread &aNcp, Mdns::Publisher &aPublisher);
+    DBusAgent(otbr::Ncp::ControllerOpenThread &aNcp,
+              Mdns::Publisher                 &aPublisher,
+              const StartupProfiler           &aStartupProfiler);
 
     /**
      * This method initializes the dbus agent.
      *
+     * This method blocks until the system bus is available.
+     *
      */
     void Init(void);
 
+    /**
+     * This method initializes the dbus agent without blocking the mainloop.
+     *
+     * The connection to the system bus is retried on the mainloop until it succeeds.
+     *
+     * @param[in] aHandler  The handler called once the dbus agent is initialized.
+     *
+     */
+    void InitAsync(InitHandler aHandler);
+
     void Update(MainloopContext &aMainloop) override;
     void Process(const MainloopContext &aMainloop) override;
 
 private:
     using Clock                                              = std::chrono::steady_clock;
     constexpr static std::chrono::seconds kDBusWaitAllowance = std::chrono::seconds(30);
+    constexpr static Milliseconds         kDBusRetryInterval = std::chrono::seconds(1);
 
     using UniqueDBusConnection = std::unique_ptr<DBusConnection, std::function<void(DBusConnection *)>>;
 
     static dbus_bool_t   AddDBusWatch(struct DBusWatch *aWatch, void *aContext);
     static void          RemoveDBusWatch(struct DBusWatch *aWatch, void *aContext);
     UniqueDBusConnection PrepareDBusConnection(void);
+    void                 Connect(Clock::time_point aDeadline, InitHandler aHandler);
+    void                 InitThreadObject(void);
 
     static const struct timeval kPollTimeout;
 
@@ -90,6 +117,8 @@ private:
     UniqueDBusConnection              mConnection;
     otbr::Ncp::ControllerOpenThread  &mNcp;
     Mdns::Publisher                  &mPublisher;
+    const StartupProfiler            &mStartupProfiler;
+    TaskRunner                        mTaskRunner;
 
     /**
      * This map is used to track DBusWatch-es.
@@ -93,10 +93,12 @@ namespace DBus {
 DBusThreadObject::DBusThreadObject(DBusConnection                  *aConnection,
                                    const std::string               &aInterfaceName,
                                    otbr::Ncp::ControllerOpenThread *aNcp,
-                                   Mdns::Publisher                 *aPublisher)
+                                   Mdns::Publisher                 *aPublisher,
+                                   const StartupProfiler           *aStartupProfiler)
     : DBusObject(aConnection, OTBR_DBUS_OBJECT_PREFIX + aInterfaceName)
     , mNcp(aNcp)
     , mPublisher(aPublisher)
+    , mStartupProfiler(aStartupProfiler)
 {
 }
 
@@ -147,6 +149,12 @@ otbrError DBusThreadObject::Init(void)
                    std::bind(&DBusThreadObject::LeaveNetworkHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SET_NAT64_ENABLED_METHOD,
                    std::bind(&DBusThreadObject::SetNat64Enabled, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_TELEMETRY_SAMPLES_METHOD,
+                   std::bind(&DBusThreadObject::GetTelemetrySamplesHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_TELEMETRY_CHANGED_SINCE_METHOD,
+                   std::bind(&DBusThreadObject::GetTelemetryChangedSinceHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_TELEMETRY_DATA_SECTIONS_METHOD,
+                   std::bind(&DBusThreadObject::GetTelemetryDataSectionsHandler, this, _1));
 
     RegisterMethod(DBUS_INTERFACE_INTROSPECTABLE, DBUS_INTROSPECT_METHOD,
                    std::bind(&DBusThreadObject::IntrospectHandler, this, _1));
@@ -165,6 +173,8 @@ otbrError DBusThreadObject::Init(void)
                                std::bind(&DBusThreadObject::SetDnsUpstreamQueryState, this, _1));
     RegisterSetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NAT64_CIDR,
                                std::bind(&DBusThreadObject::SetNat64Cidr, this, _1));
+    RegisterSetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_TELEMETRY_SAMPLE_INTERVAL,
+                               std::bind(&DBusThreadObject::SetTelemetrySampleIntervalHandler, this, _1));
 
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_LINK_MODE,
                                std::bind(&DBusThreadObject::GetLinkModeHandler, this, _1));
@@ -279,6 +289,10 @@ otbrError DBusThreadObject::Init(void)
                                std::bind(&DBusThreadObject::GetTelemetryDataHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CAPABILITIES,
                                std::bind(&DBusThreadObject::GetCapabilitiesHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_TELEMETRY_SAMPLE_INTERVAL,
+                               std::bind(&DBusThreadObject::GetTelemetrySampleIntervalHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_STARTUP_PHASES,
+                               std::bind(&DBusThreadObject::GetStartupPhasesHandler, this, _1));
 
     SuccessOrExit(error = Signal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SIGNAL_READY, std::make_tuple()));
 
@@ -1464,6 +1478,181 @@ exit:
 #endif
 }
 
+void DBusThreadObject::GetTelemetrySamplesHandler(DBusRequest &aRequest)
+{
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    using TelemetrySampler = agent::TelemetrySampler;
+
+    otError                                    error = OT_ERROR_NONE;
+    uint64_t                                   since;
+    auto                                       args    = std::tie(since);
+    TelemetrySampler                          &sampler = mNcp->GetThreadHelper()->GetTelemetrySampler();
+    std::vector<TelemetrySampler::DeltaSample> series;
+    std::vector<std::string>                   counterNames;
+    std::vector<TelemetrySample>               samples;
+    uint64_t                                   sequence;
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+    sequence = sampler.GetLatestSequence();
+    sampler.GetDeltaSeries(since, series);
+
+    for (uint8_t i = 0; i < TelemetrySampler::kNumCounters; i++)
+    {
+        counterNames.emplace_back(TelemetrySampler::CounterToString(static_cast<TelemetrySampler::Counter>(i)));
+    }
+
+    for (auto &delta : series)
+    {
+        TelemetrySample sample;
+
+        sample.mSequence  = delta.mSequence;
+        sample.mTimestamp = delta.mTimestamp;
+        sample.mValues    = std::move(delta.mValues);
+        samples.push_back(std::move(sample));
+    }
+
+    aRequest.Reply(std::tie(sequence, counterNames, samples));
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        aRequest.ReplyOtResult(error);
+    }
+#else
+    aRequest.ReplyOtResult(OT_ERROR_NOT_IMPLEMENTED);
+#endif
+}
+
+void DBusThreadObject::GetTelemetryChangedSinceHandler(DBusRequest &aRequest)
+{
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    otError                        error = OT_ERROR_NONE;
+    uint64_t                       since;
+    auto                           args    = std::tie(since);
+    const agent::TelemetrySampler &sampler = mNcp->GetThreadHelper()->GetTelemetrySampler();
+    bool                           changed;
+    uint64_t                       sequence;
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+    changed  = sampler.HasChangedSince(since);
+    sequence = sampler.GetLatestSequence();
+    aRequest.Reply(std::tie(changed, sequence));
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        aRequest.ReplyOtResult(error);
+    }
+#else
+    aRequest.ReplyOtResult(OT_ERROR_NOT_IMPLEMENTED);
+#endif
+}
+
+void DBusThreadObject::GetTelemetryDataSectionsHandler(DBusRequest &aRequest)
+{
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    otError                      error = OT_ERROR_NONE;
+    uint32_t                     sections;
+    auto                         args = std::tie(sections);
+    threadnetwork::TelemetryData telemetryData;
+
+    using ThreadHelper = agent::ThreadHelper;
+
+    static_assert(OTBR_DBUS_TELEMETRY_SECTION_WPAN_STATS == ThreadHelper::kTelemetrySectionWpanStats &&
+                      OTBR_DBUS_TELEMETRY_SECTION_WPAN_TOPO_FULL == ThreadHelper::kTelemetrySectionWpanTopoFull &&
+                      OTBR_DBUS_TELEMETRY_SECTION_TOPO_ENTRIES == ThreadHelper::kTelemetrySectionTopoEntries &&
+                      OTBR_DBUS_TELEMETRY_SECTION_WPAN_BORDER_ROUTER ==
+                          ThreadHelper::kTelemetrySectionWpanBorderRouter &&
+                      OTBR_DBUS_TELEMETRY_SECTION_WPAN_RCP == ThreadHelper::kTelemetrySectionWpanRcp &&
+                      OTBR_DBUS_TELEMETRY_SECTION_COEX_METRICS == ThreadHelper::kTelemetrySectionCoexMetrics &&
+                      OTBR_DBUS_TELEMETRY_SECTION_LOW_POWER_METRICS == ThreadHelper::kTelemetrySectionLowPowerMetrics,
+                  "D-Bus telemetry section bits don't match ThreadHelper::TelemetrySection");
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+    if (mNcp->GetThreadHelper()->RetrieveTelemetryData(mPublisher, telemetryData, sections) != OT_ERROR_NONE)
+    {
+        otbrLogWarning("Some metrics were not populated in RetrieveTelemetryData");
+    }
+
+    {
+        const std::string    telemetryDataBytes = telemetryData.SerializeAsString();
+        std::vector<uint8_t> data(telemetryDataBytes.begin(), telemetryDataBytes.end());
+
+        aRequest.Reply(std::tie(data));
+    }
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        aRequest.ReplyOtResult(error);
+    }
+#else
+    aRequest.ReplyOtResult(OT_ERROR_NOT_IMPLEMENTED);
+#endif
+}
+
+otError DBusThreadObject::SetTelemetrySampleIntervalHandler(DBusMessageIter &aIter)
+{
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    otError  error = OT_ERROR_NONE;
+    uint32_t intervalMs;
+
+    VerifyOrExit(DBusMessageExtractFromVariant(&aIter, intervalMs) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(mNcp->GetThreadHelper()->GetTelemetrySampler().SetInterval(Milliseconds(intervalMs)) ==
+                     OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+#else
+    OTBR_UNUSED_VARIABLE(aIter);
+
+    return OT_ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+otError DBusThreadObject::GetTelemetrySampleIntervalHandler(DBusMessageIter &aIter)
+{
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    otError  error = OT_ERROR_NONE;
+    uint32_t intervalMs =
+        static_cast<uint32_t>(mNcp->GetThreadHelper()->GetTelemetrySampler().GetInterval().count());
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, intervalMs) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+#else
+    OTBR_UNUSED_VARIABLE(aIter);
+
+    return OT_ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+otError DBusThreadObject::GetStartupPhasesHandler(DBusMessageIter &aIter)
+{
+    otError                   error = OT_ERROR_NONE;
+    std::vector<StartupPhase> phases;
+
+    for (const StartupProfiler::Phase &phase : mStartupProfiler->GetPhases())
+    {
+        StartupPhase startupPhase;
+
+        startupPhase.mName      = phase.mName;
+        startupPhase.mStartTime = static_cast<uint32_t>(phase.mStartTime.count());
+        startupPhase.mDuration  = static_cast<uint32_t>(phase.mDuration.count());
+        phases.push_back(startupPhase);
+    }
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, phases) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
 otError DBusThreadObject::GetCapabilitiesHandler(DBusMessageIter &aIter)
 {
     otError            error = OT_ERROR_NONE;
@@ -40,6 +40,7 @@
 
 #include <openthread/link.h>
 
+#include "common/startup_profiler.hpp"
 #include "dbus/server/dbus_object.hpp"
 #include "mdns/mdns.hpp"
 #include "ncp/ncp_openthread.hpp"
@@ -69,13 +70,15 @@ public:
      * @param[in] aConnection     The dbus connection.
      * @param[in] aInterfaceName  The dbus interface name.
      * @param[in] aNcp            The ncp controller
-     * @param[in] aPublisher      The Mdns::Publisher
+     * @param[in] aPublisher        The Mdns::Publisher
+     * @param[in] aStartupProfiler  The profiler of the agent startup phases.
      *
      */
     DBusThreadObject(DBusConnection                  *aConnection,
                      const std::string               &aInterfaceName,
                      otbr::Ncp::ControllerOpenThread *aNcp,
-                     Mdns::Publisher                 *aPublisher);
+                     Mdns::Publisher                 *aPublisher,
+                     const StartupProfiler           *aStartupProfiler);
 
     otbrError Init(void) override;
 
@@ -107,6 +110,9 @@ private:
     void GetPropertiesHandler(DBusRequest &aRequest);
     void LeaveNetworkHandler(DBusRequest &aRequest);
     void SetNat64Enabled(DBusRequest &aRequest);
+    void GetTelemetrySamplesHandler(DBusRequest &aRequest);
+    void GetTelemetryChangedSinceHandler(DBusRequest &aRequest);
+    void GetTelemetryDataSectionsHandler(DBusRequest &aRequest);
 
     void IntrospectHandler(DBusRequest &aRequest);
 
@@ -118,6 +124,7 @@ private:
     otError SetRadioRegionHandler(DBusMessageIter &aIter);
     otError SetDnsUpstreamQueryState(DBusMessageIter &aIter);
     otError SetNat64Cidr(DBusMessageIter &aIter);
+    otError SetTelemetrySampleIntervalHandler(DBusMessageIter &aIter);
 
     otError GetLinkModeHandler(DBusMessageIter &aIter);
     otError GetDeviceRoleHandler(DBusMessageIter &aIter);
@@ -174,6 +181,8 @@ private:
     otError GetDnsUpstreamQueryState(DBusMessageIter &aIter);
     otError GetTelemetryDataHandler(DBusMessageIter &aIter);
     otError GetCapabilitiesHandler(DBusMessageIter &aIter);
+    otError GetTelemetrySampleIntervalHandler(DBusMessageIter &aIter);
+    otError GetStartupPhasesHandler(DBusMessageIter &aIter);
 
     void ReplyScanResult(DBusRequest &aRequest, otError aError, const std::vector<otActiveScanResult> &aResult);
     void ReplyEnergyScanResult(DBusRequest &aRequest, otError aError, const std::vector<otEnergyScanResult> &aResult);
@@ -181,6 +190,7 @@ private:
     otbr::Ncp::ControllerOpenThread                     *mNcp;
     std::unordered_map<std::string, PropertyHandlerType> mGetPropertyHandlers;
     otbr::Mdns::Publisher                               *mPublisher;
+    const StartupProfiler                               *mStartupProfiler;
 };
 
 } // namespace DBus
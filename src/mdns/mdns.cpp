@@ -199,24 +199,26 @@ uint64_t Publisher::AddSubscriptionCallbacks(Publisher::DiscoveredServiceInstanc
     uint64_t id = mNextSubscriberId++;
 
     assert(id > 0);
-    mDiscoverCallbacks.emplace_back(id, aInstanceCallback, aHostCallback);
+    mDiscoverCallbacks.emplace_back(id, std::move(aInstanceCallback), std::move(aHostCallback));
 
     return id;
 }
 
-void Publisher::OnServiceResolved(std::string aType, DiscoveredInstanceInfo aInstanceInfo)
+void Publisher::OnServiceResolved(std::string aType, DiscoveredInstanceInfoPtr aInstanceInfo)
 {
-    bool checkToInvoke = false;
+    // Holding `aInstanceInfo` keeps the information alive even if its owner is freed by a callback.
+    const DiscoveredInstanceInfo &instanceInfo  = *aInstanceInfo;
+    bool                          checkToInvoke = false;
 
     otbrLogInfo("Service %s is resolved successfully: %s %s host %s addresses %zu", aType.c_str(),
-                aInstanceInfo.mRemoved ? "remove" : "add", aInstanceInfo.mName.c_str(), aInstanceInfo.mHostName.c_str(),
-                aInstanceInfo.mAddresses.size());
+                instanceInfo.mRemoved ? "remove" : "add", instanceInfo.mName.c_str(), instanceInfo.mHostName.c_str(),
+                instanceInfo.mAddresses.size());
 
-    if (!aInstanceInfo.mRemoved)
+    if (!instanceInfo.mRemoved)
     {
         std::string addressesString;
 
-        for (const auto &address : aInstanceInfo.mAddresses)
+        for (const auto &address : instanceInfo.mAddresses)
         {
             addressesString += address.ToString() + ",";
         }
@@ -229,15 +231,15 @@ void Publisher::OnServiceResolved(std::string aType, DiscoveredInstanceInfo aIns
 
     DnsUtils::CheckServiceNameSanity(aType);
 
-    assert(aInstanceInfo.mNetifIndex > 0);
+    assert(instanceInfo.mNetifIndex > 0);
 
-    if (!aInstanceInfo.mRemoved)
+    if (!instanceInfo.mRemoved)
     {
-        DnsUtils::CheckHostnameSanity(aInstanceInfo.mHostName);
+        DnsUtils::CheckHostnameSanity(instanceInfo.mHostName);
     }
 
     UpdateMdnsResponseCounters(mTelemetryInfo.mServiceResolutions, OTBR_ERROR_NONE);
-    UpdateServiceInstanceResolutionEmaLatency(aInstanceInfo.mName, aType, OTBR_ERROR_NONE);
+    UpdateServiceInstanceResolutionEmaLatency(instanceInfo.mName, aType, OTBR_ERROR_NONE);
 
     // The `mDiscoverCallbacks` list can get updated as the callbacks
     // are invoked. We first mark `mShouldInvoke` on all non-null
@@ -264,7 +266,7 @@ void Publisher::OnServiceResolved(std::string aType, DiscoveredInstanceInfo aIns
             {
                 callback.mShouldInvoke = false;
                 checkToInvoke          = true;
-                callback.mServiceCallback(aType, aInstanceInfo);
+                callback.mServiceCallback(aType, instanceInfo);
                 break;
             }
         }
@@ -273,27 +275,29 @@ void Publisher::OnServiceResolved(std::string aType, DiscoveredInstanceInfo aIns
 
 void Publisher::OnServiceRemoved(uint32_t aNetifIndex, std::string aType, std::string aInstanceName)
 {
-    DiscoveredInstanceInfo instanceInfo;
+    std::shared_ptr<DiscoveredInstanceInfo> instanceInfo = std::make_shared<DiscoveredInstanceInfo>();
 
     otbrLogInfo("Service %s.%s is removed from netif %u.", aInstanceName.c_str(), aType.c_str(), aNetifIndex);
 
-    instanceInfo.mRemoved    = true;
-    instanceInfo.mNetifIndex = aNetifIndex;
-    instanceInfo.mName       = aInstanceName;
+    instanceInfo->mRemoved    = true;
+    instanceInfo->mNetifIndex = aNetifIndex;
+    instanceInfo->mName       = std::move(aInstanceName);
 
-    OnServiceResolved(aType, instanceInfo);
+    OnServiceResolved(std::move(aType), std::move(instanceInfo));
 }
 
-void Publisher::OnHostResolved(std::string aHostName, Publisher::DiscoveredHostInfo aHostInfo)
+void Publisher::OnHostResolved(std::string aHostName, Publisher::DiscoveredHostInfoPtr aHostInfo)
 {
-    bool checkToInvoke = false;
+    // Holding `aHostInfo` keeps the information alive even if its owner is freed by a callback.
+    const DiscoveredHostInfo &hostInfo      = *aHostInfo;
+    bool                      checkToInvoke = false;
 
     otbrLogInfo("Host %s is resolved successfully: host %s addresses %zu ttl %u", aHostName.c_str(),
-                aHostInfo.mHostName.c_str(), aHostInfo.mAddresses.size(), aHostInfo.mTtl);
+                hostInfo.mHostName.c_str(), hostInfo.mAddresses.size(), hostInfo.mTtl);
 
-    if (!aHostInfo.mHostName.empty())
+    if (!hostInfo.mHostName.empty())
     {
-        DnsUtils::CheckHostnameSanity(aHostInfo.mHostName);
+        DnsUtils::CheckHostnameSanity(hostInfo.mHostName);
     }
 
     UpdateMdnsResponseCounters(mTelemetryInfo.mHostResolutions, OTBR_ERROR_NONE);
@@ -324,7 +328,7 @@ void Publisher::OnHostResolved(std::string aHostName, Publisher::DiscoveredHostI
             {
                 callback.mShouldInvoke = false;
                 checkToInvoke          = true;
-                callback.mHostCallback(aHostName, aHostInfo);
+                callback.mHostCallback(aHostName, hostInfo);
                 break;
             }
         }
@@ -37,7 +37,7 @@
 #include "openthread-br/config.h"
 
 #ifndef OTBR_ENABLE_MDNS
-#define OTBR_ENABLE_MDNS (OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD)
+#define OTBR_ENABLE_MDNS (OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_NATIVE)
 #endif
 
 #include <functional>
@@ -161,6 +161,22 @@ public:
         void RemoveAddress(const Ip6Address &aAddress) { Publisher::RemoveAddress(mAddresses, aAddress); }
     };
 
+    /**
+     * This type represents a shared, immutable discovered service instance.
+     *
+     * A discovered service instance is built once by the mDNS implementation and shared with all subscribers.
+     *
+     */
+    typedef std::shared_ptr<const DiscoveredInstanceInfo> DiscoveredInstanceInfoPtr;
+
+    /**
+     * This type represents a shared, immutable discovered host.
+     *
+     * A discovered host is built once by the mDNS implementation and shared with all subscribers.
+     *
+     */
+    typedef std::shared_ptr<const DiscoveredHostInfo> DiscoveredHostInfoPtr;
+
     /**
      * This function is called to notify a discovered service instance.
      *
@@ -387,12 +403,16 @@ public:
     /**
      * This function creates a mDNS publisher.
      *
-     * @param[in] aCallback  The callback for receiving mDNS publisher state changes.
+     * Publishers backed by a system mDNS daemon follow the interface configuration of the daemon and ignore
+     * @p aInterfaceName.
+     *
+     * @param[in] aCallback       The callback for receiving mDNS publisher state changes.
+     * @param[in] aInterfaceName  The network interface to publish on, empty for all interfaces.
      *
      * @returns A pointer to the newly created mDNS publisher.
      *
      */
-    static Publisher *Create(StateCallback aCallback);
+    static Publisher *Create(StateCallback aCallback, const std::string &aInterfaceName = "");
 
     /**
      * This function destroys the mDNS publisher.
@@ -602,12 +622,29 @@ protected:
     ServiceRegistration *FindServiceRegistration(const std::string &aName, const std::string &aType);
     ServiceRegistration *FindServiceRegistration(const std::string &aNameAndType);
 
-    void OnServiceResolved(std::string aType, DiscoveredInstanceInfo aInstanceInfo);
+    void OnServiceResolved(std::string aType, DiscoveredInstanceInfoPtr aInstanceInfo);
     void OnServiceResolveFailed(std::string aType, std::string aInstanceName, int32_t aErrorCode);
     void OnServiceRemoved(uint32_t aNetifIndex, std::string aType, std::string aInstanceName);
-    void OnHostResolved(std::string aHostName, DiscoveredHostInfo aHostInfo);
+    void OnHostResolved(std::string aHostName, DiscoveredHostInfoPtr aHostInfo);
     void OnHostResolveFailed(std::string aHostName, int32_t aErrorCode);
 
+    // Returns a discovered service instance or host which the mDNS implementation can update in place.
+    // The information is copied first if it is still shared with subscribers, so that they never see
+    // it change.
+    template <typename InfoType> static InfoType &GetMutableInfo(std::shared_ptr<InfoType> &aInfo)
+    {
+        if (aInfo == nullptr)
+        {
+            aInfo = std::make_shared<InfoType>();
+        }
+        else if (aInfo.use_count() > 1)
+        {
+            aInfo = std::make_shared<InfoType>(*aInfo);
+        }
+
+        return *aInfo;
+    }
+
     // Handles the cases that there is already a registration for the same service.
     // If the returned callback is completed, current registration should be considered
     // success and no further action should be performed.
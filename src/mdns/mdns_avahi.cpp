@@ -1113,8 +1113,10 @@ exit:
     return;
 }
 
-Publisher *Publisher::Create(StateCallback aStateCallback)
+Publisher *Publisher::Create(StateCallback aStateCallback, const std::string &aInterfaceName)
 {
+    OTBR_UNUSED_VARIABLE(aInterfaceName);
+
     return new PublisherAvahi(std::move(aStateCallback));
 }
 
@@ -1277,9 +1279,10 @@ void PublisherAvahi::ServiceResolver::HandleResolveServiceResult(AvahiServiceRes
     OT_UNUSED_VARIABLE(aDomain);
     OT_UNUSED_VARIABLE(aAddress);
 
-    size_t totalTxtSize = 0;
-    bool   resolved     = false;
-    int    avahiError   = AVAHI_OK;
+    DiscoveredInstanceInfo &instanceInfo = GetMutableInfo(mInstanceInfo);
+    size_t                  totalTxtSize = 0;
+    bool                    resolved     = false;
+    int                     avahiError   = AVAHI_OK;
 
     otbrLog(aEvent == AVAHI_RESOLVER_FOUND ? OTBR_LOG_INFO : OTBR_LOG_WARNING, OTBR_LOG_TAG,
             "Resolve service reply: protocol %d %s.%s.%s = host %s port %" PRIu16 " flags %d event %d", aProtocol,
@@ -1288,23 +1291,23 @@ void PublisherAvahi::ServiceResolver::HandleResolveServiceResult(AvahiServiceRes
     VerifyOrExit(aEvent == AVAHI_RESOLVER_FOUND, avahiError = avahi_client_errno(mPublisherAvahi->mClient));
     VerifyOrExit(aHostName != nullptr, avahiError = AVAHI_ERR_INVALID_HOST_NAME);
 
-    mInstanceInfo.mNetifIndex = static_cast<uint32_t>(aInterfaceIndex);
-    mInstanceInfo.mName       = aName;
-    mInstanceInfo.mHostName   = std::string(aHostName) + ".";
-    mInstanceInfo.mPort       = aPort;
+    instanceInfo.mNetifIndex = static_cast<uint32_t>(aInterfaceIndex);
+    instanceInfo.mName.assign(aName);
+    instanceInfo.mHostName.assign(aHostName).push_back('.');
+    instanceInfo.mPort = aPort;
 
     otbrLogInfo("Resolve service reply: flags=%u, host=%s", aFlags, aHostName);
 
     // TODO priority
     // TODO weight
     // TODO use a more proper TTL
-    mInstanceInfo.mTtl = kDefaultTtl;
+    instanceInfo.mTtl = kDefaultTtl;
     for (auto p = aTxt; p; p = avahi_string_list_get_next(p))
     {
         totalTxtSize += avahi_string_list_get_size(p) + 1;
     }
-    mInstanceInfo.mTxtData.resize(totalTxtSize);
-    avahi_string_list_serialize(aTxt, mInstanceInfo.mTxtData.data(), totalTxtSize);
+    instanceInfo.mTxtData.resize(totalTxtSize);
+    avahi_string_list_serialize(aTxt, instanceInfo.mTxtData.data(), totalTxtSize);
 
     // NOTE: Avahi only returns one of the host's addresses in the service resolution callback. However, the address may
     // be link-local so it may not be preferred from Thread's perspective. We want to go through the complete list of
@@ -1322,7 +1325,7 @@ exit:
         {
             avahi_record_browser_free(mRecordBrowser);
             mRecordBrowser = nullptr;
-            mInstanceInfo.mAddresses.clear();
+            instanceInfo.mAddresses.clear();
         }
         // NOTE: This `ServiceResolver` object may be freed in `OnServiceResolved`.
         mRecordBrowser = avahi_record_browser_new(mPublisherAvahi->mClient, aInterfaceIndex, AVAHI_PROTO_UNSPEC,
@@ -1375,9 +1378,10 @@ void PublisherAvahi::ServiceResolver::HandleResolveHostResult(AvahiRecordBrowser
     OTBR_UNUSED_VARIABLE(aType);
     OTBR_UNUSED_VARIABLE(aFlags);
 
-    Ip6Address address;
-    bool       resolved   = false;
-    int        avahiError = AVAHI_OK;
+    DiscoveredInstanceInfo &instanceInfo = GetMutableInfo(mInstanceInfo);
+    Ip6Address              address;
+    bool                    resolved   = false;
+    int                     avahiError = AVAHI_OK;
 
     otbrLog(aEvent != AVAHI_BROWSER_FAILURE ? OTBR_LOG_INFO : OTBR_LOG_WARNING, OTBR_LOG_TAG,
             "Resolve host reply: %s inf %d protocol %d class %" PRIu16 " type %" PRIu16 " size %zu flags %d event %d",
@@ -1397,11 +1401,11 @@ void PublisherAvahi::ServiceResolver::HandleResolveHostResult(AvahiRecordBrowser
                 address.ToString().c_str());
     if (aEvent == AVAHI_BROWSER_NEW)
     {
-        mInstanceInfo.AddAddress(address);
+        instanceInfo.AddAddress(address);
     }
     else
     {
-        mInstanceInfo.RemoveAddress(address);
+        instanceInfo.RemoveAddress(address);
     }
     resolved = true;
 
@@ -1413,7 +1417,7 @@ exit:
     }
     else if (avahiError != AVAHI_OK)
     {
-        mPublisherAvahi->OnServiceResolveFailed(mType, mInstanceInfo.mName, avahiError);
+        mPublisherAvahi->OnServiceResolveFailed(mType, instanceInfo.mName, avahiError);
     }
 }
 
@@ -1506,9 +1510,10 @@ void PublisherAvahi::HostSubscription::HandleResolveResult(AvahiRecordBrowser
     OTBR_UNUSED_VARIABLE(aType);
     OTBR_UNUSED_VARIABLE(aFlags);
 
-    Ip6Address address;
-    bool       resolved   = false;
-    int        avahiError = AVAHI_OK;
+    DiscoveredHostInfo &hostInfo = GetMutableInfo(mHostInfo);
+    Ip6Address          address;
+    bool                resolved   = false;
+    int                 avahiError = AVAHI_OK;
 
     otbrLog(aEvent != AVAHI_BROWSER_FAILURE ? OTBR_LOG_INFO : OTBR_LOG_WARNING, OTBR_LOG_TAG,
             "Resolve host reply: %s inf %d protocol %d class %" PRIu16 " type %" PRIu16 " size %zu flags %d event %d",
@@ -1527,19 +1532,19 @@ void PublisherAvahi::HostSubscription::HandleResolveResult(AvahiRecordBrowser
     otbrLogInfo("Resolved host address: %s %s", aEvent == AVAHI_BROWSER_NEW ? "add" : "remove",
                 address.ToString().c_str());
 
-    mHostInfo.mHostName = std::string(aName) + ".";
+    hostInfo.mHostName.assign(aName).push_back('.');
     if (aEvent == AVAHI_BROWSER_NEW)
     {
-        mHostInfo.AddAddress(address);
+        hostInfo.AddAddress(address);
     }
     else
     {
-        mHostInfo.RemoveAddress(address);
+        hostInfo.RemoveAddress(address);
     }
-    mHostInfo.mNetifIndex = static_cast<uint32_t>(aInterfaceIndex);
+    hostInfo.mNetifIndex = static_cast<uint32_t>(aInterfaceIndex);
     // TODO: Use a more proper TTL
-    mHostInfo.mTtl = kDefaultTtl;
-    resolved       = true;
+    hostInfo.mTtl = kDefaultTtl;
+    resolved      = true;
 
 exit:
     if (resolved)
@@ -227,9 +227,9 @@ private:
                                  size_t                 aSize,
                                  AvahiLookupResultFlags aFlags);
 
-        std::string         mHostName;
-        DiscoveredHostInfo  mHostInfo;
-        AvahiRecordBrowser *mRecordBrowser;
+        std::string                         mHostName;
+        std::shared_ptr<DiscoveredHostInfo> mHostInfo;
+        AvahiRecordBrowser                 *mRecordBrowser;
     };
 
     struct ServiceResolver
@@ -296,11 +296,11 @@ private:
                                      size_t                 aSize,
                                      AvahiLookupResultFlags aFlags);
 
-        std::string            mType;
-        PublisherAvahi        *mPublisherAvahi;
-        AvahiServiceResolver  *mServiceResolver = nullptr;
-        AvahiRecordBrowser    *mRecordBrowser   = nullptr;
-        DiscoveredInstanceInfo mInstanceInfo;
+        std::string                             mType;
+        PublisherAvahi                         *mPublisherAvahi;
+        AvahiServiceResolver                   *mServiceResolver = nullptr;
+        AvahiRecordBrowser                     *mRecordBrowser   = nullptr;
+        std::shared_ptr<DiscoveredInstanceInfo> mInstanceInfo;
     };
     struct ServiceSubscription : public Subscription
     {
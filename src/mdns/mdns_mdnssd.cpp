@@ -1008,8 +1008,10 @@ exit:
     return;
 }
 
-Publisher *Publisher::Create(StateCallback aCallback)
+Publisher *Publisher::Create(StateCallback aCallback, const std::string &aInterfaceName)
 {
+    OTBR_UNUSED_VARIABLE(aInterfaceName);
+
     return new PublisherMDnsSd(aCallback);
 }
 
@@ -1189,24 +1191,24 @@ void PublisherMDnsSd::ServiceInstanceResolution::HandleResolveResult(DNSServiceR
 {
     OTBR_UNUSED_VARIABLE(aServiceRef);
 
-    std::string instanceName, type, domain;
-    otbrError   error = OTBR_ERROR_NONE;
+    DiscoveredInstanceInfo &instanceInfo = GetMutableInfo(mInstanceInfo);
+    std::string             type, domain;
+    otbrError               error = OTBR_ERROR_NONE;
 
     otbrLogInfo("DNSServiceResolve reply: %s host %s:%d, TXT=%dB inf %u, flags=%u", aFullName, aHostTarget, aPort,
                 aTxtLen, aInterfaceIndex, aFlags);
 
     VerifyOrExit(aErrorCode == kDNSServiceErr_NoError);
 
-    SuccessOrExit(error = SplitFullServiceInstanceName(aFullName, instanceName, type, domain));
+    SuccessOrExit(error = SplitFullServiceInstanceName(aFullName, instanceInfo.mName, type, domain));
 
-    mInstanceInfo.mNetifIndex = aInterfaceIndex;
-    mInstanceInfo.mName       = instanceName;
-    mInstanceInfo.mHostName   = aHostTarget;
-    mInstanceInfo.mPort       = ntohs(aPort);
-    mInstanceInfo.mTxtData.assign(aTxtRecord, aTxtRecord + aTxtLen);
+    instanceInfo.mNetifIndex = aInterfaceIndex;
+    instanceInfo.mHostName.assign(aHostTarget);
+    instanceInfo.mPort = ntohs(aPort);
+    instanceInfo.mTxtData.assign(aTxtRecord, aTxtRecord + aTxtLen);
     // priority and weight are not given in the reply
-    mInstanceInfo.mPriority = 0;
-    mInstanceInfo.mWeight   = 0;
+    instanceInfo.mPriority = 0;
+    instanceInfo.mWeight   = 0;
 
     DeallocateServiceRef();
     error = GetAddrInfo(aInterfaceIndex);
@@ -1230,11 +1232,11 @@ otbrError PublisherMDnsSd::ServiceInstanceResolution::GetAddrInfo(uint32_t aInte
 
     assert(mServiceRef == nullptr);
 
-    otbrLogInfo("DNSServiceGetAddrInfo %s inf %d", mInstanceInfo.mHostName.c_str(), aInterfaceIndex);
+    otbrLogInfo("DNSServiceGetAddrInfo %s inf %d", mInstanceInfo->mHostName.c_str(), aInterfaceIndex);
 
     dnsError = DNSServiceGetAddrInfo(&mServiceRef, /* flags */ 0, aInterfaceIndex,
                                      kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4,
-                                     mInstanceInfo.mHostName.c_str(), HandleGetAddrInfoResult, this);
+                                     mInstanceInfo->mHostName.c_str(), HandleGetAddrInfoResult, this);
 
     if (dnsError != kDNSServiceErr_NoError)
     {
@@ -1268,8 +1270,9 @@ void PublisherMDnsSd::ServiceInstanceResolution::HandleGetAddrInfoResult(DNSServ
     OTBR_UNUSED_VARIABLE(aServiceRef);
     OTBR_UNUSED_VARIABLE(aInterfaceIndex);
 
-    Ip6Address address;
-    bool       isAdd = (aFlags & kDNSServiceFlagsAdd) != 0;
+    DiscoveredInstanceInfo &instanceInfo = GetMutableInfo(mInstanceInfo);
+    Ip6Address              address;
+    bool                    isAdd = (aFlags & kDNSServiceFlagsAdd) != 0;
 
     otbrLog(aErrorCode == kDNSServiceErr_NoError ? OTBR_LOG_INFO : OTBR_LOG_WARNING, OTBR_LOG_TAG,
             "DNSServiceGetAddrInfo reply: flags=%" PRIu32 ", host=%s, sa_family=%u, error=%" PRId32, aFlags, aHostName,
@@ -1287,16 +1290,16 @@ void PublisherMDnsSd::ServiceInstanceResolution::HandleGetAddrInfoResult(DNSServ
 
     if (isAdd)
     {
-        mInstanceInfo.AddAddress(address);
+        instanceInfo.AddAddress(address);
     }
     else
     {
-        mInstanceInfo.RemoveAddress(address);
+        instanceInfo.RemoveAddress(address);
     }
-    mInstanceInfo.mTtl = aTtl;
+    instanceInfo.mTtl = aTtl;
 
 exit:
-    if (!mInstanceInfo.mAddresses.empty() || aErrorCode != kDNSServiceErr_NoError)
+    if (!instanceInfo.mAddresses.empty() || aErrorCode != kDNSServiceErr_NoError)
     {
         FinishResolution();
     }
@@ -1304,12 +1307,9 @@ exit:
 
 void PublisherMDnsSd::ServiceInstanceResolution::FinishResolution(void)
 {
-    ServiceSubscription   *subscription = mSubscription;
-    std::string            serviceName  = mSubscription->mType;
-    DiscoveredInstanceInfo instanceInfo = mInstanceInfo;
-
-    // NOTE: The `ServiceSubscription` object may be freed in `OnServiceResolved`.
-    subscription->mPublisher.OnServiceResolved(serviceName, instanceInfo);
+    // NOTE: The `ServiceSubscription` object may be freed in `OnServiceResolved`, the arguments are copied
+    // before that and `mInstanceInfo` stays alive while it is shared with subscribers.
+    mSubscription->mPublisher.OnServiceResolved(mSubscription->mType, mInstanceInfo);
 }
 
 void PublisherMDnsSd::HostSubscription::Resolve(void)
@@ -1350,8 +1350,9 @@ void PublisherMDnsSd::HostSubscription::HandleResolveResult(DNSServiceRef
 {
     OTBR_UNUSED_VARIABLE(aServiceRef);
 
-    Ip6Address address;
-    bool       isAdd = (aFlags & kDNSServiceFlagsAdd) != 0;
+    DiscoveredHostInfo &hostInfo = GetMutableInfo(mHostInfo);
+    Ip6Address          address;
+    bool                isAdd = (aFlags & kDNSServiceFlagsAdd) != 0;
 
     otbrLog(aErrorCode == kDNSServiceErr_NoError ? OTBR_LOG_INFO : OTBR_LOG_WARNING, OTBR_LOG_TAG,
             "DNSServiceGetAddrInfo reply: flags=%" PRIu32 ", host=%s, sa_family=%u, error=%" PRId32, aFlags, aHostName,
@@ -1369,15 +1370,15 @@ void PublisherMDnsSd::HostSubscription::HandleResolveResult(DNSServiceRef
 
     if (isAdd)
     {
-        mHostInfo.AddAddress(address);
+        hostInfo.AddAddress(address);
     }
     else
     {
-        mHostInfo.RemoveAddress(address);
+        hostInfo.RemoveAddress(address);
     }
-    mHostInfo.mHostName   = aHostName;
-    mHostInfo.mNetifIndex = aInterfaceIndex;
-    mHostInfo.mTtl        = aTtl;
+    hostInfo.mHostName.assign(aHostName);
+    hostInfo.mNetifIndex = aInterfaceIndex;
+    hostInfo.mTtl        = aTtl;
 
     // NOTE: This `HostSubscription` object may be freed in `OnHostResolved`.
     mPublisher.OnHostResolved(mHostName, mHostInfo);
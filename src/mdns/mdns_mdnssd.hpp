@@ -266,12 +266,12 @@ private:
                                             const struct sockaddr *aAddress,
                                             uint32_t               aTtl);
 
-        ServiceSubscription   *mSubscription;
-        std::string            mInstanceName;
-        std::string            mType;
-        std::string            mDomain;
-        uint32_t               mNetifIndex;
-        DiscoveredInstanceInfo mInstanceInfo;
+        ServiceSubscription                    *mSubscription;
+        std::string                             mInstanceName;
+        std::string                             mType;
+        std::string                             mDomain;
+        uint32_t                                mNetifIndex;
+        std::shared_ptr<DiscoveredInstanceInfo> mInstanceInfo;
     };
 
     struct ServiceSubscription : public ServiceRef
@@ -338,8 +338,8 @@ private:
                                         const struct sockaddr *aAddress,
                                         uint32_t               aTtl);
 
-        std::string        mHostName;
-        DiscoveredHostInfo mHostInfo;
+        std::string                         mHostName;
+        std::shared_ptr<DiscoveredHostInfo> mHostInfo;
     };
 
     using ServiceSubscriptionList = std::vector<std::unique_ptr<ServiceSubscription>>;
@@ -0,0 +1,2410 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the built-in mDNS publisher.
+ */
+
+#define OTBR_LOG_TAG "MDNS"
+
+#include "mdns/mdns_native.hpp"
+
+#include <algorithm>
+#include <functional>
+
+#include <arpa/inet.h>
+#include <ctype.h>
+#include <errno.h>
+#include <ifaddrs.h>
+#include <limits.h>
+#include <net/if.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+namespace {
+
+constexpr uint16_t kFlagResponse         = 0x8000;
+constexpr uint16_t kFlagAuthoritative    = 0x0400;
+constexpr uint16_t kClassIn              = 1;
+constexpr uint16_t kClassAny             = 255;
+constexpr uint16_t kClassMask            = 0x7fff;
+constexpr uint16_t kClassFlag            = 0x8000; // The QU bit of questions and the cache-flush bit of records.
+constexpr size_t   kHeaderSize           = 12;
+constexpr size_t   kMaxLabelLength       = 63;
+constexpr size_t   kMaxNameLength        = 255;
+constexpr size_t   kMaxReceiveSize       = 9000; // See RFC 6762 section 17.
+constexpr uint8_t  kCompressionFlag      = 0xc0;
+constexpr uint16_t kMaxCompressionOffset = 0x3fff;
+constexpr uint8_t  kMaxCompressionJumps  = 16;
+constexpr uint8_t  kMaxRefreshQueries    = 4;
+
+constexpr Milliseconds kProbeInterval(250);
+constexpr Milliseconds kProbeDeferDelay(1000);
+constexpr Milliseconds kAnnounceInterval(1000);
+constexpr Milliseconds kCacheFlushDelay(1000);
+constexpr Milliseconds kInitialQueryInterval(1000);
+constexpr Milliseconds kMaxQueryInterval(3600 * 1000);
+constexpr Milliseconds kInterfaceCheckInterval(5000);
+constexpr Milliseconds kOwnMessageLifetime(2000);
+
+const char kMdnsAddress[]  = "ff02::fb";
+const char kServicesName[] = "_services._dns-sd._udp.local";
+
+void AppendUint16(std::vector<uint8_t> &aBuffer, uint16_t aValue)
+{
+    aBuffer.push_back(static_cast<uint8_t>(aValue >> 8));
+    aBuffer.push_back(static_cast<uint8_t>(aValue & 0xff));
+}
+
+void AppendUint32(std::vector<uint8_t> &aBuffer, uint32_t aValue)
+{
+    AppendUint16(aBuffer, static_cast<uint16_t>(aValue >> 16));
+    AppendUint16(aBuffer, static_cast<uint16_t>(aValue & 0xffff));
+}
+
+uint16_t ReadUint16(const uint8_t *aBuffer)
+{
+    return static_cast<uint16_t>((aBuffer[0] << 8) | aBuffer[1]);
+}
+
+uint32_t ReadUint32(const uint8_t *aBuffer)
+{
+    return (static_cast<uint32_t>(ReadUint16(aBuffer)) << 16) | ReadUint16(aBuffer + 2);
+}
+
+std::string ToLower(std::string aName)
+{
+    for (char &c : aName)
+    {
+        c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+    }
+
+    return aName;
+}
+
+// DNS names are compared case-insensitively, see RFC 6762 section 16.
+bool NameEquals(const std::string &aName, const std::string &aOther)
+{
+    return aName.size() == aOther.size() &&
+           std::equal(aName.begin(), aName.end(), aOther.begin(), [](char aLeft, char aRight) {
+               return tolower(static_cast<unsigned char>(aLeft)) == tolower(static_cast<unsigned char>(aRight));
+           });
+}
+
+void AppendLabel(std::string &aName, const std::string &aLabel)
+{
+    size_t length = std::min(aLabel.size(), kMaxLabelLength);
+
+    aName.push_back(static_cast<char>(length));
+    aName.append(aLabel, 0, length);
+}
+
+// Converts a dot-separated name to uncompressed DNS wire format.
+std::string DottedToWire(const std::string &aName)
+{
+    std::string name;
+    size_t      start = 0;
+
+    while (start < aName.size())
+    {
+        size_t end = aName.find('.', start);
+
+        if (end == std::string::npos)
+        {
+            end = aName.size();
+        }
+
+        if (end > start)
+        {
+            AppendLabel(name, aName.substr(start, end - start));
+        }
+
+        start = end + 1;
+    }
+
+    name.push_back('\0');
+
+    return name;
+}
+
+// Converts a name in uncompressed DNS wire format to a dot-separated name ending with a dot.
+std::string WireToDotted(const std::string &aName)
+{
+    std::string name;
+    size_t      offset = 0;
+
+    while (offset < aName.size() && aName[offset] != '\0')
+    {
+        size_t length = static_cast<uint8_t>(aName[offset]);
+
+        name.append(aName, offset + 1, length);
+        name.push_back('.');
+        offset += length + 1;
+    }
+
+    return name;
+}
+
+bool SplitFirstLabel(const std::string &aName, std::string &aLabel, std::string &aRest)
+{
+    bool   found  = false;
+    size_t length = aName.empty() ? 0 : static_cast<uint8_t>(aName[0]);
+
+    VerifyOrExit(length > 0 && length + 1 < aName.size());
+
+    aLabel = aName.substr(1, length);
+    aRest  = aName.substr(length + 1);
+    found  = true;
+
+exit:
+    return found;
+}
+
+otbrError ReadName(const uint8_t *aBuffer, size_t aLength, size_t &aOffset, std::string &aName)
+{
+    otbrError error  = OTBR_ERROR_NONE;
+    size_t    offset = aOffset;
+    bool      jumped = false;
+    uint8_t   jumps  = 0;
+
+    aName.clear();
+
+    while (true)
+    {
+        uint8_t length;
+
+        VerifyOrExit(offset < aLength, error = OTBR_ERROR_PARSE);
+        length = aBuffer[offset];
+
+        if ((length & kCompressionFlag) == kCompressionFlag)
+        {
+            VerifyOrExit(offset + 1 < aLength && ++jumps <= kMaxCompressionJumps, error = OTBR_ERROR_PARSE);
+
+            if (!jumped)
+            {
+                aOffset = offset + 2;
+                jumped  = true;
+            }
+
+            offset = static_cast<size_t>(ReadUint16(&aBuffer[offset]) & kMaxCompressionOffset);
+            continue;
+        }
+
+        VerifyOrExit((length & kCompressionFlag) == 0, error = OTBR_ERROR_PARSE);
+        VerifyOrExit(offset + length < aLength && aName.size() + length < kMaxNameLength, error = OTBR_ERROR_PARSE);
+        aName.append(reinterpret_cast<const char *>(&aBuffer[offset]), length + 1);
+        offset += length + 1;
+
+        if (length == 0)
+        {
+            break;
+        }
+    }
+
+    if (!jumped)
+    {
+        aOffset = offset;
+    }
+
+exit:
+    return error;
+}
+
+void WriteName(std::vector<uint8_t> &aBuffer, const std::string &aName, std::map<std::string, uint16_t> &aOffsets)
+{
+    size_t offset = 0;
+
+    while (offset < aName.size() && aName[offset] != '\0')
+    {
+        size_t      length = static_cast<uint8_t>(aName[offset]);
+        std::string suffix = ToLower(aName.substr(offset));
+        auto        it     = aOffsets.find(suffix);
+
+        if (it != aOffsets.end())
+        {
+            AppendUint16(aBuffer, (kCompressionFlag << 8) | it->second);
+            ExitNow();
+        }
+
+        if (aBuffer.size() <= kMaxCompressionOffset)
+        {
+            aOffsets.emplace(std::move(suffix), static_cast<uint16_t>(aBuffer.size()));
+        }
+
+        aBuffer.insert(aBuffer.end(), aName.begin() + offset, aName.begin() + offset + length + 1);
+        offset += length + 1;
+    }
+
+    aBuffer.push_back(0);
+
+exit:
+    return;
+}
+
+bool IsSameInstance(const Publisher::DiscoveredInstanceInfo &aInfo, const Publisher::DiscoveredInstanceInfo &aOther)
+{
+    return aInfo.mRemoved == aOther.mRemoved && aInfo.mNetifIndex == aOther.mNetifIndex &&
+           aInfo.mName == aOther.mName && aInfo.mHostName == aOther.mHostName && aInfo.mAddresses == aOther.mAddresses &&
+           aInfo.mPort == aOther.mPort && aInfo.mPriority == aOther.mPriority && aInfo.mWeight == aOther.mWeight &&
+           aInfo.mTxtData == aOther.mTxtData && aInfo.mTtl == aOther.mTtl;
+}
+
+bool IsSameHost(const Publisher::DiscoveredHostInfo &aInfo, const Publisher::DiscoveredHostInfo &aOther)
+{
+    return aInfo.mHostName == aOther.mHostName && aInfo.mAddresses == aOther.mAddresses &&
+           aInfo.mNetifIndex == aOther.mNetifIndex && aInfo.mTtl == aOther.mTtl;
+}
+
+} // namespace
+
+bool PublisherNative::Record::IsSameAs(const Record &aOther) const
+{
+    return mType == aOther.mType && mData == aOther.mData && NameEquals(mName, aOther.mName);
+}
+
+bool PublisherNative::Message::IsResponse(void) const
+{
+    return (mFlags & kFlagResponse) != 0;
+}
+
+otbrError PublisherNative::Message::Parse(const uint8_t *aBuffer, size_t aLength)
+{
+    otbrError            error  = OTBR_ERROR_NONE;
+    size_t               offset = kHeaderSize;
+    uint16_t             numQuestions;
+    std::vector<Record> *sections[] = {&mAnswers, &mAuthorities, &mAdditionals};
+
+    VerifyOrExit(aLength >= kHeaderSize, error = OTBR_ERROR_PARSE);
+
+    mId          = ReadUint16(&aBuffer[0]);
+    mFlags       = ReadUint16(&aBuffer[2]);
+    numQuestions = ReadUint16(&aBuffer[4]);
+
+    for (uint16_t i = 0; i < numQuestions; i++)
+    {
+        Question question;
+        uint16_t questionClass;
+
+        SuccessOrExit(error = ReadName(aBuffer, aLength, offset, question.mName));
+        VerifyOrExit(offset + 4 <= aLength, error = OTBR_ERROR_PARSE);
+
+        question.mType            = ReadUint16(&aBuffer[offset]);
+        questionClass             = ReadUint16(&aBuffer[offset + 2]);
+        question.mUnicastResponse = (questionClass & kClassFlag) != 0;
+        offset += 4;
+
+        questionClass &= kClassMask;
+        if (questionClass == kClassIn || questionClass == kClassAny)
+        {
+            mQuestions.push_back(std::move(question));
+        }
+    }
+
+    for (uint8_t section = 0; section < 3; section++)
+    {
+        uint16_t numRecords = ReadUint16(&aBuffer[6 + 2 * section]);
+
+        for (uint16_t i = 0; i < numRecords; i++)
+        {
+            Record   record;
+            uint16_t recordClass;
+            uint16_t dataLength;
+            size_t   dataOffset;
+
+            SuccessOrExit(error = ReadName(aBuffer, aLength, offset, record.mName));
+            VerifyOrExit(offset + 10 <= aLength, error = OTBR_ERROR_PARSE);
+
+            record.mType   = ReadUint16(&aBuffer[offset]);
+            recordClass    = ReadUint16(&aBuffer[offset + 2]);
+            record.mTtl    = ReadUint32(&aBuffer[offset + 4]);
+            record.mUnique = (recordClass & kClassFlag) != 0;
+            dataLength     = ReadUint16(&aBuffer[offset + 8]);
+            offset += 10;
+            dataOffset = offset;
+            VerifyOrExit(offset + dataLength <= aLength, error = OTBR_ERROR_PARSE);
+
+            // Domain names in RDATA may be compressed, so they are read into uncompressed form.
+            switch (record.mType)
+            {
+            case kTypePtr:
+            {
+                std::string target;
+
+                SuccessOrExit(error = ReadName(aBuffer, aLength, dataOffset, target));
+                record.mData.assign(target.begin(), target.end());
+                break;
+            }
+
+            case kTypeSrv:
+            {
+                std::string target;
+
+                VerifyOrExit(dataLength > 6, error = OTBR_ERROR_PARSE);
+                dataOffset += 6;
+                SuccessOrExit(error = ReadName(aBuffer, aLength, dataOffset, target));
+                record.mData.assign(&aBuffer[offset], &aBuffer[offset + 6]);
+                record.mData.insert(record.mData.end(), target.begin(), target.end());
+                break;
+            }
+
+            default:
+                record.mData.assign(&aBuffer[offset], &aBuffer[offset + dataLength]);
+                break;
+            }
+
+            offset += dataLength;
+
+            if ((recordClass & kClassMask) == kClassIn)
+            {
+                sections[section]->push_back(std::move(record));
+            }
+        }
+    }
+
+exit:
+    return error;
+}
+
+void PublisherNative::Message::Encode(std::vector<uint8_t> &aBuffer) const
+{
+    std::map<std::string, uint16_t> offsets;
+    const std::vector<Record>      *sections[] = {&mAnswers, &mAuthorities, &mAdditionals};
+
+    aBuffer.clear();
+    AppendUint16(aBuffer, mId);
+    AppendUint16(aBuffer, mFlags);
+    AppendUint16(aBuffer, static_cast<uint16_t>(mQuestions.size()));
+
+    for (const std::vector<Record> *section : sections)
+    {
+        AppendUint16(aBuffer, static_cast<uint16_t>(section->size()));
+    }
+
+    for (const Question &question : mQuestions)
+    {
+        WriteName(aBuffer, question.mName, offsets);
+        AppendUint16(aBuffer, question.mType);
+        AppendUint16(aBuffer, kClassIn | (question.mUnicastResponse ? kClassFlag : 0));
+    }
+
+    for (const std::vector<Record> *section : sections)
+    {
+        for (const Record &record : *section)
+        {
+            size_t lengthOffset;
+            size_t dataLength;
+
+            WriteName(aBuffer, record.mName, offsets);
+            AppendUint16(aBuffer, record.mType);
+            AppendUint16(aBuffer, kClassIn | (record.mUnique ? kClassFlag : 0));
+            AppendUint32(aBuffer, record.mTtl);
+            lengthOffset = aBuffer.size();
+            AppendUint16(aBuffer, 0);
+
+            if (record.mType == kTypePtr)
+            {
+                WriteName(aBuffer, std::string(record.mData.begin(), record.mData.end()), offsets);
+            }
+            else if (record.mType == kTypeSrv && record.mData.size() > 6)
+            {
+                aBuffer.insert(aBuffer.end(), record.mData.begin(), record.mData.begin() + 6);
+                WriteName(aBuffer, std::string(record.mData.begin() + 6, record.mData.end()), offsets);
+            }
+            else
+            {
+                aBuffer.insert(aBuffer.end(), record.mData.begin(), record.mData.end());
+            }
+
+            dataLength               = aBuffer.size() - lengthOffset - 2;
+            aBuffer[lengthOffset]     = static_cast<uint8_t>(dataLength >> 8);
+            aBuffer[lengthOffset + 1] = static_cast<uint8_t>(dataLength & 0xff);
+        }
+    }
+}
+
+size_t PublisherNative::Message::GetSize(void) const
+{
+    size_t                     size       = kHeaderSize;
+    const std::vector<Record> *sections[] = {&mAnswers, &mAuthorities, &mAdditionals};
+
+    // The size without name compression is an upper bound, so the message is only encoded when it may not fit.
+    for (const Question &question : mQuestions)
+    {
+        size += question.mName.size() + 4;
+    }
+
+    for (const std::vector<Record> *section : sections)
+    {
+        for (const Record &record : *section)
+        {
+            size += record.mName.size() + 10 + record.mData.size();
+        }
+    }
+
+    if (size > kMaxMessageSize)
+    {
+        std::vector<uint8_t> buffer;
+
+        Encode(buffer);
+        size = buffer.size();
+    }
+
+    return size;
+}
+
+void PublisherNative::MessageBatch::Append(const Message &aUnit, bool aOptional)
+{
+    VerifyOrExit(mMessages.empty() || !TryAppend(mMessages.back(), aUnit));
+    VerifyOrExit(!aOptional);
+
+    // A unit which does not fit in an empty message is still sent on its own.
+    mMessages.push_back(mTemplate);
+    Merge(mMessages.back(), aUnit);
+
+exit:
+    return;
+}
+
+void PublisherNative::MessageBatch::Merge(Message &aMessage, const Message &aUnit)
+{
+    aMessage.mQuestions.insert(aMessage.mQuestions.end(), aUnit.mQuestions.begin(), aUnit.mQuestions.end());
+    aMessage.mAnswers.insert(aMessage.mAnswers.end(), aUnit.mAnswers.begin(), aUnit.mAnswers.end());
+    aMessage.mAuthorities.insert(aMessage.mAuthorities.end(), aUnit.mAuthorities.begin(), aUnit.mAuthorities.end());
+    aMessage.mAdditionals.insert(aMessage.mAdditionals.end(), aUnit.mAdditionals.begin(), aUnit.mAdditionals.end());
+}
+
+bool PublisherNative::MessageBatch::TryAppend(Message &aMessage, const Message &aUnit)
+{
+    size_t numQuestions   = aMessage.mQuestions.size();
+    size_t numAnswers     = aMessage.mAnswers.size();
+    size_t numAuthorities = aMessage.mAuthorities.size();
+    size_t numAdditionals = aMessage.mAdditionals.size();
+    bool   appended       = true;
+
+    Merge(aMessage, aUnit);
+
+    if (aMessage.GetSize() > kMaxMessageSize)
+    {
+        aMessage.mQuestions.resize(numQuestions);
+        aMessage.mAnswers.resize(numAnswers);
+        aMessage.mAuthorities.resize(numAuthorities);
+        aMessage.mAdditionals.resize(numAdditionals);
+        appended = false;
+    }
+
+    return appended;
+}
+
+PublisherNative::RecordSet::~RecordSet(void)
+{
+    mOwner.RemoveRecordSet(*this);
+}
+
+otbrError PublisherNative::NativeServiceRegistration::Register(void)
+{
+    std::string          instanceName = MakeInstanceName(mName.empty() ? mOwner.mLocalHostName : mName, mType);
+    std::string          typeName     = MakeServiceTypeName(mType);
+    std::string          hostName     = MakeHostName(mHostName.empty() ? mOwner.mLocalHostName : mHostName);
+    std::string          servicesName = DottedToWire(kServicesName);
+    std::vector<uint8_t> instanceData(instanceName.begin(), instanceName.end());
+    std::vector<uint8_t> srvData;
+
+    otbrLogInfo("Registering service %s.%s", mName.c_str(), mType.c_str());
+
+    AppendUint16(srvData, 0); // Priority
+    AppendUint16(srvData, 0); // Weight
+    AppendUint16(srvData, mPort);
+    srvData.insert(srvData.end(), hostName.begin(), hostName.end());
+
+    mRecords.push_back({typeName, kTypePtr, kServiceTtl, false, instanceData});
+
+    for (const std::string &subType : mSubTypeList)
+    {
+        std::string subTypeName;
+
+        AppendLabel(subTypeName, subType);
+        AppendLabel(subTypeName, "_sub");
+        subTypeName += typeName;
+        mRecords.push_back({subTypeName, kTypePtr, kServiceTtl, false, instanceData});
+    }
+
+    mRecords.push_back({servicesName, kTypePtr, kServiceTtl, false, {typeName.begin(), typeName.end()}});
+    mRecords.push_back({instanceName, kTypeSrv, kHostTtl, true, srvData});
+    mRecords.push_back({instanceName, kTypeTxt, kServiceTtl, true, mTxtData.empty() ? TxtData{0} : mTxtData});
+
+    mOwner.AddRecordSet(*this);
+
+    return OTBR_ERROR_NONE;
+}
+
+void PublisherNative::NativeServiceRegistration::HandleProbed(otbrError aError)
+{
+    if (aError == OTBR_ERROR_NONE)
+    {
+        Complete(OTBR_ERROR_NONE);
+    }
+    else
+    {
+        // This frees the registration.
+        mOwner.RemoveServiceRegistration(mName, mType, aError);
+    }
+}
+
+otbrError PublisherNative::NativeHostRegistration::Register(void)
+{
+    std::string hostName = MakeHostName(mName);
+
+    otbrLogInfo("Registering host %s", mName.c_str());
+
+    for (const Ip6Address &address : mAddresses)
+    {
+        mRecords.push_back({hostName, kTypeAaaa, kHostTtl, true, {address.m8, address.m8 + sizeof(address.m8)}});
+    }
+
+    mOwner.AddRecordSet(*this);
+
+    return OTBR_ERROR_NONE;
+}
+
+void PublisherNative::NativeHostRegistration::HandleProbed(otbrError aError)
+{
+    if (aError == OTBR_ERROR_NONE)
+    {
+        Complete(OTBR_ERROR_NONE);
+    }
+    else
+    {
+        // This frees the registration.
+        mOwner.RemoveHostRegistration(mName, aError);
+    }
+}
+
+otbrError PublisherNative::NativeKeyRegistration::Register(void)
+{
+    otbrLogInfo("Registering key %s", mName.c_str());
+
+    mRecords.push_back({MakeKeyName(mName), kTypeKey, kServiceTtl, true, mKeyData});
+    mOwner.AddRecordSet(*this);
+
+    return OTBR_ERROR_NONE;
+}
+
+void PublisherNative::NativeKeyRegistration::HandleProbed(otbrError aError)
+{
+    if (aError == OTBR_ERROR_NONE)
+    {
+        Complete(OTBR_ERROR_NONE);
+    }
+    else
+    {
+        // This frees the registration.
+        mOwner.RemoveKeyRegistration(mName, aError);
+    }
+}
+
+void PublisherNative::LocalHost::HandleProbed(otbrError aError)
+{
+    VerifyOrExit(aError != OTBR_ERROR_NONE);
+
+    // The host name is usually published by another mDNS responder on this device, which also answers for the
+    // services residing on the local host.
+    otbrLogWarning("Local host name %s is in use, its addresses are not published", mOwner.mLocalHostName.c_str());
+    mOwner.RemoveRecordSet(*this);
+    mRecords.clear();
+
+exit:
+    return;
+}
+
+PublisherNative::PublisherNative(StateCallback aCallback, const std::string &aInterfaceName)
+    : mSocket(-1)
+    , mState(State::kIdle)
+    , mStateCallback(std::move(aCallback))
+    , mInterfaceName(aInterfaceName)
+    , mNextRecordSetId(0)
+    , mCacheChanged(false)
+    , mRandom(std::random_device()())
+{
+}
+
+PublisherNative::~PublisherNative(void)
+{
+    Stop();
+}
+
+otbrError PublisherNative::Start(void)
+{
+    otbrError error                       = OTBR_ERROR_NONE;
+    char      hostName[HOST_NAME_MAX + 1] = "";
+
+    VerifyOrExit(mState == State::kIdle);
+    SuccessOrExit(error = OpenSocket());
+
+    gethostname(hostName, sizeof(hostName) - 1);
+    mLocalHostName = hostName;
+    mLocalHostName = mLocalHostName.substr(0, mLocalHostName.find('.'));
+    if (mLocalHostName.empty())
+    {
+        mLocalHostName = "otbr";
+    }
+
+    mLocalHost = MakeUnique<LocalHost>(*this);
+    mState     = State::kReady;
+    UpdateInterfaces();
+
+    otbrLogInfo("Started mDNS publisher with host name %s", mLocalHostName.c_str());
+    mStateCallback(State::kReady);
+
+exit:
+    return error;
+}
+
+bool PublisherNative::IsStarted(void) const
+{
+    return mState == State::kReady;
+}
+
+void PublisherNative::Stop(void)
+{
+    VerifyOrExit(mState == State::kReady);
+
+    // Removing the registrations queues goodbyes for their records, which are sent before closing the socket.
+    mServiceRegistrations.clear();
+    mHostRegistrations.clear();
+    mKeyRegistrations.clear();
+    mLocalHost.reset();
+    SendGoodbyes();
+
+    mSubscribedServices.clear();
+    mSubscribedHosts.clear();
+    mQuestions.clear();
+    mCache.clear();
+    mPendingResponses.clear();
+    mReleasedNames.clear();
+    mSentMessages.clear();
+    mNetifIndexes.clear();
+
+    close(mSocket);
+    mSocket = -1;
+    mState  = State::kIdle;
+
+exit:
+    return;
+}
+
+otbrError PublisherNative::OpenSocket(void)
+{
+    otbrError    error = OTBR_ERROR_MDNS;
+    const int    on    = 1;
+    const int    hops  = 255; // See RFC 6762 section 11.
+    sockaddr_in6 address;
+
+    mSocket = socket(AF_INET6, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, IPPROTO_UDP);
+    VerifyOrExit(mSocket >= 0);
+
+    // Other mDNS queriers on this device may share the port.
+    VerifyOrExit(setsockopt(mSocket, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on)) == 0);
+#ifdef SO_REUSEPORT
+    VerifyOrExit(setsockopt(mSocket, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on)) == 0);
+#endif
+    VerifyOrExit(setsockopt(mSocket, IPPROTO_IPV6, IPV6_V6ONLY, &on, sizeof(on)) == 0);
+    VerifyOrExit(setsockopt(mSocket, IPPROTO_IPV6, IPV6_RECVPKTINFO, &on, sizeof(on)) == 0);
+    VerifyOrExit(setsockopt(mSocket, IPPROTO_IPV6, IPV6_MULTICAST_HOPS, &hops, sizeof(hops)) == 0);
+    VerifyOrExit(setsockopt(mSocket, IPPROTO_IPV6, IPV6_UNICAST_HOPS, &hops, sizeof(hops)) == 0);
+    VerifyOrExit(setsockopt(mSocket, IPPROTO_IPV6, IPV6_MULTICAST_LOOP, &on, sizeof(on)) == 0);
+
+    memset(&address, 0, sizeof(address));
+    address.sin6_family = AF_INET6;
+    address.sin6_addr   = in6addr_any;
+    address.sin6_port   = htons(kMdnsPort);
+    VerifyOrExit(bind(mSocket, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == 0);
+
+    error = OTBR_ERROR_NONE;
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogErr("Failed to open mDNS socket: %s", strerror(errno));
+
+        if (mSocket >= 0)
+        {
+            close(mSocket);
+            mSocket = -1;
+        }
+    }
+
+    return error;
+}
+
+void PublisherNative::UpdateInterfaces(void)
+{
+    ifaddrs              *ifAddrs = nullptr;
+    std::vector<uint32_t> netifIndexes;
+    AddressList           addresses;
+    bool                  joined = false;
+
+    mInterfaceCheckTime = Clock::now() + kInterfaceCheckInterval;
+    VerifyOrExit(getifaddrs(&ifAddrs) == 0, otbrLogWarning("Failed to get network interfaces: %s", strerror(errno)));
+
+    for (ifaddrs *ifAddr = ifAddrs; ifAddr != nullptr; ifAddr = ifAddr->ifa_next)
+    {
+        uint32_t   netifIndex;
+        Ip6Address address;
+
+        if (ifAddr->ifa_addr == nullptr || ifAddr->ifa_addr->sa_family != AF_INET6 || !(ifAddr->ifa_flags & IFF_UP) ||
+            !(ifAddr->ifa_flags & IFF_MULTICAST) || (ifAddr->ifa_flags & IFF_LOOPBACK))
+        {
+            continue;
+        }
+
+        if (!mInterfaceName.empty() && mInterfaceName != ifAddr->ifa_name)
+        {
+            continue;
+        }
+
+        netifIndex = if_nametoindex(ifAddr->ifa_name);
+        address.CopyFrom(reinterpret_cast<const sockaddr_in6 *>(ifAddr->ifa_addr)->sin6_addr);
+
+        if (netifIndex == 0)
+        {
+            continue;
+        }
+
+        if (std::find(netifIndexes.begin(), netifIndexes.end(), netifIndex) == netifIndexes.end())
+        {
+            netifIndexes.push_back(netifIndex);
+        }
+
+        if (!address.IsMulticast() && !address.IsLoopback() && !address.IsUnspecified())
+        {
+            addresses.push_back(address);
+        }
+    }
+
+    freeifaddrs(ifAddrs);
+
+    for (uint32_t netifIndex : netifIndexes)
+    {
+        ipv6_mreq request;
+
+        if (std::find(mNetifIndexes.begin(), mNetifIndexes.end(), netifIndex) != mNetifIndexes.end())
+        {
+            continue;
+        }
+
+        inet_pton(AF_INET6, kMdnsAddress, &request.ipv6mr_multiaddr);
+        request.ipv6mr_interface = netifIndex;
+
+        if (setsockopt(mSocket, IPPROTO_IPV6, IPV6_JOIN_GROUP, &request, sizeof(request)) != 0 && errno != EADDRINUSE)
+        {
+            otbrLogWarning("Failed to join mDNS group on netif %u: %s", netifIndex, strerror(errno));
+            continue;
+        }
+
+        otbrLogInfo("Joined mDNS group on netif %u", netifIndex);
+        mNetifIndexes.push_back(netifIndex);
+        joined = true;
+    }
+
+    // The memberships of removed interfaces are dropped by the kernel.
+    mNetifIndexes.erase(std::remove_if(mNetifIndexes.begin(), mNetifIndexes.end(),
+                                       [&netifIndexes](uint32_t aNetifIndex) {
+                                           return std::find(netifIndexes.begin(), netifIndexes.end(), aNetifIndex) ==
+                                                  netifIndexes.end();
+                                       }),
+                        mNetifIndexes.end());
+
+    if (joined)
+    {
+        // Announce the records again so that they are known on the new interfaces.
+        for (RecordSet *recordSet : mRecordSets)
+        {
+            if (recordSet->IsAnswering())
+            {
+                recordSet->mState    = RecordSet::State::kAnnouncing;
+                recordSet->mTxCount  = 0;
+                recordSet->mFireTime = Clock::now();
+            }
+        }
+    }
+
+    addresses = SortAddressList(std::move(addresses));
+    addresses.erase(std::unique(addresses.begin(), addresses.end()), addresses.end());
+    UpdateLocalHost(addresses);
+
+exit:
+    return;
+}
+
+void PublisherNative::UpdateLocalHost(const AddressList &aAddresses)
+{
+    std::string         hostName = MakeHostName(mLocalHostName);
+    std::vector<Record> records;
+
+    VerifyOrExit(mLocalHost != nullptr && !mLocalHost->mConflict);
+
+    for (const Ip6Address &address : aAddresses)
+    {
+        records.push_back({hostName, kTypeAaaa, kHostTtl, true, {address.m8, address.m8 + sizeof(address.m8)}});
+    }
+
+    VerifyOrExit(FindRecordSet(mLocalHost->mId) == nullptr || records.size() != mLocalHost->mRecords.size() ||
+                 !std::equal(records.begin(), records.end(), mLocalHost->mRecords.begin(),
+                             [](const Record &aRecord, const Record &aOther) { return aRecord.IsSameAs(aOther); }));
+
+    otbrLogInfo("Local host %s has %zu addresses", mLocalHostName.c_str(), aAddresses.size());
+
+    RemoveRecordSet(*mLocalHost);
+    mLocalHost->mRecords = std::move(records);
+    AddRecordSet(*mLocalHost);
+
+exit:
+    return;
+}
+
+otbrError PublisherNative::PublishServiceImpl(const std::string &aHostName,
+                                              const std::string &aName,
+                                              const std::string &aType,
+                                              const SubTypeList &aSubTypeList,
+                                              uint16_t           aPort,
+                                              const TxtData     &aTxtData,
+                                              ResultCallback   &&aCallback)
+{
+    otbrError                  error             = OTBR_ERROR_NONE;
+    SubTypeList                sortedSubTypeList = SortSubTypeList(aSubTypeList);
+    NativeServiceRegistration *serviceReg;
+
+    if (mState != State::kReady)
+    {
+        error = OTBR_ERROR_INVALID_STATE;
+        std::move(aCallback)(error);
+        ExitNow();
+    }
+
+    if (aName.size() > kMaxLabelLength)
+    {
+        error = OTBR_ERROR_INVALID_ARGS;
+        std::move(aCallback)(error);
+        ExitNow();
+    }
+
+    aCallback = HandleDuplicateServiceRegistration(aHostName, aName, aType, sortedSubTypeList, aPort, aTxtData,
+                                                   std::move(aCallback));
+    VerifyOrExit(!aCallback.IsNull());
+
+    serviceReg = new NativeServiceRegistration(aHostName, aName, aType, sortedSubTypeList, aPort, aTxtData,
+                                               std::move(aCallback), this);
+    AddServiceRegistration(std::unique_ptr<NativeServiceRegistration>(serviceReg));
+
+    error = serviceReg->Register();
+
+exit:
+    return error;
+}
+
+void PublisherNative::UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
+    RemoveServiceRegistration(aName, aType, OTBR_ERROR_ABORTED);
+
+exit:
+    std::move(aCallback)(error);
+}
+
+otbrError PublisherNative::PublishHostImpl(const std::string &aName,
+                                           const AddressList &aAddresses,
+                                           ResultCallback   &&aCallback)
+{
+    otbrError               error = OTBR_ERROR_NONE;
+    NativeHostRegistration *hostReg;
+
+    if (mState != State::kReady)
+    {
+        error = OTBR_ERROR_INVALID_STATE;
+        std::move(aCallback)(error);
+        ExitNow();
+    }
+
+    aCallback = HandleDuplicateHostRegistration(aName, aAddresses, std::move(aCallback));
+    VerifyOrExit(!aCallback.IsNull());
+
+    hostReg = new NativeHostRegistration(aName, aAddresses, std::move(aCallback), this);
+    AddHostRegistration(std::unique_ptr<NativeHostRegistration>(hostReg));
+
+    error = hostReg->Register();
+
+exit:
+    return error;
+}
+
+void PublisherNative::UnpublishHost(const std::string &aName, ResultCallback &&aCallback)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
+    RemoveHostRegistration(aName, OTBR_ERROR_ABORTED);
+
+exit:
+    std::move(aCallback)(error);
+}
+
+otbrError PublisherNative::PublishKeyImpl(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback)
+{
+    otbrError              error = OTBR_ERROR_NONE;
+    NativeKeyRegistration *keyReg;
+
+    if (mState != State::kReady)
+    {
+        error = OTBR_ERROR_INVALID_STATE;
+        std::move(aCallback)(error);
+        ExitNow();
+    }
+
+    aCallback = HandleDuplicateKeyRegistration(aName, aKeyData, std::move(aCallback));
+    VerifyOrExit(!aCallback.IsNull());
+
+    keyReg = new NativeKeyRegistration(aName, aKeyData, std::move(aCallback), this);
+    AddKeyRegistration(std::unique_ptr<NativeKeyRegistration>(keyReg));
+
+    error = keyReg->Register();
+
+exit:
+    return error;
+}
+
+void PublisherNative::UnpublishKey(const std::string &aName, ResultCallback &&aCallback)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
+    RemoveKeyRegistration(aName, OTBR_ERROR_ABORTED);
+
+exit:
+    std::move(aCallback)(error);
+}
+
+void PublisherNative::SubscribeService(const std::string &aType, const std::string &aInstanceName)
+{
+    VerifyOrExit(mState == State::kReady);
+    mSubscribedServices.push_back({aType, aInstanceName, {}});
+
+    otbrLogInfo("Subscribe service %s.%s (total %zu)", aInstanceName.c_str(), aType.c_str(),
+                mSubscribedServices.size());
+
+    if (!aInstanceName.empty())
+    {
+        mServiceInstanceResolutionBeginTime[std::make_pair(aInstanceName, aType)] = Clock::now();
+    }
+
+    // The instances may already be cached, and the questions of the subscription are added.
+    mCacheChanged = true;
+
+exit:
+    return;
+}
+
+void PublisherNative::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
+{
+    std::vector<ServiceSubscription>::iterator it;
+
+    VerifyOrExit(mState == State::kReady);
+    it = std::find_if(mSubscribedServices.begin(), mSubscribedServices.end(),
+                      [&aType, &aInstanceName](const ServiceSubscription &aService) {
+                          return aService.mType == aType && aService.mInstanceName == aInstanceName;
+                      });
+    VerifyOrExit(it != mSubscribedServices.end());
+
+    mSubscribedServices.erase(it);
+    mCacheChanged = true;
+
+    otbrLogInfo("Unsubscribe service %s.%s (left %zu)", aInstanceName.c_str(), aType.c_str(),
+                mSubscribedServices.size());
+
+exit:
+    return;
+}
+
+void PublisherNative::SubscribeHost(const std::string &aHostName)
+{
+    VerifyOrExit(mState == State::kReady);
+    mSubscribedHosts.push_back({aHostName, nullptr});
+
+    otbrLogInfo("Subscribe host %s (total %zu)", aHostName.c_str(), mSubscribedHosts.size());
+
+    mHostResolutionBeginTime[aHostName] = Clock::now();
+    mCacheChanged                       = true;
+
+exit:
+    return;
+}
+
+void PublisherNative::UnsubscribeHost(const std::string &aHostName)
+{
+    std::vector<HostSubscription>::iterator it;
+
+    VerifyOrExit(mState == State::kReady);
+    it = std::find_if(mSubscribedHosts.begin(), mSubscribedHosts.end(),
+                      [&aHostName](const HostSubscription &aHost) { return aHost.mHostName == aHostName; });
+    VerifyOrExit(it != mSubscribedHosts.end());
+
+    mSubscribedHosts.erase(it);
+    mCacheChanged = true;
+
+    otbrLogInfo("Unsubscribe host %s (remaining %zu)", aHostName.c_str(), mSubscribedHosts.size());
+
+exit:
+    return;
+}
+
+void PublisherNative::OnServiceResolveFailedImpl(const std::string &aType,
+                                                 const std::string &aInstanceName,
+                                                 int32_t            aErrorCode)
+{
+    otbrLogWarning("Resolve service %s.%s failed: %s", aInstanceName.c_str(), aType.c_str(),
+                   otbrErrorString(static_cast<otbrError>(aErrorCode)));
+}
+
+void PublisherNative::OnHostResolveFailedImpl(const std::string &aHostName, int32_t aErrorCode)
+{
+    otbrLogWarning("Resolve host %s failed: %s", aHostName.c_str(),
+                   otbrErrorString(static_cast<otbrError>(aErrorCode)));
+}
+
+otbrError PublisherNative::DnsErrorToOtbrError(int32_t aErrorCode)
+{
+    // Errors of this publisher are already `otbrError` values.
+    return static_cast<otbrError>(aErrorCode);
+}
+
+std::string PublisherNative::MakeHostName(const std::string &aHostName)
+{
+    return DottedToWire(aHostName + ".local");
+}
+
+std::string PublisherNative::MakeServiceTypeName(const std::string &aType)
+{
+    return DottedToWire(aType + ".local");
+}
+
+std::string PublisherNative::MakeInstanceName(const std::string &aInstanceName, const std::string &aType)
+{
+    std::string name;
+
+    // The instance name is a single label which may include dots, see RFC 6763 section 4.3.
+    AppendLabel(name, aInstanceName);
+
+    return name + MakeServiceTypeName(aType);
+}
+
+std::string PublisherNative::MakeKeyName(const std::string &aName)
+{
+    // A key is published either for a host or for a service instance "<Instance>.<_Service>.<_udp|_tcp>".
+    size_t      protocolDot = aName.rfind('.');
+    size_t      serviceDot  = (protocolDot == std::string::npos || protocolDot == 0)
+                                  ? std::string::npos
+                                  : aName.rfind('.', protocolDot - 1);
+    std::string protocol    = (protocolDot == std::string::npos) ? "" : aName.substr(protocolDot + 1);
+    std::string name;
+
+    if (serviceDot != std::string::npos && serviceDot > 0 && aName[serviceDot + 1] == '_' &&
+        (protocol == "_udp" || protocol == "_tcp"))
+    {
+        name = MakeInstanceName(aName.substr(0, serviceDot), aName.substr(serviceDot + 1));
+    }
+    else
+    {
+        name = MakeHostName(aName);
+    }
+
+    return name;
+}
+
+void PublisherNative::AddRecordSet(RecordSet &aRecordSet)
+{
+    Timepoint now          = Clock::now();
+    bool      needsProbing = false;
+
+    // Records which are published again must not be withdrawn.
+    mGoodbyes.erase(std::remove_if(mGoodbyes.begin(), mGoodbyes.end(),
+                                   [&aRecordSet](const Record &aGoodbye) {
+                                       return std::any_of(
+                                           aRecordSet.mRecords.begin(), aRecordSet.mRecords.end(),
+                                           [&aGoodbye](const Record &aRecord) { return aRecord.IsSameAs(aGoodbye); });
+                                   }),
+                    mGoodbyes.end());
+
+    for (const Record &record : aRecordSet.mRecords)
+    {
+        if (record.mUnique &&
+            std::find(mReleasedNames.begin(), mReleasedNames.end(), ToLower(record.mName)) == mReleasedNames.end())
+        {
+            needsProbing = true;
+        }
+    }
+
+    aRecordSet.mId       = ++mNextRecordSetId;
+    aRecordSet.mState    = RecordSet::State::kProbing;
+    aRecordSet.mConflict = false;
+
+    if (needsProbing)
+    {
+        aRecordSet.mTxCount  = 0;
+        aRecordSet.mFireTime = now + RandomDelay(0, kProbeInterval.count());
+
+        // Probes of record sets added in a burst (e.g. by one SRP update) are sent together.
+        for (const RecordSet *recordSet : mRecordSets)
+        {
+            if (recordSet->mState == RecordSet::State::kProbing && recordSet->mFireTime > now &&
+                recordSet->mFireTime <= now + kProbeInterval)
+            {
+                aRecordSet.mFireTime = recordSet->mFireTime;
+                break;
+            }
+        }
+    }
+    else
+    {
+        // Shared records and the names which were owned by this publisher until now are not probed, see RFC 6762
+        // section 8.4.
+        aRecordSet.mTxCount  = kNumProbes;
+        aRecordSet.mFireTime = now;
+    }
+
+    mRecordSets.push_back(&aRecordSet);
+}
+
+void PublisherNative::RemoveRecordSet(RecordSet &aRecordSet)
+{
+    auto it = std::find(mRecordSets.begin(), mRecordSets.end(), &aRecordSet);
+
+    VerifyOrExit(it != mRecordSets.end());
+    mRecordSets.erase(it);
+
+    VerifyOrExit(aRecordSet.IsAnswering() && !aRecordSet.mConflict);
+
+    for (const Record &record : aRecordSet.mRecords)
+    {
+        if (record.mUnique)
+        {
+            mReleasedNames.push_back(ToLower(record.mName));
+        }
+
+        mGoodbyes.push_back(record);
+    }
+
+exit:
+    return;
+}
+
+PublisherNative::RecordSet *PublisherNative::FindRecordSet(uint64_t aId) const
+{
+    auto it = std::find_if(mRecordSets.begin(), mRecordSets.end(),
+                           [aId](const RecordSet *aRecordSet) { return aRecordSet->mId == aId; });
+
+    return it == mRecordSets.end() ? nullptr : *it;
+}
+
+Milliseconds PublisherNative::RandomDelay(uint32_t aMinMs, uint32_t aMaxMs)
+{
+    return Milliseconds(std::uniform_int_distribution<uint32_t>(aMinMs, aMaxMs)(mRandom));
+}
+
+void PublisherNative::Update(MainloopContext &aMainloop)
+{
+    Timepoint now      = Clock::now();
+    Timepoint nextTime = mInterfaceCheckTime;
+
+    VerifyOrExit(mState == State::kReady);
+
+    FD_SET(mSocket, &aMainloop.mReadFdSet);
+    aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mSocket);
+
+    if (!mGoodbyes.empty() || mCacheChanged)
+    {
+        nextTime = now;
+    }
+
+    for (const RecordSet *recordSet : mRecordSets)
+    {
+        if (recordSet->mState != RecordSet::State::kAnnounced || recordSet->mConflict)
+        {
+            nextTime = std::min(nextTime, recordSet->mFireTime);
+        }
+    }
+
+    for (const auto &pendingResponse : mPendingResponses)
+    {
+        nextTime = std::min(nextTime, pendingResponse.second.first);
+    }
+
+    for (const auto &question : mQuestions)
+    {
+        auto cacheIt = mCache.find(question.first.first);
+
+        nextTime = std::min(nextTime, question.second.mNextTime);
+
+        if (cacheIt == mCache.end())
+        {
+            continue;
+        }
+
+        for (const CacheEntry &entry : cacheIt->second)
+        {
+            if (entry.mRecord.mType == question.second.mType)
+            {
+                nextTime = std::min(nextTime, entry.GetRefreshTime());
+            }
+        }
+    }
+
+    for (const auto &entries : mCache)
+    {
+        for (const CacheEntry &entry : entries.second)
+        {
+            nextTime = std::min(nextTime, entry.mExpireTime);
+        }
+    }
+
+    if (nextTime <= now)
+    {
+        aMainloop.mTimeout = ToTimeval(Microseconds::zero());
+    }
+    else
+    {
+        auto delay = std::chrono::duration_cast<Microseconds>(nextTime - now);
+
+        if (delay < FromTimeval<Microseconds>(aMainloop.mTimeout))
+        {
+            aMainloop.mTimeout = ToTimeval(delay);
+        }
+    }
+
+exit:
+    return;
+}
+
+void PublisherNative::Process(const MainloopContext &aMainloop)
+{
+    Timepoint now;
+
+    VerifyOrExit(mState == State::kReady);
+
+    if (FD_ISSET(mSocket, &aMainloop.mReadFdSet))
+    {
+        Receive();
+    }
+
+    now = Clock::now();
+
+    if (now >= mInterfaceCheckTime)
+    {
+        UpdateInterfaces();
+    }
+
+    SendGoodbyes();
+    ProcessRecordSets(now);
+
+    // The registration callbacks may stop this publisher.
+    VerifyOrExit(mState == State::kReady);
+
+    SendPendingResponses(now);
+    ExpireCache(now);
+    SendQueries(now);
+
+    if (mCacheChanged)
+    {
+        UpdateSubscriptions();
+    }
+
+exit:
+    // Names released before this point are probed again when they are published later.
+    mReleasedNames.clear();
+}
+
+void PublisherNative::ProcessRecordSets(Timepoint aNow)
+{
+    Message                                     response;
+    MessageBatch                                probes{Message()};
+    std::vector<std::pair<uint64_t, otbrError>> results;
+
+    response.mFlags = kFlagResponse | kFlagAuthoritative;
+
+    MessageBatch announcements(response);
+
+    for (RecordSet *recordSet : mRecordSets)
+    {
+        Message announcement;
+
+        if (recordSet->mFireTime > aNow || (recordSet->mState == RecordSet::State::kAnnounced && !recordSet->mConflict))
+        {
+            continue;
+        }
+
+        if (recordSet->mConflict)
+        {
+            results.emplace_back(recordSet->mId, OTBR_ERROR_DUPLICATED);
+            recordSet->mFireTime = Timepoint::max();
+            continue;
+        }
+
+        if (recordSet->mState == RecordSet::State::kProbing && recordSet->mTxCount < kNumProbes)
+        {
+            Message probe;
+
+            // A probe queries all unique names of the set and proposes the records in the authority section, see
+            // RFC 6762 section 8.1.
+            for (const Record &record : recordSet->mRecords)
+            {
+                if (!record.mUnique)
+                {
+                    continue;
+                }
+
+                if (std::none_of(probe.mQuestions.begin(), probe.mQuestions.end(), [&record](const Question &aQuestion) {
+                        return NameEquals(aQuestion.mName, record.mName);
+                    }))
+                {
+                    probe.mQuestions.push_back({record.mName, kTypeAny, recordSet->mTxCount == 0});
+                }
+
+                probe.mAuthorities.push_back(record);
+            }
+
+            probes.Append(probe);
+            recordSet->mTxCount++;
+            recordSet->mFireTime = aNow + kProbeInterval;
+            continue;
+        }
+
+        if (recordSet->mState == RecordSet::State::kProbing)
+        {
+            results.emplace_back(recordSet->mId, OTBR_ERROR_NONE);
+            recordSet->mState   = RecordSet::State::kAnnouncing;
+            recordSet->mTxCount = 0;
+        }
+
+        if (!recordSet->mRecords.empty())
+        {
+            announcement.mAnswers = recordSet->mRecords;
+            announcements.Append(announcement);
+        }
+
+        if (++recordSet->mTxCount >= kNumAnnouncements)
+        {
+            recordSet->mState = RecordSet::State::kAnnounced;
+        }
+        else
+        {
+            recordSet->mFireTime = aNow + kAnnounceInterval;
+        }
+    }
+
+    SendMulticast(probes, 0);
+    SendMulticast(announcements, 0);
+
+    // The callbacks may add or remove record sets, so the sets are looked up again.
+    for (const auto &result : results)
+    {
+        RecordSet *recordSet = FindRecordSet(result.first);
+
+        if (recordSet != nullptr)
+        {
+            recordSet->HandleProbed(result.second);
+        }
+    }
+}
+
+void PublisherNative::SendGoodbyes(void)
+{
+    Message response;
+
+    VerifyOrExit(!mGoodbyes.empty());
+
+    response.mFlags = kFlagResponse | kFlagAuthoritative;
+
+    {
+        MessageBatch goodbyes(response);
+
+        for (Record &record : mGoodbyes)
+        {
+            Message goodbye;
+
+            // Shared records may still be published by other record sets, e.g. the PTR of a service type.
+            if (std::any_of(mRecordSets.begin(), mRecordSets.end(), [&record](const RecordSet *aRecordSet) {
+                    return aRecordSet->IsAnswering() &&
+                           std::any_of(aRecordSet->mRecords.begin(), aRecordSet->mRecords.end(),
+                                       [&record](const Record &aRecord) { return aRecord.IsSameAs(record); });
+                }))
+            {
+                continue;
+            }
+
+            record.mTtl = 0;
+            goodbye.mAnswers.push_back(record);
+            goodbyes.Append(goodbye);
+        }
+
+        mGoodbyes.clear();
+        SendMulticast(goodbyes, 0);
+    }
+
+exit:
+    return;
+}
+
+void PublisherNative::Send(const Message &aMessage, uint32_t aNetifIndex, const sockaddr_in6 &aDest)
+{
+    std::vector<uint8_t> buffer;
+    uint8_t              control[CMSG_SPACE(sizeof(in6_pktinfo))];
+    in6_pktinfo          packetInfo;
+    iovec                iov;
+    msghdr               header;
+    cmsghdr             *cmsg;
+
+    aMessage.Encode(buffer);
+
+    iov.iov_base = buffer.data();
+    iov.iov_len  = buffer.size();
+
+    memset(&header, 0, sizeof(header));
+    header.msg_name       = const_cast<sockaddr_in6 *>(&aDest);
+    header.msg_namelen    = sizeof(aDest);
+    header.msg_iov        = &iov;
+    header.msg_iovlen     = 1;
+    header.msg_control    = control;
+    header.msg_controllen = sizeof(control);
+
+    memset(&packetInfo, 0, sizeof(packetInfo));
+    packetInfo.ipi6_ifindex = aNetifIndex;
+
+    cmsg             = CMSG_FIRSTHDR(&header);
+    cmsg->cmsg_level = IPPROTO_IPV6;
+    cmsg->cmsg_type  = IPV6_PKTINFO;
+    cmsg->cmsg_len   = CMSG_LEN(sizeof(packetInfo));
+    memcpy(CMSG_DATA(cmsg), &packetInfo, sizeof(packetInfo));
+
+    if (sendmsg(mSocket, &header, 0) < 0)
+    {
+        otbrLogWarning("Failed to send mDNS message on netif %u: %s", aNetifIndex, strerror(errno));
+    }
+    else
+    {
+        mSentMessages.emplace_back(Clock::now(), std::hash<std::string>()(std::string(buffer.begin(), buffer.end())));
+    }
+}
+
+void PublisherNative::SendMulticast(const MessageBatch &aBatch, uint32_t aNetifIndex)
+{
+    sockaddr_in6 dest;
+
+    memset(&dest, 0, sizeof(dest));
+    dest.sin6_family = AF_INET6;
+    dest.sin6_port   = htons(kMdnsPort);
+    inet_pton(AF_INET6, kMdnsAddress, &dest.sin6_addr);
+
+    for (const Message &message : aBatch.GetMessages())
+    {
+        for (uint32_t netifIndex : mNetifIndexes)
+        {
+            if (aNetifIndex == 0 || aNetifIndex == netifIndex)
+            {
+                dest.sin6_scope_id = netifIndex;
+                Send(message, netifIndex, dest);
+            }
+        }
+    }
+}
+
+bool PublisherNative::IsOwnMessage(const uint8_t *aBuffer, size_t aLength)
+{
+    Timepoint now  = Clock::now();
+    size_t    hash = std::hash<std::string>()(std::string(reinterpret_cast<const char *>(aBuffer), aLength));
+
+    mSentMessages.erase(std::remove_if(mSentMessages.begin(), mSentMessages.end(),
+                                       [now](const std::pair<Timepoint, size_t> &aSentMessage) {
+                                           return now - aSentMessage.first > kOwnMessageLifetime;
+                                       }),
+                        mSentMessages.end());
+
+    return std::any_of(
+        mSentMessages.begin(), mSentMessages.end(),
+        [hash](const std::pair<Timepoint, size_t> &aSentMessage) { return aSentMessage.second == hash; });
+}
+
+void PublisherNative::Receive(void)
+{
+    std::vector<uint8_t> buffer(kMaxReceiveSize);
+
+    while (true)
+    {
+        uint8_t      control[CMSG_SPACE(sizeof(in6_pktinfo))];
+        sockaddr_in6 sender;
+        iovec        iov;
+        msghdr       header;
+        ssize_t      length;
+        uint32_t     netifIndex = 0;
+        Message      message;
+        bool         isOwn;
+
+        iov.iov_base = buffer.data();
+        iov.iov_len  = buffer.size();
+
+        memset(&header, 0, sizeof(header));
+        header.msg_name       = &sender;
+        header.msg_namelen    = sizeof(sender);
+        header.msg_iov        = &iov;
+        header.msg_iovlen     = 1;
+        header.msg_control    = control;
+        header.msg_controllen = sizeof(control);
+
+        length = recvmsg(mSocket, &header, 0);
+
+        if (length < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                otbrLogWarning("Failed to receive mDNS message: %s", strerror(errno));
+            }
+
+            break;
+        }
+
+        for (cmsghdr *cmsg = CMSG_FIRSTHDR(&header); cmsg != nullptr; cmsg = CMSG_NXTHDR(&header, cmsg))
+        {
+            if (cmsg->cmsg_level == IPPROTO_IPV6 && cmsg->cmsg_type == IPV6_PKTINFO)
+            {
+                in6_pktinfo packetInfo;
+
+                memcpy(&packetInfo, CMSG_DATA(cmsg), sizeof(packetInfo));
+                netifIndex = packetInfo.ipi6_ifindex;
+            }
+        }
+
+        if (netifIndex == 0 || message.Parse(buffer.data(), static_cast<size_t>(length)) != OTBR_ERROR_NONE)
+        {
+            otbrLogDebug("Ignored invalid mDNS message");
+            continue;
+        }
+
+        // The socket is bound to all interfaces, so unicast messages may arrive from links this publisher does not
+        // serve.
+        if (std::find(mNetifIndexes.begin(), mNetifIndexes.end(), netifIndex) == mNetifIndexes.end())
+        {
+            otbrLogDebug("Ignored mDNS message from netif %u", netifIndex);
+            continue;
+        }
+
+        isOwn = IsOwnMessage(buffer.data(), static_cast<size_t>(length));
+
+        if (!message.IsResponse())
+        {
+            HandleQuery(message, sender, netifIndex, isOwn);
+        }
+        else if (ntohs(sender.sin6_port) == kMdnsPort)
+        {
+            // Responses from other ports are not trusted, see RFC 6762 section 6.
+            HandleResponse(message, netifIndex, isOwn);
+        }
+    }
+}
+
+void PublisherNative::HandleQuery(const Message      &aQuery,
+                                  const sockaddr_in6 &aSender,
+                                  uint32_t            aNetifIndex,
+                                  bool                aIsOwn)
+{
+    bool                isLegacyUnicast = ntohs(aSender.sin6_port) != kMdnsPort;
+    bool                isUnicast       = true;
+    std::vector<Record> answers;
+    std::vector<Record> additionals;
+    Message             response;
+
+    if (!aQuery.mAuthorities.empty())
+    {
+        // A query with records in the authority section is a probe, see RFC 6762 section 8.2.
+        VerifyOrExit(!aIsOwn);
+        HandleProbeQuery(aQuery);
+    }
+
+    for (const Question &question : aQuery.mQuestions)
+    {
+        size_t numAnswers = answers.size();
+
+        FindAnswers(question.mName, question.mType, answers);
+
+        // Known-answer suppression, see RFC 6762 section 7.1.
+        answers.erase(std::remove_if(answers.begin() + numAnswers, answers.end(),
+                                     [&aQuery](const Record &aAnswer) {
+                                         return std::any_of(aQuery.mAnswers.begin(), aQuery.mAnswers.end(),
+                                                            [&aAnswer](const Record &aKnownAnswer) {
+                                                                return aKnownAnswer.IsSameAs(aAnswer) &&
+                                                                       aKnownAnswer.mTtl >= aAnswer.mTtl / 2;
+                                                            });
+                                     }),
+                      answers.end());
+
+        if (answers.size() > numAnswers && !question.mUnicastResponse)
+        {
+            isUnicast = false;
+        }
+    }
+
+    VerifyOrExit(!answers.empty());
+    AddAdditionals(answers, additionals);
+
+    response.mFlags = kFlagResponse | kFlagAuthoritative;
+
+    if (isLegacyUnicast)
+    {
+        // Legacy unicast responses echo the query, and have neither the cache-flush bit nor long TTLs, see RFC 6762
+        // section 6.7.
+        response.mId        = aQuery.mId;
+        response.mQuestions = aQuery.mQuestions;
+
+        for (Question &question : response.mQuestions)
+        {
+            question.mUnicastResponse = false;
+        }
+
+        for (std::vector<Record> *records : {&answers, &additionals})
+        {
+            for (Record &record : *records)
+            {
+                record.mTtl    = std::min(record.mTtl, static_cast<uint32_t>(kLegacyUnicastTtl));
+                record.mUnique = false;
+            }
+        }
+
+        response.mAnswers     = std::move(answers);
+        response.mAdditionals = std::move(additionals);
+        Send(response, aNetifIndex, aSender);
+    }
+    else if (isUnicast)
+    {
+        response.mAnswers     = std::move(answers);
+        response.mAdditionals = std::move(additionals);
+        Send(response, aNetifIndex, aSender);
+    }
+    else
+    {
+        // Responses with shared records are delayed to aggregate answers to other queriers, see RFC 6762 section 6.
+        bool      isShared =
+            std::any_of(answers.begin(), answers.end(), [](const Record &aRecord) { return !aRecord.mUnique; });
+        Timepoint fireTime = Clock::now() + (isShared ? RandomDelay(20, 120) : Milliseconds(0));
+        auto      result   = mPendingResponses.emplace(aNetifIndex, std::make_pair(fireTime, response));
+        Message  &pending  = result.first->second.second;
+
+        result.first->second.first = std::min(result.first->second.first, fireTime);
+
+        for (const Record &answer : answers)
+        {
+            if (std::none_of(pending.mAnswers.begin(), pending.mAnswers.end(),
+                             [&answer](const Record &aRecord) { return aRecord.IsSameAs(answer); }))
+            {
+                pending.mAnswers.push_back(answer);
+            }
+        }
+
+        for (const Record &additional : additionals)
+        {
+            if (std::none_of(pending.mAdditionals.begin(), pending.mAdditionals.end(),
+                             [&additional](const Record &aRecord) { return aRecord.IsSameAs(additional); }))
+            {
+                pending.mAdditionals.push_back(additional);
+            }
+        }
+    }
+
+exit:
+    return;
+}
+
+void PublisherNative::HandleProbeQuery(const Message &aQuery)
+{
+    using RecordData = std::vector<std::pair<uint16_t, std::vector<uint8_t>>>;
+
+    // Simultaneous probes are resolved by comparing the proposed records, the lexicographically later wins, see
+    // RFC 6762 section 8.2.
+    for (RecordSet *recordSet : mRecordSets)
+    {
+        if (recordSet->mState != RecordSet::State::kProbing || recordSet->mConflict)
+        {
+            continue;
+        }
+
+        for (const Record &record : recordSet->mRecords)
+        {
+            RecordData ours;
+            RecordData theirs;
+
+            if (!record.mUnique)
+            {
+                continue;
+            }
+
+            for (const Record &other : recordSet->mRecords)
+            {
+                if (other.mUnique && NameEquals(other.mName, record.mName))
+                {
+                    ours.emplace_back(other.mType, other.mData);
+                }
+            }
+
+            for (const Record &other : aQuery.mAuthorities)
+            {
+                if (NameEquals(other.mName, record.mName))
+                {
+                    theirs.emplace_back(other.mType, other.mData);
+                }
+            }
+
+            std::sort(ours.begin(), ours.end());
+            std::sort(theirs.begin(), theirs.end());
+
+            if (!theirs.empty() && ours < theirs)
+            {
+                HandleConflict(*recordSet, /* aIsProbeLost */ true);
+                break;
+            }
+        }
+    }
+}
+
+void PublisherNative::HandleResponse(const Message &aResponse, uint32_t aNetifIndex, bool aIsOwn)
+{
+    Timepoint now = Clock::now();
+
+    for (const std::vector<Record> *records : {&aResponse.mAnswers, &aResponse.mAdditionals})
+    {
+        for (const Record &record : *records)
+        {
+            if (!aIsOwn)
+            {
+                CheckConflict(record);
+            }
+
+            // Records are cached only while they may be used by subscriptions, including the records of this
+            // publisher which are looped back.
+            if (!mSubscribedServices.empty() || !mSubscribedHosts.empty())
+            {
+                AddToCache(record, aNetifIndex, now);
+            }
+        }
+    }
+}
+
+void PublisherNative::CheckConflict(const Record &aRecord)
+{
+    VerifyOrExit(aRecord.mTtl > 0);
+
+    for (RecordSet *recordSet : mRecordSets)
+    {
+        bool isOwned     = false;
+        bool isIdentical = false;
+
+        if (recordSet->mConflict)
+        {
+            continue;
+        }
+
+        for (const Record &record : recordSet->mRecords)
+        {
+            if (!record.mUnique || !NameEquals(record.mName, aRecord.mName))
+            {
+                continue;
+            }
+
+            // While probing, any record of the name conflicts, see RFC 6762 section 8.1.
+            if (recordSet->mState == RecordSet::State::kProbing || record.mType == aRecord.mType)
+            {
+                isOwned = true;
+            }
+
+            if (record.IsSameAs(aRecord))
+            {
+                isIdentical = true;
+            }
+        }
+
+        if (isOwned && !isIdentical)
+        {
+            HandleConflict(*recordSet, /* aIsProbeLost */ false);
+        }
+    }
+
+exit:
+    return;
+}
+
+void PublisherNative::HandleConflict(RecordSet &aRecordSet, bool aIsProbeLost)
+{
+    Timepoint now = Clock::now();
+
+    if (aIsProbeLost)
+    {
+        aRecordSet.mTxCount  = 0;
+        aRecordSet.mFireTime = now + kProbeDeferDelay;
+    }
+    else if (aRecordSet.mState == RecordSet::State::kProbing)
+    {
+        aRecordSet.mConflict = true;
+        aRecordSet.mFireTime = now;
+    }
+    else
+    {
+        // Announced records are probed again, which fails if the conflict persists, see RFC 6762 section 9.
+        otbrLogWarning("Conflicting records of %s received, probing again",
+                       WireToDotted(aRecordSet.mRecords.front().mName).c_str());
+        aRecordSet.mState    = RecordSet::State::kProbing;
+        aRecordSet.mTxCount  = 0;
+        aRecordSet.mFireTime = now;
+    }
+}
+
+void PublisherNative::FindAnswers(const std::string &aName, uint16_t aType, std::vector<Record> &aRecords) const
+{
+    for (const RecordSet *recordSet : mRecordSets)
+    {
+        if (!recordSet->IsAnswering() || recordSet->mConflict)
+        {
+            continue;
+        }
+
+        for (const Record &record : recordSet->mRecords)
+        {
+            if ((aType == kTypeAny || aType == record.mType) && NameEquals(record.mName, aName) &&
+                std::none_of(aRecords.begin(), aRecords.end(),
+                             [&record](const Record &aRecord) { return aRecord.IsSameAs(record); }))
+            {
+                aRecords.push_back(record);
+            }
+        }
+    }
+}
+
+void PublisherNative::AddAdditionals(const std::vector<Record> &aAnswers, std::vector<Record> &aAdditionals) const
+{
+    std::vector<Record> pending = aAnswers;
+
+    // The records which a querier would ask for next are added, see RFC 6763 section 12.
+    while (!pending.empty())
+    {
+        Record              record = std::move(pending.back());
+        std::vector<Record> records;
+
+        pending.pop_back();
+
+        if (record.mType == kTypePtr)
+        {
+            std::string target(record.mData.begin(), record.mData.end());
+
+            FindAnswers(target, kTypeSrv, records);
+            FindAnswers(target, kTypeTxt, records);
+        }
+        else if (record.mType == kTypeSrv && record.mData.size() > 6)
+        {
+            FindAnswers(std::string(record.mData.begin() + 6, record.mData.end()), kTypeAaaa, records);
+        }
+
+        for (const Record &additional : records)
+        {
+            auto isSame = [&additional](const Record &aRecord) { return aRecord.IsSameAs(additional); };
+
+            if (std::none_of(aAnswers.begin(), aAnswers.end(), isSame) &&
+                std::none_of(aAdditionals.begin(), aAdditionals.end(), isSame))
+            {
+                aAdditionals.push_back(additional);
+                pending.push_back(additional);
+            }
+        }
+    }
+}
+
+void PublisherNative::SendPendingResponses(Timepoint aNow)
+{
+    for (auto it = mPendingResponses.begin(); it != mPendingResponses.end();)
+    {
+        Message response;
+
+        if (it->second.first > aNow)
+        {
+            ++it;
+            continue;
+        }
+
+        response.mFlags = kFlagResponse | kFlagAuthoritative;
+
+        {
+            MessageBatch batch(response);
+
+            for (const Record &answer : it->second.second.mAnswers)
+            {
+                Message unit;
+
+                unit.mAnswers.push_back(answer);
+                batch.Append(unit);
+            }
+
+            for (const Record &additional : it->second.second.mAdditionals)
+            {
+                Message unit;
+
+                unit.mAdditionals.push_back(additional);
+                batch.Append(unit, /* aOptional */ true);
+            }
+
+            SendMulticast(batch, it->first);
+        }
+
+        it = mPendingResponses.erase(it);
+    }
+}
+
+Timepoint PublisherNative::CacheEntry::GetRefreshTime(void) const
+{
+    Timepoint refreshTime = Timepoint::max();
+
+    // Cached records are queried at 80%, 85%, 90% and 95% of their TTL, see RFC 6762 section 5.2.
+    if (mQueryCount < kMaxRefreshQueries)
+    {
+        refreshTime = mReceiveTime + Milliseconds(static_cast<uint64_t>(mRecord.mTtl) * (80 + 5 * mQueryCount) * 10);
+    }
+
+    return refreshTime;
+}
+
+void PublisherNative::AddToCache(const Record &aRecord, uint32_t aNetifIndex, Timepoint aNow)
+{
+    std::string              name    = ToLower(aRecord.mName);
+    std::vector<CacheEntry> &entries = mCache[name];
+    auto                     it      = std::find_if(entries.begin(), entries.end(), [&aRecord](const CacheEntry &aEntry) {
+        return aEntry.mRecord.IsSameAs(aRecord);
+    });
+
+    VerifyOrExit(aRecord.mType == kTypePtr || aRecord.mType == kTypeSrv || aRecord.mType == kTypeTxt ||
+                 aRecord.mType == kTypeAaaa);
+
+    if (aRecord.mUnique && aRecord.mTtl > 0)
+    {
+        // Other records of a unique record set which are older than one second are flushed, see RFC 6762
+        // section 10.2.
+        for (CacheEntry &entry : entries)
+        {
+            if (entry.mRecord.mType == aRecord.mType && !entry.mRecord.IsSameAs(aRecord) &&
+                aNow - entry.mReceiveTime > kCacheFlushDelay)
+            {
+                entry.mExpireTime = std::min(entry.mExpireTime, aNow + kCacheFlushDelay);
+                entry.mQueryCount = kMaxRefreshQueries;
+            }
+        }
+    }
+
+    if (it == entries.end())
+    {
+        VerifyOrExit(aRecord.mTtl > 0);
+        entries.push_back({aRecord, aNetifIndex, aNow, aNow + Seconds(aRecord.mTtl), 0});
+        mCacheChanged = true;
+    }
+    else if (aRecord.mTtl == 0)
+    {
+        // A goodbye record is removed after one second, see RFC 6762 section 10.1.
+        it->mExpireTime = std::min(it->mExpireTime, aNow + kCacheFlushDelay);
+        it->mQueryCount = kMaxRefreshQueries;
+    }
+    else
+    {
+        it->mRecord.mTtl = aRecord.mTtl;
+        it->mNetifIndex  = aNetifIndex;
+        it->mReceiveTime = aNow;
+        it->mExpireTime  = aNow + Seconds(aRecord.mTtl);
+        it->mQueryCount  = 0;
+    }
+
+exit:
+    if (entries.empty())
+    {
+        mCache.erase(name);
+    }
+}
+
+void PublisherNative::ExpireCache(Timepoint aNow)
+{
+    for (auto it = mCache.begin(); it != mCache.end();)
+    {
+        std::vector<CacheEntry> &entries    = it->second;
+        size_t                   numEntries = entries.size();
+
+        entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                     [aNow](const CacheEntry &aEntry) { return aEntry.mExpireTime <= aNow; }),
+                      entries.end());
+
+        if (entries.size() != numEntries)
+        {
+            mCacheChanged = true;
+        }
+
+        it = entries.empty() ? mCache.erase(it) : std::next(it);
+    }
+}
+
+const PublisherNative::CacheEntry *PublisherNative::FindCacheEntry(const std::string &aName, uint16_t aType) const
+{
+    const CacheEntry *found = nullptr;
+    auto              it    = mCache.find(ToLower(aName));
+
+    VerifyOrExit(it != mCache.end());
+
+    for (const CacheEntry &entry : it->second)
+    {
+        if (entry.mRecord.mType == aType)
+        {
+            ExitNow(found = &entry);
+        }
+    }
+
+exit:
+    return found;
+}
+
+void PublisherNative::SendQueries(Timepoint aNow)
+{
+    MessageBatch batch{Message()};
+
+    for (auto &question : mQuestions)
+    {
+        QuestionState &state   = question.second;
+        bool           isDue   = aNow >= state.mNextTime;
+        auto           cacheIt = mCache.find(question.first.first);
+        Message        query;
+
+        if (cacheIt != mCache.end())
+        {
+            for (CacheEntry &entry : cacheIt->second)
+            {
+                if (entry.mRecord.mType == state.mType && aNow >= entry.GetRefreshTime())
+                {
+                    entry.mQueryCount++;
+                    isDue = true;
+                }
+            }
+        }
+
+        if (!isDue)
+        {
+            continue;
+        }
+
+        if (aNow >= state.mNextTime)
+        {
+            // The interval between queries is doubled up to one hour, see RFC 6762 section 5.2.
+            state.mNextTime = aNow + state.mInterval;
+            state.mInterval = std::min(state.mInterval * 2, kMaxQueryInterval);
+        }
+
+        query.mQuestions.push_back({state.mName, state.mType, false});
+        batch.Append(query);
+
+        if (cacheIt == mCache.end())
+        {
+            continue;
+        }
+
+        // The answers which are known for more than half of their TTL are included, see RFC 6762 section 7.1.
+        for (const CacheEntry &entry : cacheIt->second)
+        {
+            Message knownAnswer;
+            auto    remaining = std::chrono::duration_cast<Seconds>(entry.mExpireTime - aNow);
+
+            if (entry.mRecord.mType != state.mType || remaining.count() * 2 <= entry.mRecord.mTtl)
+            {
+                continue;
+            }
+
+            knownAnswer.mAnswers.push_back(entry.mRecord);
+            knownAnswer.mAnswers.back().mTtl = static_cast<uint32_t>(remaining.count());
+            batch.Append(knownAnswer, /* aOptional */ true);
+        }
+    }
+
+    SendMulticast(batch, 0);
+}
+
+void PublisherNative::AddQuestion(std::map<QuestionKey, std::string> &aQuestions,
+                                  const std::string                  &aName,
+                                  uint16_t                            aType)
+{
+    aQuestions.emplace(QuestionKey(ToLower(aName), aType), aName);
+}
+
+bool PublisherNative::ResolveInstance(const std::string                  &aInstanceName,
+                                      DiscoveredInstanceInfo             &aInstanceInfo,
+                                      std::map<QuestionKey, std::string> &aQuestions) const
+{
+    bool              resolved = false;
+    const CacheEntry *srvEntry = FindCacheEntry(aInstanceName, kTypeSrv);
+    const CacheEntry *txtEntry = FindCacheEntry(aInstanceName, kTypeTxt);
+    std::string       label;
+    std::string       type;
+    std::string       hostName;
+    uint32_t          hostTtl;
+
+    AddQuestion(aQuestions, aInstanceName, kTypeSrv);
+    AddQuestion(aQuestions, aInstanceName, kTypeTxt);
+
+    VerifyOrExit(srvEntry != nullptr && srvEntry->mRecord.mData.size() > 6);
+    VerifyOrExit(SplitFirstLabel(aInstanceName, label, type));
+
+    hostName.assign(srvEntry->mRecord.mData.begin() + 6, srvEntry->mRecord.mData.end());
+    AddQuestion(aQuestions, hostName, kTypeAaaa);
+
+    VerifyOrExit(txtEntry != nullptr);
+    ResolveAddresses(hostName, aInstanceInfo.mAddresses, hostTtl);
+    VerifyOrExit(!aInstanceInfo.mAddresses.empty());
+
+    aInstanceInfo.mNetifIndex = srvEntry->mNetifIndex;
+    aInstanceInfo.mName       = label;
+    aInstanceInfo.mHostName   = WireToDotted(hostName);
+    aInstanceInfo.mPriority   = ReadUint16(&srvEntry->mRecord.mData[0]);
+    aInstanceInfo.mWeight     = ReadUint16(&srvEntry->mRecord.mData[2]);
+    aInstanceInfo.mPort       = ReadUint16(&srvEntry->mRecord.mData[4]);
+    aInstanceInfo.mTxtData    = txtEntry->mRecord.mData;
+    aInstanceInfo.mTtl        = std::min({srvEntry->mRecord.mTtl, txtEntry->mRecord.mTtl, hostTtl});
+    resolved                  = true;
+
+exit:
+    return resolved;
+}
+
+uint32_t PublisherNative::ResolveAddresses(const std::string &aHostName, AddressList &aAddresses, uint32_t &aTtl) const
+{
+    uint32_t netifIndex = 0;
+    auto     it         = mCache.find(ToLower(aHostName));
+
+    aTtl = 0;
+    VerifyOrExit(it != mCache.end());
+
+    for (const CacheEntry &entry : it->second)
+    {
+        Ip6Address address;
+
+        if (entry.mRecord.mType != kTypeAaaa || entry.mRecord.mData.size() != sizeof(address.m8))
+        {
+            continue;
+        }
+
+        memcpy(address.m8, entry.mRecord.mData.data(), sizeof(address.m8));
+
+        if (address.IsLinkLocal() || address.IsMulticast() || address.IsLoopback() || address.IsUnspecified())
+        {
+            continue;
+        }
+
+        aAddresses.push_back(address);
+        aTtl       = (aTtl == 0) ? entry.mRecord.mTtl : std::min(aTtl, entry.mRecord.mTtl);
+        netifIndex = entry.mNetifIndex;
+    }
+
+    aAddresses = SortAddressList(std::move(aAddresses));
+
+exit:
+    return netifIndex;
+}
+
+void PublisherNative::UpdateSubscriptions(void)
+{
+    Timepoint                          now = Clock::now();
+    std::map<QuestionKey, std::string> questions;
+    std::vector<std::function<void()>> callbacks;
+
+    mCacheChanged = false;
+
+    for (ServiceSubscription &service : mSubscribedServices)
+    {
+        std::string              typeName = MakeServiceTypeName(service.mType);
+        std::string              type     = service.mType;
+        std::vector<std::string> instanceNames;
+
+        if (service.mInstanceName.empty())
+        {
+            auto cacheIt = mCache.find(ToLower(typeName));
+
+            AddQuestion(questions, typeName, kTypePtr);
+
+            for (const CacheEntry &entry : (cacheIt == mCache.end() ? std::vector<CacheEntry>() : cacheIt->second))
+            {
+                if (entry.mRecord.mType == kTypePtr)
+                {
+                    instanceNames.emplace_back(entry.mRecord.mData.begin(), entry.mRecord.mData.end());
+                }
+            }
+        }
+        else
+        {
+            instanceNames.push_back(MakeInstanceName(service.mInstanceName, service.mType));
+        }
+
+        for (auto it = service.mInstances.begin(); it != service.mInstances.end();)
+        {
+            const std::string &key = it->first;
+
+            if (std::any_of(instanceNames.begin(), instanceNames.end(),
+                            [&key](const std::string &aName) { return ToLower(aName) == key; }))
+            {
+                ++it;
+                continue;
+            }
+
+            {
+                uint32_t    netifIndex   = it->second->mNetifIndex;
+                std::string instanceName = it->second->mName;
+
+                callbacks.push_back([this, netifIndex, type, instanceName]() {
+                    OnServiceRemoved(netifIndex, type, instanceName);
+                });
+            }
+
+            it = service.mInstances.erase(it);
+        }
+
+        for (const std::string &instanceName : instanceNames)
+        {
+            DiscoveredInstanceInfo                   instanceInfo;
+            std::shared_ptr<DiscoveredInstanceInfo> &reported = service.mInstances[ToLower(instanceName)];
+
+            if (!ResolveInstance(instanceName, instanceInfo, questions))
+            {
+                if (reported == nullptr)
+                {
+                    service.mInstances.erase(ToLower(instanceName));
+                }
+                else if (!reported->mAddresses.empty())
+                {
+                    // The instance is reported again once it is resolved.
+                    GetMutableInfo(reported).mAddresses.clear();
+                }
+
+                continue;
+            }
+
+            if (reported != nullptr && IsSameInstance(*reported, instanceInfo))
+            {
+                continue;
+            }
+
+            reported = std::make_shared<DiscoveredInstanceInfo>(std::move(instanceInfo));
+
+            {
+                DiscoveredInstanceInfoPtr info = reported;
+
+                callbacks.push_back([this, type, info]() { OnServiceResolved(type, info); });
+            }
+        }
+    }
+
+    for (HostSubscription &host : mSubscribedHosts)
+    {
+        std::string        hostName = MakeHostName(host.mHostName);
+        DiscoveredHostInfo hostInfo;
+
+        AddQuestion(questions, hostName, kTypeAaaa);
+        hostInfo.mNetifIndex = ResolveAddresses(hostName, hostInfo.mAddresses, hostInfo.mTtl);
+        hostInfo.mHostName   = WireToDotted(hostName);
+
+        if (hostInfo.mAddresses.empty())
+        {
+            // The addresses are reported again once the host is resolved.
+            host.mHostInfo = nullptr;
+            continue;
+        }
+
+        if (host.mHostInfo != nullptr && IsSameHost(*host.mHostInfo, hostInfo))
+        {
+            continue;
+        }
+
+        host.mHostInfo = std::make_shared<DiscoveredHostInfo>(std::move(hostInfo));
+
+        {
+            std::string           name = host.mHostName;
+            DiscoveredHostInfoPtr info = host.mHostInfo;
+
+            callbacks.push_back([this, name, info]() { OnHostResolved(name, info); });
+        }
+    }
+
+    if (mSubscribedServices.empty() && mSubscribedHosts.empty())
+    {
+        mCache.clear();
+    }
+
+    for (auto it = mQuestions.begin(); it != mQuestions.end();)
+    {
+        it = (questions.count(it->first) > 0) ? std::next(it) : mQuestions.erase(it);
+    }
+
+    for (const auto &question : questions)
+    {
+        if (mQuestions.count(question.first) == 0)
+        {
+            // The first query is delayed to aggregate questions, see RFC 6762 section 5.2.
+            mQuestions.emplace(question.first, QuestionState{question.second, question.first.second,
+                                                             now + RandomDelay(20, 120), kInitialQueryInterval});
+        }
+    }
+
+    // The callbacks may update the subscriptions, so they are invoked at last.
+    for (const std::function<void()> &callback : callbacks)
+    {
+        callback();
+    }
+}
+
+Publisher *Publisher::Create(StateCallback aCallback, const std::string &aInterfaceName)
+{
+    return new PublisherNative(aCallback, aInterfaceName);
+}
+
+void Publisher::Destroy(Publisher *aPublisher)
+{
+    delete static_cast<PublisherNative *>(aPublisher);
+}
+
+} // namespace Mdns
+
+} // namespace otbr
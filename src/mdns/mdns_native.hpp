@@ -0,0 +1,411 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the built-in mDNS publisher.
+ */
+
+#ifndef OTBR_AGENT_MDNS_NATIVE_HPP_
+#define OTBR_AGENT_MDNS_NATIVE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <netinet/in.h>
+
+#include "common/code_utils.hpp"
+#include "common/mainloop.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
+#include "mdns/mdns.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+/**
+ * This class implements mDNS publisher with a built-in mDNS responder.
+ *
+ * The publisher owns the mDNS socket on the infrastructure link and answers queries from its in-memory record
+ * tables, so no external mDNS daemon is required. Probes and announcements which are due at the same time are
+ * sent together in as few messages as possible. Only IPv6 is supported.
+ *
+ * If an interface name is given, the publisher only listens and answers on that interface and only publishes the
+ * addresses of that interface for the local host.
+ *
+ */
+class PublisherNative : public MainloopProcessor, public Publisher
+{
+public:
+    /**
+     * This constructor initializes the publisher.
+     *
+     * @param[in] aCallback       The callback for receiving mDNS publisher state changes.
+     * @param[in] aInterfaceName  The infrastructure network interface, empty for all up multicast interfaces.
+     *
+     */
+    PublisherNative(StateCallback aCallback, const std::string &aInterfaceName);
+
+    ~PublisherNative(void) override;
+
+    // Implementation of Mdns::Publisher.
+
+    void UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback) override;
+
+    void      UnpublishHost(const std::string &aName, ResultCallback &&aCallback) override;
+    void      UnpublishKey(const std::string &aName, ResultCallback &&aCallback) override;
+    void      SubscribeService(const std::string &aType, const std::string &aInstanceName) override;
+    void      UnsubscribeService(const std::string &aType, const std::string &aInstanceName) override;
+    void      SubscribeHost(const std::string &aHostName) override;
+    void      UnsubscribeHost(const std::string &aHostName) override;
+    otbrError Start(void) override;
+    bool      IsStarted(void) const override;
+    void      Stop(void) override;
+
+    // Implementation of MainloopProcessor.
+
+    void Update(MainloopContext &aMainloop) override;
+    void Process(const MainloopContext &aMainloop) override;
+
+protected:
+    otbrError PublishServiceImpl(const std::string &aHostName,
+                                 const std::string &aName,
+                                 const std::string &aType,
+                                 const SubTypeList &aSubTypeList,
+                                 uint16_t           aPort,
+                                 const TxtData     &aTxtData,
+                                 ResultCallback   &&aCallback) override;
+    otbrError PublishHostImpl(const std::string &aName,
+                              const AddressList &aAddresses,
+                              ResultCallback   &&aCallback) override;
+    otbrError PublishKeyImpl(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback) override;
+    void      OnServiceResolveFailedImpl(const std::string &aType,
+                                         const std::string &aInstanceName,
+                                         int32_t            aErrorCode) override;
+    void      OnHostResolveFailedImpl(const std::string &aHostName, int32_t aErrorCode) override;
+    otbrError DnsErrorToOtbrError(int32_t aErrorCode) override;
+
+private:
+    static constexpr uint16_t kMdnsPort         = 5353;
+    static constexpr size_t   kMaxMessageSize   = 1440; // Fits in the minimum IPv6 MTU of the infrastructure link.
+    static constexpr uint32_t kHostTtl          = 120;  // TTL of SRV and AAAA records, see RFC 6762 section 10.
+    static constexpr uint32_t kServiceTtl       = 4500; // TTL of all other records.
+    static constexpr uint32_t kLegacyUnicastTtl = 10;
+    static constexpr uint8_t  kNumProbes        = 3;
+    static constexpr uint8_t  kNumAnnouncements = 2;
+
+    enum RecordType : uint16_t
+    {
+        kTypePtr  = 12,
+        kTypeTxt  = 16,
+        kTypeKey  = 25,
+        kTypeAaaa = 28,
+        kTypeSrv  = 33,
+        kTypeAny  = 255,
+    };
+
+    struct Record
+    {
+        std::string          mName;   ///< The owner name in uncompressed DNS wire format.
+        uint16_t             mType;   ///< The record type.
+        uint32_t             mTtl;    ///< The TTL in seconds.
+        bool                 mUnique; ///< Whether the record is unique and sent with the cache-flush bit.
+        std::vector<uint8_t> mData;   ///< The RDATA, in which domain names are never compressed.
+
+        bool IsSameAs(const Record &aOther) const;
+    };
+
+    struct Question
+    {
+        std::string mName;            ///< The queried name in uncompressed DNS wire format.
+        uint16_t    mType;            ///< The queried record type.
+        bool        mUnicastResponse; ///< Whether a unicast response is requested (the QU bit).
+    };
+
+    struct Message
+    {
+        uint16_t              mId    = 0;
+        uint16_t              mFlags = 0;
+        std::vector<Question> mQuestions;
+        std::vector<Record>   mAnswers;
+        std::vector<Record>   mAuthorities;
+        std::vector<Record>   mAdditionals;
+
+        bool      IsResponse(void) const;
+        otbrError Parse(const uint8_t *aBuffer, size_t aLength);
+        void      Encode(std::vector<uint8_t> &aBuffer) const;
+        size_t    GetSize(void) const;
+    };
+
+    // Packs questions and records into as few messages as possible.
+    class MessageBatch
+    {
+    public:
+        explicit MessageBatch(Message aTemplate)
+            : mTemplate(std::move(aTemplate))
+        {
+        }
+
+        // Appends the questions and records of `aUnit` to the same message, so an optional unit is dropped
+        // instead of starting a new message when the current one is full.
+        void Append(const Message &aUnit, bool aOptional = false);
+
+        const std::vector<Message> &GetMessages(void) const { return mMessages; }
+
+    private:
+        static void Merge(Message &aMessage, const Message &aUnit);
+        static bool TryAppend(Message &aMessage, const Message &aUnit);
+
+        Message              mTemplate;
+        std::vector<Message> mMessages;
+    };
+
+    // The records owned by this publisher, which are probed and announced together.
+    class RecordSet
+    {
+    public:
+        enum class State : uint8_t
+        {
+            kProbing,
+            kAnnouncing,
+            kAnnounced,
+        };
+
+        explicit RecordSet(PublisherNative &aOwner)
+            : mOwner(aOwner)
+        {
+        }
+
+        virtual ~RecordSet(void);
+
+        // Called when probing the unique records of this set has finished.
+        virtual void HandleProbed(otbrError aError) = 0;
+
+        bool IsAnswering(void) const { return mState != State::kProbing; }
+
+        PublisherNative    &mOwner;
+        std::vector<Record> mRecords;
+        uint64_t            mId       = 0;
+        State               mState    = State::kProbing;
+        uint8_t             mTxCount  = 0;
+        bool                mConflict = false;
+        Timepoint           mFireTime;
+    };
+
+    class NativeServiceRegistration : public ServiceRegistration, public RecordSet
+    {
+    public:
+        NativeServiceRegistration(std::string      aHostName,
+                                  std::string      aName,
+                                  std::string      aType,
+                                  SubTypeList      aSubTypeList,
+                                  uint16_t         aPort,
+                                  TxtData          aTxtData,
+                                  ResultCallback &&aCallback,
+                                  PublisherNative *aPublisher)
+            : ServiceRegistration(std::move(aHostName),
+                                  std::move(aName),
+                                  std::move(aType),
+                                  std::move(aSubTypeList),
+                                  aPort,
+                                  std::move(aTxtData),
+                                  std::move(aCallback),
+                                  aPublisher)
+            , RecordSet(*aPublisher)
+        {
+        }
+
+        otbrError Register(void);
+        void      HandleProbed(otbrError aError) override;
+    };
+
+    class NativeHostRegistration : public HostRegistration, public RecordSet
+    {
+    public:
+        NativeHostRegistration(std::string      aName,
+                               AddressList      aAddresses,
+                               ResultCallback &&aCallback,
+                               PublisherNative *aPublisher)
+            : HostRegistration(std::move(aName), std::move(aAddresses), std::move(aCallback), aPublisher)
+            , RecordSet(*aPublisher)
+        {
+        }
+
+        otbrError Register(void);
+        void      HandleProbed(otbrError aError) override;
+    };
+
+    class NativeKeyRegistration : public KeyRegistration, public RecordSet
+    {
+    public:
+        NativeKeyRegistration(std::string      aName,
+                              KeyData          aKeyData,
+                              ResultCallback &&aCallback,
+                              PublisherNative *aPublisher)
+            : KeyRegistration(std::move(aName), std::move(aKeyData), std::move(aCallback), aPublisher)
+            , RecordSet(*aPublisher)
+        {
+        }
+
+        otbrError Register(void);
+        void      HandleProbed(otbrError aError) override;
+    };
+
+    // The AAAA records of this device, which services with an empty host name reside on.
+    class LocalHost : public RecordSet
+    {
+    public:
+        using RecordSet::RecordSet;
+
+        void HandleProbed(otbrError aError) override;
+    };
+
+    struct CacheEntry
+    {
+        Record    mRecord;
+        uint32_t  mNetifIndex;
+        Timepoint mReceiveTime;
+        Timepoint mExpireTime;
+        uint8_t   mQueryCount; // The number of queries sent to refresh this record.
+
+        Timepoint GetRefreshTime(void) const;
+    };
+
+    struct QuestionState
+    {
+        std::string  mName;
+        uint16_t     mType;
+        Timepoint    mNextTime;
+        Milliseconds mInterval;
+    };
+
+    struct ServiceSubscription
+    {
+        std::string mType;
+        std::string mInstanceName;
+
+        // Lower-case instance name -> the instance last reported to subscribers, which has no addresses while the
+        // instance is not resolved.
+        std::map<std::string, std::shared_ptr<DiscoveredInstanceInfo>> mInstances;
+    };
+
+    struct HostSubscription
+    {
+        std::string                         mHostName;
+        std::shared_ptr<DiscoveredHostInfo> mHostInfo;
+    };
+
+    using QuestionKey = std::pair<std::string, uint16_t>;
+
+    static std::string MakeHostName(const std::string &aHostName);
+    static std::string MakeServiceTypeName(const std::string &aType);
+    static std::string MakeInstanceName(const std::string &aInstanceName, const std::string &aType);
+    static std::string MakeKeyName(const std::string &aName);
+
+    void      AddRecordSet(RecordSet &aRecordSet);
+    void      RemoveRecordSet(RecordSet &aRecordSet);
+    otbrError OpenSocket(void);
+    void      UpdateInterfaces(void);
+    void      UpdateLocalHost(const AddressList &aAddresses);
+    void      Send(const Message &aMessage, uint32_t aNetifIndex, const sockaddr_in6 &aDest);
+    void      SendMulticast(const MessageBatch &aBatch, uint32_t aNetifIndex);
+    void      Receive(void);
+    void      HandleQuery(const Message &aQuery, const sockaddr_in6 &aSender, uint32_t aNetifIndex, bool aIsOwn);
+    void      HandleProbeQuery(const Message &aQuery);
+    void      HandleResponse(const Message &aResponse, uint32_t aNetifIndex, bool aIsOwn);
+    void      HandleConflict(RecordSet &aRecordSet, bool aIsProbeLost);
+    void      CheckConflict(const Record &aRecord);
+    void      FindAnswers(const std::string &aName, uint16_t aType, std::vector<Record> &aRecords) const;
+    void      AddAdditionals(const std::vector<Record> &aAnswers, std::vector<Record> &aAdditionals) const;
+    bool      IsOwnMessage(const uint8_t *aBuffer, size_t aLength);
+    void      ProcessRecordSets(Timepoint aNow);
+    void      SendGoodbyes(void);
+    void      SendPendingResponses(Timepoint aNow);
+    void      SendQueries(Timepoint aNow);
+    void      AddToCache(const Record &aRecord, uint32_t aNetifIndex, Timepoint aNow);
+    void      ExpireCache(Timepoint aNow);
+    void      UpdateSubscriptions(void);
+    bool      ResolveInstance(const std::string                  &aInstanceName,
+                              DiscoveredInstanceInfo             &aInstanceInfo,
+                              std::map<QuestionKey, std::string> &aQuestions) const;
+    uint32_t  ResolveAddresses(const std::string &aHostName, AddressList &aAddresses, uint32_t &aTtl) const;
+    Milliseconds RandomDelay(uint32_t aMinMs, uint32_t aMaxMs);
+
+    static void AddQuestion(std::map<QuestionKey, std::string> &aQuestions, const std::string &aName, uint16_t aType);
+
+    const CacheEntry *FindCacheEntry(const std::string &aName, uint16_t aType) const;
+    RecordSet        *FindRecordSet(uint64_t aId) const;
+
+    int           mSocket;
+    State         mState;
+    StateCallback mStateCallback;
+    std::string   mInterfaceName;
+
+    std::string                mLocalHostName;
+    std::unique_ptr<LocalHost> mLocalHost;
+    std::vector<uint32_t>      mNetifIndexes;
+    Timepoint                  mInterfaceCheckTime;
+
+    std::vector<RecordSet *> mRecordSets;
+    uint64_t                 mNextRecordSetId;
+    std::vector<std::string> mReleasedNames; // Lower-case unique names released by removed record sets.
+    std::vector<Record>      mGoodbyes;
+
+    // Network interface index -> the multicast response which is delayed to aggregate answers.
+    std::map<uint32_t, std::pair<Timepoint, Message>> mPendingResponses;
+
+    // Lower-case name -> the cached records of the name.
+    std::map<std::string, std::vector<CacheEntry>> mCache;
+    bool                                           mCacheChanged;
+
+    std::map<QuestionKey, QuestionState> mQuestions;
+    std::vector<ServiceSubscription>     mSubscribedServices;
+    std::vector<HostSubscription>        mSubscribedHosts;
+
+    // The hashes of recently sent messages, to recognize them when they are looped back.
+    std::vector<std::pair<Timepoint, size_t>> mSentMessages;
+
+    std::default_random_engine mRandom;
+};
+
+/**
+ * @}
+ */
+
+} // namespace Mdns
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_MDNS_NATIVE_HPP_
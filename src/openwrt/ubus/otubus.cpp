@@ -45,6 +45,7 @@
 
 #include "common/logging.hpp"
 #include "ncp/ncp_openthread.hpp"
+#include "utils/hex.hpp"
 
 namespace otbr {
 namespace ubus {
@@ -225,31 +226,25 @@ static struct ubus_object otbr = {
 
 void UbusServer::ProcessScan(void)
 {
-    otError  error        = OT_ERROR_NONE;
-    uint32_t scanChannels = 0;
-    uint16_t scanDuration = 0;
-
     mNcpThreadMutex->lock();
-    SuccessOrExit(error = otLinkActiveScan(mController->GetInstance(), scanChannels, scanDuration,
-                                           &UbusServer::HandleActiveScanResult, this));
-exit:
+    // The Thread helper merges this scan with those of other clients, or reports results of a recent scan.
+    mController->GetThreadHelper()->Scan([this](otError aError, const std::vector<otActiveScanResult> &aResults) {
+        if (aError != OT_ERROR_NONE)
+        {
+            otbrLogWarning("Failed to scan: %s", otThreadErrorToString(aError));
+        }
+        for (const otActiveScanResult &result : aResults)
+        {
+            HandleActiveScanResultDetail(&result);
+        }
+        HandleActiveScanResultDetail(nullptr);
+    });
     mNcpThreadMutex->unlock();
-    return;
-}
-
-void UbusServer::HandleActiveScanResult(otActiveScanResult *aResult, void *aContext)
-{
-    static_cast<UbusServer *>(aContext)->HandleActiveScanResultDetail(aResult);
 }
 
 void UbusServer::OutputBytes(const uint8_t *aBytes, uint8_t aLength, char *aOutput)
 {
-    char byte2char[5] = "";
-    for (int i = 0; i < aLength; i++)
-    {
-        sprintf(byte2char, "%02x", aBytes[i]);
-        strcat(aOutput, byte2char);
-    }
+    Utils::Bytes2LowercaseHex(aBytes, aLength, aOutput + strlen(aOutput));
 }
 
 void UbusServer::AppendResult(otError aError, struct ubus_context *aContext, struct ubus_request_data *aRequest)
@@ -258,7 +253,7 @@ void UbusServer::AppendResult(otError aError, struct ubus_context *aContext, str
     ubus_send_reply(aContext, aRequest, mBuf.head);
 }
 
-void UbusServer::HandleActiveScanResultDetail(otActiveScanResult *aResult)
+void UbusServer::HandleActiveScanResultDetail(const otActiveScanResult *aResult)
 {
     void *jsonList = nullptr;
 
@@ -833,21 +833,12 @@ private:
                               struct blob_attr         *aMsg);
 
     /**
-     * This method handle scan result (callback function).
+     * This method detailly handler a scan result.
      *
-     * @param[in] aResult   A pointer to result.
-     * @param[in] aContext  A pointer to context.
+     * @param[in] aResult  A pointer to result, nullptr when the scan is done.
      *
      */
-    static void HandleActiveScanResult(otActiveScanResult *aResult, void *aContext);
-
-    /**
-     * This method detailly handler the scan result, called by HandleActiveScanResult.
-     *
-     * @param[in] aResult  A pointer to result.
-     *
-     */
-    void HandleActiveScanResultDetail(otActiveScanResult *aResult);
+    void HandleActiveScanResultDetail(const otActiveScanResult *aResult);
 
     /**
      * This method detailly handler get neighbor information.
@@ -31,9 +31,12 @@
 #include <cerrno>
 
 #include <assert.h>
+#include <stdio.h>
 
+#include <sys/epoll.h>
 #include <sys/socket.h>
-#include <sys/time.h>
+
+#include "rest/worker_pool.hpp"
 
 using std::chrono::duration_cast;
 using std::chrono::microseconds;
@@ -46,21 +49,37 @@ namespace rest {
 // The timeout (in microseconds) since a connection is in wait callback state
 static const uint32_t kCallbackTimeout = 10000000;
 
-// The time interval (in microseconds) for checking again if there is a connection need callback.
-static const uint32_t kCallbackCheckInterval = 500000;
-
 // The timeout (in microseconds) since a connection is in wait write state
 static const uint32_t kWriteTimeout = 10000000;
 
 // The timeout (in microseconds) since a connection is in wait read state
 static const uint32_t kReadTimeout = 1000000;
 
-Connection::Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd)
+// The time interval (in microseconds) without events after which an event stream sends a keep-alive comment.
+static const uint32_t kStreamKeepAliveInterval = 15000000;
+
+// Maximum number of bytes buffered for an event stream before the subscriber is dropped as too slow.
+static const size_t kMaxStreamBufferSize = 16384;
+
+// Number of bytes below which the write buffer of a chunked response is refilled with the next part of the body.
+static const size_t kChunkedLowWatermark = 4096;
+
+Connection::Connection(steady_clock::time_point aStartTime,
+                       Resource                *aResource,
+                       Worker                  &aWorker,
+                       uint64_t                 aId,
+                       int                      aFd)
     : mTimeStamp(aStartTime)
     , mFd(aFd)
+    , mId(aId)
     , mState(ConnectionState::kInit)
+    , mResponse(std::make_shared<Response>())
     , mParser(&mRequest)
     , mResource(aResource)
+    , mWorker(aWorker)
+    , mStreamEventId(0)
+    , mChunkedComplete(false)
+    , mChunkPending(false)
 {
 }
 
@@ -74,29 +93,38 @@ void Connection::Init(void)
     mParser.Init();
 }
 
-void Connection::UpdateReadFdSet(fd_set &aReadFdSet, int &aMaxFd) const
+uint32_t Connection::GetEvents(void) const
 {
-    if (mState == ConnectionState::kReadWait || mState == ConnectionState::kInit)
-    {
-        FD_SET(mFd, &aReadFdSet);
-        aMaxFd = aMaxFd < mFd ? mFd : aMaxFd;
-    }
-}
+    uint32_t events = 0;
 
-void Connection::UpdateWriteFdSet(fd_set &aWriteFdSet, int &aMaxFd) const
-{
-    if (mState == ConnectionState::kWriteWait)
+    switch (mState)
     {
-        FD_SET(mFd, &aWriteFdSet);
-        aMaxFd = aMaxFd < mFd ? mFd : aMaxFd;
+    case ConnectionState::kInit:
+    case ConnectionState::kReadWait:
+        events = EPOLLIN;
+        break;
+    case ConnectionState::kWriteWait:
+        events = EPOLLOUT;
+        break;
+    case ConnectionState::kStreamWait:
+    case ConnectionState::kChunkedWrite:
+        if (!mWriteContent.empty())
+        {
+            events = EPOLLOUT;
+        }
+        break;
+    default:
+        break;
     }
+
+    return events;
 }
 
-void Connection::UpdateTimeout(timeval &aTimeout) const
+void Connection::UpdateTimeout(int &aTimeout) const
 {
-    struct timeval timeout;
-    uint32_t       timeoutLen = kReadTimeout;
-    auto           duration   = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    uint32_t timeoutLen = kReadTimeout;
+    int      timeout;
+    auto     duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
 
     switch (mState)
     {
@@ -104,11 +132,15 @@ void Connection::UpdateTimeout(timeval &aTimeout) const
         timeoutLen = kReadTimeout;
         break;
     case ConnectionState::kCallbackWait:
-        timeoutLen = kCallbackCheckInterval;
+        timeoutLen = kCallbackTimeout;
         break;
     case ConnectionState::kWriteWait:
+    case ConnectionState::kChunkedWrite:
         timeoutLen = kWriteTimeout;
         break;
+    case ConnectionState::kStreamWait:
+        timeoutLen = mWriteContent.empty() ? kStreamKeepAliveInterval : kWriteTimeout;
+        break;
     case ConnectionState::kComplete:
         timeoutLen = 0;
         break;
@@ -116,28 +148,24 @@ void Connection::UpdateTimeout(timeval &aTimeout) const
         break;
     }
 
-    if (duration <= timeoutLen)
-    {
-        timeout.tv_sec  = 0;
-        timeout.tv_usec = timeoutLen - duration;
-    }
-    else
-    {
-        timeout.tv_sec  = 0;
-        timeout.tv_usec = 0;
-    }
+    // Round up, so that the connection is not processed just before it times out.
+    timeout = (duration <= timeoutLen) ? static_cast<int>((timeoutLen - duration + 999) / 1000) : 0;
 
-    if (timercmp(&timeout, &aTimeout, <))
+    if (aTimeout < 0 || timeout < aTimeout)
     {
         aTimeout = timeout;
     }
 }
 
-void Connection::Update(MainloopContext &aMainloop)
+void Connection::Update(uint32_t &aEvents, int &aTimeout)
 {
-    UpdateTimeout(aMainloop.mTimeout);
-    UpdateReadFdSet(aMainloop.mReadFdSet, aMainloop.mMaxFd);
-    UpdateWriteFdSet(aMainloop.mWriteFdSet, aMainloop.mMaxFd);
+    if (mState == ConnectionState::kStreamWait)
+    {
+        UpdateStream();
+    }
+
+    aEvents = GetEvents();
+    UpdateTimeout(aTimeout);
 }
 
 void Connection::Disconnect(void)
@@ -151,35 +179,42 @@ void Connection::Disconnect(void)
     }
 }
 
-void Connection::Process(const MainloopContext &aMainloop)
+void Connection::Process(uint32_t aEvents)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    // The connection was reset or closed, nothing can be sent to the peer anymore.
+    VerifyOrExit(!(aEvents & (EPOLLERR | EPOLLHUP)), Disconnect());
 
     switch (mState)
     {
     // Initial state, directly read for the first time.
     case ConnectionState::kInit:
     case ConnectionState::kReadWait:
-        ProcessWaitRead(aMainloop.mReadFdSet);
+        ProcessWaitRead(aEvents);
         break;
     case ConnectionState::kCallbackWait:
-        //  Wait for Callback process.
+        // Wait for the mainloop to handle the request.
         ProcessWaitCallback();
         break;
     case ConnectionState::kWriteWait:
-        ProcessWaitWrite(aMainloop.mWriteFdSet);
+        ProcessWaitWrite(aEvents);
+        break;
+    case ConnectionState::kStreamWait:
+        ProcessStream(aEvents);
+        break;
+    case ConnectionState::kChunkedWrite:
+        ProcessChunked(aEvents);
+        break;
+    case ConnectionState::kComplete:
         break;
     default:
         assert(false);
     }
 
-    if (error != OTBR_ERROR_NONE)
-    {
-        Disconnect();
-    }
+exit:
+    return;
 }
 
-void Connection::ProcessWaitRead(const fd_set &aReadFdSet)
+void Connection::ProcessWaitRead(uint32_t aEvents)
 {
     otbrError error    = OTBR_ERROR_NONE;
     int32_t   received = 0, err;
@@ -189,8 +224,8 @@ void Connection::ProcessWaitRead(const fd_set &aReadFdSet)
     // Reach a read timeout, will send response about this timeout later.
     VerifyOrExit(duration <= kReadTimeout, error = OTBR_ERROR_REST);
 
-    // It will succeed either fd is set or it is in kInit state.
-    VerifyOrExit(FD_ISSET(mFd, &aReadFdSet) || mState == ConnectionState::kInit);
+    // It will succeed either fd is readable or it is in kInit state.
+    VerifyOrExit((aEvents & EPOLLIN) || mState == ConnectionState::kInit);
 
     do
     {
@@ -217,16 +252,17 @@ void Connection::ProcessWaitRead(const fd_set &aReadFdSet)
     VerifyOrExit(received > 0 || (received == -1 && (err == EAGAIN || err == EWOULDBLOCK)), error = OTBR_ERROR_REST);
 
 exit:
-    if (error != OTBR_ERROR_NONE)
+    // Once the request is complete, `Handle()` takes care of the response.
+    if (error != OTBR_ERROR_NONE && !mRequest.IsComplete())
     {
         if (received < 0)
         {
-            mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
+            mResource->ErrorHandler(*mResponse, HttpStatusCode::kStatusInternalServerError);
             Write();
         }
         else
         {
-            mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusRequestTimeout);
+            mResource->ErrorHandler(*mResponse, HttpStatusCode::kStatusRequestTimeout);
             Write();
         }
     }
@@ -240,12 +276,35 @@ void Connection::Handle(void)
     // socket.
     VerifyOrExit((shutdown(mFd, SHUT_RD) == 0), error = OTBR_ERROR_REST);
 
-    mResource->Handle(mRequest, mResponse);
+    // The request is handled on the mainloop, which reads the OpenThread state. The response comes back through
+    // `HandleResponse()`.
+    mState     = ConnectionState::kCallbackWait;
+    mTimeStamp = steady_clock::now();
+    mWorker.HandleRequest(mId, mRequest);
+
+exit:
 
-    if (mResponse.NeedCallback())
+    if (error != OTBR_ERROR_NONE)
     {
-        mState     = ConnectionState::kCallbackWait;
-        mTimeStamp = steady_clock::now();
+        mResource->ErrorHandler(*mResponse, HttpStatusCode::kStatusInternalServerError);
+        Write();
+    }
+}
+
+void Connection::HandleResponse(std::shared_ptr<Response> aResponse)
+{
+    // The request may have timed out in the meantime.
+    VerifyOrExit(mState == ConnectionState::kCallbackWait);
+
+    mResponse = std::move(aResponse);
+
+    if (mResponse->IsStream())
+    {
+        StartStream();
+    }
+    else if (mResponse->IsChunked())
+    {
+        StartChunked();
     }
     else
     {
@@ -254,41 +313,27 @@ void Connection::Handle(void)
     }
 
 exit:
-
-    if (error != OTBR_ERROR_NONE)
-    {
-        mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
-        Write();
-    }
+    return;
 }
 
 void Connection::ProcessWaitCallback(void)
 {
     auto duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
 
-    mResource->HandleCallback(mRequest, mResponse);
-
-    if (mResponse.IsComplete())
+    if (duration >= kCallbackTimeout)
     {
+        mResource->ErrorHandler(*mResponse, HttpStatusCode::kStatusInternalServerError);
         Write();
     }
-    else
-    {
-        if (duration >= kCallbackTimeout)
-        {
-            mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
-            Write();
-        }
-    }
 }
 
-void Connection::ProcessWaitWrite(const fd_set &aWriteFdSet)
+void Connection::ProcessWaitWrite(uint32_t aEvents)
 {
     auto duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
 
     if (duration <= kWriteTimeout)
     {
-        if (FD_ISSET(mFd, &aWriteFdSet))
+        if (aEvents & EPOLLOUT)
         {
             Write();
         }
@@ -309,9 +354,10 @@ void Connection::Write(void)
     if (mState != ConnectionState::kWriteWait)
     {
         // Change its state when try write for the first time.
-        mState        = ConnectionState::kWriteWait;
-        mTimeStamp    = steady_clock::now();
-        mWriteContent = mResponse.Serialize();
+        mState     = ConnectionState::kWriteWait;
+        mTimeStamp = steady_clock::now();
+        mResponse->FormatBody();
+        mWriteContent = mResponse->Serialize();
     }
 
     // Check we do have something to write.
@@ -352,6 +398,180 @@ exit:
     }
 }
 
+void Connection::StartStream(void)
+{
+    mState         = ConnectionState::kStreamWait;
+    mTimeStamp     = steady_clock::now();
+    mStreamEventId = mResponse->GetStreamEventId();
+    mWriteContent  = mResponse->Serialize();
+
+    WriteStream();
+}
+
+void Connection::UpdateStream(void)
+{
+    otbrError error       = OTBR_ERROR_NONE;
+    uint64_t  lastEventId = mResource->GetLastEventId();
+    auto      duration    = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+
+    // A subscriber which could not even take pending data in time has most likely gone away.
+    VerifyOrExit(mWriteContent.empty() || duration <= kWriteTimeout, error = OTBR_ERROR_REST);
+
+    if (lastEventId != mStreamEventId)
+    {
+        // A subscriber which fell behind the event history is dropped, it will resubscribe and get the latest data.
+        VerifyOrExit(mResource->GetEvents(mStreamEventId, mWriteContent), error = OTBR_ERROR_REST);
+        mStreamEventId = lastEventId;
+    }
+    else if (mWriteContent.empty() && duration >= kStreamKeepAliveInterval)
+    {
+        // Comment lines are ignored by clients, but keep proxies from closing the stream and detect closed peers.
+        mWriteContent = ":\n\n";
+    }
+
+    VerifyOrExit(mWriteContent.size() <= kMaxStreamBufferSize, error = OTBR_ERROR_REST);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        Disconnect();
+    }
+}
+
+void Connection::ProcessStream(uint32_t aEvents)
+{
+    if (!mWriteContent.empty() && (aEvents & EPOLLOUT))
+    {
+        WriteStream();
+    }
+}
+
+void Connection::WriteStream(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    ssize_t   sendLength;
+
+    VerifyOrExit(!mWriteContent.empty());
+
+    do
+    {
+        // The subscriber may close the stream at any time, so never raise SIGPIPE.
+        sendLength = send(mFd, mWriteContent.c_str(), mWriteContent.size(), MSG_NOSIGNAL);
+    } while (sendLength < 0 && errno == EINTR);
+
+    if (sendLength > 0)
+    {
+        mWriteContent.erase(0, sendLength);
+        mTimeStamp = steady_clock::now();
+    }
+    else
+    {
+        VerifyOrExit(errno == EAGAIN || errno == EWOULDBLOCK, error = OTBR_ERROR_REST);
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        Disconnect();
+    }
+}
+
+void Connection::StartChunked(void)
+{
+    mState           = ConnectionState::kChunkedWrite;
+    mTimeStamp       = steady_clock::now();
+    mChunkedComplete = false;
+    mChunkPending    = false;
+    mWriteContent    = mResponse->Serialize();
+
+    WriteChunked();
+}
+
+void Connection::ProcessChunked(uint32_t aEvents)
+{
+    auto duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+
+    if (duration > kWriteTimeout)
+    {
+        Disconnect();
+    }
+    else if (aEvents & EPOLLOUT)
+    {
+        WriteChunked();
+    }
+}
+
+void Connection::HandleChunk(const std::string &aChunk, bool aMore)
+{
+    char chunkSize[sizeof(size_t) * 2 + 3];
+
+    VerifyOrExit(mState == ConnectionState::kChunkedWrite && mChunkPending);
+
+    mChunkPending    = false;
+    mChunkedComplete = !aMore;
+
+    if (!aChunk.empty())
+    {
+        snprintf(chunkSize, sizeof(chunkSize), "%zx\r\n", aChunk.size());
+        mWriteContent.append(chunkSize).append(aChunk).append("\r\n");
+    }
+
+    if (mChunkedComplete)
+    {
+        mWriteContent.append("0\r\n\r\n");
+    }
+
+    WriteChunked();
+
+exit:
+    return;
+}
+
+void Connection::WriteChunked(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    ssize_t   sendLength;
+
+    // The next part of the body is only produced once the client took most of the previous one, so the memory used
+    // does not depend on the size of the body. The body is made of the OpenThread tables, so it is produced on the
+    // mainloop and comes back through `HandleChunk()`.
+    if (!mChunkedComplete && !mChunkPending && mWriteContent.size() < kChunkedLowWatermark)
+    {
+        mChunkPending = true;
+        mWorker.ProduceChunk(mId, mResponse);
+    }
+
+    if (!mWriteContent.empty())
+    {
+        do
+        {
+            // The client may close the connection at any time, so never raise SIGPIPE.
+            sendLength = send(mFd, mWriteContent.c_str(), mWriteContent.size(), MSG_NOSIGNAL);
+        } while (sendLength < 0 && errno == EINTR);
+
+        if (sendLength > 0)
+        {
+            mWriteContent.erase(0, sendLength);
+            mTimeStamp = steady_clock::now();
+        }
+        else
+        {
+            VerifyOrExit(errno == EAGAIN || errno == EWOULDBLOCK, error = OTBR_ERROR_REST);
+        }
+    }
+
+    if (mChunkedComplete && mWriteContent.empty())
+    {
+        Disconnect();
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        Disconnect();
+    }
+}
+
 bool Connection::IsComplete() const
 {
     return mState == ConnectionState::kComplete;
@@ -36,10 +36,11 @@
 
 #include "openthread-br/config.h"
 
+#include <memory>
+
 #include <string.h>
 #include <unistd.h>
 
-#include "common/mainloop.hpp"
 #include "rest/parser.hpp"
 #include "rest/resource.hpp"
 
@@ -48,11 +49,16 @@ using std::chrono::steady_clock;
 namespace otbr {
 namespace rest {
 
+class Worker;
+
 /**
  * This class implements a Connection class of each socket connection.
  *
+ * A connection is driven by the epoll loop of the worker thread it belongs to. Only handling its request is done on
+ * the mainloop.
+ *
  */
-class Connection : public MainloopProcessor
+class Connection
 {
 public:
     /**
@@ -63,16 +69,18 @@ public:
      *                        reset when transfer to wait callback or wait write
      *                        state.
      * @param[in] aResource   A pointer to the resource handler.
+     * @param[in] aWorker     A reference to the worker thread the connection belongs to.
+     * @param[in] aId         The identifier of the connection, unique within the worker thread.
      * @param[in] aFd         The file descriptor for the connection.
      *
      */
-    Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd);
+    Connection(steady_clock::time_point aStartTime, Resource *aResource, Worker &aWorker, uint64_t aId, int aFd);
 
     /**
      * The desctructor destroys the connection instance.
      *
      */
-    ~Connection(void) override;
+    ~Connection(void);
 
     /**
      * This method initializes the connection.
@@ -81,8 +89,56 @@ public:
      */
     void Init(void);
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    /**
+     * This method updates the epoll events and the timeout this connection waits for.
+     *
+     * @param[out]    aEvents   The epoll events to wait for.
+     * @param[in,out] aTimeout  The timeout (in milliseconds) of the epoll wait, lowered to when this connection needs
+     *                          to be processed.
+     *
+     */
+    void Update(uint32_t &aEvents, int &aTimeout);
+
+    /**
+     * This method processes the connection after an epoll wait.
+     *
+     * @param[in] aEvents  The epoll events which occurred on this connection, zero if none.
+     *
+     */
+    void Process(uint32_t aEvents);
+
+    /**
+     * This method writes the response to the request of this connection, once the mainloop handled the request.
+     *
+     * @param[in] aResponse  The response to the request.
+     *
+     */
+    void HandleResponse(std::shared_ptr<Response> aResponse);
+
+    /**
+     * This method writes the next part of the body of a chunked response, once the mainloop produced it.
+     *
+     * @param[in] aChunk  The next part of the body.
+     * @param[in] aMore   Whether there is more of the body to produce.
+     *
+     */
+    void HandleChunk(const std::string &aChunk, bool aMore);
+
+    /**
+     * This method returns the identifier of this connection.
+     *
+     * @returns The identifier of this connection.
+     *
+     */
+    uint64_t GetId(void) const { return mId; }
+
+    /**
+     * This method returns the file descriptor of this connection.
+     *
+     * @returns The file descriptor of this connection, -1 if it was closed.
+     *
+     */
+    int GetFd(void) const { return mFd; }
 
     /**
      * This method indicates whether this connection no longer need to be processed.
@@ -94,15 +150,21 @@ public:
     bool IsComplete(void) const;
 
 private:
-    void UpdateReadFdSet(fd_set &aReadFdSet, int &aMaxFd) const;
-    void UpdateWriteFdSet(fd_set &aWriteFdSet, int &aMaxFd) const;
-    void UpdateTimeout(timeval &aTimeout) const;
-    void ProcessWaitRead(const fd_set &aReadFdSet);
-    void ProcessWaitCallback(void);
-    void ProcessWaitWrite(const fd_set &aWriteFdSet);
-    void Write(void);
-    void Handle(void);
-    void Disconnect(void);
+    uint32_t GetEvents(void) const;
+    void     UpdateTimeout(int &aTimeout) const;
+    void     ProcessWaitRead(uint32_t aEvents);
+    void     ProcessWaitCallback(void);
+    void     ProcessWaitWrite(uint32_t aEvents);
+    void     Write(void);
+    void     Handle(void);
+    void     StartStream(void);
+    void     UpdateStream(void);
+    void     ProcessStream(uint32_t aEvents);
+    void     WriteStream(void);
+    void     StartChunked(void);
+    void     ProcessChunked(uint32_t aEvents);
+    void     WriteChunked(void);
+    void     Disconnect(void);
 
     // Timestamp used for each check point of a connection
     steady_clock::time_point mTimeStamp;
@@ -110,11 +172,14 @@ private:
     // File descriptor for this connection
     int mFd;
 
+    // Identifier of this connection within its worker thread
+    uint64_t mId;
+
     // Enum indicates the state of this connection
     ConnectionState mState;
 
-    // Response instance binded to this connection
-    Response mResponse;
+    // Response instance binded to this connection, shared with the mainloop while it produces a chunked body
+    std::shared_ptr<Response> mResponse;
 
     // Request instance binded to this connection
     Request mRequest;
@@ -125,8 +190,20 @@ private:
     // Resource handler instance
     Resource *mResource;
 
+    // Worker thread this connection belongs to
+    Worker &mWorker;
+
     // Write buffer in case write multiple times
     std::string mWriteContent;
+
+    // Identifier of the last event queued to an event stream
+    uint64_t mStreamEventId;
+
+    // Whether the whole body of a chunked response has been queued to the write buffer
+    bool mChunkedComplete;
+
+    // Whether the mainloop is producing the next part of a chunked response
+    bool mChunkPending;
 };
 
 } // namespace rest
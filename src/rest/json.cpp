@@ -29,6 +29,10 @@
 #include "rest/json.hpp"
 #include <sstream>
 
+#include <assert.h>
+#include <inttypes.h>
+#include <stdio.h>
+
 #include "common/code_utils.hpp"
 #include "common/types.hpp"
 
@@ -42,10 +46,9 @@ namespace Json {
 
 static cJSON *Bytes2HexJson(const uint8_t *aBytes, uint8_t aLength)
 {
-    char hex[2 * aLength + 1];
+    char hex[2 * UINT8_MAX + 1];
 
     otbr::Utils::Bytes2Hex(aBytes, aLength, hex);
-    hex[2 * aLength] = '\0';
 
     return cJSON_CreateString(hex);
 }
@@ -89,6 +92,16 @@ exit:
     return ret;
 }
 
+std::string CompactJsonString(const std::string &aJsonString)
+{
+    std::vector<char> buffer(aJsonString.begin(), aJsonString.end());
+
+    buffer.push_back('\0');
+    cJSON_Minify(buffer.data());
+
+    return std::string(buffer.data());
+}
+
 std::string Json2String(const cJSON *aJson)
 {
     std::string ret;
@@ -127,21 +140,20 @@ static cJSON *Mode2Json(const otLinkModeConfig &aMode)
 static cJSON *IpAddr2Json(const otIp6Address &aAddress)
 {
     Ip6Address addr(aAddress.mFields.m8);
+    char       addrString[Ip6Address::kStringSize];
 
-    return cJSON_CreateString(addr.ToString().c_str());
+    return cJSON_CreateString(addr.ToString(addrString));
 }
 
 static cJSON *IpPrefix2Json(const otIp6NetworkPrefix &aAddress)
 {
-    std::stringstream ss;
-    otIp6Address      address = {};
+    Ip6Prefix prefix;
+    char      prefixString[Ip6Prefix::kStringSize];
 
-    address.mFields.mComponents.mNetworkPrefix = aAddress;
-    Ip6Address addr(address.mFields.m8);
+    memcpy(prefix.mPrefix.m8, aAddress.m8, sizeof(aAddress.m8));
+    prefix.mLength = OT_IP6_PREFIX_BITSIZE;
 
-    ss << addr.ToString() << "/" << OT_IP6_PREFIX_BITSIZE;
-
-    return cJSON_CreateString(ss.str().c_str());
+    return cJSON_CreateString(prefix.ToString(prefixString));
 }
 
 otbrError Json2IpPrefix(const cJSON *aJson, otIp6NetworkPrefix &aIpPrefix)
@@ -366,11 +378,11 @@ std::string Node2JsonString(const NodeInfo &aNode)
     cJSON_AddItemToObject(node, "State", cJSON_CreateString(aNode.mRole.c_str()));
     cJSON_AddItemToObject(node, "NumOfRouter", cJSON_CreateNumber(aNode.mNumOfRouter));
     cJSON_AddItemToObject(node, "RlocAddress", IpAddr2Json(aNode.mRlocAddress));
-    cJSON_AddItemToObject(node, "ExtAddress", Bytes2HexJson(aNode.mExtAddress, OT_EXT_ADDRESS_SIZE));
+    cJSON_AddItemToObject(node, "ExtAddress", Bytes2HexJson(aNode.mExtAddress.m8, OT_EXT_ADDRESS_SIZE));
     cJSON_AddItemToObject(node, "NetworkName", cJSON_CreateString(aNode.mNetworkName.c_str()));
     cJSON_AddItemToObject(node, "Rloc16", cJSON_CreateNumber(aNode.mRloc16));
     cJSON_AddItemToObject(node, "LeaderData", LeaderData2Json(aNode.mLeaderData));
-    cJSON_AddItemToObject(node, "ExtPanId", Bytes2HexJson(aNode.mExtPanId, OT_EXT_PAN_ID_SIZE));
+    cJSON_AddItemToObject(node, "ExtPanId", Bytes2HexJson(aNode.mExtPanId.m8, OT_EXT_PAN_ID_SIZE));
 
     ret = Json2String(node);
     cJSON_Delete(node);
@@ -600,6 +612,239 @@ std::string ChildTableEntry2JsonString(const otNetworkDiagChildEntry &aChildEntr
     return ret;
 }
 
+// Deletes the fields of a Json object which are not selected and serializes it without whitespace, as the entries
+// of a collection are streamed one after another. `aAllFields` lists every field the object may have.
+static std::string SelectedFields2JsonString(cJSON *aJson, const FieldSet &aFields, const FieldSet &aAllFields)
+{
+    std::string ret;
+    char       *jsonOut;
+    cJSON      *field = aJson->child;
+
+    while (field != nullptr)
+    {
+        cJSON *next = field->next;
+
+        assert(aAllFields.count(field->string) != 0);
+        OTBR_UNUSED_VARIABLE(aAllFields);
+
+        if (!aFields.empty() && aFields.find(field->string) == aFields.end())
+        {
+            cJSON_Delete(cJSON_DetachItemViaPointer(aJson, field));
+        }
+
+        field = next;
+    }
+
+    jsonOut = cJSON_PrintUnformatted(aJson);
+    if (jsonOut != nullptr)
+    {
+        ret = jsonOut;
+        cJSON_free(jsonOut);
+    }
+
+    cJSON_Delete(aJson);
+
+    return ret;
+}
+
+static cJSON *Ip4Addr2Json(const otIp4Address &aAddress)
+{
+    char addrString[sizeof("255.255.255.255")];
+
+    snprintf(addrString, sizeof(addrString), "%u.%u.%u.%u", aAddress.mFields.m8[0], aAddress.mFields.m8[1],
+             aAddress.mFields.m8[2], aAddress.mFields.m8[3]);
+
+    return cJSON_CreateString(addrString);
+}
+
+static cJSON *LeaseInfo2Json(const otSrpServerLeaseInfo &aLeaseInfo)
+{
+    cJSON *leaseInfo = cJSON_CreateObject();
+
+    cJSON_AddItemToObject(leaseInfo, "Lease", cJSON_CreateNumber(aLeaseInfo.mLease));
+    cJSON_AddItemToObject(leaseInfo, "KeyLease", cJSON_CreateNumber(aLeaseInfo.mKeyLease));
+    cJSON_AddItemToObject(leaseInfo, "RemainingLease", cJSON_CreateNumber(aLeaseInfo.mRemainingLease));
+    cJSON_AddItemToObject(leaseInfo, "RemainingKeyLease", cJSON_CreateNumber(aLeaseInfo.mRemainingKeyLease));
+
+    return leaseInfo;
+}
+
+static cJSON *Nat64ProtocolCounters2Json(const otNat64Counters &aCounters)
+{
+    cJSON *counters = cJSON_CreateObject();
+
+    cJSON_AddItemToObject(counters, "4To6Packets", cJSON_CreateNumber(aCounters.m4To6Packets));
+    cJSON_AddItemToObject(counters, "4To6Bytes", cJSON_CreateNumber(aCounters.m4To6Bytes));
+    cJSON_AddItemToObject(counters, "6To4Packets", cJSON_CreateNumber(aCounters.m6To4Packets));
+    cJSON_AddItemToObject(counters, "6To4Bytes", cJSON_CreateNumber(aCounters.m6To4Bytes));
+
+    return counters;
+}
+
+std::string ChildInfo2JsonString(const otChildInfo &aChildInfo, const FieldSet &aFields)
+{
+    cJSON           *child = cJSON_CreateObject();
+    otLinkModeConfig mode;
+
+    mode.mRxOnWhenIdle = aChildInfo.mRxOnWhenIdle;
+    mode.mDeviceType   = aChildInfo.mFullThreadDevice;
+    mode.mNetworkData  = aChildInfo.mFullNetworkData;
+
+    cJSON_AddItemToObject(child, "ExtAddress", Bytes2HexJson(aChildInfo.mExtAddress.m8, OT_EXT_ADDRESS_SIZE));
+    cJSON_AddItemToObject(child, "Rloc16", cJSON_CreateNumber(aChildInfo.mRloc16));
+    cJSON_AddItemToObject(child, "ChildId", cJSON_CreateNumber(aChildInfo.mChildId));
+    cJSON_AddItemToObject(child, "Timeout", cJSON_CreateNumber(aChildInfo.mTimeout));
+    cJSON_AddItemToObject(child, "Age", cJSON_CreateNumber(aChildInfo.mAge));
+    cJSON_AddItemToObject(child, "NetworkDataVersion", cJSON_CreateNumber(aChildInfo.mNetworkDataVersion));
+    cJSON_AddItemToObject(child, "LinkQualityIn", cJSON_CreateNumber(aChildInfo.mLinkQualityIn));
+    cJSON_AddItemToObject(child, "AverageRssi", cJSON_CreateNumber(aChildInfo.mAverageRssi));
+    cJSON_AddItemToObject(child, "LastRssi", cJSON_CreateNumber(aChildInfo.mLastRssi));
+    cJSON_AddItemToObject(child, "FrameErrorRate", cJSON_CreateNumber(aChildInfo.mFrameErrorRate));
+    cJSON_AddItemToObject(child, "MessageErrorRate", cJSON_CreateNumber(aChildInfo.mMessageErrorRate));
+    cJSON_AddItemToObject(child, "QueuedMessageCount", cJSON_CreateNumber(aChildInfo.mQueuedMessageCnt));
+    cJSON_AddItemToObject(child, "Version", cJSON_CreateNumber(aChildInfo.mVersion));
+    cJSON_AddItemToObject(child, "Mode", Mode2Json(mode));
+    cJSON_AddItemToObject(child, "IsStateRestoring", cJSON_CreateBool(aChildInfo.mIsStateRestoring));
+
+    return SelectedFields2JsonString(child, aFields, ChildInfoFields());
+}
+
+const FieldSet &ChildInfoFields(void)
+{
+    static const FieldSet kFields = {
+        "ExtAddress", "Rloc16", "ChildId", "Timeout", "Age", "NetworkDataVersion", "LinkQualityIn", "AverageRssi",
+        "LastRssi", "FrameErrorRate", "MessageErrorRate", "QueuedMessageCount", "Version", "Mode", "IsStateRestoring"};
+
+    return kFields;
+}
+
+std::string NeighborInfo2JsonString(const otNeighborInfo &aNeighborInfo, const FieldSet &aFields)
+{
+    cJSON           *neighbor = cJSON_CreateObject();
+    otLinkModeConfig mode;
+
+    mode.mRxOnWhenIdle = aNeighborInfo.mRxOnWhenIdle;
+    mode.mDeviceType   = aNeighborInfo.mFullThreadDevice;
+    mode.mNetworkData  = aNeighborInfo.mFullNetworkData;
+
+    cJSON_AddItemToObject(neighbor, "ExtAddress", Bytes2HexJson(aNeighborInfo.mExtAddress.m8, OT_EXT_ADDRESS_SIZE));
+    cJSON_AddItemToObject(neighbor, "Rloc16", cJSON_CreateNumber(aNeighborInfo.mRloc16));
+    cJSON_AddItemToObject(neighbor, "Age", cJSON_CreateNumber(aNeighborInfo.mAge));
+    cJSON_AddItemToObject(neighbor, "LinkQualityIn", cJSON_CreateNumber(aNeighborInfo.mLinkQualityIn));
+    cJSON_AddItemToObject(neighbor, "AverageRssi", cJSON_CreateNumber(aNeighborInfo.mAverageRssi));
+    cJSON_AddItemToObject(neighbor, "LastRssi", cJSON_CreateNumber(aNeighborInfo.mLastRssi));
+    cJSON_AddItemToObject(neighbor, "FrameErrorRate", cJSON_CreateNumber(aNeighborInfo.mFrameErrorRate));
+    cJSON_AddItemToObject(neighbor, "MessageErrorRate", cJSON_CreateNumber(aNeighborInfo.mMessageErrorRate));
+    cJSON_AddItemToObject(neighbor, "Version", cJSON_CreateNumber(aNeighborInfo.mVersion));
+    cJSON_AddItemToObject(neighbor, "Mode", Mode2Json(mode));
+    cJSON_AddItemToObject(neighbor, "IsChild", cJSON_CreateBool(aNeighborInfo.mIsChild));
+
+    return SelectedFields2JsonString(neighbor, aFields, NeighborInfoFields());
+}
+
+const FieldSet &NeighborInfoFields(void)
+{
+    static const FieldSet kFields = {
+        "ExtAddress", "Rloc16", "Age", "LinkQualityIn", "AverageRssi", "LastRssi", "FrameErrorRate",
+        "MessageErrorRate", "Version", "Mode", "IsChild"};
+
+    return kFields;
+}
+
+std::string SrpHost2JsonString(const otSrpServerHost *aHost, const FieldSet &aFields)
+{
+    cJSON               *host      = cJSON_CreateObject();
+    cJSON               *addresses = cJSON_CreateArray();
+    uint8_t              numAddresses;
+    const otIp6Address  *hostAddresses = otSrpServerHostGetAddresses(aHost, &numAddresses);
+    otSrpServerLeaseInfo leaseInfo;
+
+    for (uint8_t i = 0; i < numAddresses; i++)
+    {
+        cJSON_AddItemToArray(addresses, IpAddr2Json(hostAddresses[i]));
+    }
+
+    otSrpServerHostGetLeaseInfo(aHost, &leaseInfo);
+
+    cJSON_AddItemToObject(host, "FullName", cJSON_CreateString(otSrpServerHostGetFullName(aHost)));
+    cJSON_AddItemToObject(host, "Addresses", addresses);
+    cJSON_AddItemToObject(host, "Deleted", cJSON_CreateBool(otSrpServerHostIsDeleted(aHost)));
+    cJSON_AddItemToObject(host, "LeaseInfo", LeaseInfo2Json(leaseInfo));
+
+    return SelectedFields2JsonString(host, aFields, SrpHostFields());
+}
+
+const FieldSet &SrpHostFields(void)
+{
+    static const FieldSet kFields = {
+        "FullName", "Addresses", "Deleted", "LeaseInfo"};
+
+    return kFields;
+}
+
+std::string SrpService2JsonString(const otSrpServerService *aService, const FieldSet &aFields)
+{
+    cJSON               *service = cJSON_CreateObject();
+    uint16_t             txtDataLength;
+    const uint8_t       *txtData = otSrpServerServiceGetTxtData(aService, &txtDataLength);
+    otSrpServerLeaseInfo leaseInfo;
+
+    otSrpServerServiceGetLeaseInfo(aService, &leaseInfo);
+
+    cJSON_AddItemToObject(service, "InstanceName", cJSON_CreateString(otSrpServerServiceGetInstanceName(aService)));
+    cJSON_AddItemToObject(service, "ServiceName", cJSON_CreateString(otSrpServerServiceGetServiceName(aService)));
+    cJSON_AddItemToObject(service, "HostName",
+                          cJSON_CreateString(otSrpServerHostGetFullName(otSrpServerServiceGetHost(aService))));
+    cJSON_AddItemToObject(service, "Port", cJSON_CreateNumber(otSrpServerServiceGetPort(aService)));
+    cJSON_AddItemToObject(service, "Priority", cJSON_CreateNumber(otSrpServerServiceGetPriority(aService)));
+    cJSON_AddItemToObject(service, "Weight", cJSON_CreateNumber(otSrpServerServiceGetWeight(aService)));
+    cJSON_AddItemToObject(service, "TxtData",
+                          cJSON_CreateString(otbr::Utils::Bytes2Hex(txtData, txtDataLength).c_str()));
+    cJSON_AddItemToObject(service, "Deleted", cJSON_CreateBool(otSrpServerServiceIsDeleted(aService)));
+    cJSON_AddItemToObject(service, "LeaseInfo", LeaseInfo2Json(leaseInfo));
+
+    return SelectedFields2JsonString(service, aFields, SrpServiceFields());
+}
+
+const FieldSet &SrpServiceFields(void)
+{
+    static const FieldSet kFields = {
+        "InstanceName", "ServiceName", "HostName", "Port", "Priority", "Weight", "TxtData", "Deleted", "LeaseInfo"};
+
+    return kFields;
+}
+
+std::string Nat64Mapping2JsonString(const otNat64AddressMapping &aMapping, const FieldSet &aFields)
+{
+    cJSON *mapping  = cJSON_CreateObject();
+    cJSON *counters = cJSON_CreateObject();
+    char   id[sizeof(uint64_t) * 2 + 1];
+
+    // The identifier doesn't fit in a Json number without losing precision.
+    snprintf(id, sizeof(id), "%016" PRIx64, aMapping.mId);
+
+    cJSON_AddItemToObject(counters, "Total", Nat64ProtocolCounters2Json(aMapping.mCounters.mTotal));
+    cJSON_AddItemToObject(counters, "Icmp", Nat64ProtocolCounters2Json(aMapping.mCounters.mIcmp));
+    cJSON_AddItemToObject(counters, "Udp", Nat64ProtocolCounters2Json(aMapping.mCounters.mUdp));
+    cJSON_AddItemToObject(counters, "Tcp", Nat64ProtocolCounters2Json(aMapping.mCounters.mTcp));
+
+    cJSON_AddItemToObject(mapping, "Id", cJSON_CreateString(id));
+    cJSON_AddItemToObject(mapping, "Ip4", Ip4Addr2Json(aMapping.mIp4));
+    cJSON_AddItemToObject(mapping, "Ip6", IpAddr2Json(aMapping.mIp6));
+    cJSON_AddItemToObject(mapping, "RemainingTimeMs", cJSON_CreateNumber(aMapping.mRemainingTimeMs));
+    cJSON_AddItemToObject(mapping, "Counters", counters);
+
+    return SelectedFields2JsonString(mapping, aFields, Nat64MappingFields());
+}
+
+const FieldSet &Nat64MappingFields(void)
+{
+    static const FieldSet kFields = {
+        "Id", "Ip4", "Ip6", "RemainingTimeMs", "Counters"};
+
+    return kFields;
+}
+
 std::string CString2JsonString(const char *aCString)
 {
     cJSON      *cString = CString2Json(aCString);
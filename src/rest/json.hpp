@@ -36,8 +36,12 @@
 
 #include "openthread-br/config.h"
 
+#include <set>
+
 #include "openthread/dataset.h"
 #include "openthread/link.h"
+#include "openthread/nat64.h"
+#include "openthread/srp_server.h"
 #include "openthread/thread_ftd.h"
 
 #include "rest/types.hpp"
@@ -53,6 +57,13 @@ namespace rest {
  */
 namespace Json {
 
+/**
+ * This type represents the names of the fields selected from the entries of a collection, an empty set selects all
+ * fields.
+ *
+ */
+typedef std::set<std::string> FieldSet;
+
 /**
  * This method formats an integer to a Json number and serialize it to a string.
  *
@@ -115,6 +126,16 @@ std::string String2JsonString(const std::string &aString);
  */
 bool JsonString2String(const std::string &aJsonString, std::string &aString);
 
+/**
+ * This method removes all insignificant whitespace from a serialized Json string.
+ *
+ * @param[in] aJsonString  A Json string.
+ *
+ * @returns The Json string on a single line.
+ *
+ */
+std::string CompactJsonString(const std::string &aJsonString);
+
 /**
  * This method formats a Node object to a Json object and serialize it to a string.
  *
@@ -215,6 +236,101 @@ std::string MacCounters2JsonString(const otNetworkDiagMacCounters &aMacCounters)
  */
 std::string ChildTableEntry2JsonString(const otNetworkDiagChildEntry &aChildEntry);
 
+/**
+ * This method formats the selected fields of a child table entry to a compact Json object string.
+ *
+ * @param[in] aChildInfo  The child table entry.
+ * @param[in] aFields     The fields to include.
+ *
+ * @returns A string of serialized Json object.
+ *
+ */
+std::string ChildInfo2JsonString(const otChildInfo &aChildInfo, const FieldSet &aFields);
+
+/**
+ * This method returns the names of the fields of a child table entry Json object.
+ *
+ * @returns The names of the fields.
+ *
+ */
+const FieldSet &ChildInfoFields(void);
+
+/**
+ * This method formats the selected fields of a neighbor table entry to a compact Json object string.
+ *
+ * @param[in] aNeighborInfo  The neighbor table entry.
+ * @param[in] aFields        The fields to include.
+ *
+ * @returns A string of serialized Json object.
+ *
+ */
+std::string NeighborInfo2JsonString(const otNeighborInfo &aNeighborInfo, const FieldSet &aFields);
+
+/**
+ * This method returns the names of the fields of a neighbor table entry Json object.
+ *
+ * @returns The names of the fields.
+ *
+ */
+const FieldSet &NeighborInfoFields(void);
+
+/**
+ * This method formats the selected fields of an SRP host to a compact Json object string.
+ *
+ * @param[in] aHost    The SRP host.
+ * @param[in] aFields  The fields to include.
+ *
+ * @returns A string of serialized Json object.
+ *
+ */
+std::string SrpHost2JsonString(const otSrpServerHost *aHost, const FieldSet &aFields);
+
+/**
+ * This method returns the names of the fields of an SRP host Json object.
+ *
+ * @returns The names of the fields.
+ *
+ */
+const FieldSet &SrpHostFields(void);
+
+/**
+ * This method formats the selected fields of an SRP service to a compact Json object string.
+ *
+ * @param[in] aService  The SRP service.
+ * @param[in] aFields   The fields to include.
+ *
+ * @returns A string of serialized Json object.
+ *
+ */
+std::string SrpService2JsonString(const otSrpServerService *aService, const FieldSet &aFields);
+
+/**
+ * This method returns the names of the fields of an SRP service Json object.
+ *
+ * @returns The names of the fields.
+ *
+ */
+const FieldSet &SrpServiceFields(void);
+
+/**
+ * This method formats the selected fields of a NAT64 address mapping to a compact Json object string.
+ *
+ * @param[in] aMapping  The NAT64 address mapping.
+ * @param[in] aFields   The fields to include.
+ *
+ * @returns A string of serialized Json object.
+ *
+ */
+std::string Nat64Mapping2JsonString(const otNat64AddressMapping &aMapping, const FieldSet &aFields);
+
+/**
+ * This method returns the names of the fields of a NAT64 address mapping Json object.
+ *
+ * @returns The names of the fields.
+ *
+ */
+const FieldSet &Nat64MappingFields(void);
+
 /**
  * This method formats an error code and an error message to a Json object and serialize it to a string.
  *
@@ -0,0 +1,751 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the Prometheus metrics exporter of the RESTful HTTP server.
+ */
+
+#include "rest/metrics.hpp"
+
+#include <initializer_list>
+
+#include <stdio.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <openthread/dnssd_server.h>
+#include <openthread/instance.h>
+#include <openthread/ip6.h>
+#include <openthread/link.h>
+#include <openthread/nat64.h>
+#include <openthread/openthread-system.h>
+#include <openthread/srp_server.h>
+#include <openthread/thread.h>
+
+#if OTBR_ENABLE_BACKBONE_ROUTER && OTBR_ENABLE_DUA_ROUTING
+#include "backbone_router/backbone_agent.hpp"
+#endif
+#if OTBR_ENABLE_BORDER_AGENT
+#include "border_agent/border_agent.hpp"
+#endif
+#include "common/code_utils.hpp"
+#include "rest/worker_pool.hpp"
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+#include "sdp_proxy/advertising_proxy.hpp"
+#endif
+
+namespace otbr {
+namespace rest {
+
+namespace {
+
+template <typename Counters, typename Value> struct CounterField
+{
+    const char *mName;
+    Value Counters::*mField;
+};
+
+void AppendFamily(std::string &aOutput, const char *aName, const char *aType, const char *aHelp)
+{
+    aOutput += "# HELP ";
+    aOutput += aName;
+    aOutput += ' ';
+    aOutput += aHelp;
+    aOutput += "\n# TYPE ";
+    aOutput += aName;
+    aOutput += ' ';
+    aOutput += aType;
+    aOutput += '\n';
+}
+
+void AppendSample(std::string &aOutput, const char *aName, const char *aLabels, uint64_t aValue)
+{
+    char value[21];
+
+    snprintf(value, sizeof(value), "%llu", static_cast<unsigned long long>(aValue));
+
+    aOutput += aName;
+    if (aLabels != nullptr)
+    {
+        aOutput += '{';
+        aOutput += aLabels;
+        aOutput += '}';
+    }
+    aOutput += ' ';
+    aOutput += value;
+    aOutput += '\n';
+}
+
+void AppendRealSample(std::string &aOutput, const char *aName, const char *aLabels, double aValue)
+{
+    char value[32];
+
+    snprintf(value, sizeof(value), "%.17g", aValue);
+
+    aOutput += aName;
+    if (aLabels != nullptr)
+    {
+        aOutput += '{';
+        aOutput += aLabels;
+        aOutput += '}';
+    }
+    aOutput += ' ';
+    aOutput += value;
+    aOutput += '\n';
+}
+
+void AppendMetric(std::string &aOutput, const char *aName, const char *aType, const char *aHelp, uint64_t aValue)
+{
+    AppendFamily(aOutput, aName, aType, aHelp);
+    AppendSample(aOutput, aName, nullptr, aValue);
+}
+
+// Appends one counter family with one sample per field, the field names are the values of the label @p aLabel.
+template <typename Counters, typename Value, size_t kNumFields>
+void AppendCounters(std::string &aOutput,
+                    const char  *aName,
+                    const char  *aHelp,
+                    const char  *aLabel,
+                    const Counters &aCounters,
+                    const CounterField<Counters, Value> (&aFields)[kNumFields])
+{
+    std::string labels;
+
+    AppendFamily(aOutput, aName, "counter", aHelp);
+
+    for (const auto &field : aFields)
+    {
+        labels = aLabel;
+        labels += "=\"";
+        labels += field.mName;
+        labels += '"';
+        AppendSample(aOutput, aName, labels.c_str(), static_cast<uint64_t>(aCounters.*field.mField));
+    }
+}
+
+const CounterField<otMacCounters, uint32_t> kMacTxFields[] = {
+    {"unicast", &otMacCounters::mTxUnicast},
+    {"broadcast", &otMacCounters::mTxBroadcast},
+    {"ack_requested", &otMacCounters::mTxAckRequested},
+    {"acked", &otMacCounters::mTxAcked},
+    {"no_ack_requested", &otMacCounters::mTxNoAckRequested},
+    {"data", &otMacCounters::mTxData},
+    {"data_poll", &otMacCounters::mTxDataPoll},
+    {"beacon", &otMacCounters::mTxBeacon},
+    {"beacon_request", &otMacCounters::mTxBeaconRequest},
+    {"other", &otMacCounters::mTxOther},
+};
+
+const CounterField<otMacCounters, uint32_t> kMacTxErrorFields[] = {
+    {"cca", &otMacCounters::mTxErrCca},
+    {"abort", &otMacCounters::mTxErrAbort},
+    {"busy_channel", &otMacCounters::mTxErrBusyChannel},
+};
+
+const CounterField<otMacCounters, uint32_t> kMacRxFields[] = {
+    {"unicast", &otMacCounters::mRxUnicast},
+    {"broadcast", &otMacCounters::mRxBroadcast},
+    {"data", &otMacCounters::mRxData},
+    {"data_poll", &otMacCounters::mRxDataPoll},
+    {"beacon", &otMacCounters::mRxBeacon},
+    {"beacon_request", &otMacCounters::mRxBeaconRequest},
+    {"other", &otMacCounters::mRxOther},
+    {"address_filtered", &otMacCounters::mRxAddressFiltered},
+    {"dest_address_filtered", &otMacCounters::mRxDestAddrFiltered},
+    {"duplicated", &otMacCounters::mRxDuplicated},
+};
+
+const CounterField<otMacCounters, uint32_t> kMacRxErrorFields[] = {
+    {"no_frame", &otMacCounters::mRxErrNoFrame},
+    {"unknown_neighbor", &otMacCounters::mRxErrUnknownNeighbor},
+    {"invalid_src_address", &otMacCounters::mRxErrInvalidSrcAddr},
+    {"security", &otMacCounters::mRxErrSec},
+    {"fcs", &otMacCounters::mRxErrFcs},
+    {"other", &otMacCounters::mRxErrOther},
+};
+
+const CounterField<otIpCounters, uint32_t> kIp6Fields[] = {
+    {"tx_success", &otIpCounters::mTxSuccess},
+    {"tx_failure", &otIpCounters::mTxFailure},
+    {"rx_success", &otIpCounters::mRxSuccess},
+    {"rx_failure", &otIpCounters::mRxFailure},
+};
+
+const CounterField<otRadioSpinelMetrics, uint32_t> kRadioSpinelFields[] = {
+    {"rcp_timeout", &otRadioSpinelMetrics::mRcpTimeoutCount},
+    {"rcp_unexpected_reset", &otRadioSpinelMetrics::mRcpUnexpectedResetCount},
+    {"rcp_restoration", &otRadioSpinelMetrics::mRcpRestorationCount},
+    {"spinel_parse_error", &otRadioSpinelMetrics::mSpinelParseErrorCount},
+};
+
+const CounterField<otRcpInterfaceMetrics, uint64_t> kRcpInterfaceFrameFields[] = {
+    {"transferred", &otRcpInterfaceMetrics::mTransferredFrameCount},
+    {"transferred_valid", &otRcpInterfaceMetrics::mTransferredValidFrameCount},
+    {"transferred_garbage", &otRcpInterfaceMetrics::mTransferredGarbageFrameCount},
+    {"rx", &otRcpInterfaceMetrics::mRxFrameCount},
+    {"tx", &otRcpInterfaceMetrics::mTxFrameCount},
+};
+
+const CounterField<otRcpInterfaceMetrics, uint64_t> kRcpInterfaceByteFields[] = {
+    {"rx", &otRcpInterfaceMetrics::mRxFrameByteCount},
+    {"tx", &otRcpInterfaceMetrics::mTxFrameByteCount},
+};
+
+const CounterField<agent::ThreadHelper::ScanStats, uint32_t> kScanFields[] = {
+    {"active", &agent::ThreadHelper::ScanStats::mActiveScans},
+    {"energy", &agent::ThreadHelper::ScanStats::mEnergyScans},
+};
+
+const CounterField<agent::ThreadHelper::ScanStats, uint32_t> kSharedScanRequestFields[] = {
+    {"in_progress", &agent::ThreadHelper::ScanStats::mCoalescedRequests},
+    {"cached", &agent::ThreadHelper::ScanStats::mCachedResponses},
+};
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+const CounterField<otSrpServerResponseCounters, uint32_t> kSrpServerResponseFields[] = {
+    {"success", &otSrpServerResponseCounters::mSuccess},
+    {"server_failure", &otSrpServerResponseCounters::mServerFailure},
+    {"format_error", &otSrpServerResponseCounters::mFormatError},
+    {"name_exists", &otSrpServerResponseCounters::mNameExists},
+    {"refused", &otSrpServerResponseCounters::mRefused},
+    {"other", &otSrpServerResponseCounters::mOther},
+};
+
+const CounterField<SrpUpdateTracker::Counters, uint32_t> kSrpUpdateFields[] = {
+    {"completed", &SrpUpdateTracker::Counters::mCompletedUpdates},
+    {"failed", &SrpUpdateTracker::Counters::mFailedUpdates},
+    {"timed_out", &SrpUpdateTracker::Counters::mTimedOutUpdates},
+};
+#endif
+
+#if OTBR_ENABLE_BORDER_AGENT
+const CounterField<MeshCopRepublisher::Counters, uint32_t> kMeshCopRepublishFields[] = {
+    {"issued", &MeshCopRepublisher::Counters::mIssuedRepublishes},
+    {"suppressed", &MeshCopRepublisher::Counters::mSuppressedRepublishes},
+};
+#endif
+
+#if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
+const CounterField<otDnssdCounters, uint32_t> kDnssdResponseFields[] = {
+    {"success", &otDnssdCounters::mSuccessResponse},
+    {"server_failure", &otDnssdCounters::mServerFailureResponse},
+    {"format_error", &otDnssdCounters::mFormatErrorResponse},
+    {"name_error", &otDnssdCounters::mNameErrorResponse},
+    {"not_implemented", &otDnssdCounters::mNotImplementedResponse},
+    {"other", &otDnssdCounters::mOtherResponse},
+};
+#endif
+
+const CounterField<MdnsTelemetryInfo, MdnsResponseCounters> kMdnsOperationFields[] = {
+    {"host_registration", &MdnsTelemetryInfo::mHostRegistrations},
+    {"key_registration", &MdnsTelemetryInfo::mKeyRegistrations},
+    {"service_registration", &MdnsTelemetryInfo::mServiceRegistrations},
+    {"host_resolution", &MdnsTelemetryInfo::mHostResolutions},
+    {"service_resolution", &MdnsTelemetryInfo::mServiceResolutions},
+};
+
+const CounterField<MdnsResponseCounters, uint32_t> kMdnsResponseFields[] = {
+    {"success", &MdnsResponseCounters::mSuccess},
+    {"not_found", &MdnsResponseCounters::mNotFound},
+    {"invalid_args", &MdnsResponseCounters::mInvalidArgs},
+    {"duplicated", &MdnsResponseCounters::mDuplicated},
+    {"not_implemented", &MdnsResponseCounters::mNotImplemented},
+    {"unknown_error", &MdnsResponseCounters::mUnknownError},
+    {"aborted", &MdnsResponseCounters::mAborted},
+    {"invalid_state", &MdnsResponseCounters::mInvalidState},
+};
+
+const CounterField<MdnsTelemetryInfo, uint32_t> kMdnsLatencyFields[] = {
+    {"host_registration", &MdnsTelemetryInfo::mHostRegistrationEmaLatency},
+    {"key_registration", &MdnsTelemetryInfo::mKeyRegistrationEmaLatency},
+    {"service_registration", &MdnsTelemetryInfo::mServiceRegistrationEmaLatency},
+    {"host_resolution", &MdnsTelemetryInfo::mHostResolutionEmaLatency},
+    {"service_resolution", &MdnsTelemetryInfo::mServiceResolutionEmaLatency},
+};
+
+#if OTBR_ENABLE_NAT64
+const CounterField<otNat64ProtocolCounters, otNat64Counters> kNat64ProtocolFields[] = {
+    {"total", &otNat64ProtocolCounters::mTotal},
+    {"icmp", &otNat64ProtocolCounters::mIcmp},
+    {"udp", &otNat64ProtocolCounters::mUdp},
+    {"tcp", &otNat64ProtocolCounters::mTcp},
+};
+
+const char *const kNat64DropReasons[] = {"unknown", "illegal_packet", "unsupported_proto", "no_mapping"};
+#endif
+
+#if OTBR_ENABLE_BORDER_ROUTING_COUNTERS
+// The names are the complete label sets of the samples.
+const CounterField<otBorderRoutingCounters, otPacketsAndBytes> kBorderRoutingTrafficFields[] = {
+    {"direction=\"inbound\",type=\"unicast\"", &otBorderRoutingCounters::mInboundUnicast},
+    {"direction=\"inbound\",type=\"multicast\"", &otBorderRoutingCounters::mInboundMulticast},
+    {"direction=\"outbound\",type=\"unicast\"", &otBorderRoutingCounters::mOutboundUnicast},
+    {"direction=\"outbound\",type=\"multicast\"", &otBorderRoutingCounters::mOutboundMulticast},
+};
+
+const CounterField<otBorderRoutingCounters, uint32_t> kBorderRoutingNdFields[] = {
+    {"ra_rx", &otBorderRoutingCounters::mRaRx},
+    {"ra_tx_success", &otBorderRoutingCounters::mRaTxSuccess},
+    {"ra_tx_failure", &otBorderRoutingCounters::mRaTxFailure},
+    {"rs_rx", &otBorderRoutingCounters::mRsRx},
+    {"rs_tx_success", &otBorderRoutingCounters::mRsTxSuccess},
+    {"rs_tx_failure", &otBorderRoutingCounters::mRsTxFailure},
+};
+#endif
+
+#if OTBR_ENABLE_BACKBONE_ROUTER && OTBR_ENABLE_DUA_ROUTING
+const CounterField<BackboneRouter::NdProxyManager::Counters, uint64_t> kNdProxyFilteredFields[] = {
+    {"kernel", &BackboneRouter::NdProxyManager::Counters::mKernelFiltered},
+    {"user_space", &BackboneRouter::NdProxyManager::Counters::mUserSpaceFiltered},
+};
+#endif
+
+} // namespace
+
+MetricsExporter::MetricsExporter(Ncp::ControllerOpenThread &aNcp, Mdns::Publisher *aPublisher)
+    : mNcp(aNcp)
+    , mPublisher(aPublisher)
+    , mWorkerPool(nullptr)
+#if OTBR_ENABLE_BACKBONE_ROUTER && OTBR_ENABLE_DUA_ROUTING
+    , mBackboneAgent(nullptr)
+#endif
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    , mAdvertisingProxy(nullptr)
+#endif
+#if OTBR_ENABLE_BORDER_AGENT
+    , mBorderAgent(nullptr)
+#endif
+{
+}
+
+void MetricsExporter::Export(std::string &aOutput) const
+{
+    ExportThread(aOutput);
+    ExportRadio(aOutput);
+    ExportSrpServer(aOutput);
+    ExportDnssd(aOutput);
+    ExportMdns(aOutput);
+    ExportBorderAgent(aOutput);
+    ExportNat64(aOutput);
+    ExportBorderRouting(aOutput);
+    ExportNdProxy(aOutput);
+    ExportTelemetry(aOutput);
+    ExportRestServer(aOutput);
+    ExportProcess(aOutput);
+}
+
+void MetricsExporter::ExportThread(std::string &aOutput) const
+{
+    otInstance          *instance    = mNcp.GetThreadHelper()->GetInstance();
+    const otMacCounters *macCounters = otLinkGetCounters(instance);
+
+    AppendMetric(aOutput, "otbr_uptime_milliseconds", "gauge", "Time since the OpenThread instance was initialized.",
+                 otInstanceGetUptime(instance));
+    AppendMetric(aOutput, "otbr_thread_role", "gauge",
+                 "Thread device role (0: disabled, 1: detached, 2: child, 3: router, 4: leader).",
+                 otThreadGetDeviceRole(instance));
+
+    AppendMetric(aOutput, "otbr_mac_tx_frames_total", "counter", "Transmitted IEEE 802.15.4 frames.",
+                 macCounters->mTxTotal);
+    AppendMetric(aOutput, "otbr_mac_tx_retries_total", "counter", "IEEE 802.15.4 frame retransmissions.",
+                 macCounters->mTxRetry);
+    AppendCounters(aOutput, "otbr_mac_tx_frames_by_type_total", "Transmitted IEEE 802.15.4 frames by type.", "type",
+                   *macCounters, kMacTxFields);
+    AppendCounters(aOutput, "otbr_mac_tx_errors_total", "IEEE 802.15.4 frame transmission errors.", "error",
+                   *macCounters, kMacTxErrorFields);
+    AppendMetric(aOutput, "otbr_mac_rx_frames_total", "counter", "Received IEEE 802.15.4 frames.",
+                 macCounters->mRxTotal);
+    AppendCounters(aOutput, "otbr_mac_rx_frames_by_type_total", "Received IEEE 802.15.4 frames by type.", "type",
+                   *macCounters, kMacRxFields);
+    AppendCounters(aOutput, "otbr_mac_rx_errors_total", "IEEE 802.15.4 frame reception errors.", "error",
+                   *macCounters, kMacRxErrorFields);
+
+    AppendCounters(aOutput, "otbr_ip6_packets_total", "IPv6 packets on the Thread interface.", "result",
+                   *otThreadGetIp6Counters(instance), kIp6Fields);
+}
+
+void MetricsExporter::ExportRadio(std::string &aOutput) const
+{
+    const agent::ThreadHelper::ScanStats &scanStats = mNcp.GetThreadHelper()->GetScanStats();
+
+    AppendCounters(aOutput, "otbr_radio_spinel_events_total", "Radio spinel events.", "event",
+                   *otSysGetRadioSpinelMetrics(), kRadioSpinelFields);
+    AppendCounters(aOutput, "otbr_rcp_interface_frames_total", "Frames on the RCP interface.", "type",
+                   *otSysGetRcpInterfaceMetrics(), kRcpInterfaceFrameFields);
+    AppendCounters(aOutput, "otbr_rcp_interface_bytes_total", "Frame bytes on the RCP interface.", "direction",
+                   *otSysGetRcpInterfaceMetrics(), kRcpInterfaceByteFields);
+    AppendCounters(aOutput, "otbr_radio_scans_total", "Scans performed on the radio.", "type", scanStats, kScanFields);
+    AppendCounters(aOutput, "otbr_radio_shared_scan_requests_total", "Scan requests served without a new scan.",
+                   "scan", scanStats, kSharedScanRequestFields);
+    AppendMetric(aOutput, "otbr_radio_scan_time_milliseconds_total", "counter", "Time the radio spent scanning.",
+                 scanStats.mScanTime);
+}
+
+void MetricsExporter::ExportSrpServer(std::string &aOutput) const
+{
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    otInstance            *instance = mNcp.GetThreadHelper()->GetInstance();
+    const otSrpServerHost *host     = nullptr;
+    uint32_t               hosts    = 0;
+    uint32_t               services = 0;
+
+    while ((host = otSrpServerGetNextHost(instance, host)) != nullptr)
+    {
+        const otSrpServerService *service = nullptr;
+
+        hosts += otSrpServerHostIsDeleted(host) ? 0 : 1;
+
+        while ((service = otSrpServerHostGetNextService(host, service)) != nullptr)
+        {
+            services += otSrpServerServiceIsDeleted(service) ? 0 : 1;
+        }
+    }
+
+    AppendMetric(aOutput, "otbr_srp_server_state", "gauge", "SRP server state (0: disabled, 1: running, 2: stopped).",
+                 otSrpServerGetState(instance));
+    AppendMetric(aOutput, "otbr_srp_server_hosts", "gauge", "Registered SRP hosts.", hosts);
+    AppendMetric(aOutput, "otbr_srp_server_services", "gauge", "Registered SRP services.", services);
+    AppendCounters(aOutput, "otbr_srp_server_responses_total", "SRP server responses.", "response",
+                   *otSrpServerGetResponseCounters(instance), kSrpServerResponseFields);
+
+    VerifyOrExit(mAdvertisingProxy != nullptr);
+
+    AppendMetric(aOutput, "otbr_srp_advertising_proxy_outstanding_updates", "gauge",
+                 "SRP updates waiting for mDNS publishing results.",
+                 mAdvertisingProxy->GetUpdateCounters().mOutstandingUpdates);
+    AppendCounters(aOutput, "otbr_srp_advertising_proxy_updates_total", "SRP updates advertised by the proxy.",
+                   "result", mAdvertisingProxy->GetUpdateCounters(), kSrpUpdateFields);
+    AppendMetric(aOutput, "otbr_srp_advertising_proxy_update_ema_latency_milliseconds", "gauge",
+                 "Exponential moving average latency of successfully advertised SRP updates.",
+                 mAdvertisingProxy->GetUpdateCounters().mUpdateEmaLatency);
+    AppendMetric(aOutput, "otbr_srp_advertising_proxy_skipped_publishes_total", "counter",
+                 "SRP host and service publishes skipped as they were unchanged.",
+                 mAdvertisingProxy->GetSkippedPublishes());
+
+exit:
+    return;
+#else
+    OTBR_UNUSED_VARIABLE(aOutput);
+#endif
+}
+
+void MetricsExporter::ExportDnssd(std::string &aOutput) const
+{
+#if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
+    const otDnssdCounters *counters = otDnssdGetCounters(mNcp.GetThreadHelper()->GetInstance());
+
+    AppendCounters(aOutput, "otbr_dnssd_responses_total", "DNS-SD server responses.", "response", *counters,
+                   kDnssdResponseFields);
+    AppendMetric(aOutput, "otbr_dnssd_resolved_by_srp_total", "counter",
+                 "DNS-SD queries resolved from SRP registrations.", counters->mResolvedBySrp);
+#else
+    OTBR_UNUSED_VARIABLE(aOutput);
+#endif
+}
+
+void MetricsExporter::ExportMdns(std::string &aOutput) const
+{
+    const char *name = "otbr_mdns_responses_total";
+    std::string labels;
+
+    VerifyOrExit(mPublisher != nullptr);
+
+    AppendFamily(aOutput, name, "counter", "mDNS publisher responses.");
+
+    for (const auto &operation : kMdnsOperationFields)
+    {
+        const MdnsResponseCounters &counters = mPublisher->GetMdnsTelemetryInfo().*operation.mField;
+
+        for (const auto &response : kMdnsResponseFields)
+        {
+            labels = "operation=\"";
+            labels += operation.mName;
+            labels += "\",response=\"";
+            labels += response.mName;
+            labels += '"';
+            AppendSample(aOutput, name, labels.c_str(), static_cast<uint64_t>(counters.*response.mField));
+        }
+    }
+
+    name = "otbr_mdns_ema_latency_milliseconds";
+    AppendFamily(aOutput, name, "gauge", "Exponential moving average latency of mDNS publisher operations.");
+
+    for (const auto &operation : kMdnsLatencyFields)
+    {
+        labels = "operation=\"";
+        labels += operation.mName;
+        labels += '"';
+        AppendSample(aOutput, name, labels.c_str(),
+                     static_cast<uint64_t>(mPublisher->GetMdnsTelemetryInfo().*operation.mField));
+    }
+
+exit:
+    return;
+}
+
+void MetricsExporter::ExportBorderAgent(std::string &aOutput) const
+{
+#if OTBR_ENABLE_BORDER_AGENT
+    VerifyOrExit(mBorderAgent != nullptr);
+
+    AppendMetric(aOutput, "otbr_border_agent_meshcop_coalesced_updates_total", "counter",
+                 "MeshCoP service updates merged into a pending republish.",
+                 mBorderAgent->GetCounters().mCoalescedUpdates);
+    AppendCounters(aOutput, "otbr_border_agent_meshcop_republishes_total", "MeshCoP service republishes.", "result",
+                   mBorderAgent->GetCounters(), kMeshCopRepublishFields);
+
+exit:
+    return;
+#else
+    OTBR_UNUSED_VARIABLE(aOutput);
+#endif
+}
+
+void MetricsExporter::ExportNat64(std::string &aOutput) const
+{
+#if OTBR_ENABLE_NAT64
+    otInstance             *instance = mNcp.GetThreadHelper()->GetInstance();
+    otNat64ProtocolCounters protocolCounters;
+    otNat64ErrorCounters    errorCounters;
+    std::string             labels;
+
+    otNat64GetCounters(instance, &protocolCounters);
+    otNat64GetErrorCounters(instance, &errorCounters);
+
+    // The samples of a metric family must not be interleaved with other families.
+    for (bool bytes : {false, true})
+    {
+        const char *name = bytes ? "otbr_nat64_bytes_total" : "otbr_nat64_packets_total";
+
+        AppendFamily(aOutput, name, "counter", bytes ? "Bytes translated by NAT64." : "Packets translated by NAT64.");
+
+        for (const auto &protocol : kNat64ProtocolFields)
+        {
+            const otNat64Counters &counters = protocolCounters.*protocol.mField;
+
+            labels = "protocol=\"";
+            labels += protocol.mName;
+            labels += "\",direction=\"4to6\"";
+            AppendSample(aOutput, name, labels.c_str(), bytes ? counters.m4To6Bytes : counters.m4To6Packets);
+
+            labels = "protocol=\"";
+            labels += protocol.mName;
+            labels += "\",direction=\"6to4\"";
+            AppendSample(aOutput, name, labels.c_str(), bytes ? counters.m6To4Bytes : counters.m6To4Packets);
+        }
+    }
+
+    AppendFamily(aOutput, "otbr_nat64_dropped_packets_total", "counter", "Packets dropped by NAT64.");
+
+    for (size_t reason = 0; reason < sizeof(kNat64DropReasons) / sizeof(kNat64DropReasons[0]); ++reason)
+    {
+        labels = "reason=\"";
+        labels += kNat64DropReasons[reason];
+        labels += "\",direction=\"4to6\"";
+        AppendSample(aOutput, "otbr_nat64_dropped_packets_total", labels.c_str(), errorCounters.mCount4To6[reason]);
+
+        labels = "reason=\"";
+        labels += kNat64DropReasons[reason];
+        labels += "\",direction=\"6to4\"";
+        AppendSample(aOutput, "otbr_nat64_dropped_packets_total", labels.c_str(), errorCounters.mCount6To4[reason]);
+    }
+#else
+    OTBR_UNUSED_VARIABLE(aOutput);
+#endif
+}
+
+void MetricsExporter::ExportBorderRouting(std::string &aOutput) const
+{
+#if OTBR_ENABLE_BORDER_ROUTING_COUNTERS
+    const otBorderRoutingCounters *counters = otIp6GetBorderRoutingCounters(mNcp.GetThreadHelper()->GetInstance());
+
+    AppendFamily(aOutput, "otbr_border_routing_packets_total", "counter", "Packets forwarded by the border router.");
+    for (const auto &traffic : kBorderRoutingTrafficFields)
+    {
+        AppendSample(aOutput, "otbr_border_routing_packets_total", traffic.mName, (counters->*traffic.mField).mPackets);
+    }
+
+    AppendFamily(aOutput, "otbr_border_routing_bytes_total", "counter", "Bytes forwarded by the border router.");
+    for (const auto &traffic : kBorderRoutingTrafficFields)
+    {
+        AppendSample(aOutput, "otbr_border_routing_bytes_total", traffic.mName, (counters->*traffic.mField).mBytes);
+    }
+
+    AppendCounters(aOutput, "otbr_border_routing_nd_messages_total", "Router Advertisements and Solicitations.",
+                   "message", *counters, kBorderRoutingNdFields);
+#else
+    OTBR_UNUSED_VARIABLE(aOutput);
+#endif
+}
+
+void MetricsExporter::ExportNdProxy(std::string &aOutput) const
+{
+#if OTBR_ENABLE_BACKBONE_ROUTER && OTBR_ENABLE_DUA_ROUTING
+    BackboneRouter::NdProxyManager::Counters counters;
+
+    // The counters are reset whenever the ND Proxy manager is enabled.
+    VerifyOrExit(mBackboneAgent != nullptr && mBackboneAgent->GetNdProxyManager().IsEnabled());
+
+    counters = mBackboneAgent->GetNdProxyManager().GetCounters();
+
+    AppendMetric(aOutput, "otbr_nd_proxy_delivered_neighbor_solicits_total", "counter",
+                 "Multicast Neighbor Solicitations on the backbone interface delivered to the ND proxy.",
+                 counters.mDelivered);
+    AppendCounters(aOutput, "otbr_nd_proxy_filtered_neighbor_solicits_total",
+                   "Multicast Neighbor Solicitations on the backbone interface which are not for a proxied DUA.",
+                   "filter", counters, kNdProxyFilteredFields);
+    AppendMetric(aOutput, "otbr_nd_proxy_filter_updates_total", "counter",
+                 "Regenerations of the Neighbor Solicitation socket filter.", counters.mFilterUpdates);
+    AppendMetric(aOutput, "otbr_nd_proxy_user_space_matching", "gauge",
+                 "Whether the proxied DUAs exceed the capacity of the socket filter.", counters.mUserSpaceMatching);
+
+exit:
+    return;
+#else
+    OTBR_UNUSED_VARIABLE(aOutput);
+#endif
+}
+
+void MetricsExporter::ExportTelemetry(std::string &aOutput) const
+{
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    using ThreadHelper = agent::ThreadHelper;
+
+    static const struct
+    {
+        const char *mName;
+        const char *mType;
+        const char *mHelp;
+        uint64_t ThreadHelper::TelemetrySectionStats::*mField;
+    } kFamilies[] = {
+        {"otbr_telemetry_section_retrievals_total", "counter", "Retrievals of each telemetry data section.",
+         &ThreadHelper::TelemetrySectionStats::mRetrievals},
+        {"otbr_telemetry_section_duration_microseconds_total", "counter",
+         "Time spent retrieving each telemetry data section.", &ThreadHelper::TelemetrySectionStats::mTotalDurationUs},
+        {"otbr_telemetry_section_max_duration_microseconds", "gauge",
+         "Longest retrieval of each telemetry data section.", &ThreadHelper::TelemetrySectionStats::mMaxDurationUs},
+    };
+
+    const ThreadHelper *threadHelper = mNcp.GetThreadHelper();
+    std::string         labels;
+
+    for (const auto &family : kFamilies)
+    {
+        AppendFamily(aOutput, family.mName, family.mType, family.mHelp);
+
+        for (uint8_t i = 0; i < ThreadHelper::kNumTelemetrySections; i++)
+        {
+            ThreadHelper::TelemetrySection section = static_cast<ThreadHelper::TelemetrySection>(1u << i);
+
+            labels = "section=\"";
+            labels += ThreadHelper::TelemetrySectionToString(section);
+            labels += '"';
+            AppendSample(aOutput, family.mName, labels.c_str(),
+                         threadHelper->GetTelemetrySectionStats(section).*family.mField);
+        }
+    }
+#else
+    OTBR_UNUSED_VARIABLE(aOutput);
+#endif
+}
+
+void MetricsExporter::ExportRestServer(std::string &aOutput) const
+{
+    static const struct
+    {
+        const char *mName;
+        const char *mHelp;
+        size_t (Worker::*mGetter)(void) const;
+    } kWorkerGauges[] = {
+        {"otbr_rest_worker_queue_depth", "Tasks waiting on each REST worker thread.", &Worker::GetQueueDepth},
+        {"otbr_rest_worker_queue_depth_max", "Highest number of tasks waiting on each REST worker thread.",
+         &Worker::GetMaxQueueDepth},
+        {"otbr_rest_worker_connections", "Connections served by each REST worker thread.",
+         &Worker::GetNumConnections},
+    };
+
+    std::string labels;
+
+    VerifyOrExit(mWorkerPool != nullptr);
+
+    AppendMetric(aOutput, "otbr_rest_worker_threads", "gauge", "REST worker threads.",
+                 mWorkerPool->GetWorkers().size());
+    AppendMetric(aOutput, "otbr_rest_mainloop_pending_requests", "gauge",
+                 "REST requests and chunks waiting to be handled on the mainloop.",
+                 mWorkerPool->GetNumPendingRequests());
+
+    for (const auto &gauge : kWorkerGauges)
+    {
+        AppendFamily(aOutput, gauge.mName, "gauge", gauge.mHelp);
+
+        for (size_t i = 0; i < mWorkerPool->GetWorkers().size(); ++i)
+        {
+            labels = "worker=\"" + std::to_string(i) + "\"";
+            AppendSample(aOutput, gauge.mName, labels.c_str(), ((*mWorkerPool->GetWorkers()[i]).*gauge.mGetter)());
+        }
+    }
+
+exit:
+    return;
+}
+
+void MetricsExporter::ExportProcess(std::string &aOutput) const
+{
+    struct rusage usage;
+    FILE         *statm;
+    unsigned long size;
+    unsigned long resident;
+
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+        AppendFamily(aOutput, "process_cpu_seconds_total", "counter", "Total user and system CPU time in seconds.");
+        AppendRealSample(aOutput, "process_cpu_seconds_total", nullptr,
+                         usage.ru_utime.tv_sec + usage.ru_stime.tv_sec +
+                             (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6);
+    }
+
+    statm = fopen("/proc/self/statm", "r");
+    VerifyOrExit(statm != nullptr);
+
+    if (fscanf(statm, "%lu %lu", &size, &resident) == 2)
+    {
+        AppendMetric(aOutput, "process_virtual_memory_bytes", "gauge", "Virtual memory size in bytes.",
+                     static_cast<uint64_t>(size) * sysconf(_SC_PAGESIZE));
+        AppendMetric(aOutput, "process_resident_memory_bytes", "gauge", "Resident memory size in bytes.",
+                     static_cast<uint64_t>(resident) * sysconf(_SC_PAGESIZE));
+    }
+
+    fclose(statm);
+
+exit:
+    return;
+}
+
+} // namespace rest
+} // namespace otbr
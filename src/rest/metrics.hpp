@@ -0,0 +1,160 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the Prometheus metrics exporter of the RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_METRICS_HPP_
+#define OTBR_REST_METRICS_HPP_
+
+#include "openthread-br/config.h"
+
+#include <string>
+
+#include "mdns/mdns.hpp"
+#include "ncp/ncp_openthread.hpp"
+
+namespace otbr {
+
+#if OTBR_ENABLE_BACKBONE_ROUTER && OTBR_ENABLE_DUA_ROUTING
+namespace BackboneRouter {
+class BackboneAgent;
+}
+#endif
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+class AdvertisingProxy;
+#endif
+
+#if OTBR_ENABLE_BORDER_AGENT
+class BorderAgent;
+#endif
+
+namespace rest {
+
+class WorkerPool;
+
+/**
+ * This class exports the counters of the agent in the Prometheus text exposition format.
+ *
+ * The counters are read directly from OpenThread and the mDNS publisher, without building any intermediate
+ * representation, so that a scrape stays cheap.
+ *
+ */
+class MetricsExporter
+{
+public:
+    /**
+     * The constructor initializes the metrics exporter.
+     *
+     * @param[in] aNcp        A reference to the NCP controller.
+     * @param[in] aPublisher  A pointer to the mDNS publisher, or nullptr if there is none.
+     *
+     */
+    MetricsExporter(Ncp::ControllerOpenThread &aNcp, Mdns::Publisher *aPublisher);
+
+    /**
+     * This method sets the worker threads of the REST server, whose queues are exported.
+     *
+     * @param[in] aWorkerPool  A pointer to the worker pool, or nullptr if there is none.
+     *
+     */
+    void SetWorkerPool(const WorkerPool *aWorkerPool) { mWorkerPool = aWorkerPool; }
+
+#if OTBR_ENABLE_BACKBONE_ROUTER && OTBR_ENABLE_DUA_ROUTING
+    /**
+     * This method sets the Backbone agent, whose ND Proxy counters are exported.
+     *
+     * @param[in] aBackboneAgent  A pointer to the Backbone agent, or nullptr if there is none.
+     *
+     */
+    void SetBackboneAgent(const BackboneRouter::BackboneAgent *aBackboneAgent) { mBackboneAgent = aBackboneAgent; }
+#endif
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    /**
+     * This method sets the Advertising Proxy, whose SRP update counters are exported.
+     *
+     * @param[in] aAdvertisingProxy  A pointer to the Advertising Proxy, or nullptr if there is none.
+     *
+     */
+    void SetAdvertisingProxy(const AdvertisingProxy *aAdvertisingProxy) { mAdvertisingProxy = aAdvertisingProxy; }
+#endif
+
+#if OTBR_ENABLE_BORDER_AGENT
+    /**
+     * This method sets the Border Agent, whose MeshCoP service republishing counters are exported.
+     *
+     * @param[in] aBorderAgent  A pointer to the Border Agent, or nullptr if there is none.
+     *
+     */
+    void SetBorderAgent(const BorderAgent *aBorderAgent) { mBorderAgent = aBorderAgent; }
+#endif
+
+    /**
+     * This method appends all metrics to a string in the Prometheus text exposition format.
+     *
+     * @param[in,out] aOutput  A string the metrics are appended to.
+     *
+     */
+    void Export(std::string &aOutput) const;
+
+private:
+    void ExportThread(std::string &aOutput) const;
+    void ExportRadio(std::string &aOutput) const;
+    void ExportSrpServer(std::string &aOutput) const;
+    void ExportDnssd(std::string &aOutput) const;
+    void ExportMdns(std::string &aOutput) const;
+    void ExportBorderAgent(std::string &aOutput) const;
+    void ExportNat64(std::string &aOutput) const;
+    void ExportBorderRouting(std::string &aOutput) const;
+    void ExportNdProxy(std::string &aOutput) const;
+    void ExportTelemetry(std::string &aOutput) const;
+    void ExportRestServer(std::string &aOutput) const;
+    void ExportProcess(std::string &aOutput) const;
+
+    Ncp::ControllerOpenThread &mNcp;
+    Mdns::Publisher           *mPublisher;
+    const WorkerPool          *mWorkerPool;
+#if OTBR_ENABLE_BACKBONE_ROUTER && OTBR_ENABLE_DUA_ROUTING
+    const BackboneRouter::BackboneAgent *mBackboneAgent;
+#endif
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    const AdvertisingProxy *mAdvertisingProxy;
+#endif
+#if OTBR_ENABLE_BORDER_AGENT
+    const BorderAgent *mBorderAgent;
+#endif
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_METRICS_HPP_
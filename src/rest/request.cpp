@@ -27,6 +27,7 @@
  */
 
 #include "rest/request.hpp"
+#include "utils/hex.hpp"
 #include "utils/string_utils.hpp"
 
 namespace otbr {
@@ -98,6 +99,58 @@ exit:
     return url;
 }
 
+bool Request::GetQueryParameter(const std::string &aName, std::string &aValue) const
+{
+    size_t begin = mUrl.find('?');
+    bool   found = false;
+
+    VerifyOrExit(begin != std::string::npos);
+
+    while (!found && begin < mUrl.size())
+    {
+        size_t end = mUrl.find('&', ++begin);
+        size_t equal;
+
+        if (end == std::string::npos)
+        {
+            end = mUrl.size();
+        }
+
+        equal = mUrl.find('=', begin);
+        if (equal == std::string::npos || equal > end)
+        {
+            equal = end;
+        }
+
+        if (mUrl.compare(begin, equal - begin, aName) == 0)
+        {
+            found = true;
+            aValue.clear();
+
+            for (size_t i = equal + 1; i < end; i++)
+            {
+                uint8_t byte;
+
+                if (mUrl[i] == '%' && i + 2 < end &&
+                    Utils::Hex2Bytes(mUrl.substr(i + 1, 2).c_str(), &byte, sizeof(byte)) == 1)
+                {
+                    aValue += static_cast<char>(byte);
+                    i += 2;
+                }
+                else
+                {
+                    aValue += (mUrl[i] == '+') ? ' ' : mUrl[i];
+                }
+            }
+        }
+
+        begin = end;
+    }
+
+exit:
+    return found;
+}
+
 std::string Request::GetHeaderValue(const std::string aHeaderField) const
 {
     auto it = mHeaders.find(StringUtils::ToLowercase(aHeaderField));
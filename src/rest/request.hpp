@@ -143,6 +143,16 @@ public:
      */
     std::string GetUrl(void) const;
 
+    /**
+     * This method returns the value of a query parameter of the url of this request.
+     *
+     * @param[in]  aName   The name of the query parameter.
+     * @param[out] aValue  The percent-decoded value of the query parameter.
+     *
+     * @returns Whether the url has the query parameter @p aName.
+     */
+    bool GetQueryParameter(const std::string &aName, std::string &aValue) const;
+
     /**
      * This method returns the specified header field for this request.
      *
@@ -30,6 +30,11 @@
 
 #include "rest/resource.hpp"
 
+#include <cctype>
+#include <cstdlib>
+#include <random>
+#include <sstream>
+
 #define OT_PSKC_MAX_LENGTH 16
 #define OT_EXTENDED_PANID_LENGTH 8
 
@@ -46,14 +51,41 @@
 #define OT_REST_RESOURCE_PATH_NODE_EXTPANID "/node/ext-panid"
 #define OT_REST_RESOURCE_PATH_NODE_DATASET_ACTIVE "/node/dataset/active"
 #define OT_REST_RESOURCE_PATH_NODE_DATASET_PENDING "/node/dataset/pending"
+#define OT_REST_RESOURCE_PATH_NODE_TELEMETRY "/node/telemetry"
+#define OT_REST_RESOURCE_PATH_NODE_CHILDREN "/node/children"
+#define OT_REST_RESOURCE_PATH_NODE_NEIGHBORS "/node/neighbors"
+#define OT_REST_RESOURCE_PATH_NODE_SRP_HOSTS "/node/srp/hosts"
+#define OT_REST_RESOURCE_PATH_NODE_SRP_SERVICES "/node/srp/services"
+#define OT_REST_RESOURCE_PATH_NODE_NAT64_MAPPINGS "/node/nat64/mappings"
 #define OT_REST_RESOURCE_PATH_NETWORK "/networks"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT "/networks/current"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_COMMISSION "/networks/commission"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_PREFIX "/networks/current/prefix"
+#define OT_REST_RESOURCE_PATH_EVENTS "/events"
+#define OT_REST_RESOURCE_PATH_METRICS "/metrics"
+
+#define OT_REST_CONTENT_TYPE_METRICS "text/plain; version=0.0.4; charset=utf-8"
+#define OT_REST_CONTENT_TYPE_PROTOBUF "application/x-protobuf"
+
+#define OT_REST_QUERY_SECTIONS "sections"
+#define OT_REST_QUERY_LIMIT "limit"
+#define OT_REST_QUERY_CURSOR "cursor"
+#define OT_REST_QUERY_FIELDS "fields"
+
+#define OT_REST_EVENT_STATE "state"
+#define OT_REST_EVENT_NETWORKNAME "network-name"
+#define OT_REST_EVENT_LEADERDATA "leader-data"
+#define OT_REST_EVENT_DATASET_ACTIVE "dataset-active"
+#define OT_REST_EVENT_DATASET_PENDING "dataset-pending"
+
+#define OT_REST_LAST_EVENT_ID_HEADER "Last-Event-ID"
+#define OT_REST_ETAG_HEADER "ETag"
+#define OT_REST_IF_NONE_MATCH_HEADER "If-None-Match"
 
 #define OT_REST_HTTP_STATUS_200 "200 OK"
 #define OT_REST_HTTP_STATUS_201 "201 Created"
 #define OT_REST_HTTP_STATUS_204 "204 No Content"
+#define OT_REST_HTTP_STATUS_304 "304 Not Modified"
 #define OT_REST_HTTP_STATUS_400 "400 Bad Request"
 #define OT_REST_HTTP_STATUS_404 "404 Not Found"
 #define OT_REST_HTTP_STATUS_405 "405 Method Not Allowed"
@@ -83,6 +115,481 @@ static const uint32_t kDiagResetTimeout = 3000000;
 // Timeout (in Microseconds) for collecting diagnostics
 static const uint32_t kDiagCollectTimeout = 2000000;
 
+// Maximum number of recent Thread state events kept for subscribers catching up
+static const size_t kMaxEvents = 32;
+
+// Thread state changes which are reported as events
+static const otChangedFlags kEventFlags = OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID |
+                                          OT_CHANGED_THREAD_NETDATA | OT_CHANGED_THREAD_NETWORK_NAME |
+                                          OT_CHANGED_ACTIVE_DATASET | OT_CHANGED_PENDING_DATASET;
+
+// Thread state changes which may alter the resources of each resource group, indexed by `ResourceGroup`
+static const otChangedFlags kResourceGroupFlags[] = {
+    OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_THREAD_NETDATA |
+        OT_CHANGED_THREAD_NETWORK_NAME | OT_CHANGED_THREAD_EXT_PANID | OT_CHANGED_THREAD_RLOC_ADDED |
+        OT_CHANGED_THREAD_RLOC_REMOVED | OT_CHANGED_THREAD_ML_ADDR | OT_CHANGED_ACTIVE_DATASET,
+    OT_CHANGED_THREAD_ROLE,
+    OT_CHANGED_THREAD_NETWORK_NAME,
+    OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_THREAD_NETDATA,
+    OT_CHANGED_ACTIVE_DATASET,
+};
+
+// Number of bytes of a collection produced at once, as one chunk of the response.
+static const size_t kCollectionChunkSize = 4096;
+
+/**
+ * This class iterates over the entries of a collection resource.
+ *
+ * The position of an iterator is its cursor, a number which lets a later request continue where a previous one
+ * stopped.
+ *
+ */
+class CollectionIterator
+{
+public:
+    virtual ~CollectionIterator(void) = default;
+
+    /**
+     * This method moves the iterator to the position of a cursor.
+     *
+     * @param[in] aCursor  A cursor returned by `GetCursor()`.
+     *
+     * @retval TRUE   Successfully moved the iterator.
+     * @retval FALSE  The cursor is not valid.
+     *
+     */
+    virtual bool SetCursor(uint32_t aCursor) = 0;
+
+    /**
+     * This method returns the cursor of the current position.
+     *
+     * @returns The cursor of the current position.
+     *
+     */
+    virtual uint32_t GetCursor(void) const = 0;
+
+    /**
+     * This method formats the entry at the current position and moves to the next one.
+     *
+     * @param[in]  aFields  The fields of the entry to format.
+     * @param[out] aEntry   The entry formatted as a Json object.
+     *
+     * @retval TRUE   Successfully formatted the entry.
+     * @retval FALSE  There are no more entries.
+     *
+     */
+    virtual bool Next(const Json::FieldSet &aFields, std::string &aEntry) = 0;
+
+    /**
+     * This method returns the names of the fields of an entry.
+     *
+     * @returns The names of the fields.
+     *
+     */
+    virtual const Json::FieldSet &GetFields(void) const = 0;
+
+    /**
+     * This method is called after each chunk of the collection.
+     *
+     * The OpenThread tables may change before the next chunk, so no pointer into them may be kept.
+     *
+     */
+    virtual void Pause(void) {}
+};
+
+namespace {
+
+class ChildIterator : public CollectionIterator
+{
+public:
+    explicit ChildIterator(otInstance *aInstance)
+        : mInstance(aInstance)
+        , mIndex(0)
+    {
+    }
+
+    bool SetCursor(uint32_t aCursor) override
+    {
+        mIndex = aCursor;
+
+        return aCursor <= otThreadGetMaxAllowedChildren(mInstance);
+    }
+
+    uint32_t GetCursor(void) const override { return mIndex; }
+
+    bool Next(const Json::FieldSet &aFields, std::string &aEntry) override
+    {
+        otChildInfo childInfo;
+        bool        found = false;
+
+        // Unused entries of the child table are skipped, the index of an entry stays the same while children come
+        // and go.
+        while (!found && mIndex < otThreadGetMaxAllowedChildren(mInstance))
+        {
+            found = (otThreadGetChildInfoByIndex(mInstance, mIndex++, &childInfo) == OT_ERROR_NONE);
+        }
+
+        if (found)
+        {
+            aEntry = Json::ChildInfo2JsonString(childInfo, aFields);
+        }
+
+        return found;
+    }
+
+    const Json::FieldSet &GetFields(void) const override { return Json::ChildInfoFields(); }
+
+private:
+    otInstance *mInstance;
+    uint16_t    mIndex;
+};
+
+/**
+ * This class iterates over the neighbors, the cursor is the OpenThread neighbor iterator offset by `-INT16_MIN`.
+ *
+ * The OpenThread iterator is a child table index while walking the children, and becomes negative while walking the
+ * routers, so it is offset to make every cursor a non-negative number.
+ *
+ */
+class NeighborIterator : public CollectionIterator
+{
+public:
+    explicit NeighborIterator(otInstance *aInstance)
+        : mInstance(aInstance)
+        , mIterator(OT_NEIGHBOR_INFO_ITERATOR_INIT)
+    {
+    }
+
+    bool SetCursor(uint32_t aCursor) override
+    {
+        bool valid = (aCursor <= static_cast<uint32_t>(INT16_MAX - INT16_MIN));
+
+        if (valid)
+        {
+            mIterator = static_cast<otNeighborInfoIterator>(static_cast<int32_t>(aCursor) + INT16_MIN);
+        }
+
+        return valid;
+    }
+
+    uint32_t GetCursor(void) const override { return static_cast<uint32_t>(mIterator - INT16_MIN); }
+
+    bool Next(const Json::FieldSet &aFields, std::string &aEntry) override
+    {
+        otNeighborInfo neighborInfo;
+        bool           found = (otThreadGetNextNeighborInfo(mInstance, &mIterator, &neighborInfo) == OT_ERROR_NONE);
+
+        if (found)
+        {
+            aEntry = Json::NeighborInfo2JsonString(neighborInfo, aFields);
+        }
+
+        return found;
+    }
+
+    const Json::FieldSet &GetFields(void) const override { return Json::NeighborInfoFields(); }
+
+private:
+    otInstance            *mInstance;
+    otNeighborInfoIterator mIterator;
+};
+
+/**
+ * This class iterates over a collection whose OpenThread iterator may not be kept between chunks, the cursor is the
+ * number of entries before the current position.
+ *
+ */
+class OrdinalIterator : public CollectionIterator
+{
+public:
+    OrdinalIterator(void)
+        : mPosition(0)
+        , mResumed(false)
+        , mEnd(false)
+    {
+    }
+
+    bool SetCursor(uint32_t aCursor) override
+    {
+        mPosition = aCursor;
+        mResumed  = false;
+
+        return true;
+    }
+
+    uint32_t GetCursor(void) const override { return mPosition; }
+
+    bool Next(const Json::FieldSet &aFields, std::string &aEntry) override
+    {
+        // Entries may have been added or removed since the previous chunk, so walk to the current position again.
+        if (!mResumed)
+        {
+            Rewind();
+
+            for (uint32_t i = 0; !mEnd && i < mPosition; i++)
+            {
+                mEnd = !Advance();
+            }
+
+            mResumed = true;
+        }
+
+        mEnd = mEnd || !Advance();
+        VerifyOrExit(!mEnd);
+
+        aEntry = Format(aFields);
+        mPosition++;
+
+    exit:
+        return !mEnd;
+    }
+
+    void Pause(void) override { mResumed = false; }
+
+protected:
+    // Moves before the first entry.
+    virtual void Rewind(void) = 0;
+
+    // Moves to the next entry, returns false if there is none.
+    virtual bool Advance(void) = 0;
+
+    // Formats the current entry.
+    virtual std::string Format(const Json::FieldSet &aFields) const = 0;
+
+private:
+    uint32_t mPosition;
+    bool     mResumed;
+    bool     mEnd;
+};
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+class SrpHostIterator : public OrdinalIterator
+{
+public:
+    explicit SrpHostIterator(otInstance *aInstance)
+        : mInstance(aInstance)
+        , mHost(nullptr)
+    {
+    }
+
+    const Json::FieldSet &GetFields(void) const override { return Json::SrpHostFields(); }
+
+protected:
+    void Rewind(void) override { mHost = nullptr; }
+
+    bool Advance(void) override
+    {
+        mHost = otSrpServerGetNextHost(mInstance, mHost);
+
+        return mHost != nullptr;
+    }
+
+    std::string Format(const Json::FieldSet &aFields) const override
+    {
+        return Json::SrpHost2JsonString(mHost, aFields);
+    }
+
+private:
+    otInstance            *mInstance;
+    const otSrpServerHost *mHost;
+};
+
+class SrpServiceIterator : public OrdinalIterator
+{
+public:
+    explicit SrpServiceIterator(otInstance *aInstance)
+        : mInstance(aInstance)
+        , mHost(nullptr)
+        , mService(nullptr)
+    {
+    }
+
+    const Json::FieldSet &GetFields(void) const override { return Json::SrpServiceFields(); }
+
+protected:
+    void Rewind(void) override
+    {
+        mHost    = nullptr;
+        mService = nullptr;
+    }
+
+    bool Advance(void) override
+    {
+        mService = (mHost != nullptr) ? otSrpServerHostGetNextService(mHost, mService) : nullptr;
+
+        while (mService == nullptr && (mHost = otSrpServerGetNextHost(mInstance, mHost)) != nullptr)
+        {
+            mService = otSrpServerHostGetNextService(mHost, nullptr);
+        }
+
+        return mService != nullptr;
+    }
+
+    std::string Format(const Json::FieldSet &aFields) const override
+    {
+        return Json::SrpService2JsonString(mService, aFields);
+    }
+
+private:
+    otInstance               *mInstance;
+    const otSrpServerHost    *mHost;
+    const otSrpServerService *mService;
+};
+#endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
+
+#if OTBR_ENABLE_NAT64
+class Nat64MappingIterator : public OrdinalIterator
+{
+public:
+    explicit Nat64MappingIterator(otInstance *aInstance)
+        : mInstance(aInstance)
+        , mIterator()
+        , mMapping()
+    {
+    }
+
+    const Json::FieldSet &GetFields(void) const override { return Json::Nat64MappingFields(); }
+
+protected:
+    void Rewind(void) override { otNat64InitAddressMappingIterator(mInstance, &mIterator); }
+
+    bool Advance(void) override
+    {
+        return otNat64GetNextAddressMapping(mInstance, &mIterator, &mMapping) == OT_ERROR_NONE;
+    }
+
+    std::string Format(const Json::FieldSet &aFields) const override
+    {
+        return Json::Nat64Mapping2JsonString(mMapping, aFields);
+    }
+
+private:
+    otInstance                   *mInstance;
+    otNat64AddressMappingIterator mIterator;
+    otNat64AddressMapping         mMapping;
+};
+#endif // OTBR_ENABLE_NAT64
+
+/**
+ * This class produces the body of a collection resource, as a Json object with the entries in `Items` and the cursor
+ * of the following entries in `Next` if the limit was reached before the end of the collection.
+ *
+ */
+class CollectionWriter
+{
+public:
+    CollectionWriter(std::shared_ptr<CollectionIterator> aIterator, const Json::FieldSet &aFields, uint32_t aLimit)
+        : mIterator(std::move(aIterator))
+        , mFields(aFields)
+        , mLimit(aLimit)
+        , mCount(0)
+        , mStarted(false)
+    {
+    }
+
+    bool operator()(std::string &aChunk)
+    {
+        bool        more = true;
+        uint32_t    cursor;
+        std::string entry;
+
+        if (!mStarted)
+        {
+            aChunk += "{\"Items\":[";
+            mStarted = true;
+        }
+
+        while (more && aChunk.size() < kCollectionChunkSize)
+        {
+            cursor = mIterator->GetCursor();
+
+            if (!mIterator->Next(mFields, entry))
+            {
+                aChunk += "]}";
+                more = false;
+            }
+            else if (mLimit != 0 && mCount == mLimit)
+            {
+                aChunk += "],\"Next\":\"" + std::to_string(cursor) + "\"}";
+                more = false;
+            }
+            else
+            {
+                if (mCount++ > 0)
+                {
+                    aChunk += ',';
+                }
+                aChunk += entry;
+            }
+        }
+
+        mIterator->Pause();
+
+        return more;
+    }
+
+private:
+    std::shared_ptr<CollectionIterator> mIterator;
+    Json::FieldSet                      mFields;
+    uint32_t                            mLimit;
+    uint32_t                            mCount;
+    bool                                mStarted;
+};
+
+bool ParseUint32(const std::string &aString, uint32_t &aValue)
+{
+    char         *end   = nullptr;
+    unsigned long value = 0;
+
+    if (!aString.empty() && isdigit(static_cast<unsigned char>(aString[0])))
+    {
+        value = strtoul(aString.c_str(), &end, 10);
+    }
+
+    aValue = static_cast<uint32_t>(value);
+
+    return end != nullptr && *end == '\0' && value <= UINT32_MAX;
+}
+
+bool ParseCollectionQuery(const Request      &aRequest,
+                          CollectionIterator &aIterator,
+                          Json::FieldSet     &aFields,
+                          uint32_t           &aLimit)
+{
+    bool        ret = true;
+    std::string value;
+    uint32_t    cursor;
+
+    if (aRequest.GetQueryParameter(OT_REST_QUERY_LIMIT, value))
+    {
+        VerifyOrExit(ParseUint32(value, aLimit) && aLimit > 0, ret = false);
+    }
+
+    if (aRequest.GetQueryParameter(OT_REST_QUERY_CURSOR, value))
+    {
+        VerifyOrExit(ParseUint32(value, cursor) && aIterator.SetCursor(cursor), ret = false);
+    }
+
+    if (aRequest.GetQueryParameter(OT_REST_QUERY_FIELDS, value))
+    {
+        std::istringstream fieldNames(value);
+        std::string        fieldName;
+
+        while (std::getline(fieldNames, fieldName, ','))
+        {
+            VerifyOrExit(aIterator.GetFields().count(fieldName) != 0, ret = false);
+            aFields.insert(fieldName);
+        }
+
+        VerifyOrExit(!aFields.empty(), ret = false);
+    }
+
+exit:
+    return ret;
+}
+
+} // namespace
+
 static std::string GetHttpStatus(HttpStatusCode aErrorCode)
 {
     std::string httpStatus;
@@ -98,6 +605,9 @@ static std::string GetHttpStatus(HttpStatusCode aErrorCode)
     case HttpStatusCode::kStatusNoContent:
         httpStatus = OT_REST_HTTP_STATUS_204;
         break;
+    case HttpStatusCode::kStatusNotModified:
+        httpStatus = OT_REST_HTTP_STATUS_304;
+        break;
     case HttpStatusCode::kStatusBadRequest:
         httpStatus = OT_REST_HTTP_STATUS_400;
         break;
@@ -121,9 +631,14 @@ static std::string GetHttpStatus(HttpStatusCode aErrorCode)
     return httpStatus;
 }
 
-Resource::Resource(ControllerOpenThread *aNcp)
+Resource::Resource(ControllerOpenThread *aNcp, Mdns::Publisher *aPublisher)
     : mInstance(nullptr)
     , mNcp(aNcp)
+    , mPublisher(aPublisher)
+    , mMetricsExporter(*aNcp, aPublisher)
+    , mGenerations()
+    , mETagPrefix(std::to_string(std::random_device()()))
+    , mLastEventId(0)
 {
     // Resource Handler
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOSTICS, &Resource::Diagnostic);
@@ -139,6 +654,27 @@ Resource::Resource(ControllerOpenThread *aNcp)
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_RLOC, &Resource::Rloc);
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_DATASET_ACTIVE, &Resource::DatasetActive);
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_DATASET_PENDING, &Resource::DatasetPending);
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_EVENTS, &Resource::Events);
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_METRICS, &Resource::Metrics);
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_TELEMETRY, &Resource::Telemetry);
+#endif
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_CHILDREN, &Resource::Children);
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_NEIGHBORS, &Resource::Neighbors);
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_SRP_HOSTS, &Resource::SrpHosts);
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_SRP_SERVICES, &Resource::SrpServices);
+#endif
+#if OTBR_ENABLE_NAT64
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_NAT64_MAPPINGS, &Resource::Nat64Mappings);
+#endif
+
+    // Resource groups supporting conditional GET
+    mResourceGroupMap.emplace(OT_REST_RESOURCE_PATH_NODE, ResourceGroup::kNode);
+    mResourceGroupMap.emplace(OT_REST_RESOURCE_PATH_NODE_STATE, ResourceGroup::kState);
+    mResourceGroupMap.emplace(OT_REST_RESOURCE_PATH_NODE_NETWORKNAME, ResourceGroup::kNetworkName);
+    mResourceGroupMap.emplace(OT_REST_RESOURCE_PATH_NODE_LEADERDATA, ResourceGroup::kLeaderData);
+    mResourceGroupMap.emplace(OT_REST_RESOURCE_PATH_NODE_DATASET_ACTIVE, ResourceGroup::kDatasetActive);
 
     // Resource callback handler
     mResourceCallbackMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOSTICS, &Resource::HandleDiagnosticCallback);
@@ -147,17 +683,40 @@ Resource::Resource(ControllerOpenThread *aNcp)
 void Resource::Init(void)
 {
     mInstance = mNcp->GetThreadHelper()->GetInstance();
+
+    mNcp->AddThreadStateChangedCallback([this](otChangedFlags aFlags) { HandleThreadStateChanged(aFlags); });
+    HandleThreadStateChanged(kEventFlags);
 }
 
 void Resource::Handle(Request &aRequest, Response &aResponse) const
 {
-    std::string url = aRequest.GetUrl();
-    auto        it  = mResourceMap.find(url);
+    std::string url     = aRequest.GetUrl();
+    auto        it      = mResourceMap.find(url);
+    auto        groupIt = mResourceGroupMap.find(url);
+    std::string eTag;
+    std::string errorCode;
 
-    if (it != mResourceMap.end())
+    if (groupIt != mResourceGroupMap.end() && aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        eTag = GetETag(groupIt->second, aRequest);
+    }
+
+    if (!eTag.empty() && MatchETag(aRequest.GetHeaderValue(OT_REST_IF_NONE_MATCH_HEADER), eTag))
+    {
+        // Nothing changed since the client got this resource, so neither read the state nor build the body.
+        errorCode = GetHttpStatus(HttpStatusCode::kStatusNotModified);
+        aResponse.SetResponsCode(errorCode);
+        aResponse.SetHeader(OT_REST_ETAG_HEADER, eTag);
+    }
+    else if (it != mResourceMap.end())
     {
         ResourceHandler resourceHandler = it->second;
         (this->*resourceHandler)(aRequest, aResponse);
+
+        if (!eTag.empty() && aResponse.GetResponseCode() == GetHttpStatus(HttpStatusCode::kStatusOk))
+        {
+            aResponse.SetHeader(OT_REST_ETAG_HEADER, eTag);
+        }
     }
     else
     {
@@ -181,7 +740,6 @@ void Resource::HandleDiagnosticCallback(const Request &aRequest, Response &aResp
 {
     OT_UNUSED_VARIABLE(aRequest);
     std::vector<std::vector<otNetworkDiagTlv>> diagContentSet;
-    std::string                                body;
     std::string                                errorCode;
 
     auto duration = duration_cast<microseconds>(steady_clock::now() - aResponse.GetStartTime()).count();
@@ -194,10 +752,9 @@ void Resource::HandleDiagnosticCallback(const Request &aRequest, Response &aResp
             diagContentSet.push_back(it->second.mDiagContent);
         }
 
-        body      = Json::Diag2JsonString(diagContentSet);
         errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
         aResponse.SetResponsCode(errorCode);
-        aResponse.SetBody(body);
+        aResponse.SetBodyFormatter([diagContentSet]() { return Json::Diag2JsonString(diagContentSet); });
         aResponse.SetComplete();
     }
 }
@@ -216,34 +773,20 @@ void Resource::GetNodeInfo(Response &aResponse) const
 {
     otbrError       error = OTBR_ERROR_NONE;
     struct NodeInfo node  = {};
-    otRouterInfo    routerInfo;
-    uint8_t         maxRouterId;
-    std::string     body;
     std::string     errorCode;
 
     VerifyOrExit(otBorderAgentGetId(mInstance, &node.mBaId) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
     (void)otThreadGetLeaderData(mInstance, &node.mLeaderData);
 
-    node.mNumOfRouter = 0;
-    maxRouterId       = otThreadGetMaxRouterId(mInstance);
-    for (uint8_t i = 0; i <= maxRouterId; ++i)
-    {
-        if (otThreadGetRouterInfo(mInstance, i, &routerInfo) != OT_ERROR_NONE)
-        {
-            continue;
-        }
-        ++node.mNumOfRouter;
-    }
-
+    node.mNumOfRouter = GetNumOfRouters();
     node.mRole        = GetDeviceRoleName(otThreadGetDeviceRole(mInstance));
-    node.mExtAddress  = reinterpret_cast<const uint8_t *>(otLinkGetExtendedAddress(mInstance));
+    node.mExtAddress  = *otLinkGetExtendedAddress(mInstance);
     node.mNetworkName = otThreadGetNetworkName(mInstance);
     node.mRloc16      = otThreadGetRloc16(mInstance);
-    node.mExtPanId    = reinterpret_cast<const uint8_t *>(otThreadGetExtendedPanId(mInstance));
+    node.mExtPanId    = *otThreadGetExtendedPanId(mInstance);
     node.mRlocAddress = *otThreadGetRloc(mInstance);
 
-    body = Json::Node2JsonString(node);
-    aResponse.SetBody(body);
+    aResponse.SetBodyFormatter([node]() { return Json::Node2JsonString(node); });
 
 exit:
     if (error == OTBR_ERROR_NONE)
@@ -507,15 +1050,13 @@ void Resource::LeaderData(const Request &aRequest, Response &aResponse) const
     }
 }
 
-void Resource::GetDataNumOfRoute(Response &aResponse) const
+uint8_t Resource::GetNumOfRouters(void) const
 {
     uint8_t      count = 0;
     uint8_t      maxRouterId;
     otRouterInfo routerInfo;
-    maxRouterId = otThreadGetMaxRouterId(mInstance);
-    std::string body;
-    std::string errorCode;
 
+    maxRouterId = otThreadGetMaxRouterId(mInstance);
     for (uint8_t i = 0; i <= maxRouterId; ++i)
     {
         if (otThreadGetRouterInfo(mInstance, i, &routerInfo) != OT_ERROR_NONE)
@@ -525,7 +1066,15 @@ void Resource::GetDataNumOfRoute(Response &aResponse) const
         ++count;
     }
 
-    body = Json::Number2JsonString(count);
+    return count;
+}
+
+void Resource::GetDataNumOfRoute(Response &aResponse) const
+{
+    std::string body;
+    std::string errorCode;
+
+    body = Json::Number2JsonString(GetNumOfRouters());
 
     aResponse.SetBody(body);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
@@ -629,7 +1178,6 @@ void Resource::GetDataset(DatasetType aDatasetType, const Request &aRequest, Res
 {
     otbrError                error = OTBR_ERROR_NONE;
     struct NodeInfo          node;
-    std::string              body;
     std::string              errorCode;
     otOperationalDataset     dataset;
     otOperationalDatasetTlvs datasetTlvs;
@@ -648,24 +1196,23 @@ void Resource::GetDataset(DatasetType aDatasetType, const Request &aRequest, Res
         }
 
         aResponse.SetContentType(OT_REST_CONTENT_TYPE_PLAIN);
-        body = Utils::Bytes2Hex(datasetTlvs.mTlvs, datasetTlvs.mLength);
+        aResponse.SetBodyFormatter(
+            [datasetTlvs]() { return Utils::Bytes2Hex(datasetTlvs.mTlvs, datasetTlvs.mLength); });
     }
     else
     {
         if (aDatasetType == DatasetType::kActive)
         {
             VerifyOrExit(otDatasetGetActive(mInstance, &dataset) == OT_ERROR_NONE, error = OTBR_ERROR_NOT_FOUND);
-            body = Json::ActiveDataset2JsonString(dataset);
+            aResponse.SetBodyFormatter([dataset]() { return Json::ActiveDataset2JsonString(dataset); });
         }
         else if (aDatasetType == DatasetType::kPending)
         {
             VerifyOrExit(otDatasetGetPending(mInstance, &dataset) == OT_ERROR_NONE, error = OTBR_ERROR_NOT_FOUND);
-            body = Json::PendingDataset2JsonString(dataset);
+            aResponse.SetBodyFormatter([dataset]() { return Json::PendingDataset2JsonString(dataset); });
         }
     }
 
-    aResponse.SetBody(body);
-
 exit:
     if (error == OTBR_ERROR_NONE)
     {
@@ -898,5 +1445,320 @@ exit:
     }
 }
 
+void Resource::Events(const Request &aRequest, Response &aResponse) const
+{
+    std::string lastEventId = aRequest.GetHeaderValue(OT_REST_LAST_EVENT_ID_HEADER);
+    char       *end         = nullptr;
+    uint64_t    id          = 0;
+    std::string body;
+    std::string errorCode;
+
+    VerifyOrExit(aRequest.GetMethod() == HttpMethod::kGet,
+                 ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed));
+
+    if (!lastEventId.empty())
+    {
+        id = strtoull(lastEventId.c_str(), &end, 10);
+    }
+
+    // A subscriber resuming within the event history only gets the events it missed, any other
+    // subscriber starts with the latest data of each event.
+    if (end == nullptr || *end != '\0' || !GetEvents(id, body))
+    {
+        body.clear();
+
+        for (const auto &event : mEventSnapshot)
+        {
+            AppendEvent(mLastEventId, event.first, event.second, body);
+        }
+    }
+
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetBody(body);
+    aResponse.SetStream(mLastEventId);
+
+exit:
+    return;
+}
+
+void Resource::Metrics(const Request &aRequest, Response &aResponse) const
+{
+    // Large enough for all metrics, so that building the body does not reallocate.
+    static constexpr size_t kMetricsReserveSize = 16384;
+
+    std::string body;
+    std::string errorCode;
+
+    VerifyOrExit(aRequest.GetMethod() == HttpMethod::kGet,
+                 ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed));
+
+    body.reserve(kMetricsReserveSize);
+    mMetricsExporter.Export(body);
+
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetContentType(OT_REST_CONTENT_TYPE_METRICS);
+    aResponse.SetBody(body);
+
+exit:
+    return;
+}
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+void Resource::Telemetry(const Request &aRequest, Response &aResponse) const
+{
+    uint32_t                                      sections = agent::ThreadHelper::kTelemetrySectionsAll;
+    std::string                                   sectionNames;
+    std::string                                   errorCode;
+    std::shared_ptr<threadnetwork::TelemetryData> telemetryData = std::make_shared<threadnetwork::TelemetryData>();
+
+    VerifyOrExit(aRequest.GetMethod() == HttpMethod::kGet,
+                 ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed));
+
+    // Only the requested sections are retrieved, e.g. `?sections=wpan_stats,wpan_rcp` for a cheap health probe.
+    if (aRequest.GetQueryParameter(OT_REST_QUERY_SECTIONS, sectionNames))
+    {
+        VerifyOrExit(agent::ThreadHelper::ParseTelemetrySections(sectionNames, sections) == OT_ERROR_NONE,
+                     ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest));
+    }
+
+    if (mNcp->GetThreadHelper()->RetrieveTelemetryData(mPublisher, *telemetryData, sections) != OT_ERROR_NONE)
+    {
+        otbrLogWarning("Some metrics were not populated in RetrieveTelemetryData");
+    }
+
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetContentType(OT_REST_CONTENT_TYPE_PROTOBUF);
+    aResponse.SetBodyFormatter([telemetryData]() { return telemetryData->SerializeAsString(); });
+
+exit:
+    return;
+}
+#endif // OTBR_ENABLE_TELEMETRY_DATA_API
+
+void Resource::GetCollection(std::shared_ptr<CollectionIterator> aIterator,
+                             const Request                      &aRequest,
+                             Response                           &aResponse) const
+{
+    Json::FieldSet fields;
+    uint32_t       limit = 0;
+    std::string    errorCode;
+
+    VerifyOrExit(aRequest.GetMethod() == HttpMethod::kGet,
+                 ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed));
+    VerifyOrExit(ParseCollectionQuery(aRequest, *aIterator, fields, limit),
+                 ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest));
+
+    // The body is produced from the OpenThread tables while it is written, so that large tables are never held
+    // in memory as a whole.
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetChunked(CollectionWriter(std::move(aIterator), fields, limit));
+
+exit:
+    return;
+}
+
+void Resource::Children(const Request &aRequest, Response &aResponse) const
+{
+    GetCollection(std::make_shared<ChildIterator>(mInstance), aRequest, aResponse);
+}
+
+void Resource::Neighbors(const Request &aRequest, Response &aResponse) const
+{
+    GetCollection(std::make_shared<NeighborIterator>(mInstance), aRequest, aResponse);
+}
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+void Resource::SrpHosts(const Request &aRequest, Response &aResponse) const
+{
+    GetCollection(std::make_shared<SrpHostIterator>(mInstance), aRequest, aResponse);
+}
+
+void Resource::SrpServices(const Request &aRequest, Response &aResponse) const
+{
+    GetCollection(std::make_shared<SrpServiceIterator>(mInstance), aRequest, aResponse);
+}
+#endif
+
+#if OTBR_ENABLE_NAT64
+void Resource::Nat64Mappings(const Request &aRequest, Response &aResponse) const
+{
+    GetCollection(std::make_shared<Nat64MappingIterator>(mInstance), aRequest, aResponse);
+}
+#endif
+
+uint64_t Resource::GetLastEventId(void) const
+{
+    std::lock_guard<std::mutex> lock(mEventMutex);
+
+    return mLastEventId;
+}
+
+bool Resource::GetEvents(uint64_t aLastEventId, std::string &aOutput) const
+{
+    std::lock_guard<std::mutex> lock(mEventMutex);
+    bool                        ret = false;
+
+    VerifyOrExit(aLastEventId <= mLastEventId);
+    VerifyOrExit(mEvents.empty() || aLastEventId + 1 >= mEvents.front().mId);
+
+    for (const Event &event : mEvents)
+    {
+        if (event.mId > aLastEventId)
+        {
+            AppendEvent(event.mId, event.mName, event.mData, aOutput);
+        }
+    }
+
+    ret = true;
+
+exit:
+    return ret;
+}
+
+std::string Resource::GetETag(ResourceGroup aGroup, const Request &aRequest) const
+{
+    uint8_t     group = static_cast<uint8_t>(aGroup);
+    std::string eTag  = mETagPrefix + "-" + std::to_string(group) + "-" + std::to_string(mGenerations[group]);
+
+    switch (aGroup)
+    {
+    case ResourceGroup::kNode:
+        // Router table changes are not reported by any state changed flag.
+        eTag += "-" + std::to_string(GetNumOfRouters());
+        break;
+    case ResourceGroup::kDatasetActive:
+        if (aRequest.GetHeaderValue(OT_REST_ACCEPT_HEADER) == OT_REST_CONTENT_TYPE_PLAIN)
+        {
+            eTag += "-tlv";
+        }
+        break;
+    default:
+        break;
+    }
+
+    return "\"" + eTag + "\"";
+}
+
+bool Resource::MatchETag(const std::string &aIfNoneMatch, const std::string &aETag)
+{
+    bool   match = false;
+    size_t begin = 0;
+
+    VerifyOrExit(!aIfNoneMatch.empty());
+
+    while (!match && begin < aIfNoneMatch.size())
+    {
+        size_t      end = aIfNoneMatch.find(',', begin);
+        std::string candidate;
+
+        end       = (end == std::string::npos) ? aIfNoneMatch.size() : end;
+        candidate = aIfNoneMatch.substr(begin, end - begin);
+        begin     = end + 1;
+
+        candidate.erase(0, candidate.find_first_not_of(' '));
+        candidate.erase(candidate.find_last_not_of(' ') + 1);
+
+        // If-None-Match uses the weak comparison.
+        if (candidate.compare(0, 2, "W/") == 0)
+        {
+            candidate.erase(0, 2);
+        }
+
+        match = (candidate == "*" || candidate == aETag);
+    }
+
+exit:
+    return match;
+}
+
+void Resource::HandleThreadStateChanged(otChangedFlags aFlags)
+{
+    otLeaderData         leaderData;
+    otOperationalDataset dataset;
+
+    for (uint8_t group = 0; group < kNumResourceGroups; ++group)
+    {
+        if (aFlags & kResourceGroupFlags[group])
+        {
+            ++mGenerations[group];
+        }
+    }
+
+    VerifyOrExit(aFlags & kEventFlags);
+
+    if (aFlags & OT_CHANGED_THREAD_ROLE)
+    {
+        PushEvent(OT_REST_EVENT_STATE, Json::String2JsonString(GetDeviceRoleName(otThreadGetDeviceRole(mInstance))));
+    }
+
+    if (aFlags & OT_CHANGED_THREAD_NETWORK_NAME)
+    {
+        PushEvent(OT_REST_EVENT_NETWORKNAME, Json::String2JsonString(otThreadGetNetworkName(mInstance)));
+    }
+
+    if (aFlags & (OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_THREAD_NETDATA))
+    {
+        PushEvent(OT_REST_EVENT_LEADERDATA, otThreadGetLeaderData(mInstance, &leaderData) == OT_ERROR_NONE
+                                                ? Json::LeaderData2JsonString(leaderData)
+                                                : "");
+    }
+
+    if (aFlags & OT_CHANGED_ACTIVE_DATASET)
+    {
+        PushEvent(OT_REST_EVENT_DATASET_ACTIVE, otDatasetGetActive(mInstance, &dataset) == OT_ERROR_NONE
+                                                    ? Json::ActiveDataset2JsonString(dataset)
+                                                    : "");
+    }
+
+    if (aFlags & OT_CHANGED_PENDING_DATASET)
+    {
+        PushEvent(OT_REST_EVENT_DATASET_PENDING, otDatasetGetPending(mInstance, &dataset) == OT_ERROR_NONE
+                                                     ? Json::PendingDataset2JsonString(dataset)
+                                                     : "");
+    }
+
+exit:
+    return;
+}
+
+void Resource::PushEvent(const std::string &aName, const std::string &aData)
+{
+    std::string data = aData.empty() ? "null" : Json::CompactJsonString(aData);
+    auto        it   = mEventSnapshot.find(aName);
+
+    // Only push an event when the data actually changed, e.g. not for each Network Data update.
+    VerifyOrExit(it == mEventSnapshot.end() || it->second != data);
+
+    mEventSnapshot[aName] = data;
+
+    {
+        std::lock_guard<std::mutex> lock(mEventMutex);
+
+        mEvents.push_back({++mLastEventId, aName, data});
+
+        if (mEvents.size() > kMaxEvents)
+        {
+            mEvents.pop_front();
+        }
+    }
+
+    if (mEventListener != nullptr)
+    {
+        mEventListener();
+    }
+
+exit:
+    return;
+}
+
+void Resource::AppendEvent(uint64_t aId, const std::string &aName, const std::string &aData, std::string &aOutput)
+{
+    aOutput += "id: " + std::to_string(aId) + "\nevent: " + aName + "\ndata: " + aData + "\n\n";
+}
+
 } // namespace rest
 } // namespace otbr
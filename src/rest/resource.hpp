@@ -36,6 +36,11 @@
 
 #include "openthread-br/config.h"
 
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 
 #include <openthread/border_agent.h>
@@ -46,6 +51,7 @@
 #include "openthread/dataset.h"
 #include "openthread/dataset_ftd.h"
 #include "rest/json.hpp"
+#include "rest/metrics.hpp"
 #include "rest/request.hpp"
 #include "rest/response.hpp"
 #include "utils/thread_helper.hpp"
@@ -56,6 +62,8 @@ using std::chrono::steady_clock;
 namespace otbr {
 namespace rest {
 
+class CollectionIterator;
+
 /**
  * This class implements the Resource handler for OTBR-REST.
  *
@@ -66,10 +74,11 @@ public:
     /**
      * The constructor initializes the resource handler instance.
      *
-     * @param[in] aNcp  A pointer to the NCP controller.
+     * @param[in] aNcp        A pointer to the NCP controller.
+     * @param[in] aPublisher  A pointer to the mDNS publisher, or nullptr if there is none.
      *
      */
-    Resource(ControllerOpenThread *aNcp);
+    Resource(ControllerOpenThread *aNcp, Mdns::Publisher *aPublisher);
 
     /**
      * This method initialize the Resource handler.
@@ -107,6 +116,54 @@ public:
      */
     void ErrorHandler(Response &aResponse, HttpStatusCode aErrorCode) const;
 
+    /**
+     * This method sets the function called on the mainloop whenever a Thread state event is pushed.
+     *
+     * @param[in] aListener  The function called for each event.
+     *
+     */
+    void SetEventListener(std::function<void(void)> aListener) { mEventListener = std::move(aListener); }
+
+    /**
+     * This method sets the worker threads of the REST server, whose queues are exported as metrics.
+     *
+     * @param[in] aWorkerPool  A pointer to the worker pool.
+     *
+     */
+    void SetWorkerPool(const WorkerPool *aWorkerPool) { mMetricsExporter.SetWorkerPool(aWorkerPool); }
+
+    /**
+     * This method returns the exporter of the `/metrics` resource.
+     *
+     * @returns A reference to the metrics exporter.
+     *
+     */
+    MetricsExporter &GetMetricsExporter(void) { return mMetricsExporter; }
+
+    /**
+     * This method returns the identifier of the latest Thread state event.
+     *
+     * It is safe to call this method from any thread.
+     *
+     * @returns The identifier of the latest event, zero if there was no event yet.
+     *
+     */
+    uint64_t GetLastEventId(void) const;
+
+    /**
+     * This method serializes the Thread state events newer than a given event in `text/event-stream` format.
+     *
+     * It is safe to call this method from any thread.
+     *
+     * @param[in]     aLastEventId  The identifier of the last event the subscriber has received.
+     * @param[in,out] aOutput       A string the serialized events are appended to.
+     *
+     * @retval TRUE   All events newer than @p aLastEventId were appended.
+     * @retval FALSE  Some events newer than @p aLastEventId are no longer in the event history.
+     *
+     */
+    bool GetEvents(uint64_t aLastEventId, std::string &aOutput) const;
+
 private:
     /**
      * This enumeration represents the Dataset type (active or pending).
@@ -118,6 +175,28 @@ private:
         kPending, ///< Pending Dataset
     };
 
+    /**
+     * This enumeration represents the groups of resources which share a generation counter for conditional GET.
+     *
+     */
+    enum class ResourceGroup : uint8_t
+    {
+        kNode,          ///< Node information
+        kState,         ///< Thread state
+        kNetworkName,   ///< Network name
+        kLeaderData,    ///< Leader data
+        kDatasetActive, ///< Active Dataset
+    };
+
+    static constexpr uint8_t kNumResourceGroups = static_cast<uint8_t>(ResourceGroup::kDatasetActive) + 1;
+
+    struct Event
+    {
+        uint64_t    mId;
+        std::string mName;
+        std::string mData;
+    };
+
     typedef void (Resource::*ResourceHandler)(const Request &aRequest, Response &aResponse) const;
     typedef void (Resource::*ResourceCallbackHandler)(const Request &aRequest, Response &aResponse);
     void NodeInfo(const Request &aRequest, Response &aResponse) const;
@@ -135,6 +214,20 @@ private:
     void DatasetPending(const Request &aRequest, Response &aResponse) const;
     void Diagnostic(const Request &aRequest, Response &aResponse) const;
     void HandleDiagnosticCallback(const Request &aRequest, Response &aResponse);
+    void Events(const Request &aRequest, Response &aResponse) const;
+    void Metrics(const Request &aRequest, Response &aResponse) const;
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    void Telemetry(const Request &aRequest, Response &aResponse) const;
+#endif
+    void Children(const Request &aRequest, Response &aResponse) const;
+    void Neighbors(const Request &aRequest, Response &aResponse) const;
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    void SrpHosts(const Request &aRequest, Response &aResponse) const;
+    void SrpServices(const Request &aRequest, Response &aResponse) const;
+#endif
+#if OTBR_ENABLE_NAT64
+    void Nat64Mappings(const Request &aRequest, Response &aResponse) const;
+#endif
 
     void GetNodeInfo(Response &aResponse) const;
     void DeleteNodeInfo(Response &aResponse) const;
@@ -149,11 +242,22 @@ private:
     void GetDataExtendedPanId(Response &aResponse) const;
     void GetDataRloc(Response &aResponse) const;
     void GetDataset(DatasetType aDatasetType, const Request &aRequest, Response &aResponse) const;
+    void GetCollection(std::shared_ptr<CollectionIterator> aIterator,
+                       const Request                      &aRequest,
+                       Response                           &aResponse) const;
     void SetDataset(DatasetType aDatasetType, const Request &aRequest, Response &aResponse) const;
 
     void DeleteOutDatedDiagnostic(void);
     void UpdateDiag(std::string aKey, std::vector<otNetworkDiagTlv> &aDiag);
 
+    uint8_t     GetNumOfRouters(void) const;
+    std::string GetETag(ResourceGroup aGroup, const Request &aRequest) const;
+    static bool MatchETag(const std::string &aIfNoneMatch, const std::string &aETag);
+
+    void        HandleThreadStateChanged(otChangedFlags aFlags);
+    void        PushEvent(const std::string &aName, const std::string &aData);
+    static void AppendEvent(uint64_t aId, const std::string &aName, const std::string &aData, std::string &aOutput);
+
     static void DiagnosticResponseHandler(otError              aError,
                                           otMessage           *aMessage,
                                           const otMessageInfo *aMessageInfo,
@@ -162,11 +266,26 @@ private:
 
     otInstance           *mInstance;
     ControllerOpenThread *mNcp;
+    Mdns::Publisher      *mPublisher;
+    MetricsExporter       mMetricsExporter;
 
     std::unordered_map<std::string, ResourceHandler>         mResourceMap;
     std::unordered_map<std::string, ResourceCallbackHandler> mResourceCallbackMap;
 
     std::unordered_map<std::string, DiagInfo> mDiagSet;
+
+    // Generation of each resource group, bumped whenever a Thread state change may alter its resources.
+    std::unordered_map<std::string, ResourceGroup> mResourceGroupMap;
+    uint32_t                                       mGenerations[kNumResourceGroups];
+    std::string                                    mETagPrefix;
+
+    // Recent Thread state events, and the latest data of each event for new subscribers. The events are pushed on
+    // the mainloop and streamed by the worker threads, `mEventMutex` protects `mEvents` and `mLastEventId`.
+    std::deque<Event>                  mEvents;
+    std::map<std::string, std::string> mEventSnapshot;
+    uint64_t                           mLastEventId;
+    mutable std::mutex                 mEventMutex;
+    std::function<void(void)>          mEventListener;
 };
 
 } // namespace rest
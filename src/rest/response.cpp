@@ -29,6 +29,7 @@
 #include "rest/response.hpp"
 
 #include <stdio.h>
+#include <utility>
 
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_ORIGIN "*"
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_HEADERS                                                              \
@@ -36,6 +37,9 @@
     "Access-Control-Request-Headers"
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_METHOD "DELETE, GET, OPTIONS, PUT"
 #define OT_REST_RESPONSE_CONNECTION "close"
+#define OT_REST_RESPONSE_CONNECTION_STREAM "keep-alive"
+#define OT_REST_RESPONSE_CACHE_CONTROL_STREAM "no-cache"
+#define OT_REST_RESPONSE_TRANSFER_ENCODING_CHUNKED "chunked"
 
 namespace otbr {
 namespace rest {
@@ -43,6 +47,8 @@ namespace rest {
 Response::Response(void)
     : mCallback(false)
     , mComplete(false)
+    , mStream(false)
+    , mStreamEventId(0)
 {
     // HTTP protocol
     mProtocol = "HTTP/1.1";
@@ -85,6 +91,16 @@ void Response::SetContentType(const std::string &aContentType)
     mHeaders[OT_REST_CONTENT_TYPE_HEADER] = aContentType;
 }
 
+std::string Response::GetResponseCode(void) const
+{
+    return mCode;
+}
+
+void Response::SetHeader(const std::string &aField, const std::string &aValue)
+{
+    mHeaders[aField] = aValue;
+}
+
 void Response::SetCallback(void)
 {
     mCallback = true;
@@ -100,11 +116,60 @@ std::string Response::GetBody(void) const
     return mBody;
 }
 
+void Response::SetBodyFormatter(BodyFormatter aFormatter)
+{
+    mBodyFormatter = std::move(aFormatter);
+}
+
+void Response::FormatBody(void)
+{
+    if (mBodyFormatter != nullptr)
+    {
+        mBody          = mBodyFormatter();
+        mBodyFormatter = nullptr;
+    }
+}
+
 bool Response::NeedCallback(void)
 {
     return mCallback;
 }
 
+void Response::SetStream(uint64_t aLastEventId)
+{
+    mStream                               = true;
+    mStreamEventId                        = aLastEventId;
+    mHeaders[OT_REST_CONTENT_TYPE_HEADER] = OT_REST_CONTENT_TYPE_EVENT_STREAM;
+    mHeaders["Cache-Control"]             = OT_REST_RESPONSE_CACHE_CONTROL_STREAM;
+    mHeaders["Connection"]                = OT_REST_RESPONSE_CONNECTION_STREAM;
+}
+
+bool Response::IsStream(void) const
+{
+    return mStream;
+}
+
+uint64_t Response::GetStreamEventId(void) const
+{
+    return mStreamEventId;
+}
+
+void Response::SetChunked(ChunkProducer aProducer)
+{
+    mChunkProducer                = std::move(aProducer);
+    mHeaders["Transfer-Encoding"] = OT_REST_RESPONSE_TRANSFER_ENCODING_CHUNKED;
+}
+
+bool Response::IsChunked(void) const
+{
+    return mChunkProducer != nullptr;
+}
+
+bool Response::ProduceChunk(std::string &aChunk)
+{
+    return mChunkProducer(aChunk);
+}
+
 std::string Response::Serialize(void) const
 {
     std::string spacer = "\r\n";
@@ -114,7 +179,10 @@ std::string Response::Serialize(void) const
     {
         ret += (spacer + header.first + ": " + header.second);
     }
-    ret += spacer + "Content-Length: " + std::to_string(mBody.size());
+    if (!mStream && !IsChunked())
+    {
+        ret += spacer + "Content-Length: " + std::to_string(mBody.size());
+    }
     ret += (spacer + spacer + mBody);
 
     return ret;
@@ -37,6 +37,7 @@
 #include "openthread-br/config.h"
 
 #include <chrono>
+#include <functional>
 #include <map>
 #include <string>
 
@@ -80,6 +81,31 @@ public:
      */
     std::string GetBody(void) const;
 
+    /**
+     * This function builds the body of a response from the data captured when the request was handled.
+     *
+     * @returns A string to be set as response body.
+     *
+     */
+    typedef std::function<std::string(void)> BodyFormatter;
+
+    /**
+     * This method defers building the body to the worker thread which writes the response.
+     *
+     * Requests are handled on the mainloop, so a handler should only capture a copy of the OpenThread data the body is
+     * made of and leave encoding it to the formatter. The formatter must not access any other state.
+     *
+     * @param[in] aFormatter  The function building the body.
+     *
+     */
+    void SetBodyFormatter(BodyFormatter aFormatter);
+
+    /**
+     * This method builds the body with the body formatter, if one was set.
+     *
+     */
+    void FormatBody(void);
+
     /**
      * This method set the response code.
      *
@@ -96,6 +122,22 @@ public:
      */
     void SetContentType(const std::string &aContentType);
 
+    /**
+     * This method sets a header field of the response.
+     *
+     * @param[in] aField  The name of the header field.
+     * @param[in] aValue  The value of the header field.
+     *
+     */
+    void SetHeader(const std::string &aField, const std::string &aValue);
+
+    /**
+     * This method returns the response code.
+     *
+     * @returns A string representing response code such as "404 not found".
+     */
+    std::string GetResponseCode(void) const;
+
     /**
      * This method labels the response as need callback.
      *
@@ -123,6 +165,73 @@ public:
      */
     bool IsComplete();
 
+    /**
+     * This method labels the response as an event stream.
+     *
+     * The response is sent without Content-Length and the connection is kept open to push more events
+     * after the body.
+     *
+     * @param[in] aLastEventId  The identifier of the last event included in the body.
+     *
+     */
+    void SetStream(uint64_t aLastEventId);
+
+    /**
+     * This method checks whether this response is an event stream.
+     *
+     * @returns A bool value indicates whether this response is an event stream.
+     */
+    bool IsStream(void) const;
+
+    /**
+     * This method returns the identifier of the last event included in the body of an event stream.
+     *
+     * @returns The identifier of the last event.
+     */
+    uint64_t GetStreamEventId(void) const;
+
+    /**
+     * This function produces the next part of a chunked response body.
+     *
+     * @param[out] aChunk  A string to append the next part of the body to.
+     *
+     * @retval TRUE   There is more of the body to produce.
+     * @retval FALSE  The body is complete.
+     *
+     */
+    typedef std::function<bool(std::string &aChunk)> ChunkProducer;
+
+    /**
+     * This method labels the response as chunked.
+     *
+     * The body is not set in advance but sent with chunked transfer encoding, and produced one part after another
+     * whenever the previous part was written, so that its size does not matter.
+     *
+     * @param[in] aProducer  The function producing the body.
+     *
+     */
+    void SetChunked(ChunkProducer aProducer);
+
+    /**
+     * This method checks whether this response is chunked.
+     *
+     * @returns A bool value indicates whether this response is chunked.
+     */
+    bool IsChunked(void) const;
+
+    /**
+     * This method produces the next part of the body of a chunked response.
+     *
+     * The producer reads the OpenThread state, so this method must be called on the mainloop.
+     *
+     * @param[out] aChunk  A string to append the next part of the body to.
+     *
+     * @retval TRUE   There is more of the body to produce.
+     * @retval FALSE  The body is complete.
+     *
+     */
+    bool ProduceChunk(std::string &aChunk);
+
     /**
      * This method is used to set a timestamp. when a callback is needed and this field tells callback handler when to
      * collect all the data and form the response.
@@ -152,6 +261,10 @@ private:
     std::string                        mProtocol;
     std::string                        mBody;
     bool                               mComplete;
+    bool                               mStream;
+    uint64_t                           mStreamEventId;
+    BodyFormatter                      mBodyFormatter;
+    ChunkProducer                      mChunkProducer;
     steady_clock::time_point           mStartTime;
 };
 
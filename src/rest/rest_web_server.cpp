@@ -33,22 +33,18 @@
 #include <arpa/inet.h>
 #include <cerrno>
 
-#include <fcntl.h>
-
 #include "utils/socket_utils.hpp"
 
-using std::chrono::duration_cast;
-using std::chrono::microseconds;
-using std::chrono::steady_clock;
-
 namespace otbr {
 namespace rest {
 
-// Maximum number of connection a server support at the same time.
-static const uint32_t kMaxServeNum = 500;
-
-RestWebServer::RestWebServer(ControllerOpenThread &aNcp, const std::string &aRestListenAddress, int aRestListenPort)
-    : mResource(Resource(&aNcp))
+RestWebServer::RestWebServer(ControllerOpenThread &aNcp,
+                             Mdns::Publisher      &aPublisher,
+                             const std::string    &aRestListenAddress,
+                             int                   aRestListenPort,
+                             uint32_t              aNumWorkerThreads)
+    : mResource(&aNcp, &aPublisher)
+    , mWorkerPool(mResource, mTaskRunner, aNumWorkerThreads)
     , mListenFd(-1)
 {
     mAddress.sin6_family = AF_INET6;
@@ -65,6 +61,8 @@ RestWebServer::RestWebServer(ControllerOpenThread &aNcp, const std::string &aRes
 
 RestWebServer::~RestWebServer(void)
 {
+    mWorkerPool.Stop();
+
     if (mListenFd != -1)
     {
         close(mListenFd);
@@ -74,52 +72,11 @@ RestWebServer::~RestWebServer(void)
 void RestWebServer::Init(void)
 {
     mResource.Init();
+    mResource.SetWorkerPool(&mWorkerPool);
+    mResource.SetEventListener([this]() { mWorkerPool.WakeUp(); });
     InitializeListenFd();
-}
-
-void RestWebServer::Update(MainloopContext &aMainloop)
-{
-    FD_SET(mListenFd, &aMainloop.mReadFdSet);
-    aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mListenFd);
 
-    return;
-}
-
-void RestWebServer::Process(const MainloopContext &aMainloop)
-{
-    UpdateConnections(aMainloop.mReadFdSet);
-}
-
-void RestWebServer::UpdateConnections(const fd_set &aReadFdSet)
-{
-    otbrError error   = OTBR_ERROR_NONE;
-    auto      eraseIt = mConnectionSet.begin();
-
-    // Erase useless connections
-    for (eraseIt = mConnectionSet.begin(); eraseIt != mConnectionSet.end();)
-    {
-        Connection *connection = eraseIt->second.get();
-
-        if (connection->IsComplete())
-        {
-            eraseIt = mConnectionSet.erase(eraseIt);
-        }
-        else
-        {
-            eraseIt++;
-        }
-    }
-
-    // Create new connection if listenfd is set
-    if (FD_ISSET(mListenFd, &aReadFdSet) && mConnectionSet.size() < kMaxServeNum)
-    {
-        error = Accept(mListenFd);
-    }
-
-    if (error != OTBR_ERROR_NONE)
-    {
-        otbrLogWarning("Failed to accept new connection: %s", otbrErrorString(error));
-    }
+    VerifyOrDie(mWorkerPool.Start(mListenFd) == OTBR_ERROR_NONE, "otbr rest server worker threads init error");
 }
 
 bool RestWebServer::ParseListenAddress(const std::string listenAddress, struct in6_addr *sin6_addr)
@@ -174,68 +131,5 @@ exit:
     VerifyOrDie(error == OTBR_ERROR_NONE, "otbr rest server init error");
 }
 
-otbrError RestWebServer::Accept(int aListenFd)
-{
-    std::string errorMessage;
-    otbrError   error = OTBR_ERROR_NONE;
-    int32_t     err;
-    int32_t     fd;
-    sockaddr_in tmp;
-    socklen_t   addrlen = sizeof(tmp);
-
-    fd  = accept(aListenFd, reinterpret_cast<struct sockaddr *>(&mAddress), &addrlen);
-    err = errno;
-
-    VerifyOrExit(fd >= 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "accept");
-
-    VerifyOrExit(SetFdNonblocking(fd), err = errno, error = OTBR_ERROR_REST; errorMessage = "set nonblock");
-
-    CreateNewConnection(fd);
-
-exit:
-    if (error != OTBR_ERROR_NONE)
-    {
-        if (fd != -1)
-        {
-            close(fd);
-            fd = -1;
-        }
-        otbrLogErr("Rest server accept error: %s %s", errorMessage.c_str(), strerror(err));
-    }
-
-    return error;
-}
-
-void RestWebServer::CreateNewConnection(int &aFd)
-{
-    auto it =
-        mConnectionSet.emplace(aFd, std::unique_ptr<Connection>(new Connection(steady_clock::now(), &mResource, aFd)));
-
-    if (it.second == true)
-    {
-        Connection *connection = it.first->second.get();
-        connection->Init();
-    }
-    else
-    {
-        // failure on inserting new connection
-        close(aFd);
-        aFd = -1;
-    }
-}
-
-bool RestWebServer::SetFdNonblocking(int32_t fd)
-{
-    int32_t oldMode;
-    bool    ret = true;
-
-    oldMode = fcntl(fd, F_GETFL);
-
-    VerifyOrExit(fcntl(fd, F_SETFL, oldMode | O_NONBLOCK) >= 0, ret = false);
-
-exit:
-    return ret;
-}
-
 } // namespace rest
 } // namespace otbr
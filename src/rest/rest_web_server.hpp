@@ -40,8 +40,9 @@
 #include <netinet/ip.h>
 #include <sys/socket.h>
 
-#include "common/mainloop.hpp"
-#include "rest/connection.hpp"
+#include "common/task_runner.hpp"
+#include "rest/resource.hpp"
+#include "rest/worker_pool.hpp"
 
 using otbr::Ncp::ControllerOpenThread;
 using std::chrono::steady_clock;
@@ -52,23 +53,33 @@ namespace rest {
 /**
  * This class implements a REST server.
  *
+ * Connections are served by a pool of worker threads, the mainloop only handles complete requests.
+ *
  */
-class RestWebServer : public MainloopProcessor
+class RestWebServer
 {
 public:
     /**
      * The constructor to initialize a REST server.
      *
-     * @param[in] aNcp  A reference to the NCP controller.
+     * @param[in] aNcp                A reference to the NCP controller.
+     * @param[in] aPublisher          A reference to the mDNS publisher.
+     * @param[in] aRestListenAddress  Network address to listen on.
+     * @param[in] aRestListenPort     Network port to listen on.
+     * @param[in] aNumWorkerThreads   Number of worker threads serving the connections.
      *
      */
-    RestWebServer(ControllerOpenThread &aNcp, const std::string &aRestListenAddress, int aRestListenPort);
+    RestWebServer(ControllerOpenThread &aNcp,
+                  Mdns::Publisher      &aPublisher,
+                  const std::string    &aRestListenAddress,
+                  int                   aRestListenPort,
+                  uint32_t              aNumWorkerThreads);
 
     /**
      * The destructor destroys the server instance.
      *
      */
-    ~RestWebServer(void) override;
+    ~RestWebServer(void);
 
     /**
      * This method initializes the REST server.
@@ -76,25 +87,28 @@ public:
      */
     void Init(void);
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    /**
+     * This method returns the exporter of the `/metrics` resource, so that the agent can register its components.
+     *
+     * @returns A reference to the metrics exporter.
+     *
+     */
+    MetricsExporter &GetMetricsExporter(void) { return mResource.GetMetricsExporter(); }
 
 private:
-    void      UpdateConnections(const fd_set &aReadFdSet);
-    void      CreateNewConnection(int32_t &aFd);
-    otbrError Accept(int32_t aListenFd);
-    bool      ParseListenAddress(const std::string listenAddress, struct in6_addr *sin6_addr);
-    void      InitializeListenFd(void);
-    bool      SetFdNonblocking(int32_t fd);
+    bool ParseListenAddress(const std::string listenAddress, struct in6_addr *sin6_addr);
+    void InitializeListenFd(void);
 
     // Resource handler
     Resource mResource;
+    // Task runner passing requests from the worker threads to the mainloop
+    TaskRunner mTaskRunner;
+    // Worker threads serving the connections
+    WorkerPool mWorkerPool;
     // Struct for server configuration
     sockaddr_in6 mAddress;
     // File descriptor for listening
     int32_t mListenFd;
-    // Connection List
-    std::unordered_map<int32_t, std::unique_ptr<Connection>> mConnectionSet;
 };
 
 } // namespace rest
@@ -49,6 +49,7 @@
 
 #define OT_REST_CONTENT_TYPE_JSON "application/json"
 #define OT_REST_CONTENT_TYPE_PLAIN "text/plain"
+#define OT_REST_CONTENT_TYPE_EVENT_STREAM "text/event-stream"
 
 using std::chrono::steady_clock;
 
@@ -71,6 +72,7 @@ enum class HttpStatusCode : std::uint16_t
     kStatusOk                  = 200,
     kStatusCreated             = 201,
     kStatusNoContent           = 204,
+    kStatusNotModified         = 304,
     kStatusBadRequest          = 400,
     kStatusResourceNotFound    = 404,
     kStatusMethodNotAllowed    = 405,
@@ -96,6 +98,8 @@ enum class ConnectionState : std::uint8_t
     kWriteTimeout  = 5, ///< Reach write timeout
     kInternalError = 6, ///< Occur internal call error
     kComplete      = 7, ///< No longer need to be processed
+    kStreamWait    = 8, ///< Wait for events to stream
+    kChunkedWrite  = 9, ///< Write a chunked response
 
 };
 struct NodeInfo
@@ -104,8 +108,8 @@ struct NodeInfo
     std::string     mRole;
     uint32_t        mNumOfRouter;
     uint16_t        mRloc16;
-    const uint8_t  *mExtPanId;
-    const uint8_t  *mExtAddress;
+    otExtendedPanId mExtPanId;
+    otExtAddress    mExtAddress;
     otIp6Address    mRlocAddress;
     otLeaderData    mLeaderData;
     std::string     mNetworkName;
@@ -0,0 +1,480 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the worker threads of the RESTful HTTP server.
+ */
+
+#include "rest/worker_pool.hpp"
+
+#include <cerrno>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+
+#include "common/logging.hpp"
+
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+using std::chrono::steady_clock;
+
+namespace otbr {
+namespace rest {
+
+// Maximum number of connection a server support at the same time.
+static const size_t kMaxServeNum = 500;
+
+// The timeout (in microseconds) since a request is waiting for a callback.
+static const uint32_t kCallbackTimeout = 10000000;
+
+// The time interval (in milliseconds) for checking again if a request waiting for a callback is complete.
+static const uint32_t kCallbackCheckInterval = 500;
+
+// Maximum number of epoll events processed in one pass of the epoll loop.
+static const int kMaxEpollEvents = 32;
+
+// The epoll data of the listening socket and of the wake-up event, connections use larger identifiers.
+static const uint64_t kListenId          = 0;
+static const uint64_t kWakeUpId          = 1;
+static const uint64_t kFirstConnectionId = 2;
+
+Worker::Worker(WorkerPool &aPool, Resource &aResource)
+    : mPool(aPool)
+    , mResource(aResource)
+    , mListenFd(-1)
+    , mEpollFd(-1)
+    , mEventFd(-1)
+    , mStopping(false)
+    , mQueueDepth(0)
+    , mMaxQueueDepth(0)
+    , mNumConnections(0)
+    , mNextConnectionId(kFirstConnectionId)
+{
+}
+
+Worker::~Worker(void)
+{
+    Stop();
+    mConnections.clear();
+
+    if (mEventFd != -1)
+    {
+        close(mEventFd);
+    }
+
+    if (mEpollFd != -1)
+    {
+        close(mEpollFd);
+    }
+}
+
+otbrError Worker::Start(int aListenFd)
+{
+    otbrError   error = OTBR_ERROR_NONE;
+    epoll_event event = {};
+
+    mListenFd = aListenFd;
+
+    mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrExit(mEpollFd != -1, error = OTBR_ERROR_ERRNO);
+
+    mEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    VerifyOrExit(mEventFd != -1, error = OTBR_ERROR_ERRNO);
+
+    event.events   = EPOLLIN;
+    event.data.u64 = kWakeUpId;
+    VerifyOrExit(epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mEventFd, &event) == 0, error = OTBR_ERROR_ERRNO);
+
+    // Only one of the worker threads is woken up for each new connection.
+    event.events = EPOLLIN;
+#ifdef EPOLLEXCLUSIVE
+    event.events |= EPOLLEXCLUSIVE;
+#endif
+    event.data.u64 = kListenId;
+    VerifyOrExit(epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mListenFd, &event) == 0, error = OTBR_ERROR_ERRNO);
+
+    mThread = std::thread(&Worker::Run, this);
+
+exit:
+    return error;
+}
+
+void Worker::Stop(void)
+{
+    VerifyOrExit(mThread.joinable());
+
+    mStopping = true;
+    WakeUp();
+    mThread.join();
+
+exit:
+    return;
+}
+
+void Worker::Post(Task aTask)
+{
+    {
+        std::lock_guard<std::mutex> lock(mTaskQueueMutex);
+
+        mTaskQueue.push_back(std::move(aTask));
+        mQueueDepth = mTaskQueue.size();
+
+        if (mQueueDepth > mMaxQueueDepth)
+        {
+            mMaxQueueDepth.store(mQueueDepth);
+        }
+    }
+
+    WakeUp();
+}
+
+void Worker::WakeUp(void)
+{
+    uint64_t one = 1;
+
+    // The counter of the event only overflows if the worker thread already has to wake up.
+    if (write(mEventFd, &one, sizeof(one)) != sizeof(one) && errno != EAGAIN)
+    {
+        otbrLogWarning("Failed to wake up REST worker thread: %s", strerror(errno));
+    }
+}
+
+void Worker::HandleRequest(uint64_t aConnectionId, const Request &aRequest)
+{
+    mPool.HandleRequest(*this, aConnectionId, aRequest);
+}
+
+void Worker::ProduceChunk(uint64_t aConnectionId, std::shared_ptr<Response> aResponse)
+{
+    mPool.ProduceChunk(*this, aConnectionId, std::move(aResponse));
+}
+
+void Worker::Run(void)
+{
+    epoll_event events[kMaxEpollEvents];
+
+    while (!mStopping)
+    {
+        std::unordered_map<uint64_t, uint32_t> connectionEvents;
+        int                                    timeout = -1;
+        int                                    num;
+
+        UpdateConnections(timeout);
+
+        num = epoll_wait(mEpollFd, events, kMaxEpollEvents, timeout);
+
+        if (num < 0)
+        {
+            VerifyOrDie(errno == EINTR, strerror(errno));
+            continue;
+        }
+
+        for (int i = 0; i < num; ++i)
+        {
+            if (events[i].data.u64 == kListenId)
+            {
+                Accept();
+            }
+            else if (events[i].data.u64 == kWakeUpId)
+            {
+                uint64_t count;
+
+                OTBR_UNUSED_VARIABLE(read(mEventFd, &count, sizeof(count)));
+            }
+            else
+            {
+                connectionEvents[events[i].data.u64] |= events[i].events;
+            }
+        }
+
+        RunTasks();
+        ProcessConnections(connectionEvents);
+    }
+}
+
+void Worker::RunTasks(void)
+{
+    std::deque<Task> tasks;
+
+    {
+        std::lock_guard<std::mutex> lock(mTaskQueueMutex);
+
+        tasks.swap(mTaskQueue);
+        mQueueDepth = 0;
+    }
+
+    for (Task &task : tasks)
+    {
+        task();
+    }
+}
+
+void Worker::Accept(void)
+{
+    std::unique_ptr<Connection> connection;
+    epoll_event                 event = {};
+    uint64_t                    id;
+    int                         fd;
+
+    fd = accept4(mListenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+
+    // Another worker thread may have taken the connection.
+    VerifyOrExit(fd != -1 || errno == EAGAIN || errno == EWOULDBLOCK,
+                 otbrLogWarning("Failed to accept new connection: %s", strerror(errno)));
+    VerifyOrExit(fd != -1);
+
+    VerifyOrExit(mPool.AddConnection(), close(fd), otbrLogWarning("Too many REST connections, dropping one"));
+
+    id = mNextConnectionId++;
+    connection.reset(new Connection(steady_clock::now(), &mResource, *this, id, fd));
+    connection->Init();
+
+    // The events are set in the next `UpdateConnections()`.
+    event.events   = 0;
+    event.data.u64 = id;
+
+    if (epoll_ctl(mEpollFd, EPOLL_CTL_ADD, fd, &event) != 0)
+    {
+        otbrLogWarning("Failed to add REST connection to epoll: %s", strerror(errno));
+        mPool.RemoveConnection();
+        ExitNow();
+    }
+
+    mConnections[id] = {std::move(connection), 0};
+    mNumConnections  = mConnections.size();
+
+exit:
+    return;
+}
+
+void Worker::UpdateConnections(int &aTimeout)
+{
+    for (auto it = mConnections.begin(); it != mConnections.end();)
+    {
+        Connection *connection = it->second.mConnection.get();
+        uint32_t    events;
+
+        if (connection->IsComplete())
+        {
+            // Closing the socket also removes it from the epoll loop.
+            it = mConnections.erase(it);
+            mPool.RemoveConnection();
+            continue;
+        }
+
+        connection->Update(events, aTimeout);
+
+        if (events != it->second.mEvents && connection->GetFd() != -1)
+        {
+            epoll_event event = {};
+
+            event.events   = events;
+            event.data.u64 = it->first;
+
+            if (epoll_ctl(mEpollFd, EPOLL_CTL_MOD, connection->GetFd(), &event) == 0)
+            {
+                it->second.mEvents = events;
+            }
+        }
+
+        ++it;
+    }
+
+    mNumConnections = mConnections.size();
+}
+
+void Worker::ProcessConnections(const std::unordered_map<uint64_t, uint32_t> &aEvents)
+{
+    for (auto &entry : mConnections)
+    {
+        auto it = aEvents.find(entry.first);
+
+        entry.second.mConnection->Process(it == aEvents.end() ? 0 : it->second);
+    }
+}
+
+void Worker::HandleResponse(uint64_t aConnectionId, std::shared_ptr<Response> aResponse)
+{
+    auto it = mConnections.find(aConnectionId);
+
+    // The connection may have been closed in the meantime.
+    VerifyOrExit(it != mConnections.end());
+
+    it->second.mConnection->HandleResponse(std::move(aResponse));
+
+exit:
+    return;
+}
+
+void Worker::HandleChunk(uint64_t aConnectionId, const std::string &aChunk, bool aMore)
+{
+    auto it = mConnections.find(aConnectionId);
+
+    // The connection may have been closed in the meantime.
+    VerifyOrExit(it != mConnections.end());
+
+    it->second.mConnection->HandleChunk(aChunk, aMore);
+
+exit:
+    return;
+}
+
+WorkerPool::WorkerPool(Resource &aResource, TaskRunner &aTaskRunner, uint32_t aNumWorkers)
+    : mResource(aResource)
+    , mTaskRunner(aTaskRunner)
+    , mNumConnections(0)
+    , mNumPendingRequests(0)
+{
+    for (uint32_t i = 0; i < aNumWorkers; ++i)
+    {
+        mWorkers.emplace_back(new Worker(*this, aResource));
+    }
+}
+
+WorkerPool::~WorkerPool(void)
+{
+    Stop();
+}
+
+otbrError WorkerPool::Start(int aListenFd)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    for (auto &worker : mWorkers)
+    {
+        SuccessOrExit(error = worker->Start(aListenFd));
+    }
+
+exit:
+    return error;
+}
+
+void WorkerPool::Stop(void)
+{
+    for (auto &worker : mWorkers)
+    {
+        worker->Stop();
+    }
+}
+
+void WorkerPool::WakeUp(void)
+{
+    for (auto &worker : mWorkers)
+    {
+        worker->WakeUp();
+    }
+}
+
+bool WorkerPool::AddConnection(void)
+{
+    bool added = (++mNumConnections <= kMaxServeNum);
+
+    if (!added)
+    {
+        --mNumConnections;
+    }
+
+    return added;
+}
+
+void WorkerPool::RemoveConnection(void)
+{
+    --mNumConnections;
+}
+
+void WorkerPool::HandleRequest(Worker &aWorker, uint64_t aConnectionId, const Request &aRequest)
+{
+    std::shared_ptr<Request> request = std::make_shared<Request>(aRequest);
+
+    ++mNumPendingRequests;
+
+    mTaskRunner.Post([this, &aWorker, aConnectionId, request]() {
+        std::shared_ptr<Response> response = std::make_shared<Response>();
+
+        --mNumPendingRequests;
+        mResource.Handle(*request, *response);
+
+        if (response->NeedCallback())
+        {
+            WaitCallback(aWorker, aConnectionId, request, response);
+        }
+        else
+        {
+            aWorker.Post([&aWorker, aConnectionId, response]() { aWorker.HandleResponse(aConnectionId, response); });
+        }
+    });
+}
+
+void WorkerPool::WaitCallback(Worker                   &aWorker,
+                              uint64_t                  aConnectionId,
+                              std::shared_ptr<Request>  aRequest,
+                              std::shared_ptr<Response> aResponse)
+{
+    auto duration = duration_cast<microseconds>(steady_clock::now() - aResponse->GetStartTime()).count();
+
+    mResource.HandleCallback(*aRequest, *aResponse);
+
+    if (!aResponse->IsComplete())
+    {
+        if (duration < kCallbackTimeout)
+        {
+            mTaskRunner.Post(Milliseconds(kCallbackCheckInterval),
+                             [this, &aWorker, aConnectionId, aRequest, aResponse]() {
+                                 WaitCallback(aWorker, aConnectionId, aRequest, aResponse);
+                             });
+            ExitNow();
+        }
+
+        mResource.ErrorHandler(*aResponse, HttpStatusCode::kStatusInternalServerError);
+    }
+
+    aWorker.Post([&aWorker, aConnectionId, aResponse]() { aWorker.HandleResponse(aConnectionId, aResponse); });
+
+exit:
+    return;
+}
+
+void WorkerPool::ProduceChunk(Worker &aWorker, uint64_t aConnectionId, std::shared_ptr<Response> aResponse)
+{
+    ++mNumPendingRequests;
+
+    mTaskRunner.Post([this, &aWorker, aConnectionId, aResponse]() {
+        std::string chunk;
+        bool        more;
+
+        --mNumPendingRequests;
+        more = aResponse->ProduceChunk(chunk);
+
+        aWorker.Post([&aWorker, aConnectionId, chunk, more]() { aWorker.HandleChunk(aConnectionId, chunk, more); });
+    });
+}
+
+} // namespace rest
+} // namespace otbr
@@ -0,0 +1,295 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the worker threads of the RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_WORKER_POOL_HPP_
+#define OTBR_REST_WORKER_POOL_HPP_
+
+#include "openthread-br/config.h"
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
+#include "rest/connection.hpp"
+
+namespace otbr {
+namespace rest {
+
+class WorkerPool;
+
+/**
+ * This class implements a worker thread of the REST server.
+ *
+ * A worker thread accepts connections and runs their HTTP parsing, framing and socket I/O in its own epoll loop, so
+ * that slow clients or large responses never delay the mainloop.
+ *
+ */
+class Worker : private NonCopyable
+{
+public:
+    /**
+     * This type represents a task executed on the worker thread.
+     *
+     */
+    typedef std::function<void(void)> Task;
+
+    /**
+     * The constructor initializes a worker thread.
+     *
+     * @param[in] aPool      A reference to the worker pool.
+     * @param[in] aResource  A reference to the resource handler.
+     *
+     */
+    Worker(WorkerPool &aPool, Resource &aResource);
+
+    /**
+     * The destructor stops the worker thread and closes its connections.
+     *
+     */
+    ~Worker(void);
+
+    /**
+     * This method starts the worker thread.
+     *
+     * @param[in] aListenFd  The listening socket to accept connections from.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully started the worker thread.
+     * @retval OTBR_ERROR_ERRNO  Failed to set up the epoll loop.
+     *
+     */
+    otbrError Start(int aListenFd);
+
+    /**
+     * This method stops the worker thread and waits until it exits.
+     *
+     */
+    void Stop(void);
+
+    /**
+     * This method posts a task to be executed on the worker thread.
+     *
+     * It is safe to call this method from any thread.
+     *
+     * @param[in] aTask  The task to be executed.
+     *
+     */
+    void Post(Task aTask);
+
+    /**
+     * This method wakes the worker thread up, so that it updates its connections.
+     *
+     * It is safe to call this method from any thread.
+     *
+     */
+    void WakeUp(void);
+
+    /**
+     * This method passes a complete request to the mainloop to be handled.
+     *
+     * This method must be called on the worker thread.
+     *
+     * @param[in] aConnectionId  The identifier of the connection of the request.
+     * @param[in] aRequest       The request.
+     *
+     */
+    void HandleRequest(uint64_t aConnectionId, const Request &aRequest);
+
+    /**
+     * This method asks the mainloop to produce the next part of a chunked response.
+     *
+     * This method must be called on the worker thread.
+     *
+     * @param[in] aConnectionId  The identifier of the connection of the response.
+     * @param[in] aResponse      The response.
+     *
+     */
+    void ProduceChunk(uint64_t aConnectionId, std::shared_ptr<Response> aResponse);
+
+    /**
+     * This method returns the number of tasks waiting to be executed on the worker thread.
+     *
+     * @returns The number of pending tasks.
+     *
+     */
+    size_t GetQueueDepth(void) const { return mQueueDepth; }
+
+    /**
+     * This method returns the highest number of tasks which were waiting to be executed on the worker thread.
+     *
+     * @returns The highest number of pending tasks.
+     *
+     */
+    size_t GetMaxQueueDepth(void) const { return mMaxQueueDepth; }
+
+    /**
+     * This method returns the number of connections of the worker thread.
+     *
+     * @returns The number of connections.
+     *
+     */
+    size_t GetNumConnections(void) const { return mNumConnections; }
+
+private:
+    friend class WorkerPool;
+
+    struct ConnectionEntry
+    {
+        std::unique_ptr<Connection> mConnection;
+        uint32_t                    mEvents;
+    };
+
+    void Run(void);
+    void RunTasks(void);
+    void Accept(void);
+    void UpdateConnections(int &aTimeout);
+    void ProcessConnections(const std::unordered_map<uint64_t, uint32_t> &aEvents);
+    void HandleResponse(uint64_t aConnectionId, std::shared_ptr<Response> aResponse);
+    void HandleChunk(uint64_t aConnectionId, const std::string &aChunk, bool aMore);
+
+    WorkerPool &mPool;
+    Resource   &mResource;
+    int         mListenFd;
+    int         mEpollFd;
+    int         mEventFd;
+    std::thread mThread;
+
+    // Set when the worker thread should exit.
+    std::atomic<bool> mStopping;
+
+    // The tasks posted by other threads, `mTaskQueueMutex` protects `mTaskQueue`.
+    std::mutex          mTaskQueueMutex;
+    std::deque<Task>    mTaskQueue;
+    std::atomic<size_t> mQueueDepth;
+    std::atomic<size_t> mMaxQueueDepth;
+
+    // The connections of this worker thread, keyed by their identifier which is never reused.
+    std::unordered_map<uint64_t, ConnectionEntry> mConnections;
+    std::atomic<size_t>                           mNumConnections;
+    uint64_t                                      mNextConnectionId;
+};
+
+/**
+ * This class implements the pool of worker threads of the REST server.
+ *
+ * The worker threads share the listening socket. A complete request is handled on the mainloop, which captures the
+ * OpenThread data of the response and passes it back to the worker thread of the connection to be encoded and sent.
+ *
+ */
+class WorkerPool : private NonCopyable
+{
+public:
+    /**
+     * The constructor initializes the worker pool.
+     *
+     * @param[in] aResource    A reference to the resource handler.
+     * @param[in] aTaskRunner  A reference to the task runner of the mainloop.
+     * @param[in] aNumWorkers  The number of worker threads.
+     *
+     */
+    WorkerPool(Resource &aResource, TaskRunner &aTaskRunner, uint32_t aNumWorkers);
+
+    /**
+     * The destructor stops all worker threads.
+     *
+     */
+    ~WorkerPool(void);
+
+    /**
+     * This method starts all worker threads.
+     *
+     * @param[in] aListenFd  The listening socket to accept connections from.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully started all worker threads.
+     * @retval OTBR_ERROR_ERRNO  Failed to start a worker thread.
+     *
+     */
+    otbrError Start(int aListenFd);
+
+    /**
+     * This method stops all worker threads and waits until they exit.
+     *
+     */
+    void Stop(void);
+
+    /**
+     * This method wakes all worker threads up, e.g. to stream a new event.
+     *
+     */
+    void WakeUp(void);
+
+    /**
+     * This method returns the worker threads.
+     *
+     * @returns The worker threads.
+     *
+     */
+    const std::vector<std::unique_ptr<Worker>> &GetWorkers(void) const { return mWorkers; }
+
+    /**
+     * This method returns the number of requests and chunks waiting to be handled on the mainloop.
+     *
+     * @returns The number of pending requests and chunks.
+     *
+     */
+    size_t GetNumPendingRequests(void) const { return mNumPendingRequests; }
+
+private:
+    friend class Worker;
+
+    bool AddConnection(void);
+    void RemoveConnection(void);
+    void HandleRequest(Worker &aWorker, uint64_t aConnectionId, const Request &aRequest);
+    void ProduceChunk(Worker &aWorker, uint64_t aConnectionId, std::shared_ptr<Response> aResponse);
+    void WaitCallback(Worker                   &aWorker,
+                      uint64_t                  aConnectionId,
+                      std::shared_ptr<Request>  aRequest,
+                      std::shared_ptr<Response> aResponse);
+
+    Resource                            &mResource;
+    TaskRunner                          &mTaskRunner;
+    std::vector<std::unique_ptr<Worker>> mWorkers;
+    std::atomic<size_t>                  mNumConnections;
+    std::atomic<size_t>                  mNumPendingRequests;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_WORKER_POOL_HPP_
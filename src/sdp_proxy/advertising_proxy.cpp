@@ -37,13 +37,14 @@
 
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
 
-#if !OTBR_ENABLE_MDNS_AVAHI && !OTBR_ENABLE_MDNS_MDNSSD && !OTBR_ENABLE_MDNS_MOJO
-#error "The Advertising Proxy requires OTBR_ENABLE_MDNS_AVAHI, OTBR_ENABLE_MDNS_MDNSSD or OTBR_ENABLE_MDNS_MOJO"
+#if !OTBR_ENABLE_MDNS_AVAHI && !OTBR_ENABLE_MDNS_MDNSSD && !OTBR_ENABLE_MDNS_MOJO && !OTBR_ENABLE_MDNS_NATIVE
+#error "The Advertising Proxy requires at least one `OTBR_MDNS` implementation"
 #endif
 
 #include <string>
 
 #include <assert.h>
+#include <string.h>
 
 #include "common/code_utils.hpp"
 #include "common/dns_utils.hpp"
@@ -51,52 +52,14 @@
 
 namespace otbr {
 
-static otError OtbrErrorToOtError(otbrError aError)
-{
-    otError error;
-
-    switch (aError)
-    {
-    case OTBR_ERROR_NONE:
-        error = OT_ERROR_NONE;
-        break;
-
-    case OTBR_ERROR_NOT_FOUND:
-        error = OT_ERROR_NOT_FOUND;
-        break;
-
-    case OTBR_ERROR_PARSE:
-        error = OT_ERROR_PARSE;
-        break;
-
-    case OTBR_ERROR_NOT_IMPLEMENTED:
-        error = OT_ERROR_NOT_IMPLEMENTED;
-        break;
-
-    case OTBR_ERROR_INVALID_ARGS:
-        error = OT_ERROR_INVALID_ARGS;
-        break;
-
-    case OTBR_ERROR_DUPLICATED:
-        error = OT_ERROR_DUPLICATED;
-        break;
-
-    case OTBR_ERROR_INVALID_STATE:
-        error = OT_ERROR_INVALID_STATE;
-        break;
-
-    default:
-        error = OT_ERROR_FAILED;
-        break;
-    }
-
-    return error;
-}
-
 AdvertisingProxy::AdvertisingProxy(Ncp::ControllerOpenThread &aNcp, Mdns::Publisher &aPublisher)
     : mNcp(aNcp)
     , mPublisher(aPublisher)
     , mIsEnabled(false)
+    , mUpdateTracker([this](otSrpServerServiceUpdateId aId, otError aError) {
+        otSrpServerHandleServiceUpdateResult(GetInstance(), aId, aError);
+    })
+    , mSkippedPublishes(0)
 {
     mNcp.RegisterResetHandler(
         [this]() { otSrpServerSetServiceUpdateHandler(GetInstance(), AdvertisingHandler, this); });
@@ -130,6 +93,11 @@ void AdvertisingProxy::Stop(void)
 {
     // Outstanding updates will fail on the SRP server because of timeout.
     // TODO: handle this case gracefully.
+    mUpdateTracker.Clear();
+
+    // Everything is republished when the proxy is enabled again.
+    mServiceFingerprints.Clear();
+    mHostFingerprints.Clear();
 
     // Stop receiving SRP server events.
     if (GetInstance() != nullptr)
@@ -152,55 +120,18 @@ void AdvertisingProxy::AdvertisingHandler(otSrpServerServiceUpdateId aId,
                                           const otSrpServerHost     *aHost,
                                           uint32_t                   aTimeout)
 {
-    OTBR_UNUSED_VARIABLE(aTimeout);
-
-    OutstandingUpdate *update = nullptr;
-    otbrError          error  = OTBR_ERROR_NONE;
+    otbrError error = OTBR_ERROR_NONE;
 
     VerifyOrExit(IsEnabled());
 
-    mOutstandingUpdates.emplace_back();
-    update      = &mOutstandingUpdates.back();
-    update->mId = aId;
-
-    error = PublishHostAndItsServices(aHost, update);
-
-    if (error != OTBR_ERROR_NONE || update->mCallbackCount == 0)
-    {
-        mOutstandingUpdates.pop_back();
-        otSrpServerHandleServiceUpdateResult(GetInstance(), aId, OtbrErrorToOtError(error));
-    }
+    mUpdateTracker.Add(aId);
+    error = PublishHostAndItsServices(aHost, &aId);
+    mUpdateTracker.WaitForResults(aId, error, Milliseconds(aTimeout));
 
 exit:
     return;
 }
 
-void AdvertisingProxy::OnMdnsPublishResult(otSrpServerServiceUpdateId aUpdateId, otbrError aError)
-{
-    for (auto update = mOutstandingUpdates.begin(); update != mOutstandingUpdates.end(); ++update)
-    {
-        if (update->mId != aUpdateId)
-        {
-            continue;
-        }
-
-        if (aError != OTBR_ERROR_NONE || update->mCallbackCount == 1)
-        {
-            // Erase before notifying OpenThread, because there are chances that new
-            // elements may be added to `otSrpServerHandleServiceUpdateResult` and
-            // the iterator will be invalidated.
-            mOutstandingUpdates.erase(update);
-            otSrpServerHandleServiceUpdateResult(GetInstance(), aUpdateId, OtbrErrorToOtError(aError));
-        }
-        else
-        {
-            --update->mCallbackCount;
-            otbrLogInfo("Waiting for more publishing callbacks %d", update->mCallbackCount);
-        }
-        break;
-    }
-}
-
 std::vector<Ip6Address> AdvertisingProxy::GetEligibleAddresses(const otIp6Address *aHostAddresses,
                                                                uint8_t             aHostAddressNum)
 {
@@ -231,6 +162,9 @@ void AdvertisingProxy::HandleMdnsState(Mdns::Publisher::State aState)
     VerifyOrExit(IsEnabled());
     VerifyOrExit(aState == Mdns::Publisher::State::kReady);
 
+    // The mDNS publisher starts without any registrations, so nothing published before is known to be published.
+    mServiceFingerprints.Clear();
+    mHostFingerprints.Clear();
     PublishAllHostsAndServices();
 
 exit:
@@ -254,67 +188,113 @@ exit:
     return;
 }
 
-otbrError AdvertisingProxy::PublishHostAndItsServices(const otSrpServerHost *aHost, OutstandingUpdate *aUpdate)
+otbrError AdvertisingProxy::PublishHostAndItsServices(const otSrpServerHost            *aHost,
+                                                      const otSrpServerServiceUpdateId *aUpdateId)
 {
     otbrError                  error = OTBR_ERROR_NONE;
+    DnsNameParts               hostNameParts;
     std::string                hostName;
-    std::string                hostDomain;
     const otIp6Address        *hostAddresses;
     uint8_t                    hostAddressNum;
     bool                       hostDeleted;
     const otSrpServerService  *service;
+    std::vector<Ip6Address>    addresses;
+    Fingerprint                hostFingerprint = 0;
+    bool                       hostChanged;
     otSrpServerServiceUpdateId updateId     = 0;
     bool                       hasUpdate    = false;
+    uint32_t                   numSkipped   = 0;
     std::string                fullHostName = otSrpServerHostGetFullName(aHost);
 
+    // The services to advertise with their new fingerprints, zero for those to unpublish.
+    std::vector<std::pair<const otSrpServerService *, Fingerprint>> changedServices;
+
     otbrLogInfo("Advertise SRP service updates: host=%s", fullHostName.c_str());
 
-    SuccessOrExit(error = SplitFullHostName(fullHostName, hostName, hostDomain));
+    hostNameParts = ParseFullDnsName(fullHostName);
+    VerifyOrExit(hostNameParts.IsHost(), error = OTBR_ERROR_INVALID_ARGS);
+    hostName = hostNameParts.mHostName.ToString();
     hostAddresses = otSrpServerHostGetAddresses(aHost, &hostAddressNum);
     hostDeleted   = otSrpServerHostIsDeleted(aHost);
 
-    if (aUpdate)
+    // Only hosts and services whose published content changes are sent to the mDNS publisher, a deleted one is
+    // changed if it's still published. Lease refreshes of an SRP client usually change nothing.
+    service = nullptr;
+    while ((service = otSrpServerHostGetNextService(aHost, service)) != nullptr)
     {
-        hasUpdate = true;
-        updateId  = aUpdate->mId;
-        aUpdate->mCallbackCount++;
-        aUpdate->mHostName = hostName;
-        service            = nullptr;
-        while ((service = otSrpServerHostGetNextService(aHost, service)) != nullptr)
+        Fingerprint fingerprint = 0;
+
+        if (!hostDeleted && !otSrpServerServiceIsDeleted(service))
+        {
+            fingerprint = MakeFingerprint(service, hostName);
+        }
+
+        if (mServiceFingerprints.IsChanged(otSrpServerServiceGetInstanceName(service), fingerprint))
         {
-            aUpdate->mCallbackCount++;
+            changedServices.emplace_back(service, fingerprint);
+        }
+        else
+        {
+            numSkipped++;
         }
     }
 
-    service = nullptr;
-    while ((service = otSrpServerHostGetNextService(aHost, service)) != nullptr)
+    if (!hostDeleted)
     {
-        std::string fullServiceName = otSrpServerServiceGetInstanceName(service);
-        std::string serviceName;
-        std::string serviceType;
-        std::string serviceDomain;
+        addresses       = GetEligibleAddresses(hostAddresses, hostAddressNum);
+        hostFingerprint = MakeFingerprint(addresses);
+    }
 
-        SuccessOrExit(error = SplitFullServiceInstanceName(fullServiceName, serviceName, serviceType, serviceDomain));
+    hostChanged = mHostFingerprints.IsChanged(fullHostName, hostFingerprint);
+    if (!hostChanged)
+    {
+        numSkipped++;
+    }
 
-        if (!hostDeleted && !otSrpServerServiceIsDeleted(service))
+    mSkippedPublishes += numSkipped;
+    otbrLogDebug("Skip %u unchanged SRP hosts and services", numSkipped);
+
+    if (aUpdateId != nullptr)
+    {
+        hasUpdate = true;
+        updateId  = *aUpdateId;
+        mUpdateTracker.SetPendingResults(updateId, hostName, changedServices.size() + (hostChanged ? 1 : 0));
+    }
+
+    for (const auto &changedService : changedServices)
+    {
+        Fingerprint  fingerprint      = changedService.second;
+        std::string  fullServiceName  = otSrpServerServiceGetInstanceName(changedService.first);
+        DnsNameParts serviceNameParts = ParseFullDnsName(fullServiceName);
+        std::string  serviceName;
+        std::string  serviceType;
+
+        VerifyOrExit(serviceNameParts.IsServiceInstance(), error = OTBR_ERROR_INVALID_ARGS);
+        serviceName = serviceNameParts.mInstanceName.ToString();
+        serviceType = serviceNameParts.mServiceName.ToString();
+
+        if (fingerprint != 0)
         {
-            Mdns::Publisher::TxtData     txtData     = MakeTxtData(service);
-            Mdns::Publisher::SubTypeList subTypeList = MakeSubTypeList(service);
+            Mdns::Publisher::TxtData     txtData     = MakeTxtData(changedService.first);
+            Mdns::Publisher::SubTypeList subTypeList = MakeSubTypeList(changedService.first);
 
             otbrLogDebug("Publish SRP service '%s'", fullServiceName.c_str());
+            mServiceFingerprints.HandlePublish(fullServiceName, fingerprint);
             mPublisher.PublishService(
-                hostName, serviceName, serviceType, subTypeList, otSrpServerServiceGetPort(service), txtData,
-                [this, hasUpdate, updateId, fullServiceName](otbrError aError) {
+                hostName, serviceName, serviceType, subTypeList, otSrpServerServiceGetPort(changedService.first),
+                txtData, [this, hasUpdate, updateId, fullServiceName, fingerprint](otbrError aError) {
                     otbrLogResult(aError, "Handle publish SRP service '%s'", fullServiceName.c_str());
+                    mServiceFingerprints.HandlePublishResult(fullServiceName, fingerprint, aError);
                     if (hasUpdate)
                     {
-                        OnMdnsPublishResult(updateId, aError);
+                        mUpdateTracker.HandlePublishResult(updateId, aError);
                     }
                 });
         }
         else
         {
             otbrLogDebug("Unpublish SRP service '%s'", fullServiceName.c_str());
+            mServiceFingerprints.HandleUnpublish(fullServiceName);
             mPublisher.UnpublishService(
                 serviceName, serviceType, [this, hasUpdate, updateId, fullServiceName](otbrError aError) {
                     // Treat `NOT_FOUND` as success when unpublishing service
@@ -322,40 +302,43 @@ otbrError AdvertisingProxy::PublishHostAndItsServices(const otSrpServerHost *aHo
                     otbrLogResult(aError, "Handle unpublish SRP service '%s'", fullServiceName.c_str());
                     if (hasUpdate)
                     {
-                        OnMdnsPublishResult(updateId, aError);
+                        mUpdateTracker.HandlePublishResult(updateId, aError);
                     }
                 });
         }
     }
 
+    VerifyOrExit(hostChanged);
+
     if (!hostDeleted)
     {
-        std::vector<Ip6Address> addresses;
-
         // TODO: select a preferred address or advertise all addresses from SRP client.
         otbrLogDebug("Publish SRP host '%s'", fullHostName.c_str());
 
-        addresses = GetEligibleAddresses(hostAddresses, hostAddressNum);
+        mHostFingerprints.HandlePublish(fullHostName, hostFingerprint);
         mPublisher.PublishHost(
             hostName, addresses,
-            Mdns::Publisher::ResultCallback([this, hasUpdate, updateId, fullHostName](otbrError aError) {
-                otbrLogResult(aError, "Handle publish SRP host '%s'", fullHostName.c_str());
-                if (hasUpdate)
-                {
-                    OnMdnsPublishResult(updateId, aError);
-                }
-            }));
+            Mdns::Publisher::ResultCallback(
+                [this, hasUpdate, updateId, fullHostName, hostFingerprint](otbrError aError) {
+                    otbrLogResult(aError, "Handle publish SRP host '%s'", fullHostName.c_str());
+                    mHostFingerprints.HandlePublishResult(fullHostName, hostFingerprint, aError);
+                    if (hasUpdate)
+                    {
+                        mUpdateTracker.HandlePublishResult(updateId, aError);
+                    }
+                }));
     }
     else
     {
         otbrLogDebug("Unpublish SRP host '%s'", fullHostName.c_str());
+        mHostFingerprints.HandleUnpublish(fullHostName);
         mPublisher.UnpublishHost(hostName, [this, hasUpdate, updateId, fullHostName](otbrError aError) {
             // Treat `NOT_FOUND` as success when unpublishing host.
             aError = (aError == OTBR_ERROR_NOT_FOUND) ? OTBR_ERROR_NONE : aError;
             otbrLogResult(aError, "Handle unpublish SRP host '%s'", fullHostName.c_str());
             if (hasUpdate)
             {
-                OnMdnsPublishResult(updateId, aError);
+                mUpdateTracker.HandlePublishResult(updateId, aError);
             }
         });
     }
@@ -399,6 +382,68 @@ exit:
     return subTypeList;
 }
 
+// Computes 64-bit FNV-1a hashes. The length of each field is hashed first, so that content can't move between
+// adjacent fields without changing the fingerprint.
+static uint64_t HashBytes(uint64_t aHash, const void *aData, size_t aLength)
+{
+    static constexpr uint64_t kFnvPrime = 0x100000001b3ULL;
+
+    const uint8_t *bytes = static_cast<const uint8_t *>(aData);
+
+    for (size_t i = 0; i < sizeof(aLength); i++)
+    {
+        aHash = (aHash ^ ((aLength >> (i * 8)) & 0xff)) * kFnvPrime;
+    }
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        aHash = (aHash ^ bytes[i]) * kFnvPrime;
+    }
+
+    return aHash;
+}
+
+static constexpr uint64_t kFnvOffsetBasis = 0xcbf29ce484222325ULL;
+
+AdvertisingProxy::Fingerprint AdvertisingProxy::MakeFingerprint(const otSrpServerService *aSrpService,
+                                                                const std::string        &aHostName)
+{
+    Fingerprint    fingerprint = kFnvOffsetBasis;
+    uint16_t       port        = otSrpServerServiceGetPort(aSrpService);
+    const uint8_t *txtData;
+    uint16_t       txtLength = 0;
+
+    txtData     = otSrpServerServiceGetTxtData(aSrpService, &txtLength);
+    fingerprint = HashBytes(fingerprint, aHostName.data(), aHostName.size());
+    fingerprint = HashBytes(fingerprint, &port, sizeof(port));
+    fingerprint = HashBytes(fingerprint, txtData, txtLength);
+
+    for (uint16_t index = 0;; index++)
+    {
+        const char *subTypeName = otSrpServerServiceGetSubTypeServiceNameAt(aSrpService, index);
+
+        VerifyOrExit(subTypeName != nullptr);
+        fingerprint = HashBytes(fingerprint, subTypeName, strlen(subTypeName));
+    }
+
+exit:
+    // Zero is reserved for unpublished services.
+    return fingerprint != 0 ? fingerprint : 1;
+}
+
+AdvertisingProxy::Fingerprint AdvertisingProxy::MakeFingerprint(const std::vector<Ip6Address> &aAddresses)
+{
+    Fingerprint fingerprint = kFnvOffsetBasis;
+
+    for (const Ip6Address &address : aAddresses)
+    {
+        fingerprint = HashBytes(fingerprint, address.m8, sizeof(address.m8));
+    }
+
+    // Zero is reserved for unpublished hosts.
+    return fingerprint != 0 ? fingerprint : 1;
+}
+
 } // namespace otbr
 
 #endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
@@ -46,6 +46,8 @@
 #include "common/code_utils.hpp"
 #include "mdns/mdns.hpp"
 #include "ncp/ncp_openthread.hpp"
+#include "sdp_proxy/published_fingerprints.hpp"
+#include "sdp_proxy/srp_update_tracker.hpp"
 
 namespace otbr {
 
@@ -87,23 +89,36 @@ public:
      */
     void HandleMdnsState(Mdns::Publisher::State aState);
 
-private:
-    struct OutstandingUpdate
-    {
-        otSrpServerServiceUpdateId mId;                // The ID of the SRP service update transaction.
-        std::string                mHostName;          // The host name.
-        uint32_t                   mCallbackCount = 0; // The number of callbacks which we are waiting for.
-    };
+    /**
+     * This method returns the counters of SRP updates.
+     *
+     * @returns  The counters of SRP updates.
+     *
+     */
+    const SrpUpdateTracker::Counters &GetUpdateCounters(void) const { return mUpdateTracker.GetCounters(); }
+
+    /**
+     * This method returns the number of host and service publishes skipped as they were unchanged.
+     *
+     * @returns  The number of skipped publishes.
+     *
+     */
+    uint32_t GetSkippedPublishes(void) const { return mSkippedPublishes; }
 
+private:
     static void AdvertisingHandler(otSrpServerServiceUpdateId aId,
                                    const otSrpServerHost     *aHost,
                                    uint32_t                   aTimeout,
                                    void                      *aContext);
     void        AdvertisingHandler(otSrpServerServiceUpdateId aId, const otSrpServerHost *aHost, uint32_t aTimeout);
 
+    typedef PublishedFingerprints::Fingerprint Fingerprint;
+
     static Mdns::Publisher::TxtData     MakeTxtData(const otSrpServerService *aSrpService);
     static Mdns::Publisher::SubTypeList MakeSubTypeList(const otSrpServerService *aSrpService);
-    void                                OnMdnsPublishResult(otSrpServerServiceUpdateId aUpdateId, otbrError aError);
+    static Fingerprint                  MakeFingerprint(const otSrpServerService *aSrpService,
+                                                        const std::string        &aHostName);
+    static Fingerprint                  MakeFingerprint(const std::vector<Ip6Address> &aAddresses);
 
     std::vector<Ip6Address> GetEligibleAddresses(const otIp6Address *aHostAddresses, uint8_t aHostAddressNum);
 
@@ -114,17 +129,17 @@ private:
     /**
      * This method publishes a specified host and its services.
      *
-     * It also makes a OutstandingUpdate object when needed.
+     * It also sets the publishing results the SRP update waits for when needed.
      *
      * @param[in]  aHost         A pointer to the host.
-     * @param[in]  aUpdate       A pointer to the output OutstandingUpdate object. When it's not null, the method will
-     *                           fill its fields, otherwise it's ignored.
+     * @param[in]  aUpdateId     A pointer to the ID of the SRP update. When it's not null, the publishing results are
+     *                           reported to the update, otherwise it's ignored.
      *
      * @retval  OTBR_ERROR_NONE  Successfully published the host and its services.
      * @retval  ...              Failed to publish the host and/or its services.
      *
      */
-    otbrError PublishHostAndItsServices(const otSrpServerHost *aHost, OutstandingUpdate *aUpdate);
+    otbrError PublishHostAndItsServices(const otSrpServerHost *aHost, const otSrpServerServiceUpdateId *aUpdateId);
 
     otInstance *GetInstance(void) { return mNcp.GetInstance(); }
 
@@ -136,8 +151,16 @@ private:
 
     bool mIsEnabled;
 
-    // A vector that tracks outstanding updates.
-    std::vector<OutstandingUpdate> mOutstandingUpdates;
+    // The SRP updates which are waiting for the publishing results.
+    SrpUpdateTracker mUpdateTracker;
+
+    // The number of host and service publishes skipped as they were unchanged.
+    uint32_t mSkippedPublishes;
+
+    // The fingerprints of published services by their full instance names, and of published hosts by their full
+    // names.
+    PublishedFingerprints mServiceFingerprints;
+    PublishedFingerprints mHostFingerprints;
 };
 
 } // namespace otbr
@@ -48,16 +48,10 @@
 #include "common/dns_utils.hpp"
 #include "common/logging.hpp"
 #include "utils/dns_utils.hpp"
-#include "utils/string_utils.hpp"
 
 namespace otbr {
 namespace Dnssd {
 
-static inline bool DnsLabelsEqual(const std::string &aLabel1, const std::string &aLabel2)
-{
-    return StringUtils::EqualCaseInsensitive(aLabel1, aLabel2);
-}
-
 DiscoveryProxy::DiscoveryProxy(Ncp::ControllerOpenThread &aNcp, Mdns::Publisher &aPublisher)
     : mNcp(aNcp)
     , mMdnsPublisher(aPublisher)
@@ -127,20 +121,19 @@ void DiscoveryProxy::OnDiscoveryProxySubscribe(void *aContext, const char *aFull
 
 void DiscoveryProxy::OnDiscoveryProxySubscribe(const char *aFullName)
 {
-    std::string fullName(aFullName);
-    DnsNameInfo nameInfo = SplitFullDnsName(fullName);
+    DnsNameParts nameParts = ParseFullDnsName(aFullName);
 
-    otbrLogInfo("Subscribe: %s", fullName.c_str());
+    otbrLogInfo("Subscribe: %s", aFullName);
 
-    if (GetServiceSubscriptionCount(nameInfo) == 1)
+    if (GetServiceSubscriptionCount(nameParts) == 1)
     {
-        if (nameInfo.mHostName.empty())
+        if (nameParts.mHostName.IsEmpty())
         {
-            mMdnsPublisher.SubscribeService(nameInfo.mServiceName, nameInfo.mInstanceName);
+            mMdnsPublisher.SubscribeService(nameParts.mServiceName.ToString(), nameParts.mInstanceName.ToString());
         }
         else
         {
-            mMdnsPublisher.SubscribeHost(nameInfo.mHostName);
+            mMdnsPublisher.SubscribeHost(nameParts.mHostName.ToString());
         }
     }
 }
@@ -152,20 +145,19 @@ void DiscoveryProxy::OnDiscoveryProxyUnsubscribe(void *aContext, const char *aFu
 
 void DiscoveryProxy::OnDiscoveryProxyUnsubscribe(const char *aFullName)
 {
-    std::string fullName(aFullName);
-    DnsNameInfo nameInfo = SplitFullDnsName(fullName);
+    DnsNameParts nameParts = ParseFullDnsName(aFullName);
 
-    otbrLogInfo("Unsubscribe: %s", fullName.c_str());
+    otbrLogInfo("Unsubscribe: %s", aFullName);
 
-    if (GetServiceSubscriptionCount(nameInfo) == 1)
+    if (GetServiceSubscriptionCount(nameParts) == 1)
     {
-        if (nameInfo.mHostName.empty())
+        if (nameParts.mHostName.IsEmpty())
         {
-            mMdnsPublisher.UnsubscribeService(nameInfo.mServiceName, nameInfo.mInstanceName);
+            mMdnsPublisher.UnsubscribeService(nameParts.mServiceName.ToString(), nameParts.mInstanceName.ToString());
         }
         else
         {
-            mMdnsPublisher.UnsubscribeHost(nameInfo.mHostName);
+            mMdnsPublisher.UnsubscribeHost(nameParts.mHostName.ToString());
         }
     }
 }
@@ -174,14 +166,20 @@ void DiscoveryProxy::OnServiceDiscovered(const std::string
                                          const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo)
 {
     otDnssdServiceInstanceInfo instanceInfo;
-    const otDnssdQuery        *query                 = nullptr;
-    std::string                unescapedInstanceName = DnsUtils::UnescapeInstanceName(aInstanceInfo.mName);
+    const otDnssdQuery        *query = nullptr;
+    char                       unescapedBuffer[OT_DNS_MAX_NAME_SIZE];
+    DnsNameView                unescapedInstanceName;
 
     otbrLogInfo("Service discovered: %s, instance %s hostname %s addresses %zu port %d priority %d "
                 "weight %d",
                 aType.c_str(), aInstanceInfo.mName.c_str(), aInstanceInfo.mHostName.c_str(),
                 aInstanceInfo.mAddresses.size(), aInstanceInfo.mPort, aInstanceInfo.mPriority, aInstanceInfo.mWeight);
 
+    // An instance name this long can't be a part of any full service instance name to answer with.
+    VerifyOrExit(aInstanceInfo.mName.length() <= sizeof(unescapedBuffer));
+    unescapedInstanceName =
+        DnsNameView(unescapedBuffer, DnsUtils::UnescapeInstanceName(aInstanceInfo.mName, unescapedBuffer));
+
     instanceInfo.mAddressNum = aInstanceInfo.mAddresses.size();
 
     if (!aInstanceInfo.mAddresses.empty())
@@ -200,40 +198,40 @@ void DiscoveryProxy::OnServiceDiscovered(const std::string
     instanceInfo.mTxtData   = aInstanceInfo.mTxtData.data();
     instanceInfo.mTtl       = CapTtl(aInstanceInfo.mTtl);
 
+    // The queries are matched on views into their names, only an answer needs to build any string.
     while ((query = otDnssdGetNextQuery(mNcp.GetInstance(), query)) != nullptr)
     {
-        std::string      instanceName;
-        std::string      serviceName;
-        std::string      hostName;
-        std::string      domain;
         char             queryName[OT_DNS_MAX_NAME_SIZE];
-        otDnssdQueryType type = otDnssdGetQueryTypeAndName(query, &queryName);
-        otbrError        splitError;
+        otDnssdQueryType type       = otDnssdGetQueryTypeAndName(query, &queryName);
+        DnsNameParts     queryParts = ParseFullDnsName(queryName);
+        bool             isWanted;
 
         switch (type)
         {
         case OT_DNSSD_QUERY_TYPE_BROWSE:
-            splitError = SplitFullServiceName(queryName, serviceName, domain);
+            isWanted = queryParts.IsService();
             break;
         case OT_DNSSD_QUERY_TYPE_RESOLVE:
-            splitError = SplitFullServiceInstanceName(queryName, instanceName, serviceName, domain);
+            isWanted = queryParts.IsServiceInstance();
             break;
         default:
-            splitError = OTBR_ERROR_NOT_FOUND;
+            isWanted = false;
             break;
         }
-        if (splitError != OTBR_ERROR_NONE)
+        if (!isWanted)
         {
             // Incoming service/instance was not what current query wanted to see, move on.
             continue;
         }
 
-        if (DnsLabelsEqual(serviceName, aType) &&
-            (instanceName.empty() || DnsLabelsEqual(instanceName, unescapedInstanceName)))
+        if (queryParts.mServiceName.EqualsCaseInsensitive(aType) &&
+            (queryParts.mInstanceName.IsEmpty() ||
+             queryParts.mInstanceName.EqualsCaseInsensitive(unescapedInstanceName)))
         {
+            std::string domain             = queryParts.GetDomainWithDot();
             std::string serviceFullName    = aType + "." + domain;
             std::string translatedHostName = TranslateDomain(aInstanceInfo.mHostName, domain);
-            std::string instanceFullName   = unescapedInstanceName + "." + serviceFullName;
+            std::string instanceFullName   = unescapedInstanceName.ToString() + "." + serviceFullName;
 
             instanceInfo.mFullName = instanceFullName.c_str();
             instanceInfo.mHostName = translatedHostName.c_str();
@@ -241,6 +239,9 @@ void DiscoveryProxy::OnServiceDiscovered(const std::string
             otDnssdQueryHandleDiscoveredServiceInstance(mNcp.GetInstance(), serviceFullName.c_str(), &instanceInfo);
         }
     }
+
+exit:
+    return;
 }
 
 void DiscoveryProxy::OnHostDiscovered(const std::string                         &aHostName,
@@ -272,28 +273,25 @@ void DiscoveryProxy::OnHostDiscovered(const std::string
 
     while ((query = otDnssdGetNextQuery(mNcp.GetInstance(), query)) != nullptr)
     {
-        std::string      hostName, domain;
         char             queryName[OT_DNS_MAX_NAME_SIZE];
         otDnssdQueryType type = otDnssdGetQueryTypeAndName(query, &queryName);
-        otbrError        splitError;
-
-        OTBR_UNUSED_VARIABLE(splitError);
+        DnsNameParts     queryParts;
 
         if (type != OT_DNSSD_QUERY_TYPE_RESOLVE_HOST)
         {
             continue;
         }
 
-        splitError = SplitFullHostName(queryName, hostName, domain);
+        queryParts = ParseFullDnsName(queryName);
 
-        if (splitError != OTBR_ERROR_NONE)
+        if (!queryParts.IsHost())
         {
             continue;
         }
 
-        if (DnsLabelsEqual(hostName, aHostName))
+        if (queryParts.mHostName.EqualsCaseInsensitive(aHostName))
         {
-            std::string hostFullName = TranslateDomain(resolvedHostName, domain);
+            std::string hostFullName = TranslateDomain(resolvedHostName, queryParts.GetDomainWithDot());
 
             otDnssdQueryHandleDiscoveredHost(mNcp.GetInstance(), hostFullName.c_str(), &hostInfo);
         }
@@ -302,36 +300,35 @@ void DiscoveryProxy::OnHostDiscovered(const std::string
 
 std::string DiscoveryProxy::TranslateDomain(const std::string &aName, const std::string &aTargetDomain)
 {
-    std::string targetName;
-    std::string hostName;
-    std::string domain;
+    DnsNameParts nameParts = ParseFullDnsName(aName);
+    std::string  targetName;
 
-    VerifyOrExit(OTBR_ERROR_NONE == SplitFullHostName(aName, hostName, domain), targetName = aName);
-    VerifyOrExit(DnsLabelsEqual(domain, "local."), targetName = aName);
+    VerifyOrExit(nameParts.IsHost(), targetName = aName);
+    VerifyOrExit(nameParts.mDomain.EqualsCaseInsensitive(DnsNameView("local")), targetName = aName);
 
-    targetName = hostName + "." + aTargetDomain;
+    targetName = nameParts.mHostName.ToString() + "." + aTargetDomain;
 
 exit:
     otbrLogDebug("Translate domain: %s => %s", aName.c_str(), targetName.c_str());
     return targetName;
 }
 
-int DiscoveryProxy::GetServiceSubscriptionCount(const DnsNameInfo &aNameInfo) const
+int DiscoveryProxy::GetServiceSubscriptionCount(const DnsNameParts &aNameParts) const
 {
     const otDnssdQuery *query = nullptr;
     int                 count = 0;
 
     while ((query = otDnssdGetNextQuery(mNcp.GetInstance(), query)) != nullptr)
     {
-        char        queryName[OT_DNS_MAX_NAME_SIZE];
-        DnsNameInfo queryInfo;
+        char         queryName[OT_DNS_MAX_NAME_SIZE];
+        DnsNameParts queryParts;
 
         otDnssdGetQueryTypeAndName(query, &queryName);
-        queryInfo = SplitFullDnsName(queryName);
+        queryParts = ParseFullDnsName(queryName);
 
-        count += (DnsLabelsEqual(aNameInfo.mInstanceName, queryInfo.mInstanceName) &&
-                  DnsLabelsEqual(aNameInfo.mServiceName, queryInfo.mServiceName) &&
-                  DnsLabelsEqual(aNameInfo.mHostName, queryInfo.mHostName));
+        count += (aNameParts.mInstanceName.EqualsCaseInsensitive(queryParts.mInstanceName) &&
+                  aNameParts.mServiceName.EqualsCaseInsensitive(queryParts.mServiceName) &&
+                  aNameParts.mHostName.EqualsCaseInsensitive(queryParts.mHostName));
     }
 
     return count;
@@ -101,7 +101,7 @@ private:
     void               OnDiscoveryProxySubscribe(const char *aSubscription);
     static void        OnDiscoveryProxyUnsubscribe(void *aContext, const char *aFullName);
     void               OnDiscoveryProxyUnsubscribe(const char *aSubscription);
-    int                GetServiceSubscriptionCount(const DnsNameInfo &aNameInfo) const;
+    int                GetServiceSubscriptionCount(const DnsNameParts &aNameParts) const;
     static std::string TranslateDomain(const std::string &aName, const std::string &aTargetDomain);
     void               OnServiceDiscovered(const std::string                             &aSubscription,
                                            const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo);
@@ -0,0 +1,85 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the fingerprints of the hosts and services published by the Advertising Proxy.
+ */
+
+#include "sdp_proxy/published_fingerprints.hpp"
+
+namespace otbr {
+
+bool PublishedFingerprints::IsChanged(const std::string &aName, Fingerprint aFingerprint) const
+{
+    auto it = mEntries.find(aName);
+    bool changed;
+
+    if (aFingerprint == 0)
+    {
+        // Unpublishing is needed as long as anything was sent to the mDNS publisher.
+        changed = (it != mEntries.end());
+    }
+    else
+    {
+        changed = (it == mEntries.end() || !it->second.mPublished || it->second.mFingerprint != aFingerprint);
+    }
+
+    return changed;
+}
+
+void PublishedFingerprints::HandlePublish(const std::string &aName, Fingerprint aFingerprint)
+{
+    Entry &entry = mEntries[aName];
+
+    if (entry.mFingerprint != aFingerprint)
+    {
+        entry.mFingerprint = aFingerprint;
+        entry.mPublished   = false;
+    }
+}
+
+void PublishedFingerprints::HandlePublishResult(const std::string &aName, Fingerprint aFingerprint, otbrError aError)
+{
+    auto it = mEntries.find(aName);
+
+    if (it != mEntries.end() && it->second.mFingerprint == aFingerprint)
+    {
+        if (aError == OTBR_ERROR_NONE)
+        {
+            it->second.mPublished = true;
+        }
+        else
+        {
+            // A failed publish must be retried by the next update.
+            mEntries.erase(it);
+        }
+    }
+}
+
+} // namespace otbr
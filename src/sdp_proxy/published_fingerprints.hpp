@@ -0,0 +1,124 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the fingerprints of the hosts and services published by the Advertising Proxy.
+ */
+
+#ifndef OTBR_SDP_PROXY_PUBLISHED_FINGERPRINTS_HPP_
+#define OTBR_SDP_PROXY_PUBLISHED_FINGERPRINTS_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stdint.h>
+
+#include <string>
+#include <unordered_map>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class remembers the content of the hosts or services published by the Advertising Proxy, so that an SRP update
+ * which changes nothing is not sent to the mDNS publisher.
+ *
+ * The content is represented by a fingerprint, zero stands for not published. A fingerprint only counts as published
+ * once the mDNS publisher reported success, so an update repeating a publish which is still in progress is sent again,
+ * and the mDNS publisher attaches it to the registration in progress.
+ *
+ */
+class PublishedFingerprints
+{
+public:
+    /**
+     * A compact fingerprint of the published content of a host or service.
+     *
+     */
+    typedef uint64_t Fingerprint;
+
+    /**
+     * This method tells whether publishing a fingerprint would change what is published.
+     *
+     * @param[in] aName         The full name of the host or service.
+     * @param[in] aFingerprint  The fingerprint to publish, or zero to unpublish.
+     *
+     * @returns Whether the host or service must be sent to the mDNS publisher.
+     *
+     */
+    bool IsChanged(const std::string &aName, Fingerprint aFingerprint) const;
+
+    /**
+     * This method records that a host or service is being published.
+     *
+     * @param[in] aName         The full name of the host or service.
+     * @param[in] aFingerprint  The fingerprint which is published.
+     *
+     */
+    void HandlePublish(const std::string &aName, Fingerprint aFingerprint);
+
+    /**
+     * This method records the publishing result of a host or service.
+     *
+     * A result is ignored if the host or service has been published with another fingerprint or unpublished since.
+     *
+     * @param[in] aName         The full name of the host or service.
+     * @param[in] aFingerprint  The fingerprint which was published.
+     * @param[in] aError        The publishing result.
+     *
+     */
+    void HandlePublishResult(const std::string &aName, Fingerprint aFingerprint, otbrError aError);
+
+    /**
+     * This method records that a host or service is being unpublished.
+     *
+     * @param[in] aName  The full name of the host or service.
+     *
+     */
+    void HandleUnpublish(const std::string &aName) { mEntries.erase(aName); }
+
+    /**
+     * This method forgets all fingerprints, so that everything is published again.
+     *
+     */
+    void Clear(void) { mEntries.clear(); }
+
+private:
+    struct Entry
+    {
+        Fingerprint mFingerprint; // The fingerprint which was last sent to the mDNS publisher.
+        bool        mPublished;   // Whether the mDNS publisher reported success for the fingerprint.
+    };
+
+    std::unordered_map<std::string, Entry> mEntries;
+};
+
+} // namespace otbr
+
+#endif // OTBR_SDP_PROXY_PUBLISHED_FINGERPRINTS_HPP_
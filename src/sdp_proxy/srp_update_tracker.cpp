@@ -0,0 +1,238 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements tracking the SRP service updates of the Advertising Proxy.
+ */
+
+#define OTBR_LOG_TAG "ADPROXY"
+
+#include "sdp_proxy/srp_update_tracker.hpp"
+
+#include "common/logging.hpp"
+
+namespace otbr {
+
+// The weight of the latest latency in the EMA latency of SRP updates.
+static constexpr uint32_t kEmaFactorNumerator   = 1;
+static constexpr uint32_t kEmaFactorDenominator = 2;
+
+static otError OtbrErrorToOtError(otbrError aError)
+{
+    otError error;
+
+    switch (aError)
+    {
+    case OTBR_ERROR_NONE:
+        error = OT_ERROR_NONE;
+        break;
+
+    case OTBR_ERROR_NOT_FOUND:
+        error = OT_ERROR_NOT_FOUND;
+        break;
+
+    case OTBR_ERROR_PARSE:
+        error = OT_ERROR_PARSE;
+        break;
+
+    case OTBR_ERROR_NOT_IMPLEMENTED:
+        error = OT_ERROR_NOT_IMPLEMENTED;
+        break;
+
+    case OTBR_ERROR_INVALID_ARGS:
+        error = OT_ERROR_INVALID_ARGS;
+        break;
+
+    case OTBR_ERROR_DUPLICATED:
+        error = OT_ERROR_DUPLICATED;
+        break;
+
+    case OTBR_ERROR_INVALID_STATE:
+        error = OT_ERROR_INVALID_STATE;
+        break;
+
+    default:
+        error = OT_ERROR_FAILED;
+        break;
+    }
+
+    return error;
+}
+
+SrpUpdateTracker::SrpUpdateTracker(ResultHandler aResultHandler)
+    : mResultHandler(std::move(aResultHandler))
+    , mCounters()
+{
+}
+
+void SrpUpdateTracker::Add(otSrpServerServiceUpdateId aId)
+{
+    OutstandingUpdate &update = mOutstandingUpdates[aId];
+
+    update.mStartTime = Now();
+    mCounters.mOutstandingUpdates++;
+}
+
+void SrpUpdateTracker::SetPendingResults(otSrpServerServiceUpdateId aId,
+                                         const std::string         &aHostName,
+                                         uint32_t                   aNumResults)
+{
+    auto it = mOutstandingUpdates.find(aId);
+
+    VerifyOrExit(it != mOutstandingUpdates.end());
+
+    it->second.mHostName      = aHostName;
+    it->second.mCallbackCount = aNumResults;
+
+exit:
+    return;
+}
+
+void SrpUpdateTracker::WaitForResults(otSrpServerServiceUpdateId aId, otbrError aError, Milliseconds aTimeout)
+{
+    auto it = mOutstandingUpdates.find(aId);
+
+    // The update may already be completed by callbacks which are invoked immediately.
+    VerifyOrExit(it != mOutstandingUpdates.end());
+
+    if (aError != OTBR_ERROR_NONE || it->second.mCallbackCount == 0)
+    {
+        Complete(aId, aError);
+    }
+    else
+    {
+        // Fail the update on time instead of leaving it to the SRP server, which times it out at the same deadline
+        // but without freeing the update here.
+        it->second.mTimeoutTaskId = ScheduleTimeout(aId, aTimeout);
+    }
+
+exit:
+    return;
+}
+
+void SrpUpdateTracker::HandlePublishResult(otSrpServerServiceUpdateId aId, otbrError aError)
+{
+    auto it = mOutstandingUpdates.find(aId);
+
+    VerifyOrExit(it != mOutstandingUpdates.end());
+
+    if (aError != OTBR_ERROR_NONE || it->second.mCallbackCount == 1)
+    {
+        Complete(aId, aError);
+    }
+    else
+    {
+        --it->second.mCallbackCount;
+        otbrLogInfo("Waiting for more publishing callbacks %d", it->second.mCallbackCount);
+    }
+
+exit:
+    return;
+}
+
+void SrpUpdateTracker::Clear(void)
+{
+    for (const auto &update : mOutstandingUpdates)
+    {
+        CancelTimeout(update.second.mTimeoutTaskId);
+    }
+    mOutstandingUpdates.clear();
+    mCounters.mOutstandingUpdates = 0;
+}
+
+TaskRunner::TaskId SrpUpdateTracker::ScheduleTimeout(otSrpServerServiceUpdateId aId, Milliseconds aDelay)
+{
+    return mTaskRunner.Post(aDelay, [this, aId]() { HandleTimeout(aId); });
+}
+
+void SrpUpdateTracker::CancelTimeout(TaskRunner::TaskId aTaskId)
+{
+    mTaskRunner.Cancel(aTaskId);
+}
+
+void SrpUpdateTracker::Complete(otSrpServerServiceUpdateId aId, otbrError aError)
+{
+    auto     it = mOutstandingUpdates.find(aId);
+    uint32_t latency;
+
+    VerifyOrExit(it != mOutstandingUpdates.end());
+
+    latency = std::chrono::duration_cast<Milliseconds>(Now() - it->second.mStartTime).count();
+    if (it->second.mTimeoutTaskId != 0)
+    {
+        CancelTimeout(it->second.mTimeoutTaskId);
+    }
+
+    // Erase before reporting the result, because there are chances that new
+    // updates may be added in `otSrpServerHandleServiceUpdateResult`.
+    mOutstandingUpdates.erase(it);
+    mCounters.mOutstandingUpdates--;
+
+    if (aError == OTBR_ERROR_NONE)
+    {
+        mCounters.mCompletedUpdates++;
+        mCounters.mUpdateEmaLatency =
+            (mCounters.mUpdateEmaLatency == 0)
+                ? latency
+                : (latency * kEmaFactorNumerator +
+                   mCounters.mUpdateEmaLatency * (kEmaFactorDenominator - kEmaFactorNumerator)) /
+                      kEmaFactorDenominator;
+    }
+    else
+    {
+        mCounters.mFailedUpdates++;
+    }
+
+    mResultHandler(aId, OtbrErrorToOtError(aError));
+
+exit:
+    return;
+}
+
+void SrpUpdateTracker::HandleTimeout(otSrpServerServiceUpdateId aId)
+{
+    auto it = mOutstandingUpdates.find(aId);
+
+    VerifyOrExit(it != mOutstandingUpdates.end());
+
+    otbrLogWarning("SRP service update %u of host %s timed out with %u callbacks outstanding", aId,
+                   it->second.mHostName.c_str(), it->second.mCallbackCount);
+
+    // Results of the mDNS publisher which arrive later are ignored.
+    mOutstandingUpdates.erase(it);
+    mCounters.mOutstandingUpdates--;
+    mCounters.mTimedOutUpdates++;
+
+    mResultHandler(aId, OT_ERROR_RESPONSE_TIMEOUT);
+
+exit:
+    return;
+}
+
+} // namespace otbr
@@ -0,0 +1,194 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for tracking the SRP service updates of the Advertising Proxy.
+ */
+
+#ifndef OTBR_SDP_PROXY_SRP_UPDATE_TRACKER_HPP_
+#define OTBR_SDP_PROXY_SRP_UPDATE_TRACKER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stdint.h>
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+
+#include <openthread/error.h>
+#include <openthread/srp_server.h>
+
+#include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class tracks the SRP service updates which are waiting for the results of the mDNS publisher.
+ *
+ * An update succeeds when all its publishing results succeeded, fails with the first failed result, and times out
+ * at its deadline. The result of an update is reported exactly once, publishing results arriving later are ignored.
+ *
+ */
+class SrpUpdateTracker : private NonCopyable
+{
+public:
+    /**
+     * This structure represents the counters of SRP updates.
+     *
+     */
+    struct Counters
+    {
+        uint32_t mOutstandingUpdates; ///< The number of updates which are waiting for mDNS publishing results.
+        uint32_t mCompletedUpdates;   ///< The number of updates which are published successfully.
+        uint32_t mFailedUpdates;      ///< The number of updates which failed to be published.
+        uint32_t mTimedOutUpdates;    ///< The number of updates which missed their deadline.
+        uint32_t mUpdateEmaLatency;   ///< The EMA latency of successfully published updates in milliseconds.
+    };
+
+    /**
+     * This function reports the result of an SRP update.
+     *
+     * @param[in] aId     The ID of the SRP service update transaction.
+     * @param[in] aError  The result of the update.
+     *
+     */
+    typedef std::function<void(otSrpServerServiceUpdateId aId, otError aError)> ResultHandler;
+
+    /**
+     * The constructor initializes the tracker.
+     *
+     * @param[in] aResultHandler  The function which reports the result of each update.
+     *
+     */
+    explicit SrpUpdateTracker(ResultHandler aResultHandler);
+
+    virtual ~SrpUpdateTracker(void) = default;
+
+    /**
+     * This method starts tracking an update.
+     *
+     * @param[in] aId  The ID of the SRP service update transaction.
+     *
+     */
+    void Add(otSrpServerServiceUpdateId aId);
+
+    /**
+     * This method sets the number of publishing results an update waits for.
+     *
+     * It must be called before the publishing starts, as results may arrive immediately.
+     *
+     * @param[in] aId          The ID of the SRP service update transaction.
+     * @param[in] aHostName    The name of the host of the update.
+     * @param[in] aNumResults  The number of publishing results.
+     *
+     */
+    void SetPendingResults(otSrpServerServiceUpdateId aId, const std::string &aHostName, uint32_t aNumResults);
+
+    /**
+     * This method waits for the publishing results of an update once its publishing has started.
+     *
+     * The update completes at once if the publishing failed or there are no results to wait for, otherwise it times
+     * out after @p aTimeout.
+     *
+     * @param[in] aId       The ID of the SRP service update transaction.
+     * @param[in] aError    The error of starting the publishing.
+     * @param[in] aTimeout  The time to wait for the publishing results.
+     *
+     */
+    void WaitForResults(otSrpServerServiceUpdateId aId, otbrError aError, Milliseconds aTimeout);
+
+    /**
+     * This method handles a publishing result of an update.
+     *
+     * @param[in] aId     The ID of the SRP service update transaction.
+     * @param[in] aError  The publishing result.
+     *
+     */
+    void HandlePublishResult(otSrpServerServiceUpdateId aId, otbrError aError);
+
+    /**
+     * This method stops tracking all updates without reporting their results.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method returns the counters of SRP updates.
+     *
+     * @returns The counters of SRP updates.
+     *
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+protected:
+    virtual Timepoint Now(void) const { return Clock::now(); }
+
+    /**
+     * This method schedules the timeout of an update.
+     *
+     * @param[in] aId     The ID of the SRP service update transaction.
+     * @param[in] aDelay  The time until the deadline.
+     *
+     * @returns The ID of the timeout task, which is passed to `CancelTimeout()`.
+     *
+     */
+    virtual TaskRunner::TaskId ScheduleTimeout(otSrpServerServiceUpdateId aId, Milliseconds aDelay);
+    virtual void               CancelTimeout(TaskRunner::TaskId aTaskId);
+
+    void HandleTimeout(otSrpServerServiceUpdateId aId);
+
+private:
+    struct OutstandingUpdate
+    {
+        std::string        mHostName;          // The host name.
+        uint32_t           mCallbackCount = 0; // The number of callbacks which we are waiting for.
+        Timepoint          mStartTime;         // The time when the update was received.
+        TaskRunner::TaskId mTimeoutTaskId = 0; // The ID of the task which fails the update at its deadline.
+    };
+
+    void Complete(otSrpServerServiceUpdateId aId, otbrError aError);
+
+    ResultHandler mResultHandler;
+
+    // The outstanding updates by their IDs.
+    std::unordered_map<otSrpServerServiceUpdateId, OutstandingUpdate> mOutstandingUpdates;
+
+    // Runs the deadlines of outstanding updates.
+    TaskRunner mTaskRunner;
+
+    Counters mCounters;
+};
+
+} // namespace otbr
+
+#endif // OTBR_SDP_PROXY_SRP_UPDATE_TRACKER_HPP_
@@ -0,0 +1,156 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements keeping the TREL peers across restarts.
+ */
+
+#define OTBR_LOG_TAG "TrelDns"
+
+#include "trel_dnssd/peer_snapshot.hpp"
+
+#include <string.h>
+
+#include "common/logging.hpp"
+
+namespace otbr {
+
+namespace TrelDnssd {
+
+constexpr uint16_t PeerSnapshot::kRestoredPeerTimeoutMs;
+
+PeerSnapshot::PeerSnapshot(ExpireHandler aExpireHandler)
+    : mExpireHandler(std::move(aExpireHandler))
+{
+}
+
+void PeerSnapshot::Save(Utils::Snapshot &aSnapshot, const std::string &aNetif, const std::vector<SavedPeer> &aPeers)
+{
+    Utils::Snapshot::Writer writer;
+
+    SuccessOrExit(writer.WriteString(aNetif));
+
+    for (const SavedPeer &peer : aPeers)
+    {
+        Utils::Snapshot::Writer peerWriter;
+
+        if (WritePeer(peerWriter, peer) != OTBR_ERROR_NONE)
+        {
+            otbrLogWarning("Skipped TREL peer %s in snapshot", peer.mInstanceName.c_str());
+            continue;
+        }
+
+        writer.GetData().insert(writer.GetData().end(), peerWriter.GetData().begin(), peerWriter.GetData().end());
+    }
+
+    aSnapshot.SetSection(Utils::Snapshot::kSectionTrelPeers, std::move(writer.GetData()));
+
+exit:
+    return;
+}
+
+otbrError PeerSnapshot::WritePeer(Utils::Snapshot::Writer &aWriter, const SavedPeer &aPeer)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = aWriter.WriteString(aPeer.mInstanceName));
+    SuccessOrExit(error = aWriter.WriteBytes(aPeer.mSockAddr.mAddress.mFields.m8,
+                                             sizeof(aPeer.mSockAddr.mAddress.mFields.m8)));
+    aWriter.WriteUint16(aPeer.mSockAddr.mPort);
+    SuccessOrExit(error = aWriter.WriteBytes(aPeer.mTxtData.data(), aPeer.mTxtData.size()));
+
+exit:
+    return error;
+}
+
+otbrError PeerSnapshot::Restore(const Utils::Snapshot &aSnapshot)
+{
+    otbrError                   error   = OTBR_ERROR_NONE;
+    const std::vector<uint8_t> *section = aSnapshot.GetSection(Utils::Snapshot::kSectionTrelPeers);
+    std::string                 netif;
+    std::vector<SavedPeer>      peers;
+
+    VerifyOrExit(section != nullptr);
+
+    {
+        Utils::Snapshot::Reader reader(*section);
+
+        SuccessOrExit(error = reader.ReadString(netif));
+
+        while (!reader.IsEnd())
+        {
+            SavedPeer            peer;
+            std::vector<uint8_t> address;
+
+            SuccessOrExit(error = reader.ReadString(peer.mInstanceName));
+            SuccessOrExit(error = reader.ReadBytes(address));
+            VerifyOrExit(address.size() == sizeof(peer.mSockAddr.mAddress.mFields.m8), error = OTBR_ERROR_PARSE);
+            memcpy(peer.mSockAddr.mAddress.mFields.m8, address.data(), address.size());
+            SuccessOrExit(error = reader.ReadUint16(peer.mSockAddr.mPort));
+            SuccessOrExit(error = reader.ReadBytes(peer.mTxtData));
+            peers.push_back(std::move(peer));
+        }
+    }
+
+    otbrLogInfo("Restored %zu TREL peers of netif %s from snapshot", peers.size(), netif.c_str());
+    mRestoredNetif = std::move(netif);
+    mRestoredPeers = std::move(peers);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Ignored invalid TREL peers in snapshot: %s", otbrErrorString(error));
+    }
+    return error;
+}
+
+std::vector<PeerSnapshot::SavedPeer> PeerSnapshot::TakeRestoredPeers(const std::string &aNetif)
+{
+    std::vector<SavedPeer> peers;
+
+    VerifyOrExit(!mRestoredPeers.empty());
+    VerifyOrExit(mRestoredNetif == aNetif,
+                 otbrLogInfo("Ignored TREL peers of netif %s from snapshot", mRestoredNetif.c_str()));
+
+    peers.swap(mRestoredPeers);
+    ScheduleExpiry(Milliseconds(kRestoredPeerTimeoutMs));
+
+exit:
+    mRestoredPeers.clear();
+    return peers;
+}
+
+void PeerSnapshot::ScheduleExpiry(Milliseconds aDelay)
+{
+    mTaskRunner.Post(aDelay, [this]() { HandleExpiry(); });
+}
+
+} // namespace TrelDnssd
+
+} // namespace otbr
@@ -0,0 +1,153 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for keeping the TREL peers across restarts.
+ */
+
+#ifndef OTBR_AGENT_TREL_PEER_SNAPSHOT_HPP_
+#define OTBR_AGENT_TREL_PEER_SNAPSHOT_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stdint.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <openthread/ip6.h>
+
+#include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
+#include "utils/snapshot.hpp"
+
+namespace otbr {
+
+namespace TrelDnssd {
+
+/**
+ * This class saves the TREL peers discovered by mDNS to a snapshot, and restores them after a restart.
+ *
+ * The restored peers are taken once for the TREL network interface they were saved for. The restored peers which
+ * are not discovered again by mDNS expire kRestoredPeerTimeoutMs after they are taken.
+ *
+ */
+class PeerSnapshot : private NonCopyable
+{
+public:
+    /**
+     * The time in milliseconds mDNS has to discover a restored peer again.
+     *
+     */
+    static constexpr uint16_t kRestoredPeerTimeoutMs = 30000;
+
+    /**
+     * This structure represents a TREL peer in a snapshot.
+     *
+     */
+    struct SavedPeer
+    {
+        std::string          mInstanceName; ///< The service instance name.
+        std::vector<uint8_t> mTxtData;      ///< The TXT data.
+        otSockAddr           mSockAddr;     ///< The socket address.
+    };
+
+    /**
+     * This function removes the restored peers which were not discovered again.
+     *
+     */
+    typedef std::function<void(void)> ExpireHandler;
+
+    /**
+     * The constructor initializes the peer snapshot.
+     *
+     * @param[in] aExpireHandler  The function which removes the restored peers which were not discovered again.
+     *
+     */
+    explicit PeerSnapshot(ExpireHandler aExpireHandler);
+
+    virtual ~PeerSnapshot(void) = default;
+
+    /**
+     * This method saves TREL peers to a snapshot.
+     *
+     * A peer which can't be encoded is skipped.
+     *
+     * @param[in] aSnapshot  The snapshot to save to.
+     * @param[in] aNetif     The TREL network interface of the peers.
+     * @param[in] aPeers     The peers to save.
+     *
+     */
+    static void Save(Utils::Snapshot &aSnapshot, const std::string &aNetif, const std::vector<SavedPeer> &aPeers);
+
+    /**
+     * This method restores the TREL peers saved in a snapshot.
+     *
+     * @param[in] aSnapshot  The snapshot to restore from.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully restored the peers, or the snapshot has no TREL peers.
+     * @retval OTBR_ERROR_PARSE  The TREL peers in the snapshot are invalid, nothing is restored.
+     *
+     */
+    otbrError Restore(const Utils::Snapshot &aSnapshot);
+
+    /**
+     * This method takes the restored peers and starts their expiry.
+     *
+     * The restored peers are dropped if they were saved for another TREL network interface.
+     *
+     * @param[in] aNetif  The TREL network interface.
+     *
+     * @returns The restored peers of @p aNetif.
+     *
+     */
+    std::vector<SavedPeer> TakeRestoredPeers(const std::string &aNetif);
+
+protected:
+    virtual void ScheduleExpiry(Milliseconds aDelay);
+
+    void HandleExpiry(void) { mExpireHandler(); }
+
+private:
+    static otbrError WritePeer(Utils::Snapshot::Writer &aWriter, const SavedPeer &aPeer);
+
+    ExpireHandler          mExpireHandler;
+    std::string            mRestoredNetif;
+    std::vector<SavedPeer> mRestoredPeers;
+    TaskRunner             mTaskRunner;
+};
+
+} // namespace TrelDnssd
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_TREL_PEER_SNAPSHOT_HPP_
@@ -84,6 +84,7 @@ namespace TrelDnssd {
 TrelDnssd::TrelDnssd(Ncp::ControllerOpenThread &aNcp, Mdns::Publisher &aPublisher)
     : mPublisher(aPublisher)
     , mNcp(aNcp)
+    , mPeerSnapshot([this]() { RemoveRestoredPeers(); })
 {
     sTrelDnssd = this;
 }
@@ -448,6 +449,8 @@ void TrelDnssd::OnBecomeReady(void)
             mPublisher.SubscribeService(kTrelServiceName, /* aInstanceName */ "");
         }
 
+        AddRestoredPeers();
+
         if (mRegisterInfo.IsValid())
         {
             PublishTrelService();
@@ -476,6 +479,94 @@ uint16_t TrelDnssd::CountDuplicatePeers(const TrelDnssd::Peer &aPeer)
     return count;
 }
 
+void TrelDnssd::SaveSnapshot(Utils::Snapshot &aSnapshot) const
+{
+    std::vector<PeerSnapshot::SavedPeer> peers;
+
+    VerifyOrExit(IsInitialized());
+
+    for (const auto &entry : mPeers)
+    {
+        const Peer &peer = entry.second;
+
+        // Only peers confirmed by mDNS are saved, so a peer which is gone does not survive repeated restarts.
+        if (peer.mRestored)
+        {
+            continue;
+        }
+
+        peers.push_back({entry.first, peer.mTxtData, peer.mSockAddr});
+    }
+
+    PeerSnapshot::Save(aSnapshot, mTrelNetif, peers);
+
+exit:
+    return;
+}
+
+void TrelDnssd::RestoreSnapshot(const Utils::Snapshot &aSnapshot)
+{
+    // An invalid snapshot is logged and ignored, TREL peers are discovered by mDNS anyway.
+    mPeerSnapshot.Restore(aSnapshot);
+}
+
+void TrelDnssd::AddRestoredPeers(void)
+{
+    std::vector<PeerSnapshot::SavedPeer> restoredPeers = mPeerSnapshot.TakeRestoredPeers(mTrelNetif);
+    size_t                               numPeers      = 0;
+
+    VerifyOrExit(!restoredPeers.empty());
+
+    for (const PeerSnapshot::SavedPeer &restoredPeer : restoredPeers)
+    {
+        Peer               peer(restoredPeer.mTxtData, restoredPeer.mSockAddr);
+        otPlatTrelPeerInfo peerInfo;
+
+        if (!peer.mValid || mPeers.count(restoredPeer.mInstanceName) > 0)
+        {
+            continue;
+        }
+
+        peer.mRestored = true;
+
+        peerInfo.mRemoved   = false;
+        peerInfo.mSockAddr  = peer.mSockAddr;
+        peerInfo.mTxtData   = peer.mTxtData.data();
+        peerInfo.mTxtLength = peer.mTxtData.size();
+
+        otPlatTrelHandleDiscoveredPeerInfo(mNcp.GetInstance(), &peerInfo);
+
+        mPeers.emplace(restoredPeer.mInstanceName, peer);
+        CheckPeersNumLimit();
+        numPeers++;
+    }
+
+    otbrLogInfo("Added %zu TREL peers from snapshot, expecting mDNS to discover them within %u ms", numPeers,
+                PeerSnapshot::kRestoredPeerTimeoutMs);
+
+exit:
+    return;
+}
+
+void TrelDnssd::RemoveRestoredPeers(void)
+{
+    std::vector<std::string> instanceNames;
+
+    for (const auto &entry : mPeers)
+    {
+        if (entry.second.mRestored)
+        {
+            instanceNames.push_back(entry.first);
+        }
+    }
+
+    for (const std::string &instanceName : instanceNames)
+    {
+        otbrLogInfo("Peer %s from snapshot was not discovered again", instanceName.c_str());
+        OnTrelServiceInstanceRemoved(instanceName);
+    }
+}
+
 void TrelDnssd::RegisterInfo::Assign(uint16_t aPort, const uint8_t *aTxtData, uint8_t aTxtLength)
 {
     assert(!IsPublished());
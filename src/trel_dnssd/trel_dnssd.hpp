@@ -46,6 +46,8 @@
 #include "common/types.hpp"
 #include "mdns/mdns.hpp"
 #include "ncp/ncp_openthread.hpp"
+#include "trel_dnssd/peer_snapshot.hpp"
+#include "utils/snapshot.hpp"
 
 namespace otbr {
 
@@ -116,6 +118,28 @@ public:
      */
     void HandleMdnsState(Mdns::Publisher::State aState);
 
+    /**
+     * This method saves the TREL peers discovered by mDNS to a snapshot.
+     *
+     * The snapshot is left unchanged if TREL DNS-SD is not initialized.
+     *
+     * @param[in] aSnapshot  The snapshot to save to.
+     *
+     */
+    void SaveSnapshot(Utils::Snapshot &aSnapshot) const;
+
+    /**
+     * This method restores the TREL peers saved in a snapshot.
+     *
+     * The restored peers are reported to OpenThread as soon as TREL DNS-SD is ready, so TREL can reach them before
+     * mDNS discovers them again. A restored peer which is not discovered again within
+     * PeerSnapshot::kRestoredPeerTimeoutMs is removed. Peers saved for another TREL network interface are ignored.
+     *
+     * @param[in] aSnapshot  The snapshot to restore from.
+     *
+     */
+    void RestoreSnapshot(const Utils::Snapshot &aSnapshot);
+
 private:
     static constexpr size_t   kPeerCacheSize             = 256;
     static constexpr uint16_t kCheckNetifReadyIntervalMs = 5000;
@@ -152,7 +176,8 @@ private:
         std::vector<uint8_t> mTxtData;
         otSockAddr           mSockAddr;
         otExtAddress         mExtAddr;
-        bool                 mValid = false;
+        bool                 mValid    = false;
+        bool                 mRestored = false; ///< Restored from a snapshot and not discovered again yet.
     };
 
     using PeerMap = std::map<std::string, Peer>;
@@ -175,6 +200,8 @@ private:
     void     CheckPeersNumLimit(void);
     void     RemoveAllPeers(void);
     uint16_t CountDuplicatePeers(const Peer &aPeer);
+    void     AddRestoredPeers(void);
+    void     RemoveRestoredPeers(void);
 
     Mdns::Publisher           &mPublisher;
     Ncp::ControllerOpenThread &mNcp;
@@ -185,6 +212,7 @@ private:
     RegisterInfo               mRegisterInfo;
     PeerMap                    mPeers;
     bool                       mMdnsPublisherReady = false;
+    PeerSnapshot               mPeerSnapshot;
 };
 
 /**
@@ -35,30 +35,79 @@
 
 namespace otbr {
 
+namespace {
+
+template <size_t kSliceSize> struct Crc16Tables
+{
+    explicit Crc16Tables(uint16_t aPolynomial)
+    {
+        for (uint16_t byte = 0; byte < 256; byte++)
+        {
+            uint16_t crc = static_cast<uint16_t>(byte << 8);
+
+            for (uint8_t i = 0; i < 8; i++)
+            {
+                crc = (crc & 0x8000) ? static_cast<uint16_t>(crc << 1) ^ aPolynomial : static_cast<uint16_t>(crc << 1);
+            }
+
+            mTables[0][byte] = crc;
+        }
+
+        // `mTables[k][b]` is the CRC of byte `b` followed by `k` zero bytes.
+        for (size_t k = 1; k < kSliceSize; k++)
+        {
+            for (uint16_t byte = 0; byte < 256; byte++)
+            {
+                uint16_t prev = mTables[k - 1][byte];
+
+                mTables[k][byte] = static_cast<uint16_t>(prev << 8) ^ mTables[0][prev >> 8];
+            }
+        }
+    }
+
+    uint16_t mTables[kSliceSize][256];
+};
+
+} // namespace
+
+constexpr size_t Crc16::kSliceSize;
+
 Crc16::Crc16(Polynomial aPolynomial)
+    : mTables(&GetTables(aPolynomial))
 {
-    mPolynomial = static_cast<uint16_t>(aPolynomial);
     Init();
 }
 
-void Crc16::Update(uint8_t aByte)
+const Crc16::Tables &Crc16::GetTables(Polynomial aPolynomial)
 {
-    uint8_t i;
+    // Built once on first use, function-local statics are initialized thread-safely.
+    static const Crc16Tables<kSliceSize> sCcittTables(kCcitt);
+    static const Crc16Tables<kSliceSize> sAnsiTables(kAnsi);
 
-    mCrc = mCrc ^ static_cast<uint16_t>(aByte << 8);
-    i    = 8;
+    return aPolynomial == kCcitt ? sCcittTables.mTables : sAnsiTables.mTables;
+}
+
+void Crc16::Update(const uint8_t *aBytes, size_t aLength)
+{
+    const Tables &tables = *mTables;
 
-    do
+    for (; aLength >= kSliceSize; aLength -= kSliceSize, aBytes += kSliceSize)
     {
-        if (mCrc & 0x8000)
-        {
-            mCrc = static_cast<uint16_t>(mCrc << 1) ^ mPolynomial;
-        }
-        else
+        uint16_t crc =
+            tables[kSliceSize - 1][(mCrc >> 8) ^ aBytes[0]] ^ tables[kSliceSize - 2][(mCrc & 0xff) ^ aBytes[1]];
+
+        for (size_t i = 2; i < kSliceSize; i++)
         {
-            mCrc = static_cast<uint16_t>(mCrc << 1);
+            crc ^= tables[kSliceSize - 1 - i][aBytes[i]];
         }
-    } while (--i);
+
+        mCrc = crc;
+    }
+
+    while (aLength-- > 0)
+    {
+        Update(*aBytes++);
+    }
 }
 
 } // namespace otbr
@@ -38,10 +38,17 @@ namespace DnsUtils {
 
 std::string UnescapeInstanceName(const std::string &aName)
 {
-    std::string newName;
-    auto        nameLen = aName.length();
+    std::string newName(aName.length(), '\0');
 
-    newName.reserve(nameLen);
+    newName.resize(UnescapeInstanceName(aName, &newName[0]));
+
+    return newName;
+}
+
+size_t UnescapeInstanceName(const std::string &aName, char *aBuffer)
+{
+    size_t length  = 0;
+    auto   nameLen = aName.length();
 
     for (unsigned int i = 0; i < nameLen; i++)
     {
@@ -53,24 +60,24 @@ std::string UnescapeInstanceName(const std::string &aName)
             {
                 uint8_t b = (aName[i + 1] - '0') * 100 + (aName[i + 2] - '0') * 10 + (aName[i + 3] - '0');
 
-                newName.push_back(b);
+                aBuffer[length++] = static_cast<char>(b);
                 i += 3;
                 continue;
             }
 
             if (i + 1 < nameLen)
             {
-                newName.push_back(aName[i + 1]);
+                aBuffer[length++] = aName[i + 1];
                 i += 1;
                 continue;
             }
         }
 
         // append all not escaped characters
-        newName.push_back(c);
+        aBuffer[length++] = c;
     }
 
-    return newName;
+    return length;
 }
 
 void CheckHostnameSanity(const std::string &aHostName)
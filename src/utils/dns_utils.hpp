@@ -36,6 +36,8 @@
 
 #include "openthread-br/config.h"
 
+#include <stddef.h>
+
 #include <string>
 
 namespace otbr {
@@ -55,6 +57,20 @@ namespace DnsUtils {
  */
 std::string UnescapeInstanceName(const std::string &aName);
 
+/**
+ * This function unescapes a DNS Service Instance name into a caller-provided buffer.
+ *
+ * The unescaped name is never longer than the escaped one, so a buffer of `aName.length()` characters is always
+ * large enough. The unescaped name is not null-terminated.
+ *
+ * @param[in]  aName    The DNS Service Instance name to unescape.
+ * @param[out] aBuffer  A pointer to a buffer of at least `aName.length()` characters to receive the unescaped name.
+ *
+ * @returns  The length of the unescaped DNS Service Instance name.
+ *
+ */
+size_t UnescapeInstanceName(const std::string &aName, char *aBuffer);
+
 /**
  * This function checks a given host name for sanity.
  *
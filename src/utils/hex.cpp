@@ -35,58 +35,91 @@
 
 #include <string>
 
-#include <stdio.h>
 #include <string.h>
 
 namespace otbr {
 
 namespace Utils {
 
+namespace {
+
+constexpr char kUppercaseHexDigits[] = "0123456789ABCDEF";
+constexpr char kLowercaseHexDigits[] = "0123456789abcdef";
+
+// The value of each hexadecimal digit character, -1 for other characters.
+// clang-format off
+constexpr int8_t kHexDigitValues[256] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     0,  1,  2,  3,  4,  5,  6,  7,  8,  9, -1, -1, -1, -1, -1, -1,
+    -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+};
+// clang-format on
+
+inline int HexDigitValue(char aChar)
+{
+    return kHexDigitValues[static_cast<uint8_t>(aChar)];
+}
+
+char *EncodeHex(const uint8_t *aBytes, uint16_t aBytesLength, char *aHex, const char *aDigits)
+{
+    for (uint16_t i = 0; i < aBytesLength; i++)
+    {
+        *aHex++ = aDigits[aBytes[i] >> 4];
+        *aHex++ = aDigits[aBytes[i] & 0x0f];
+    }
+
+    return aHex;
+}
+
+} // namespace
+
 int Hex2Bytes(const char *aHex, uint8_t *aBytes, uint16_t aBytesLength)
 {
-    size_t      hexLength = strlen(aHex);
-    const char *hexEnd    = aHex + hexLength;
-    uint8_t    *cur       = aBytes;
-    uint8_t     numChars  = hexLength & 1;
-    uint8_t     byte      = 0;
+    size_t   hexLength = strlen(aHex);
+    uint8_t *cur       = aBytes;
 
     if ((hexLength + 1) / 2 > aBytesLength)
     {
         return -1;
     }
 
-    while (aHex < hexEnd)
+    // A string of an odd length starts with a single digit byte.
+    if (hexLength & 1)
     {
-        if ('A' <= *aHex && *aHex <= 'F')
-        {
-            byte |= 10 + (*aHex - 'A');
-        }
-        else if ('a' <= *aHex && *aHex <= 'f')
-        {
-            byte |= 10 + (*aHex - 'a');
-        }
-        else if ('0' <= *aHex && *aHex <= '9')
-        {
-            byte |= *aHex - '0';
-        }
-        else
+        int value = HexDigitValue(*aHex++);
+
+        if (value < 0)
         {
             return -1;
         }
 
-        aHex++;
-        numChars++;
+        *cur++ = static_cast<uint8_t>(value);
+    }
 
-        if (numChars >= 2)
-        {
-            numChars = 0;
-            *cur++   = byte;
-            byte     = 0;
-        }
-        else
+    for (; *aHex != '\0'; aHex += 2)
+    {
+        int high = HexDigitValue(aHex[0]);
+        int low  = HexDigitValue(aHex[1]);
+
+        if ((high | low) < 0)
         {
-            byte <<= 4;
+            return -1;
         }
+
+        *cur++ = static_cast<uint8_t>((high << 4) | low);
     }
 
     return static_cast<int>(cur - aBytes);
@@ -94,51 +127,41 @@ int Hex2Bytes(const char *aHex, uint8_t *aBytes, uint16_t aBytesLength)
 
 size_t Bytes2Hex(const uint8_t *aBytes, const uint16_t aBytesLength, char *aHex)
 {
-    char byteHex[3];
+    *EncodeHex(aBytes, aBytesLength, aHex, kUppercaseHexDigits) = '\0';
 
-    // Make sure strcat appends at the beginning of the output buffer even
-    // if uninitialized.
-    aHex[0] = '\0';
+    return 2 * static_cast<size_t>(aBytesLength);
+}
 
-    for (int i = 0; i < aBytesLength; i++)
-    {
-        snprintf(byteHex, sizeof(byteHex), "%02X", aBytes[i]);
-        strcat(aHex, byteHex);
-    }
+size_t Bytes2LowercaseHex(const uint8_t *aBytes, const uint16_t aBytesLength, char *aHex)
+{
+    *EncodeHex(aBytes, aBytesLength, aHex, kLowercaseHexDigits) = '\0';
 
-    return strlen(aHex);
+    return 2 * static_cast<size_t>(aBytesLength);
 }
 
 std::string Bytes2Hex(const uint8_t *aBytes, const uint16_t aBytesLength)
 {
-    char        hex[2 * aBytesLength + 1];
-    std::string s;
-    size_t      len;
+    std::string s(2 * static_cast<size_t>(aBytesLength), '\0');
 
-    len = Bytes2Hex(aBytes, aBytesLength, hex);
-    s   = std::string(hex, len);
+    if (aBytesLength > 0)
+    {
+        EncodeHex(aBytes, aBytesLength, &s[0], kUppercaseHexDigits);
+    }
 
     return s;
 }
 
 size_t Long2Hex(const uint64_t aLong, char *aHex)
 {
-    char     byteHex[3];
-    uint64_t longValue = aLong;
-
-    // Make sure strcat appends at the beginning of the output buffer even
-    // if uninitialized.
-    aHex[0] = '\0';
+    uint8_t bytes[sizeof(uint64_t)];
 
+    // The bytes are written from the least significant one.
     for (uint8_t i = 0; i < sizeof(uint64_t); i++)
     {
-        uint8_t byte = longValue & 0xff;
-        snprintf(byteHex, sizeof(byteHex), "%02X", byte);
-        strcat(aHex, byteHex);
-        longValue = longValue >> 8;
+        bytes[i] = static_cast<uint8_t>(aLong >> (8 * i));
     }
 
-    return strlen(aHex);
+    return Bytes2Hex(bytes, sizeof(bytes), aHex);
 }
 
 } // namespace Utils
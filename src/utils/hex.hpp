@@ -68,6 +68,18 @@ int Hex2Bytes(const char *aHex, uint8_t *aBytes, uint16_t aBytesLength);
  */
 size_t Bytes2Hex(const uint8_t *aBytes, const uint16_t aBytesLength, char *aHex);
 
+/**
+ * @brief Converts a byte array to a lowercase hexadecimal string.
+ *
+ * @param[in]  aBytes A pointer to the byte array to be converted.
+ * @param[in]  aBytesLength The length of the byte array.
+ * @param[out] aHex A character array to store the resulting hexadecimal string.
+ *                  Must be at least 2 * @param aBytesLength + 1 long.
+ *
+ * @return The length of the resulting hexadecimal string.
+ */
+size_t Bytes2LowercaseHex(const uint8_t *aBytes, const uint16_t aBytesLength, char *aHex);
+
 /**
  * @brief Converts a byte array to a hexadecimal string.
  *
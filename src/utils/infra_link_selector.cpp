@@ -39,6 +39,7 @@
 
 #include <linux/rtnetlink.h>
 #include <net/if.h>
+#include <string.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <unistd.h>
@@ -80,7 +81,11 @@ InfraLinkSelector::InfraLinkSelector(std::vector<const char *> aInfraLinkNames)
 
     for (const char *name : mInfraLinkNames)
     {
-        mInfraLinkInfos[name].Update(QueryInfraLinkState(name));
+        LinkInfo &linkInfo = mInfraLinkInfos[name];
+
+        // Later changes are tracked from netlink payloads, so the index lookup and the ioctl only happen once.
+        linkInfo.mIfIndex = if_nametoindex(name);
+        linkInfo.Update(QueryInfraLinkState(name));
     }
 }
 
@@ -111,6 +116,16 @@ const char *InfraLinkSelector::Select(void)
     return sel;
 }
 
+bool InfraLinkSelector::IsReselectPending(void) const
+{
+#if OTBR_ENABLE_VENDOR_INFRA_LINK_SELECT
+    // The vendor rules may depend on state this class doesn't track.
+    return true;
+#else
+    return mRequireReselect;
+#endif
+}
+
 const char *InfraLinkSelector::SelectGeneric(void)
 {
     const char                  *prevInfraLink         = mCurrentInfraLink;
@@ -220,7 +235,7 @@ InfraLinkSelector::LinkState InfraLinkSelector::QueryInfraLinkState(const char *
 
     VerifyOrExit(ioctl(sock, SIOCGIFFLAGS, &ifReq) != -1);
 
-    state = (ifReq.ifr_flags & IFF_UP) ? ((ifReq.ifr_flags & IFF_RUNNING) ? kUpAndRunning : kUp) : kDown;
+    state = LinkStateFromFlags(static_cast<uint16_t>(ifReq.ifr_flags));
 
 exit:
     if (sock != 0)
@@ -231,6 +246,11 @@ exit:
     return state;
 }
 
+InfraLinkSelector::LinkState InfraLinkSelector::LinkStateFromFlags(uint32_t aFlags)
+{
+    return (aFlags & IFF_UP) ? ((aFlags & IFF_RUNNING) ? kUpAndRunning : kUp) : kDown;
+}
+
 void InfraLinkSelector::Update(MainloopContext &aMainloop)
 {
     if (mNetlinkSocket != -1)
@@ -270,61 +290,97 @@ void InfraLinkSelector::ReceiveNetLinkMessage(void)
     for (struct nlmsghdr *header = &msgBuffer.mHeader; NLMSG_OK(header, static_cast<size_t>(len));
          header                  = NLMSG_NEXT(header, len))
     {
-        struct ifinfomsg *ifinfo;
-
-        switch (header->nlmsg_type)
-        {
-        case RTM_NEWLINK:
-        case RTM_DELLINK:
-            ifinfo = reinterpret_cast<struct ifinfomsg *>(NLMSG_DATA(header));
-            HandleInfraLinkStateChange(ifinfo->ifi_index);
-            break;
-        case NLMSG_ERROR:
-        {
-            struct nlmsgerr *errMsg = reinterpret_cast<struct nlmsgerr *>(NLMSG_DATA(header));
-
-            otbrLogWarning("netlink NLMSG_ERROR response: seq=%u, error=%d", header->nlmsg_seq, errMsg->error);
-            break;
-        }
-        default:
-            break;
-        }
+        HandleNetLinkMessage(*header);
     }
 
 exit:
     return;
 }
 
-void InfraLinkSelector::HandleInfraLinkStateChange(uint32_t aInfraLinkIndex)
+void InfraLinkSelector::HandleNetLinkMessage(const nlmsghdr &aHeader)
 {
-    const char *infraLinkName = nullptr;
-
-    for (const char *name : mInfraLinkNames)
+    switch (aHeader.nlmsg_type)
+    {
+    case RTM_NEWLINK:
+    case RTM_DELLINK:
     {
-        if (aInfraLinkIndex == if_nametoindex(name))
+        const struct ifinfomsg *ifinfo    = reinterpret_cast<const struct ifinfomsg *>(NLMSG_DATA(&aHeader));
+        const char             *ifname    = nullptr;
+        const char             *knownName = nullptr;
+        int                     attrLen;
+        uint32_t                ifIndex;
+        LinkState               state;
+
+        VerifyOrExit(aHeader.nlmsg_len >= NLMSG_LENGTH(sizeof(*ifinfo)));
+
+        attrLen = static_cast<int>(IFLA_PAYLOAD(&aHeader));
+        ifIndex = static_cast<uint32_t>(ifinfo->ifi_index);
+        state   = (aHeader.nlmsg_type == RTM_DELLINK) ? kInvalid : LinkStateFromFlags(ifinfo->ifi_flags);
+
+        for (const struct rtattr *attr = IFLA_RTA(ifinfo); RTA_OK(attr, attrLen); attr = RTA_NEXT(attr, attrLen))
         {
-            infraLinkName = name;
-            break;
+            if (attr->rta_type == IFLA_IFNAME)
+            {
+                ifname = reinterpret_cast<const char *>(RTA_DATA(attr));
+                break;
+            }
         }
-    }
 
-    VerifyOrExit(infraLinkName != nullptr);
+        for (const char *name : mInfraLinkNames)
+        {
+            if (mInfraLinkInfos[name].mIfIndex == ifIndex)
+            {
+                knownName = name;
+            }
+        }
 
-    {
-        LinkInfo &linkInfo  = mInfraLinkInfos[infraLinkName];
-        LinkState prevState = linkInfo.mState;
+        // The interface known by this index was renamed away from a candidate name.
+        if (knownName != nullptr && ifname != nullptr && strcmp(knownName, ifname) != 0)
+        {
+            HandleInfraLinkStateChange(knownName, 0, kInvalid);
+        }
 
-        if (linkInfo.Update(QueryInfraLinkState(infraLinkName)))
+        for (const char *name : mInfraLinkNames)
         {
-            otbrLogInfo("Infra link name %s index %lu state changed: %s -> %s", infraLinkName, aInfraLinkIndex,
-                        LinkStateToString(prevState), LinkStateToString(linkInfo.mState));
-            mRequireReselect = true;
+            if ((ifname != nullptr && strcmp(name, ifname) == 0) || (ifname == nullptr && name == knownName))
+            {
+                HandleInfraLinkStateChange(name, state == kInvalid ? 0 : ifIndex, state);
+                break;
+            }
         }
+        break;
     }
+    case NLMSG_ERROR:
+    {
+        const struct nlmsgerr *errMsg = reinterpret_cast<const struct nlmsgerr *>(NLMSG_DATA(&aHeader));
+
+        otbrLogWarning("netlink NLMSG_ERROR response: seq=%u, error=%d", aHeader.nlmsg_seq, errMsg->error);
+        break;
+    }
+    default:
+        break;
+    }
+
 exit:
     return;
 }
 
+void InfraLinkSelector::HandleInfraLinkStateChange(const char *aInfraLinkName, uint32_t aIfIndex, LinkState aState)
+{
+    LinkInfo &linkInfo  = mInfraLinkInfos[aInfraLinkName];
+    LinkState prevState = linkInfo.mState;
+
+    linkInfo.mIfIndex = aIfIndex;
+
+    if (linkInfo.Update(aState))
+    {
+        otbrLogInfo("Infra link name %s index %lu state changed: %s -> %s", aInfraLinkName,
+                    static_cast<unsigned long>(aIfIndex), LinkStateToString(prevState),
+                    LinkStateToString(linkInfo.mState));
+        mRequireReselect = true;
+    }
+}
+
 const char *InfraLinkSelector::LinkStateToString(LinkState aState)
 {
     const char *str = "";
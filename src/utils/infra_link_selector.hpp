@@ -39,6 +39,7 @@
 #if __linux__
 
 #include <assert.h>
+#include <linux/netlink.h>
 #include <map>
 #include <utility>
 #include <vector>
@@ -102,6 +103,14 @@ public:
      */
     const char *Select(void);
 
+    /**
+     * This method indicates whether `Select()` may return a different infrastructure link than last time.
+     *
+     * @returns  TRUE if a link state changed or a delayed recheck is due since the last selection, FALSE otherwise.
+     *
+     */
+    bool IsReselectPending(void) const;
+
 private:
     /**
      * This enumeration infrastructure link states.
@@ -118,7 +127,8 @@ private:
 
     struct LinkInfo
     {
-        LinkState         mState = kInvalid;
+        LinkState         mState   = kInvalid;
+        uint32_t          mIfIndex = 0;
         Clock::time_point mLastRunningTime;
         bool              mWasUpAndRunning = false;
 
@@ -132,10 +142,12 @@ private:
 
     static const char *LinkStateToString(LinkState aState);
     static LinkState   QueryInfraLinkState(const char *aInfraLinkName);
+    static LinkState   LinkStateFromFlags(uint32_t aFlags);
     void               Update(MainloopContext &aMainloop) override;
     void               Process(const MainloopContext &aMainloop) override;
     void               ReceiveNetLinkMessage(void);
-    void               HandleInfraLinkStateChange(uint32_t aInfraLinkIndex);
+    void               HandleNetLinkMessage(const nlmsghdr &aHeader);
+    void               HandleInfraLinkStateChange(const char *aInfraLinkName, uint32_t aIfIndex, LinkState aState);
 
     std::vector<const char *>        mInfraLinkNames;
     std::map<const char *, LinkInfo> mInfraLinkInfos;
@@ -33,6 +33,10 @@
 
 #include "utils/pskc.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 
@@ -81,17 +85,46 @@ exit:
 
 const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase)
 {
-    uint32_t blockCounter = 0;
-    uint16_t useLen       = 0;
-    uint16_t prfBlockLen  = MBEDTLS_CIPHER_BLKSIZE_MAX;
-    uint8_t  prfInput[OT_PBKDF2_SALT_MAX_LENGTH + 4];
-    uint8_t  prfOutput[MBEDTLS_CIPHER_BLKSIZE_MAX];
-    uint8_t  keyBlock[MBEDTLS_CIPHER_BLKSIZE_MAX];
-    uint16_t keyLen = OT_PSKC_LENGTH;
-    uint8_t *pskc   = mPskc;
+    static constexpr uint16_t kPrfKeyLen = 16;
+
+    const mbedtls_cipher_info_t *cipherInfo    = mbedtls_cipher_info_from_type(MBEDTLS_CIPHER_AES_128_ECB);
+    const uint8_t               *passphrase    = reinterpret_cast<const uint8_t *>(aPassphrase);
+    size_t                       passphraseLen = strlen(aPassphrase);
+    uint32_t                     blockCounter  = 0;
+    uint16_t                     useLen        = 0;
+    uint16_t                     prfBlockLen   = MBEDTLS_CIPHER_BLKSIZE_MAX;
+    uint8_t                      prfKey[kPrfKeyLen];
+    uint8_t                      prfInput[OT_PBKDF2_SALT_MAX_LENGTH + 4];
+    uint8_t                      prfOutput[MBEDTLS_CIPHER_BLKSIZE_MAX];
+    uint8_t                      keyBlock[MBEDTLS_CIPHER_BLKSIZE_MAX];
+    uint16_t                     keyLen = OT_PSKC_LENGTH;
+    uint8_t                     *pskc   = mPskc;
+    mbedtls_cipher_context_t     cmac;
+    int                          ret;
 
     SetSalt(aExtPanId, aNetworkName);
 
+    // AES-CMAC-PRF-128 (RFC 4615) first turns the passphrase into a 128-bit key. The key only depends on
+    // the passphrase, so derive it and set up the AES key schedule once instead of in each of the
+    // OT_ITERATION_COUNTS PRF calls, as `mbedtls_aes_cmac_prf_128()` would do.
+    if (passphraseLen == kPrfKeyLen)
+    {
+        memcpy(prfKey, passphrase, kPrfKeyLen);
+    }
+    else
+    {
+        const uint8_t zeroKey[kPrfKeyLen] = {0};
+
+        ret = mbedtls_cipher_cmac(cipherInfo, zeroKey, kPrfKeyLen * 8, passphrase, passphraseLen, prfKey);
+        SuccessOrDie(ret, "Failed to derive AES-CMAC-PRF-128 key");
+    }
+
+    mbedtls_cipher_init(&cmac);
+    ret = mbedtls_cipher_setup(&cmac, cipherInfo);
+    SuccessOrDie(ret, "Failed to set up AES-CMAC");
+    ret = mbedtls_cipher_cmac_starts(&cmac, prfKey, kPrfKeyLen * 8);
+    SuccessOrDie(ret, "Failed to set AES-CMAC key");
+
     while (keyLen)
     {
         memcpy(prfInput, mSalt, mSaltLen);
@@ -102,17 +135,16 @@ const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkN
         prfInput[mSaltLen + 2] = (uint8_t)(blockCounter >> 8);
         prfInput[mSaltLen + 3] = (uint8_t)(blockCounter);
         // Calculate U_1
-        mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), prfInput,
-                                 mSaltLen + 4, prfOutput);
+        mbedtls_cipher_cmac_update(&cmac, prfInput, mSaltLen + 4);
+        mbedtls_cipher_cmac_finish(&cmac, prfOutput);
         memcpy(keyBlock, prfOutput, prfBlockLen);
 
         for (uint32_t i = 1; i < OT_ITERATION_COUNTS; i++)
         {
-            memcpy(prfInput, prfOutput, prfBlockLen);
-
             // Calculate U_i
-            mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), prfInput,
-                                     prfBlockLen, prfOutput);
+            mbedtls_cipher_cmac_reset(&cmac);
+            mbedtls_cipher_cmac_update(&cmac, prfOutput, prfBlockLen);
+            mbedtls_cipher_cmac_finish(&cmac, prfOutput);
 
             // xor
             for (uint32_t j = 0; j < prfBlockLen; j++)
@@ -121,13 +153,55 @@ const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkN
             }
         }
 
+        mbedtls_cipher_cmac_reset(&cmac);
+
         useLen = (keyLen < prfBlockLen) ? keyLen : prfBlockLen;
         memcpy(pskc, keyBlock, useLen);
         pskc += useLen;
         keyLen -= useLen;
     }
+
+    mbedtls_cipher_free(&cmac);
+
     return mPskc;
 }
 
+void Pskc::ComputePskcs(const std::vector<Params> &aParams, std::vector<Value> &aPskcs, unsigned aNumThreads)
+{
+    std::atomic<size_t>      next(0);
+    std::vector<std::thread> threads;
+    auto                     worker = [&aParams, &aPskcs, &next]() {
+        Pskc computer;
+
+        for (size_t i = next++; i < aParams.size(); i = next++)
+        {
+            const Params  &params = aParams[i];
+            const uint8_t *pskc =
+                computer.ComputePskc(params.mExtPanId, params.mNetworkName.c_str(), params.mPassphrase.c_str());
+
+            std::copy(pskc, pskc + OT_PSKC_LENGTH, aPskcs[i].begin());
+        }
+    };
+
+    if (aNumThreads == 0)
+    {
+        aNumThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    aPskcs.resize(aParams.size());
+
+    for (unsigned i = 1; i < std::min<size_t>(aNumThreads, aParams.size()); i++)
+    {
+        threads.emplace_back(worker);
+    }
+
+    worker();
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+}
+
 } // namespace Psk
 } // namespace otbr
@@ -42,8 +42,11 @@
 #define OT_PBKDF2_SALT_MAX_LENGTH 30
 #define OT_PSKC_LENGTH 16
 
+#include <array>
 #include <stdint.h>
 #include <string.h>
+#include <string>
+#include <vector>
 
 #include <mbedtls/cmac.h>
 
@@ -59,6 +62,19 @@ enum
 class Pskc
 {
 public:
+    /**
+     * This structure represents the inputs of one PSKc computation.
+     *
+     */
+    struct Params
+    {
+        uint8_t     mExtPanId[OT_EXTENDED_PAN_ID_LENGTH]; ///< The extended PAN ID.
+        std::string mNetworkName;                         ///< The network name.
+        std::string mPassphrase;                          ///< The passphrase.
+    };
+
+    typedef std::array<uint8_t, OT_PSKC_LENGTH> Value; ///< A PSKc value.
+
     /**
      * This method computes the PSKc.
      *
@@ -71,6 +87,19 @@ public:
      */
     const uint8_t *ComputePskc(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase);
 
+    /**
+     * This method computes the PSKc of many networks.
+     *
+     * The work is spread over a pool of @p aNumThreads threads which pick up the next pending
+     * computation until all are done.
+     *
+     * @param[in]  aParams      The inputs of each PSKc computation.
+     * @param[out] aPskcs       The PSKc values, in the same order as @p aParams.
+     * @param[in]  aNumThreads  The number of threads to use, zero to use one thread per CPU core.
+     *
+     */
+    static void ComputePskcs(const std::vector<Params> &aParams, std::vector<Value> &aPskcs, unsigned aNumThreads);
+
 private:
     void SetSalt(const uint8_t *aExtPanId, const char *aNetworkName);
 
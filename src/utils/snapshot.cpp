@@ -0,0 +1,276 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the warm-restart snapshot of the agent state.
+ */
+
+#include "utils/snapshot.hpp"
+
+#include <algorithm>
+
+#include <assert.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "utils/crc16.hpp"
+
+namespace otbr {
+namespace Utils {
+
+constexpr uint32_t Snapshot::kMagic;
+constexpr uint8_t  Snapshot::kVersion;
+constexpr size_t   Snapshot::kHeaderSize;
+constexpr size_t   Snapshot::kMaxFileSize;
+
+void Snapshot::Writer::WriteUint16(uint16_t aValue)
+{
+    WriteUint8(static_cast<uint8_t>(aValue >> 8));
+    WriteUint8(static_cast<uint8_t>(aValue));
+}
+
+void Snapshot::Writer::WriteUint32(uint32_t aValue)
+{
+    WriteUint16(static_cast<uint16_t>(aValue >> 16));
+    WriteUint16(static_cast<uint16_t>(aValue));
+}
+
+otbrError Snapshot::Writer::WriteBytes(const uint8_t *aBytes, size_t aLength)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(aLength <= UINT16_MAX, error = OTBR_ERROR_INVALID_ARGS);
+    WriteUint16(static_cast<uint16_t>(aLength));
+    mData.insert(mData.end(), aBytes, aBytes + aLength);
+
+exit:
+    return error;
+}
+
+otbrError Snapshot::Writer::WriteString(const std::string &aString)
+{
+    return WriteBytes(reinterpret_cast<const uint8_t *>(aString.data()), aString.size());
+}
+
+otbrError Snapshot::Reader::Read(uint8_t *aBytes, size_t aLength)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(aLength <= mData.size() - mOffset, error = OTBR_ERROR_PARSE);
+    std::copy(mData.begin() + mOffset, mData.begin() + mOffset + aLength, aBytes);
+    mOffset += aLength;
+
+exit:
+    return error;
+}
+
+otbrError Snapshot::Reader::ReadUint8(uint8_t &aValue)
+{
+    return Read(&aValue, sizeof(aValue));
+}
+
+otbrError Snapshot::Reader::ReadUint16(uint16_t &aValue)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    uint8_t   bytes[sizeof(aValue)];
+
+    SuccessOrExit(error = Read(bytes, sizeof(bytes)));
+    aValue = static_cast<uint16_t>(bytes[0] << 8 | bytes[1]);
+
+exit:
+    return error;
+}
+
+otbrError Snapshot::Reader::ReadUint32(uint32_t &aValue)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    uint16_t  high;
+    uint16_t  low;
+
+    SuccessOrExit(error = ReadUint16(high));
+    SuccessOrExit(error = ReadUint16(low));
+    aValue = static_cast<uint32_t>(high) << 16 | low;
+
+exit:
+    return error;
+}
+
+otbrError Snapshot::Reader::ReadBytes(std::vector<uint8_t> &aBytes)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    uint16_t  length;
+
+    SuccessOrExit(error = ReadUint16(length));
+    VerifyOrExit(length <= mData.size() - mOffset, error = OTBR_ERROR_PARSE);
+    aBytes.resize(length);
+    error = Read(aBytes.data(), length);
+
+exit:
+    return error;
+}
+
+otbrError Snapshot::Reader::ReadString(std::string &aString)
+{
+    otbrError            error = OTBR_ERROR_NONE;
+    std::vector<uint8_t> bytes;
+
+    SuccessOrExit(error = ReadBytes(bytes));
+    aString.assign(bytes.begin(), bytes.end());
+
+exit:
+    return error;
+}
+
+void Snapshot::SetSection(SectionType aType, std::vector<uint8_t> aValue)
+{
+    mSections[aType] = std::move(aValue);
+}
+
+const std::vector<uint8_t> *Snapshot::GetSection(SectionType aType) const
+{
+    auto it = mSections.find(aType);
+
+    return it != mSections.end() ? &it->second : nullptr;
+}
+
+otbrError Snapshot::Load(const std::string &aPath)
+{
+    otbrError                               error = OTBR_ERROR_NONE;
+    FILE                                   *file  = fopen(aPath.c_str(), "rb");
+    std::vector<uint8_t>                    data;
+    uint8_t                                 buffer[1024];
+    size_t                                  length;
+    std::map<uint8_t, std::vector<uint8_t>> sections;
+    Crc16                                   crc16(Crc16::kCcitt);
+    uint32_t                                magic;
+    uint8_t                                 version;
+    uint16_t                                crc;
+    uint32_t                                payloadLength;
+
+    VerifyOrExit(file != nullptr, error = OTBR_ERROR_ERRNO);
+
+    while ((length = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    {
+        data.insert(data.end(), buffer, buffer + length);
+        VerifyOrExit(data.size() <= kMaxFileSize, error = OTBR_ERROR_PARSE);
+    }
+    VerifyOrExit(!ferror(file), error = OTBR_ERROR_ERRNO);
+
+    {
+        Reader reader(data);
+
+        SuccessOrExit(error = reader.ReadUint32(magic));
+        SuccessOrExit(error = reader.ReadUint8(version));
+        SuccessOrExit(error = reader.ReadUint16(crc));
+        SuccessOrExit(error = reader.ReadUint32(payloadLength));
+        VerifyOrExit(magic == kMagic && version == kVersion, error = OTBR_ERROR_PARSE);
+        VerifyOrExit(payloadLength == data.size() - kHeaderSize, error = OTBR_ERROR_PARSE);
+
+        crc16.Init();
+        crc16.Update(data.data() + kHeaderSize, payloadLength);
+        VerifyOrExit(crc16.Get() == crc, error = OTBR_ERROR_PARSE);
+
+        while (!reader.IsEnd())
+        {
+            uint8_t              type;
+            uint32_t             valueLength;
+            std::vector<uint8_t> value;
+
+            SuccessOrExit(error = reader.ReadUint8(type));
+            SuccessOrExit(error = reader.ReadUint32(valueLength));
+            VerifyOrExit(valueLength <= payloadLength, error = OTBR_ERROR_PARSE);
+            value.resize(valueLength);
+            SuccessOrExit(error = reader.Read(value.data(), valueLength));
+            sections[type] = std::move(value);
+        }
+    }
+
+    mSections = std::move(sections);
+
+exit:
+    if (file != nullptr)
+    {
+        fclose(file);
+    }
+    return error;
+}
+
+otbrError Snapshot::Save(const std::string &aPath) const
+{
+    otbrError   error   = OTBR_ERROR_NONE;
+    std::string tmpPath = aPath + ".tmp";
+    FILE       *file    = nullptr;
+    Writer      header;
+    Writer      payload;
+    Crc16       crc16(Crc16::kCcitt);
+    int         ret;
+
+    for (const auto &section : mSections)
+    {
+        payload.WriteUint8(section.first);
+        payload.WriteUint32(static_cast<uint32_t>(section.second.size()));
+        payload.GetData().insert(payload.GetData().end(), section.second.begin(), section.second.end());
+    }
+
+    crc16.Init();
+    crc16.Update(payload.GetData().data(), payload.GetData().size());
+
+    header.WriteUint32(kMagic);
+    header.WriteUint8(kVersion);
+    header.WriteUint16(crc16.Get());
+    header.WriteUint32(static_cast<uint32_t>(payload.GetData().size()));
+    assert(header.GetData().size() == kHeaderSize);
+
+    file = fopen(tmpPath.c_str(), "wb");
+    VerifyOrExit(file != nullptr, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(fwrite(header.GetData().data(), 1, kHeaderSize, file) == kHeaderSize, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(fwrite(payload.GetData().data(), 1, payload.GetData().size(), file) == payload.GetData().size(),
+                 error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(fflush(file) == 0 && fsync(fileno(file)) == 0, error = OTBR_ERROR_ERRNO);
+
+    ret  = fclose(file);
+    file = nullptr;
+    VerifyOrExit(ret == 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(rename(tmpPath.c_str(), aPath.c_str()) == 0, error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (file != nullptr)
+    {
+        fclose(file);
+    }
+    if (error != OTBR_ERROR_NONE)
+    {
+        unlink(tmpPath.c_str());
+    }
+    return error;
+}
+
+} // namespace Utils
+} // namespace otbr
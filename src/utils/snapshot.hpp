@@ -0,0 +1,211 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the warm-restart snapshot of the agent state.
+ */
+
+#ifndef OTBR_UTILS_SNAPSHOT_HPP_
+#define OTBR_UTILS_SNAPSHOT_HPP_
+
+#include "openthread-br/config.h"
+
+#include <map>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "common/types.hpp"
+
+namespace otbr {
+namespace Utils {
+
+/**
+ * This class implements a compact binary snapshot of the agent state which is kept across restarts.
+ *
+ * The snapshot consists of sections, each owned by one component. In the file, a header with a magic
+ * number, the format version, the payload length and the CRC16 of the payload is followed by the
+ * sections encoded as `type (1 byte) | length (4 bytes) | value`. Multi-byte integers are big-endian.
+ *
+ */
+class Snapshot
+{
+public:
+    /**
+     * This enumeration represents the section types.
+     *
+     */
+    enum SectionType : uint8_t
+    {
+        kSectionTrelPeers = 1, ///< The discovered TREL peers.
+    };
+
+    /**
+     * This class implements the encoder of a section value.
+     *
+     */
+    class Writer
+    {
+    public:
+        void WriteUint8(uint8_t aValue) { mData.push_back(aValue); }
+        void WriteUint16(uint16_t aValue);
+        void WriteUint32(uint32_t aValue);
+
+        /**
+         * This method writes a byte sequence prefixed by its 16-bit length.
+         *
+         * @param[in] aBytes   A pointer to the bytes.
+         * @param[in] aLength  The number of bytes.
+         *
+         * @retval OTBR_ERROR_NONE          Successfully wrote the bytes.
+         * @retval OTBR_ERROR_INVALID_ARGS  @p aLength is larger than UINT16_MAX, nothing is written.
+         *
+         */
+        otbrError WriteBytes(const uint8_t *aBytes, size_t aLength);
+        otbrError WriteString(const std::string &aString);
+
+        /**
+         * This method returns the encoded value.
+         *
+         * @returns The encoded value.
+         *
+         */
+        std::vector<uint8_t> &GetData(void) { return mData; }
+
+    private:
+        std::vector<uint8_t> mData;
+    };
+
+    /**
+     * This class implements the decoder of a section value.
+     *
+     * Each read method returns OTBR_ERROR_PARSE if the value is truncated.
+     *
+     */
+    class Reader
+    {
+    public:
+        explicit Reader(const std::vector<uint8_t> &aData)
+            : mData(aData)
+            , mOffset(0)
+        {
+        }
+
+        otbrError ReadUint8(uint8_t &aValue);
+        otbrError ReadUint16(uint16_t &aValue);
+        otbrError ReadUint32(uint32_t &aValue);
+        otbrError ReadBytes(std::vector<uint8_t> &aBytes);
+        otbrError ReadString(std::string &aString);
+
+        /**
+         * This method indicates whether the whole value has been read.
+         *
+         * @returns Whether the whole value has been read.
+         *
+         */
+        bool IsEnd(void) const { return mOffset == mData.size(); }
+
+        /**
+         * This method reads raw bytes.
+         *
+         * @param[out] aBytes   A pointer to the buffer to read to.
+         * @param[in]  aLength  The number of bytes to read.
+         *
+         * @retval OTBR_ERROR_NONE   Successfully read the bytes.
+         * @retval OTBR_ERROR_PARSE  Fewer than @p aLength bytes are left.
+         *
+         */
+        otbrError Read(uint8_t *aBytes, size_t aLength);
+
+    private:
+        const std::vector<uint8_t> &mData;
+        size_t                      mOffset;
+    };
+
+    /**
+     * This method sets the value of a section, replacing any previous value.
+     *
+     * @param[in] aType   The section type.
+     * @param[in] aValue  The section value.
+     *
+     */
+    void SetSection(SectionType aType, std::vector<uint8_t> aValue);
+
+    /**
+     * This method returns the value of a section.
+     *
+     * @param[in] aType  The section type.
+     *
+     * @returns A pointer to the section value, or nullptr if the snapshot does not include the section.
+     *
+     */
+    const std::vector<uint8_t> *GetSection(SectionType aType) const;
+
+    /**
+     * This method loads the snapshot from a file.
+     *
+     * Sections of unknown types are kept, so a snapshot written by a newer agent can be loaded.
+     *
+     * @param[in] aPath  The path of the snapshot file.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully loaded the snapshot.
+     * @retval OTBR_ERROR_ERRNO  Failed to read the file.
+     * @retval OTBR_ERROR_PARSE  The file is not a valid snapshot.
+     *
+     */
+    otbrError Load(const std::string &aPath);
+
+    /**
+     * This method saves the snapshot to a file.
+     *
+     * The snapshot is written to a temporary file first and then renamed, so a crash while saving
+     * never leaves a truncated snapshot behind. The temporary file is removed if saving fails.
+     *
+     * @param[in] aPath  The path of the snapshot file.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully saved the snapshot.
+     * @retval OTBR_ERROR_ERRNO  Failed to write the file.
+     *
+     */
+    otbrError Save(const std::string &aPath) const;
+
+private:
+    static constexpr uint32_t kMagic       = 0x4f544253; // "OTBS"
+    static constexpr uint8_t  kVersion     = 1;
+    static constexpr size_t   kHeaderSize  = 11;
+    static constexpr size_t   kMaxFileSize = 1024 * 1024;
+
+    std::map<uint8_t, std::vector<uint8_t>> mSections;
+};
+
+} // namespace Utils
+} // namespace otbr
+
+#endif // OTBR_UTILS_SNAPSHOT_HPP_
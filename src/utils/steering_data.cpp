@@ -28,13 +28,34 @@
 
 #include "utils/steering_data.hpp"
 
+#include <algorithm>
 #include <assert.h>
+#include <thread>
+
 #include <mbedtls/sha256.h>
 
 #include "utils/crc16.hpp"
 
 namespace otbr {
 
+namespace {
+
+constexpr size_t kSizeHashSha256Output = 32;
+
+void ComputeJoinerIdWithContext(mbedtls_sha256_context &aSha256, const uint8_t *aEui64, uint8_t *aJoinerId)
+{
+    uint8_t hash[kSizeHashSha256Output];
+
+    mbedtls_sha256_starts(&aSha256, 0);
+    mbedtls_sha256_update(&aSha256, aEui64, SteeringData::kSizeEui64);
+    mbedtls_sha256_finish(&aSha256, hash);
+
+    memcpy(aJoinerId, hash, SteeringData::kSizeJoinerId);
+    aJoinerId[0] |= 2;
+}
+
+} // namespace
+
 void SteeringData::Init(uint8_t aLength)
 {
     assert(aLength <= kMaxSizeOfBloomFilter);
@@ -44,20 +65,15 @@ void SteeringData::Init(uint8_t aLength)
     Clear();
 }
 
+constexpr size_t SteeringData::kMinJoinersPerThread;
+
 void SteeringData::ComputeJoinerId(const uint8_t *aEui64, uint8_t *aJoinerId)
 {
-    const size_t           kSizeHashSha256Output = 32;
-    const size_t           kSizeEui64            = 8;
-    uint8_t                hash[kSizeHashSha256Output];
     mbedtls_sha256_context sha256;
 
     mbedtls_sha256_init(&sha256);
-    mbedtls_sha256_starts(&sha256, 0);
-    mbedtls_sha256_update(&sha256, aEui64, kSizeEui64);
-    mbedtls_sha256_finish(&sha256, hash);
-
-    memcpy(aJoinerId, hash, kSizeJoinerId);
-    aJoinerId[0] |= 2;
+    ComputeJoinerIdWithContext(sha256, aEui64, aJoinerId);
+    mbedtls_sha256_free(&sha256);
 }
 
 void SteeringData::ComputeBloomFilter(const uint8_t *aJoinerId)
@@ -66,15 +82,63 @@ void SteeringData::ComputeBloomFilter(const uint8_t *aJoinerId)
     Crc16          ansi(Crc16::kAnsi);
     const uint16_t numBits = mLength * 8;
 
-    for (size_t i = 0; i < kSizeJoinerId; i++)
-    {
-        uint8_t byte = aJoinerId[i];
-        ccitt.Update(byte);
-        ansi.Update(byte);
-    }
+    ccitt.Update(aJoinerId, kSizeJoinerId);
+    ansi.Update(aJoinerId, kSizeJoinerId);
 
     SetBit(static_cast<uint8_t>(ccitt.Get() % numBits));
     SetBit(static_cast<uint8_t>(ansi.Get() % numBits));
 }
 
+void SteeringData::ComputeBloomFilter(const std::vector<Eui64> &aEui64s, unsigned aNumThreads)
+{
+    size_t numThreads = std::min<size_t>(std::max(aNumThreads, 1u), aEui64s.size() / kMinJoinersPerThread);
+
+    if (numThreads <= 1)
+    {
+        AddJoiners(aEui64s.data(), aEui64s.data() + aEui64s.size());
+    }
+    else
+    {
+        std::vector<SteeringData> partials(numThreads);
+        std::vector<std::thread>  threads;
+        size_t                    chunkSize = (aEui64s.size() + numThreads - 1) / numThreads;
+
+        for (size_t i = 0; i < numThreads; i++)
+        {
+            const Eui64 *begin = aEui64s.data() + std::min(i * chunkSize, aEui64s.size());
+            const Eui64 *end   = aEui64s.data() + std::min((i + 1) * chunkSize, aEui64s.size());
+
+            partials[i].Init(mLength);
+            threads.emplace_back([&partials, i, begin, end]() { partials[i].AddJoiners(begin, end); });
+        }
+
+        for (size_t i = 0; i < numThreads; i++)
+        {
+            threads[i].join();
+
+            for (uint8_t j = 0; j < mLength; j++)
+            {
+                mBloomFilter[j] |= partials[i].mBloomFilter[j];
+            }
+        }
+    }
+}
+
+void SteeringData::AddJoiners(const Eui64 *aBegin, const Eui64 *aEnd)
+{
+    mbedtls_sha256_context sha256;
+
+    mbedtls_sha256_init(&sha256);
+
+    for (const Eui64 *eui64 = aBegin; eui64 != aEnd; ++eui64)
+    {
+        uint8_t joinerId[kSizeJoinerId];
+
+        ComputeJoinerIdWithContext(sha256, eui64->data(), joinerId);
+        ComputeBloomFilter(joinerId);
+    }
+
+    mbedtls_sha256_free(&sha256);
+}
+
 } // namespace otbr
@@ -36,8 +36,10 @@
 
 #include "openthread-br/config.h"
 
+#include <array>
 #include <stdint.h>
 #include <string.h>
+#include <vector>
 
 namespace otbr {
 
@@ -52,8 +54,15 @@ public:
     {
         kMaxSizeOfBloomFilter = 16, ///< Max length of bloom filter in bytes.
         kSizeJoinerId         = 8,  ///< Size of Extended Joiner ID.
+        kSizeEui64            = 8,  ///< Size of a joiner EUI-64.
     };
 
+    /**
+     * This type represents a joiner EUI-64.
+     *
+     */
+    typedef std::array<uint8_t, kSizeEui64> Eui64;
+
     /**
      * This method initializes the bloom filter.
      *
@@ -90,6 +99,19 @@ public:
      */
     void ComputeBloomFilter(const uint8_t *aJoinerId);
 
+    /**
+     * This method adds a list of joiners, given by their EUI-64s, to the bloom filter.
+     *
+     * The joiner IDs are derived with a single SHA-256 context per worker. When @p aNumThreads is
+     * greater than one, the list is split between that many threads which each build a partial
+     * filter, and the partial filters are merged afterwards.
+     *
+     * @param[in] aEui64s      The joiner EUI-64s.
+     * @param[in] aNumThreads  The maximum number of threads to use.
+     *
+     */
+    void ComputeBloomFilter(const std::vector<Eui64> &aEui64s, unsigned aNumThreads = 1);
+
     /**
      * This method computes joiner id from EUI64.
      *
@@ -114,6 +136,10 @@ public:
     uint8_t GetLength(void) const { return mLength; }
 
 private:
+    static constexpr size_t kMinJoinersPerThread = 256;
+
+    void AddJoiners(const Eui64 *aBegin, const Eui64 *aEnd);
+
     uint8_t mBloomFilter[kMaxSizeOfBloomFilter];
     uint8_t mLength;
 };
@@ -0,0 +1,265 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the sampled telemetry ring buffer.
+ */
+
+#define OTBR_LOG_TAG "UTILS"
+
+#include "utils/telemetry_sampler.hpp"
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+
+#include <utility>
+
+#include <openthread/ip6.h>
+#include <openthread/link.h>
+#include <openthread/thread.h>
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+#include <openthread/srp_server.h>
+#endif
+#if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
+#include <openthread/dnssd_server.h>
+#endif
+
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace agent {
+
+constexpr size_t       TelemetrySampler::kCapacity;
+constexpr Milliseconds TelemetrySampler::kMinInterval;
+
+TelemetrySampler::TelemetrySampler(otInstance *aInstance)
+    : mInstance(aInstance)
+    , mInterval(0)
+    , mStartTime(Clock::now())
+    , mSampleTaskId(0)
+    , mOldest(0)
+    , mCount(0)
+    , mNextSequence(1)
+    , mLastChangedSequence(0)
+{
+}
+
+otbrError TelemetrySampler::SetInterval(Milliseconds aInterval)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    // A short interval would keep the mainloop busy sampling.
+    VerifyOrExit(aInterval.count() == 0 || aInterval >= kMinInterval, error = OTBR_ERROR_INVALID_ARGS);
+
+    CancelSample();
+
+    mInterval = aInterval;
+    otbrLogInfo("Telemetry sample interval: %lu ms", static_cast<unsigned long>(mInterval.count()));
+
+    if (mInterval.count() > 0)
+    {
+        ScheduleSample(mInterval);
+    }
+
+exit:
+    return error;
+}
+
+void TelemetrySampler::HandleSampleTimer(void)
+{
+    Sample &sample = mSamples[(mOldest + mCount) % kCapacity];
+
+    if (mCount == kCapacity)
+    {
+        mOldest = (mOldest + 1) % kCapacity;
+    }
+    else
+    {
+        mCount++;
+    }
+
+    sample.mSequence  = mNextSequence++;
+    sample.mTimestamp = static_cast<uint64_t>(
+        std::chrono::duration_cast<Milliseconds>(Now() - mStartTime).count());
+    ReadCounters(sample.mValues);
+
+    // The first sample counts as a change so that fresh readers always see data.
+    if (mCount == 1 || sample.mValues != mSamples[(mOldest + mCount - 2) % kCapacity].mValues)
+    {
+        mLastChangedSequence = sample.mSequence;
+    }
+
+    ScheduleSample(mInterval);
+}
+
+void TelemetrySampler::ScheduleSample(Milliseconds aDelay)
+{
+    CancelSample();
+    mSampleTaskId = mTaskRunner.Post(aDelay, [this]() {
+        mSampleTaskId = 0;
+        HandleSampleTimer();
+    });
+}
+
+void TelemetrySampler::CancelSample(void)
+{
+    if (mSampleTaskId != 0)
+    {
+        mTaskRunner.Cancel(mSampleTaskId);
+        mSampleTaskId = 0;
+    }
+}
+
+void TelemetrySampler::ReadCounters(Values &aValues) const
+{
+    const otMacCounters           *macCounters = otLinkGetCounters(mInstance);
+    const otIpCounters            *ipCounters  = otThreadGetIp6Counters(mInstance);
+    const otBorderRoutingCounters *brCounters  = otIp6GetBorderRoutingCounters(mInstance);
+
+    aValues.fill(0);
+
+    aValues[kMacTxTotal]      = macCounters->mTxTotal;
+    aValues[kMacRxTotal]      = macCounters->mRxTotal;
+    aValues[kMacTxUnicast]    = macCounters->mTxUnicast;
+    aValues[kMacRxUnicast]    = macCounters->mRxUnicast;
+    aValues[kMacTxBroadcast]  = macCounters->mTxBroadcast;
+    aValues[kMacRxBroadcast]  = macCounters->mRxBroadcast;
+    aValues[kMacTxRetry]      = macCounters->mTxRetry;
+    aValues[kMacTxErrCca]     = macCounters->mTxErrCca;
+    aValues[kMacTxErrAbort]   = macCounters->mTxErrAbort;
+    aValues[kMacRxErrNoFrame] = macCounters->mRxErrNoFrame;
+    aValues[kMacRxErrSec]     = macCounters->mRxErrSec;
+    aValues[kMacRxErrFcs]     = macCounters->mRxErrFcs;
+    aValues[kMacRxErrOther]   = macCounters->mRxErrOther;
+
+    aValues[kIp6TxSuccess] = ipCounters->mTxSuccess;
+    aValues[kIp6RxSuccess] = ipCounters->mRxSuccess;
+    aValues[kIp6TxFailure] = ipCounters->mTxFailure;
+    aValues[kIp6RxFailure] = ipCounters->mRxFailure;
+
+    aValues[kBrInboundUnicastPackets]    = brCounters->mInboundUnicast.mPackets;
+    aValues[kBrOutboundUnicastPackets]   = brCounters->mOutboundUnicast.mPackets;
+    aValues[kBrInboundMulticastPackets]  = brCounters->mInboundMulticast.mPackets;
+    aValues[kBrOutboundMulticastPackets] = brCounters->mOutboundMulticast.mPackets;
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    {
+        const otSrpServerResponseCounters *srpCounters = otSrpServerGetResponseCounters(mInstance);
+
+        aValues[kSrpResponseSuccess] = srpCounters->mSuccess;
+        aValues[kSrpResponseFailure] = srpCounters->mServerFailure + srpCounters->mFormatError +
+                                       srpCounters->mNameExists + srpCounters->mRefused + srpCounters->mOther;
+    }
+#endif
+
+#if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
+    {
+        const otDnssdCounters *dnssdCounters = otDnssdGetCounters(mInstance);
+
+        aValues[kDnssdResponseSuccess] = dnssdCounters->mSuccessResponse;
+        aValues[kDnssdResponseFailure] = dnssdCounters->mServerFailureResponse + dnssdCounters->mFormatErrorResponse +
+                                         dnssdCounters->mNameErrorResponse + dnssdCounters->mNotImplementedResponse +
+                                         dnssdCounters->mOtherResponse;
+    }
+#endif
+}
+
+void TelemetrySampler::GetDeltaSeries(uint64_t aSinceSequence, std::vector<DeltaSample> &aSeries) const
+{
+    const Values *previous = nullptr;
+
+    aSeries.clear();
+
+    for (size_t i = 0; i < mCount; i++)
+    {
+        const Sample &sample = mSamples[(mOldest + i) % kCapacity];
+        DeltaSample   delta;
+
+        if (sample.mSequence <= aSinceSequence)
+        {
+            continue;
+        }
+
+        delta.mSequence  = sample.mSequence;
+        delta.mTimestamp = sample.mTimestamp;
+        delta.mValues.resize(kNumCounters);
+
+        for (size_t counter = 0; counter < kNumCounters; counter++)
+        {
+            delta.mValues[counter] = static_cast<int64_t>(sample.mValues[counter]);
+
+            if (previous != nullptr)
+            {
+                delta.mValues[counter] -= static_cast<int64_t>((*previous)[counter]);
+            }
+        }
+
+        aSeries.push_back(std::move(delta));
+        previous = &sample.mValues;
+    }
+}
+
+const char *TelemetrySampler::CounterToString(Counter aCounter)
+{
+    static const char *const kCounterNames[] = {
+        "mac_tx_total",                  // kMacTxTotal
+        "mac_rx_total",                  // kMacRxTotal
+        "mac_tx_unicast",                // kMacTxUnicast
+        "mac_rx_unicast",                // kMacRxUnicast
+        "mac_tx_broadcast",              // kMacTxBroadcast
+        "mac_rx_broadcast",              // kMacRxBroadcast
+        "mac_tx_retry",                  // kMacTxRetry
+        "mac_tx_err_cca",                // kMacTxErrCca
+        "mac_tx_err_abort",              // kMacTxErrAbort
+        "mac_rx_err_no_frame",           // kMacRxErrNoFrame
+        "mac_rx_err_sec",                // kMacRxErrSec
+        "mac_rx_err_fcs",                // kMacRxErrFcs
+        "mac_rx_err_other",              // kMacRxErrOther
+        "ip6_tx_success",                // kIp6TxSuccess
+        "ip6_rx_success",                // kIp6RxSuccess
+        "ip6_tx_failure",                // kIp6TxFailure
+        "ip6_rx_failure",                // kIp6RxFailure
+        "br_inbound_unicast_packets",    // kBrInboundUnicastPackets
+        "br_outbound_unicast_packets",   // kBrOutboundUnicastPackets
+        "br_inbound_multicast_packets",  // kBrInboundMulticastPackets
+        "br_outbound_multicast_packets", // kBrOutboundMulticastPackets
+        "srp_response_success",          // kSrpResponseSuccess
+        "srp_response_failure",          // kSrpResponseFailure
+        "dnssd_response_success",        // kDnssdResponseSuccess
+        "dnssd_response_failure",        // kDnssdResponseFailure
+    };
+
+    static_assert(sizeof(kCounterNames) / sizeof(kCounterNames[0]) == kNumCounters, "Missing counter names");
+
+    return aCounter < kNumCounters ? kCounterNames[aCounter] : "unknown";
+}
+
+} // namespace agent
+} // namespace otbr
+
+#endif // OTBR_ENABLE_TELEMETRY_DATA_API
@@ -0,0 +1,248 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the sampled telemetry ring buffer.
+ */
+
+#ifndef OTBR_UTILS_TELEMETRY_SAMPLER_HPP_
+#define OTBR_UTILS_TELEMETRY_SAMPLER_HPP_
+
+#include "openthread-br/config.h"
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+
+#include <array>
+#include <stdint.h>
+#include <vector>
+
+#include <openthread/instance.h>
+
+#include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+namespace agent {
+
+/**
+ * This class periodically samples a selected set of OpenThread counters into a fixed-size ring buffer.
+ *
+ * Sampling runs on the mainloop and reads the counters directly, so a sample costs a handful of
+ * OpenThread getters instead of a full `TelemetryData` snapshot.
+ *
+ */
+class TelemetrySampler : private NonCopyable
+{
+public:
+    /**
+     * This enumeration represents the sampled counters.
+     *
+     */
+    enum Counter : uint8_t
+    {
+        kMacTxTotal,
+        kMacRxTotal,
+        kMacTxUnicast,
+        kMacRxUnicast,
+        kMacTxBroadcast,
+        kMacRxBroadcast,
+        kMacTxRetry,
+        kMacTxErrCca,
+        kMacTxErrAbort,
+        kMacRxErrNoFrame,
+        kMacRxErrSec,
+        kMacRxErrFcs,
+        kMacRxErrOther,
+        kIp6TxSuccess,
+        kIp6RxSuccess,
+        kIp6TxFailure,
+        kIp6RxFailure,
+        kBrInboundUnicastPackets,
+        kBrOutboundUnicastPackets,
+        kBrInboundMulticastPackets,
+        kBrOutboundMulticastPackets,
+        kSrpResponseSuccess,
+        kSrpResponseFailure,
+        kDnssdResponseSuccess,
+        kDnssdResponseFailure,
+        kNumCounters, ///< The number of sampled counters.
+    };
+
+    static constexpr size_t       kCapacity    = 128; ///< The maximum number of samples kept in the ring buffer.
+    static constexpr Milliseconds kMinInterval = Milliseconds(1000); ///< The minimum sampling interval.
+
+    /**
+     * This structure represents one entry of a delta-encoded series.
+     *
+     */
+    struct DeltaSample
+    {
+        uint64_t             mSequence;  ///< The sequence number of the sample.
+        uint64_t             mTimestamp; ///< The sample time, in milliseconds since the sampler was created.
+        std::vector<int64_t> mValues;    ///< Absolute values for the first entry, deltas for the following ones.
+    };
+
+    /**
+     * This constructor initializes the sampler. Sampling is disabled until an interval is set.
+     *
+     * @param[in] aInstance  The OpenThread instance.
+     *
+     */
+    explicit TelemetrySampler(otInstance *aInstance);
+
+    virtual ~TelemetrySampler(void) = default;
+
+    /**
+     * This method sets the sampling interval and restarts sampling.
+     *
+     * @param[in] aInterval  The sampling interval, zero to stop sampling.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully set the interval.
+     * @retval OTBR_ERROR_INVALID_ARGS  @p aInterval is neither zero nor at least kMinInterval.
+     *
+     */
+    otbrError SetInterval(Milliseconds aInterval);
+
+    /**
+     * This method returns the sampling interval.
+     *
+     * @returns The sampling interval, zero if sampling is stopped.
+     *
+     */
+    Milliseconds GetInterval(void) const { return mInterval; }
+
+    /**
+     * This method returns the sequence number of the latest sample.
+     *
+     * @returns The latest sequence number, zero if nothing has been sampled.
+     *
+     */
+    uint64_t GetLatestSequence(void) const { return mNextSequence - 1; }
+
+    /**
+     * This method tells whether any sampled counter has changed after a given sample.
+     *
+     * This is a constant-time check which never walks the ring buffer.
+     *
+     * @param[in] aSequence  The sequence number last seen by the caller.
+     *
+     * @returns TRUE if a sample newer than @p aSequence carries a changed value, FALSE otherwise.
+     *
+     */
+    bool HasChangedSince(uint64_t aSequence) const { return mLastChangedSequence > aSequence; }
+
+    /**
+     * This method returns the buffered samples newer than a given sample as a delta-encoded series.
+     *
+     * The first entry carries absolute counter values and every following entry carries the
+     * difference to its predecessor. Deltas may be negative if the counters were reset.
+     *
+     * @param[in]  aSinceSequence  Only samples with a larger sequence number are returned.
+     * @param[out] aSeries         The delta-encoded series.
+     *
+     */
+    void GetDeltaSeries(uint64_t aSinceSequence, std::vector<DeltaSample> &aSeries) const;
+
+    /**
+     * This method returns the name of a sampled counter.
+     *
+     * @param[in] aCounter  The counter.
+     *
+     * @returns The counter name.
+     *
+     */
+    static const char *CounterToString(Counter aCounter);
+
+protected:
+    using Values = std::array<uint64_t, kNumCounters>;
+
+    /**
+     * This method reads the current values of the sampled counters.
+     *
+     * @param[out] aValues  The counter values.
+     *
+     */
+    virtual void ReadCounters(Values &aValues) const;
+
+    /**
+     * This method returns the current time.
+     *
+     * @returns The current time.
+     *
+     */
+    virtual Timepoint Now(void) const { return Clock::now(); }
+
+    /**
+     * This method schedules `HandleSampleTimer()` after a delay, replacing any pending sample.
+     *
+     * @param[in] aDelay  The delay.
+     *
+     */
+    virtual void ScheduleSample(Milliseconds aDelay);
+
+    /**
+     * This method cancels the pending sample, if any.
+     *
+     */
+    virtual void CancelSample(void);
+
+    /**
+     * This method takes a sample and schedules the next one.
+     *
+     */
+    void HandleSampleTimer(void);
+
+private:
+    struct Sample
+    {
+        uint64_t mSequence;
+        uint64_t mTimestamp;
+        Values   mValues;
+    };
+
+    otInstance        *mInstance;
+    Milliseconds       mInterval;
+    Timepoint          mStartTime;
+    TaskRunner         mTaskRunner;
+    TaskRunner::TaskId mSampleTaskId;
+
+    std::array<Sample, kCapacity> mSamples;
+    size_t                        mOldest;
+    size_t                        mCount;
+    uint64_t                      mNextSequence;
+    uint64_t                      mLastChangedSequence;
+};
+
+} // namespace agent
+} // namespace otbr
+
+#endif // OTBR_ENABLE_TELEMETRY_DATA_API
+
+#endif // OTBR_UTILS_TELEMETRY_SAMPLER_HPP_
@@ -30,6 +30,7 @@
 
 #include "utils/thread_helper.hpp"
 
+#include <algorithm>
 #include <assert.h>
 #include <limits.h>
 #include <string.h>
@@ -224,12 +225,50 @@ void CopyMdnsResponseCounters(const MdnsResponseCounters &from, threadnetwork::T
     to->set_aborted_count(from.mAborted);
     to->set_invalid_state_count(from.mInvalidState);
 }
+
+struct TelemetrySectionName
+{
+    ThreadHelper::TelemetrySection mSection;
+    const char                    *mName;
+};
+
+// The sections are named after their `TelemetryData` fields, and listed in the order of their bits.
+const TelemetrySectionName kTelemetrySectionNames[] = {
+    {ThreadHelper::kTelemetrySectionWpanStats, "wpan_stats"},
+    {ThreadHelper::kTelemetrySectionWpanTopoFull, "wpan_topo_full"},
+    {ThreadHelper::kTelemetrySectionTopoEntries, "topo_entries"},
+    {ThreadHelper::kTelemetrySectionWpanBorderRouter, "wpan_border_router"},
+    {ThreadHelper::kTelemetrySectionWpanRcp, "wpan_rcp"},
+    {ThreadHelper::kTelemetrySectionCoexMetrics, "coex_metrics"},
+    {ThreadHelper::kTelemetrySectionLowPowerMetrics, "low_power_metrics"},
+};
+
+static_assert(sizeof(kTelemetrySectionNames) / sizeof(kTelemetrySectionNames[0]) ==
+                  ThreadHelper::kNumTelemetrySections,
+              "kTelemetrySectionNames doesn't list all telemetry sections");
+
+uint8_t TelemetrySectionToIndex(ThreadHelper::TelemetrySection aSection)
+{
+    uint8_t index = 0;
+
+    while (index + 1 < ThreadHelper::kNumTelemetrySections && kTelemetrySectionNames[index].mSection != aSection)
+    {
+        index++;
+    }
+
+    return index;
+}
 #endif // OTBR_ENABLE_TELEMETRY_DATA_API
 } // namespace
 
+constexpr Milliseconds ThreadHelper::kDefaultScanCacheMaxAge;
+
 ThreadHelper::ThreadHelper(otInstance *aInstance, otbr::Ncp::ControllerOpenThread *aNcp)
     : mInstance(aInstance)
     , mNcp(aNcp)
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    , mTelemetrySampler(aInstance)
+#endif
 {
 #if OTBR_ENABLE_TELEMETRY_DATA_API && (OTBR_ENABLE_NAT64 || OTBR_ENABLE_DHCP6_PD)
     otError error;
@@ -352,20 +391,34 @@ void ThreadHelper::Scan(ScanHandler aHandler)
     otError error = OT_ERROR_NONE;
 
     VerifyOrExit(aHandler != nullptr);
-    mScanHandler = aHandler;
+
+    if (!mScanHandlers.empty())
+    {
+        mScanStats.mCoalescedRequests++;
+        mScanHandlers.push_back(std::move(aHandler));
+        ExitNow();
+    }
+
+    if (mScanResultsValid && Clock::now() - mScanEndTime <= mScanCacheMaxAge)
+    {
+        mScanStats.mCachedResponses++;
+        aHandler(OT_ERROR_NONE, mScanResults);
+        ExitNow();
+    }
+
     mScanResults.clear();
+    mScanResultsValid = false;
 
-    error =
-        otLinkActiveScan(mInstance, /*scanChannels =*/0, /*scanDuration=*/0, &ThreadHelper::ActiveScanHandler, this);
+    SuccessOrExit(error = otLinkActiveScan(mInstance, /*scanChannels =*/0, /*scanDuration=*/0,
+                                           &ThreadHelper::ActiveScanHandler, this));
+    mScanStats.mActiveScans++;
+    mScanStartTime = Clock::now();
+    mScanHandlers.push_back(std::move(aHandler));
 
 exit:
     if (error != OT_ERROR_NONE)
     {
-        if (aHandler)
-        {
-            mScanHandler(error, {});
-        }
-        mScanHandler = nullptr;
+        aHandler(error, {});
     }
 }
 
@@ -376,20 +429,41 @@ void ThreadHelper::EnergyScan(uint32_t aScanDuration, EnergyScanHandler aHandler
 
     VerifyOrExit(aHandler != nullptr, error = OT_ERROR_BUSY);
     VerifyOrExit(aScanDuration < UINT16_MAX, error = OT_ERROR_INVALID_ARGS);
-    mEnergyScanHandler = aHandler;
+
+    if (!mEnergyScanHandlers.empty())
+    {
+        // The energy scan in progress can't be extended to a longer duration.
+        VerifyOrExit(aScanDuration <= mEnergyScanDuration, error = OT_ERROR_BUSY);
+        mScanStats.mCoalescedRequests++;
+        mEnergyScanHandlers.push_back(std::move(aHandler));
+        ExitNow();
+    }
+
+    if (mEnergyScanResultsValid && aScanDuration <= mEnergyScanDuration &&
+        Clock::now() - mEnergyScanEndTime <= mScanCacheMaxAge)
+    {
+        mScanStats.mCachedResponses++;
+        aHandler(OT_ERROR_NONE, mEnergyScanResults);
+        ExitNow();
+    }
+
     mEnergyScanResults.clear();
+    mEnergyScanResultsValid = false;
 
-    error = otLinkEnergyScan(mInstance, preferredChannels, static_cast<uint16_t>(aScanDuration),
-                             &ThreadHelper::EnergyScanCallback, this);
+    SuccessOrExit(error = otLinkEnergyScan(mInstance, preferredChannels, static_cast<uint16_t>(aScanDuration),
+                                           &ThreadHelper::EnergyScanCallback, this));
+    mScanStats.mEnergyScans++;
+    mEnergyScanDuration  = static_cast<uint16_t>(aScanDuration);
+    mEnergyScanStartTime = Clock::now();
+    mEnergyScanHandlers.push_back(std::move(aHandler));
 
 exit:
     if (error != OT_ERROR_NONE)
     {
         if (aHandler)
         {
-            mEnergyScanHandler(error, {});
+            aHandler(error, {});
         }
-        mEnergyScanHandler = nullptr;
     }
 }
 
@@ -415,9 +489,18 @@ void ThreadHelper::ActiveScanHandler(otActiveScanResult *aResult)
 {
     if (aResult == nullptr)
     {
-        if (mScanHandler != nullptr)
+        // Handlers may start another scan, which changes the members.
+        std::vector<ScanHandler>        handlers;
+        std::vector<otActiveScanResult> results = mScanResults;
+
+        mScanEndTime      = Clock::now();
+        mScanResultsValid = true;
+        mScanStats.mScanTime += std::chrono::duration_cast<Milliseconds>(mScanEndTime - mScanStartTime).count();
+        handlers.swap(mScanHandlers);
+
+        for (const ScanHandler &handler : handlers)
         {
-            mScanHandler(OT_ERROR_NONE, mScanResults);
+            handler(OT_ERROR_NONE, results);
         }
     }
     else
@@ -437,9 +520,19 @@ void ThreadHelper::EnergyScanCallback(otEnergyScanResult *aResult)
 {
     if (aResult == nullptr)
     {
-        if (mEnergyScanHandler != nullptr)
+        // Handlers may start another scan, which changes the members.
+        std::vector<EnergyScanHandler>  handlers;
+        std::vector<otEnergyScanResult> results = mEnergyScanResults;
+
+        mEnergyScanEndTime      = Clock::now();
+        mEnergyScanResultsValid = true;
+        mScanStats.mScanTime +=
+            std::chrono::duration_cast<Milliseconds>(mEnergyScanEndTime - mEnergyScanStartTime).count();
+        handlers.swap(mEnergyScanHandlers);
+
+        for (const EnergyScanHandler &handler : handlers)
         {
-            mEnergyScanHandler(OT_ERROR_NONE, mEnergyScanResults);
+            handler(OT_ERROR_NONE, results);
         }
     }
     else
@@ -920,13 +1013,154 @@ void ThreadHelper::DetachGracefullyCallback(void)
 }
 
 #if OTBR_ENABLE_TELEMETRY_DATA_API
-otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadnetwork::TelemetryData &telemetryData)
+otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher              *aPublisher,
+                                            threadnetwork::TelemetryData &telemetryData,
+                                            uint32_t                      aSections)
 {
-    otError                     error = OT_ERROR_NONE;
+    static constexpr uint32_t kSectionsUsingTables =
+        kTelemetrySectionWpanTopoFull | kTelemetrySectionTopoEntries | kTelemetrySectionLowPowerMetrics;
+
+    otError                     error        = OT_ERROR_NONE;
+    bool                        tablesLoaded = false;
     std::vector<otNeighborInfo> neighborTable;
+    std::vector<otChildInfo>    childTable;
+
+    for (uint8_t index = 0; index < kNumTelemetrySections; index++)
+    {
+        uint32_t  section      = 1u << index;
+        otError   sectionError = OT_ERROR_NONE;
+        Timepoint start        = Clock::now();
+
+        if (!(aSections & section))
+        {
+            continue;
+        }
+
+        // The tables are read once, and the read is accounted to the first section using them.
+        if ((section & kSectionsUsingTables) && !tablesLoaded)
+        {
+            ReadNeighborAndChildTables(neighborTable, childTable);
+            tablesLoaded = true;
+        }
+
+        switch (section)
+        {
+        case kTelemetrySectionWpanStats:
+            sectionError = RetrieveWpanStats(telemetryData);
+            break;
+        case kTelemetrySectionWpanTopoFull:
+            sectionError = RetrieveWpanTopoFull(telemetryData, neighborTable, childTable);
+            break;
+        case kTelemetrySectionTopoEntries:
+            RetrieveTopoEntries(telemetryData, neighborTable, childTable);
+            break;
+        case kTelemetrySectionWpanBorderRouter:
+            RetrieveWpanBorderRouter(aPublisher, telemetryData);
+            break;
+        case kTelemetrySectionWpanRcp:
+            RetrieveWpanRcp(telemetryData);
+            break;
+        case kTelemetrySectionCoexMetrics:
+            sectionError = RetrieveCoexMetrics(telemetryData);
+            break;
+        case kTelemetrySectionLowPowerMetrics:
+#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+            RetrieveLowPowerMetrics(telemetryData, neighborTable);
+#endif
+            break;
+        }
+
+        if (sectionError != OT_ERROR_NONE)
+        {
+            error = OT_ERROR_FAILED;
+        }
 
-    // Begin of WpanStats section.
-    auto wpanStats = telemetryData.mutable_wpan_stats();
+        UpdateTelemetrySectionStats(index, std::chrono::duration_cast<Microseconds>(Clock::now() - start));
+    }
+
+    return error;
+}
+
+void ThreadHelper::ReadNeighborAndChildTables(std::vector<otNeighborInfo> &aNeighborTable,
+                                              std::vector<otChildInfo>    &aChildTable)
+{
+    otNeighborInfoIterator iter = OT_NEIGHBOR_INFO_ITERATOR_INIT;
+    otNeighborInfo         neighborInfo;
+    uint16_t               childIndex = 0;
+    otChildInfo            childInfo;
+
+    while (otThreadGetNextNeighborInfo(mInstance, &iter, &neighborInfo) == OT_ERROR_NONE)
+    {
+        aNeighborTable.push_back(neighborInfo);
+    }
+
+    while (otThreadGetChildInfoByIndex(mInstance, childIndex, &childInfo) == OT_ERROR_NONE)
+    {
+        aChildTable.push_back(childInfo);
+        childIndex++;
+    }
+}
+
+void ThreadHelper::UpdateTelemetrySectionStats(uint8_t aIndex, Microseconds aDuration)
+{
+    TelemetrySectionStats &stats    = mTelemetrySectionStats[aIndex];
+    uint64_t               duration = static_cast<uint64_t>(aDuration.count());
+
+    stats.mRetrievals++;
+    stats.mTotalDurationUs += duration;
+    stats.mMaxDurationUs = std::max(stats.mMaxDurationUs, duration);
+}
+
+const ThreadHelper::TelemetrySectionStats &ThreadHelper::GetTelemetrySectionStats(TelemetrySection aSection) const
+{
+    return mTelemetrySectionStats[TelemetrySectionToIndex(aSection)];
+}
+
+const char *ThreadHelper::TelemetrySectionToString(TelemetrySection aSection)
+{
+    return kTelemetrySectionNames[TelemetrySectionToIndex(aSection)].mName;
+}
+
+otError ThreadHelper::ParseTelemetrySections(const std::string &aNames, uint32_t &aSections)
+{
+    otError error = OT_ERROR_NONE;
+    size_t  begin = 0;
+
+    aSections = 0;
+
+    while (begin <= aNames.size())
+    {
+        size_t end   = aNames.find(',', begin);
+        bool   found = false;
+
+        if (end == std::string::npos)
+        {
+            end = aNames.size();
+        }
+
+        for (const auto &entry : kTelemetrySectionNames)
+        {
+            if (aNames.compare(begin, end - begin, entry.mName) == 0)
+            {
+                aSections |= entry.mSection;
+                found = true;
+                break;
+            }
+        }
+
+        VerifyOrExit(found, error = OT_ERROR_INVALID_ARGS);
+        begin = end + 1;
+    }
+
+exit:
+    return error;
+}
+
+otError ThreadHelper::RetrieveWpanStats(threadnetwork::TelemetryData &aTelemetryData)
+{
+    otError error = OT_ERROR_NONE;
+
+    auto wpanStats = aTelemetryData.mutable_wpan_stats();
 
     {
         otDeviceRole     role  = otThreadGetDeviceRole(mInstance);
@@ -998,603 +1232,596 @@ otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadn
         wpanStats->set_ip_tx_failure(ipCounters->mTxFailure);
         wpanStats->set_ip_rx_failure(ipCounters->mRxFailure);
     }
-    // End of WpanStats section.
 
-    {
-        // Begin of WpanTopoFull section.
-        auto     wpanTopoFull = telemetryData.mutable_wpan_topo_full();
-        uint16_t rloc16       = otThreadGetRloc16(mInstance);
+    return error;
+}
 
-        wpanTopoFull->set_rloc16(rloc16);
+otError ThreadHelper::RetrieveWpanTopoFull(threadnetwork::TelemetryData      &aTelemetryData,
+                                           const std::vector<otNeighborInfo> &aNeighborTable,
+                                           const std::vector<otChildInfo>    &aChildTable)
+{
+    otError error = OT_ERROR_NONE;
 
-        {
-            otRouterInfo info;
+    auto     wpanTopoFull = aTelemetryData.mutable_wpan_topo_full();
+    uint16_t rloc16       = otThreadGetRloc16(mInstance);
 
-            if (otThreadGetRouterInfo(mInstance, rloc16, &info) == OT_ERROR_NONE)
-            {
-                wpanTopoFull->set_router_id(info.mRouterId);
-            }
-            else
-            {
-                error = OT_ERROR_FAILED;
-            }
-        }
+    wpanTopoFull->set_rloc16(rloc16);
 
-        otNeighborInfoIterator iter = OT_NEIGHBOR_INFO_ITERATOR_INIT;
-        otNeighborInfo         neighborInfo;
+    {
+        otRouterInfo info;
 
-        while (otThreadGetNextNeighborInfo(mInstance, &iter, &neighborInfo) == OT_ERROR_NONE)
+        if (otThreadGetRouterInfo(mInstance, rloc16, &info) == OT_ERROR_NONE)
+        {
+            wpanTopoFull->set_router_id(info.mRouterId);
+        }
+        else
         {
-            neighborTable.push_back(neighborInfo);
+            error = OT_ERROR_FAILED;
         }
-        wpanTopoFull->set_neighbor_table_size(neighborTable.size());
+    }
 
-        uint16_t                 childIndex = 0;
-        otChildInfo              childInfo;
-        std::vector<otChildInfo> childTable;
+    wpanTopoFull->set_neighbor_table_size(aNeighborTable.size());
+    wpanTopoFull->set_child_table_size(aChildTable.size());
 
-        while (otThreadGetChildInfoByIndex(mInstance, childIndex, &childInfo) == OT_ERROR_NONE)
+    {
+        struct otLeaderData leaderData;
+
+        if (otThreadGetLeaderData(mInstance, &leaderData) == OT_ERROR_NONE)
         {
-            childTable.push_back(childInfo);
-            childIndex++;
+            wpanTopoFull->set_leader_router_id(leaderData.mLeaderRouterId);
+            wpanTopoFull->set_leader_weight(leaderData.mWeighting);
+            wpanTopoFull->set_network_data_version(leaderData.mDataVersion);
+            wpanTopoFull->set_stable_network_data_version(leaderData.mStableDataVersion);
         }
-        wpanTopoFull->set_child_table_size(childTable.size());
-
+        else
         {
-            struct otLeaderData leaderData;
-
-            if (otThreadGetLeaderData(mInstance, &leaderData) == OT_ERROR_NONE)
-            {
-                wpanTopoFull->set_leader_router_id(leaderData.mLeaderRouterId);
-                wpanTopoFull->set_leader_weight(leaderData.mWeighting);
-                wpanTopoFull->set_network_data_version(leaderData.mDataVersion);
-                wpanTopoFull->set_stable_network_data_version(leaderData.mStableDataVersion);
-            }
-            else
-            {
-                error = OT_ERROR_FAILED;
-            }
+            error = OT_ERROR_FAILED;
         }
+    }
 
-        uint8_t weight = otThreadGetLocalLeaderWeight(mInstance);
+    uint8_t weight = otThreadGetLocalLeaderWeight(mInstance);
 
-        wpanTopoFull->set_leader_local_weight(weight);
+    wpanTopoFull->set_leader_local_weight(weight);
 
-        uint32_t partitionId = otThreadGetPartitionId(mInstance);
+    uint32_t partitionId = otThreadGetPartitionId(mInstance);
 
-        wpanTopoFull->set_partition_id(partitionId);
+    wpanTopoFull->set_partition_id(partitionId);
 
-        static constexpr size_t kNetworkDataMaxSize = 255;
-        {
-            uint8_t              data[kNetworkDataMaxSize];
-            uint8_t              len = sizeof(data);
-            std::vector<uint8_t> networkData;
+    static constexpr size_t kNetworkDataMaxSize = 255;
+    {
+        uint8_t              data[kNetworkDataMaxSize];
+        uint8_t              len = sizeof(data);
+        std::vector<uint8_t> networkData;
 
-            if (otNetDataGet(mInstance, /*stable=*/false, data, &len) == OT_ERROR_NONE)
-            {
-                networkData = std::vector<uint8_t>(&data[0], &data[len]);
-                wpanTopoFull->set_network_data(std::string(networkData.begin(), networkData.end()));
-            }
-            else
-            {
-                error = OT_ERROR_FAILED;
-            }
+        if (otNetDataGet(mInstance, /*stable=*/false, data, &len) == OT_ERROR_NONE)
+        {
+            networkData = std::vector<uint8_t>(&data[0], &data[len]);
+            wpanTopoFull->set_network_data(std::string(networkData.begin(), networkData.end()));
         }
-
+        else
         {
-            uint8_t              data[kNetworkDataMaxSize];
-            uint8_t              len = sizeof(data);
-            std::vector<uint8_t> networkData;
+            error = OT_ERROR_FAILED;
+        }
+    }
 
-            if (otNetDataGet(mInstance, /*stable=*/true, data, &len) == OT_ERROR_NONE)
-            {
-                networkData = std::vector<uint8_t>(&data[0], &data[len]);
-                wpanTopoFull->set_stable_network_data(std::string(networkData.begin(), networkData.end()));
-            }
-            else
-            {
-                error = OT_ERROR_FAILED;
-            }
+    {
+        uint8_t              data[kNetworkDataMaxSize];
+        uint8_t              len = sizeof(data);
+        std::vector<uint8_t> networkData;
+
+        if (otNetDataGet(mInstance, /*stable=*/true, data, &len) == OT_ERROR_NONE)
+        {
+            networkData = std::vector<uint8_t>(&data[0], &data[len]);
+            wpanTopoFull->set_stable_network_data(std::string(networkData.begin(), networkData.end()));
         }
+        else
+        {
+            error = OT_ERROR_FAILED;
+        }
+    }
 
-        int8_t rssi = otPlatRadioGetRssi(mInstance);
+    int8_t rssi = otPlatRadioGetRssi(mInstance);
 
-        wpanTopoFull->set_instant_rssi(rssi);
+    wpanTopoFull->set_instant_rssi(rssi);
 
-        const otExtendedPanId *extPanId = otThreadGetExtendedPanId(mInstance);
-        uint64_t               extPanIdVal;
+    const otExtendedPanId *extPanId = otThreadGetExtendedPanId(mInstance);
+    uint64_t               extPanIdVal;
 
-        extPanIdVal = ConvertOpenThreadUint64(extPanId->m8);
-        wpanTopoFull->set_extended_pan_id(extPanIdVal);
-        // End of WpanTopoFull section.
+    extPanIdVal = ConvertOpenThreadUint64(extPanId->m8);
+    wpanTopoFull->set_extended_pan_id(extPanIdVal);
 
-        // Begin of TopoEntry section.
-        std::map<uint16_t, const otChildInfo *> childMap;
+    return error;
+}
 
-        for (const otChildInfo &childInfo : childTable)
-        {
-            auto pair = childMap.insert({childInfo.mRloc16, &childInfo});
-            if (!pair.second)
-            {
-                // This shouldn't happen, so log an error. It doesn't matter which
-                // duplicate is kept.
-                otbrLogErr("Children with duplicate RLOC16 found: 0x%04x", static_cast<int>(childInfo.mRloc16));
-            }
-        }
+void ThreadHelper::RetrieveTopoEntries(threadnetwork::TelemetryData      &aTelemetryData,
+                                       const std::vector<otNeighborInfo> &aNeighborTable,
+                                       const std::vector<otChildInfo>    &aChildTable)
+{
+    std::map<uint16_t, const otChildInfo *> childMap;
 
-        for (const otNeighborInfo &neighborInfo : neighborTable)
+    for (const otChildInfo &childInfo : aChildTable)
+    {
+        auto pair = childMap.insert({childInfo.mRloc16, &childInfo});
+        if (!pair.second)
         {
-            auto topoEntry = telemetryData.add_topo_entries();
-            topoEntry->set_rloc16(neighborInfo.mRloc16);
-            topoEntry->mutable_age()->set_seconds(neighborInfo.mAge);
-            topoEntry->set_link_quality_in(neighborInfo.mLinkQualityIn);
-            topoEntry->set_average_rssi(neighborInfo.mAverageRssi);
-            topoEntry->set_last_rssi(neighborInfo.mLastRssi);
-            topoEntry->set_link_frame_counter(neighborInfo.mLinkFrameCounter);
-            topoEntry->set_mle_frame_counter(neighborInfo.mMleFrameCounter);
-            topoEntry->set_rx_on_when_idle(neighborInfo.mRxOnWhenIdle);
-            topoEntry->set_secure_data_request(true);
-            topoEntry->set_full_function(neighborInfo.mFullThreadDevice);
-            topoEntry->set_full_network_data(neighborInfo.mFullNetworkData);
-            topoEntry->set_mac_frame_error_rate(static_cast<float>(neighborInfo.mFrameErrorRate) / 0xffff);
-            topoEntry->set_ip_message_error_rate(static_cast<float>(neighborInfo.mMessageErrorRate) / 0xffff);
-            topoEntry->set_version(neighborInfo.mVersion);
-
-            if (!neighborInfo.mIsChild)
-            {
-                continue;
-            }
-
-            auto it = childMap.find(neighborInfo.mRloc16);
-            if (it == childMap.end())
-            {
-                otbrLogErr("Neighbor 0x%04x not found in child table", static_cast<int>(neighborInfo.mRloc16));
-                continue;
-            }
-            const otChildInfo *childInfo = it->second;
-            topoEntry->set_is_child(true);
-            topoEntry->mutable_timeout()->set_seconds(childInfo->mTimeout);
-            topoEntry->set_network_data_version(childInfo->mNetworkDataVersion);
+            // This shouldn't happen, so log an error. It doesn't matter which
+            // duplicate is kept.
+            otbrLogErr("Children with duplicate RLOC16 found: 0x%04x", static_cast<int>(childInfo.mRloc16));
         }
-        // End of TopoEntry section.
-    }
-
-    {
-        // Begin of WpanBorderRouter section.
-        auto wpanBorderRouter = telemetryData.mutable_wpan_border_router();
-        // Begin of BorderRoutingCounters section.
-        auto                           borderRoutingCouters    = wpanBorderRouter->mutable_border_routing_counters();
-        const otBorderRoutingCounters *otBorderRoutingCounters = otIp6GetBorderRoutingCounters(mInstance);
-
-        borderRoutingCouters->mutable_inbound_unicast()->set_packet_count(
-            otBorderRoutingCounters->mInboundUnicast.mPackets);
-        borderRoutingCouters->mutable_inbound_unicast()->set_byte_count(
-            otBorderRoutingCounters->mInboundUnicast.mBytes);
-        borderRoutingCouters->mutable_inbound_multicast()->set_packet_count(
-            otBorderRoutingCounters->mInboundMulticast.mPackets);
-        borderRoutingCouters->mutable_inbound_multicast()->set_byte_count(
-            otBorderRoutingCounters->mInboundMulticast.mBytes);
-        borderRoutingCouters->mutable_outbound_unicast()->set_packet_count(
-            otBorderRoutingCounters->mOutboundUnicast.mPackets);
-        borderRoutingCouters->mutable_outbound_unicast()->set_byte_count(
-            otBorderRoutingCounters->mOutboundUnicast.mBytes);
-        borderRoutingCouters->mutable_outbound_multicast()->set_packet_count(
-            otBorderRoutingCounters->mOutboundMulticast.mPackets);
-        borderRoutingCouters->mutable_outbound_multicast()->set_byte_count(
-            otBorderRoutingCounters->mOutboundMulticast.mBytes);
-        borderRoutingCouters->set_ra_rx(otBorderRoutingCounters->mRaRx);
-        borderRoutingCouters->set_ra_tx_success(otBorderRoutingCounters->mRaTxSuccess);
-        borderRoutingCouters->set_ra_tx_failure(otBorderRoutingCounters->mRaTxFailure);
-        borderRoutingCouters->set_rs_rx(otBorderRoutingCounters->mRsRx);
-        borderRoutingCouters->set_rs_tx_success(otBorderRoutingCounters->mRsTxSuccess);
-        borderRoutingCouters->set_rs_tx_failure(otBorderRoutingCounters->mRsTxFailure);
-        borderRoutingCouters->mutable_inbound_internet()->set_packet_count(
-            otBorderRoutingCounters->mInboundInternet.mPackets);
-        borderRoutingCouters->mutable_inbound_internet()->set_byte_count(
-            otBorderRoutingCounters->mInboundInternet.mBytes);
-        borderRoutingCouters->mutable_outbound_internet()->set_packet_count(
-            otBorderRoutingCounters->mOutboundInternet.mPackets);
-        borderRoutingCouters->mutable_outbound_internet()->set_byte_count(
-            otBorderRoutingCounters->mOutboundInternet.mBytes);
+    }
 
-#if OTBR_ENABLE_NAT64
+    for (const otNeighborInfo &neighborInfo : aNeighborTable)
+    {
+        auto topoEntry = aTelemetryData.add_topo_entries();
+        topoEntry->set_rloc16(neighborInfo.mRloc16);
+        topoEntry->mutable_age()->set_seconds(neighborInfo.mAge);
+        topoEntry->set_link_quality_in(neighborInfo.mLinkQualityIn);
+        topoEntry->set_average_rssi(neighborInfo.mAverageRssi);
+        topoEntry->set_last_rssi(neighborInfo.mLastRssi);
+        topoEntry->set_link_frame_counter(neighborInfo.mLinkFrameCounter);
+        topoEntry->set_mle_frame_counter(neighborInfo.mMleFrameCounter);
+        topoEntry->set_rx_on_when_idle(neighborInfo.mRxOnWhenIdle);
+        topoEntry->set_secure_data_request(true);
+        topoEntry->set_full_function(neighborInfo.mFullThreadDevice);
+        topoEntry->set_full_network_data(neighborInfo.mFullNetworkData);
+        topoEntry->set_mac_frame_error_rate(static_cast<float>(neighborInfo.mFrameErrorRate) / 0xffff);
+        topoEntry->set_ip_message_error_rate(static_cast<float>(neighborInfo.mMessageErrorRate) / 0xffff);
+        topoEntry->set_version(neighborInfo.mVersion);
+
+        if (!neighborInfo.mIsChild)
         {
-            auto nat64IcmpCounters = borderRoutingCouters->mutable_nat64_protocol_counters()->mutable_icmp();
-            auto nat64UdpCounters  = borderRoutingCouters->mutable_nat64_protocol_counters()->mutable_udp();
-            auto nat64TcpCounters  = borderRoutingCouters->mutable_nat64_protocol_counters()->mutable_tcp();
-            otNat64ProtocolCounters otCounters;
-
-            otNat64GetCounters(mInstance, &otCounters);
-            nat64IcmpCounters->set_ipv4_to_ipv6_packets(otCounters.mIcmp.m4To6Packets);
-            nat64IcmpCounters->set_ipv4_to_ipv6_bytes(otCounters.mIcmp.m4To6Bytes);
-            nat64IcmpCounters->set_ipv6_to_ipv4_packets(otCounters.mIcmp.m6To4Packets);
-            nat64IcmpCounters->set_ipv6_to_ipv4_bytes(otCounters.mIcmp.m6To4Bytes);
-            nat64UdpCounters->set_ipv4_to_ipv6_packets(otCounters.mUdp.m4To6Packets);
-            nat64UdpCounters->set_ipv4_to_ipv6_bytes(otCounters.mUdp.m4To6Bytes);
-            nat64UdpCounters->set_ipv6_to_ipv4_packets(otCounters.mUdp.m6To4Packets);
-            nat64UdpCounters->set_ipv6_to_ipv4_bytes(otCounters.mUdp.m6To4Bytes);
-            nat64TcpCounters->set_ipv4_to_ipv6_packets(otCounters.mTcp.m4To6Packets);
-            nat64TcpCounters->set_ipv4_to_ipv6_bytes(otCounters.mTcp.m4To6Bytes);
-            nat64TcpCounters->set_ipv6_to_ipv4_packets(otCounters.mTcp.m6To4Packets);
-            nat64TcpCounters->set_ipv6_to_ipv4_bytes(otCounters.mTcp.m6To4Bytes);
+            continue;
         }
 
+        auto it = childMap.find(neighborInfo.mRloc16);
+        if (it == childMap.end())
         {
-            auto                 errorCounters = borderRoutingCouters->mutable_nat64_error_counters();
-            otNat64ErrorCounters otCounters;
-            otNat64GetErrorCounters(mInstance, &otCounters);
-
-            errorCounters->mutable_unknown()->set_ipv4_to_ipv6_packets(
-                otCounters.mCount4To6[OT_NAT64_DROP_REASON_UNKNOWN]);
-            errorCounters->mutable_unknown()->set_ipv6_to_ipv4_packets(
-                otCounters.mCount6To4[OT_NAT64_DROP_REASON_UNKNOWN]);
-            errorCounters->mutable_illegal_packet()->set_ipv4_to_ipv6_packets(
-                otCounters.mCount4To6[OT_NAT64_DROP_REASON_ILLEGAL_PACKET]);
-            errorCounters->mutable_illegal_packet()->set_ipv6_to_ipv4_packets(
-                otCounters.mCount6To4[OT_NAT64_DROP_REASON_ILLEGAL_PACKET]);
-            errorCounters->mutable_unsupported_protocol()->set_ipv4_to_ipv6_packets(
-                otCounters.mCount4To6[OT_NAT64_DROP_REASON_UNSUPPORTED_PROTO]);
-            errorCounters->mutable_unsupported_protocol()->set_ipv6_to_ipv4_packets(
-                otCounters.mCount6To4[OT_NAT64_DROP_REASON_UNSUPPORTED_PROTO]);
-            errorCounters->mutable_no_mapping()->set_ipv4_to_ipv6_packets(
-                otCounters.mCount4To6[OT_NAT64_DROP_REASON_NO_MAPPING]);
-            errorCounters->mutable_no_mapping()->set_ipv6_to_ipv4_packets(
-                otCounters.mCount6To4[OT_NAT64_DROP_REASON_NO_MAPPING]);
+            otbrLogErr("Neighbor 0x%04x not found in child table", static_cast<int>(neighborInfo.mRloc16));
+            continue;
         }
+        const otChildInfo *childInfo = it->second;
+        topoEntry->set_is_child(true);
+        topoEntry->mutable_timeout()->set_seconds(childInfo->mTimeout);
+        topoEntry->set_network_data_version(childInfo->mNetworkDataVersion);
+    }
+}
+
+void ThreadHelper::RetrieveWpanBorderRouter(Mdns::Publisher *aPublisher, threadnetwork::TelemetryData &aTelemetryData)
+{
+    auto wpanBorderRouter = aTelemetryData.mutable_wpan_border_router();
+    // Begin of BorderRoutingCounters section.
+    auto                           borderRoutingCouters    = wpanBorderRouter->mutable_border_routing_counters();
+    const otBorderRoutingCounters *otBorderRoutingCounters = otIp6GetBorderRoutingCounters(mInstance);
+
+    borderRoutingCouters->mutable_inbound_unicast()->set_packet_count(
+        otBorderRoutingCounters->mInboundUnicast.mPackets);
+    borderRoutingCouters->mutable_inbound_unicast()->set_byte_count(
+        otBorderRoutingCounters->mInboundUnicast.mBytes);
+    borderRoutingCouters->mutable_inbound_multicast()->set_packet_count(
+        otBorderRoutingCounters->mInboundMulticast.mPackets);
+    borderRoutingCouters->mutable_inbound_multicast()->set_byte_count(
+        otBorderRoutingCounters->mInboundMulticast.mBytes);
+    borderRoutingCouters->mutable_outbound_unicast()->set_packet_count(
+        otBorderRoutingCounters->mOutboundUnicast.mPackets);
+    borderRoutingCouters->mutable_outbound_unicast()->set_byte_count(
+        otBorderRoutingCounters->mOutboundUnicast.mBytes);
+    borderRoutingCouters->mutable_outbound_multicast()->set_packet_count(
+        otBorderRoutingCounters->mOutboundMulticast.mPackets);
+    borderRoutingCouters->mutable_outbound_multicast()->set_byte_count(
+        otBorderRoutingCounters->mOutboundMulticast.mBytes);
+    borderRoutingCouters->set_ra_rx(otBorderRoutingCounters->mRaRx);
+    borderRoutingCouters->set_ra_tx_success(otBorderRoutingCounters->mRaTxSuccess);
+    borderRoutingCouters->set_ra_tx_failure(otBorderRoutingCounters->mRaTxFailure);
+    borderRoutingCouters->set_rs_rx(otBorderRoutingCounters->mRsRx);
+    borderRoutingCouters->set_rs_tx_success(otBorderRoutingCounters->mRsTxSuccess);
+    borderRoutingCouters->set_rs_tx_failure(otBorderRoutingCounters->mRsTxFailure);
+    borderRoutingCouters->mutable_inbound_internet()->set_packet_count(
+        otBorderRoutingCounters->mInboundInternet.mPackets);
+    borderRoutingCouters->mutable_inbound_internet()->set_byte_count(
+        otBorderRoutingCounters->mInboundInternet.mBytes);
+    borderRoutingCouters->mutable_outbound_internet()->set_packet_count(
+        otBorderRoutingCounters->mOutboundInternet.mPackets);
+    borderRoutingCouters->mutable_outbound_internet()->set_byte_count(
+        otBorderRoutingCounters->mOutboundInternet.mBytes);
+
+#if OTBR_ENABLE_NAT64
+    {
+        auto nat64IcmpCounters = borderRoutingCouters->mutable_nat64_protocol_counters()->mutable_icmp();
+        auto nat64UdpCounters  = borderRoutingCouters->mutable_nat64_protocol_counters()->mutable_udp();
+        auto nat64TcpCounters  = borderRoutingCouters->mutable_nat64_protocol_counters()->mutable_tcp();
+        otNat64ProtocolCounters otCounters;
+
+        otNat64GetCounters(mInstance, &otCounters);
+        nat64IcmpCounters->set_ipv4_to_ipv6_packets(otCounters.mIcmp.m4To6Packets);
+        nat64IcmpCounters->set_ipv4_to_ipv6_bytes(otCounters.mIcmp.m4To6Bytes);
+        nat64IcmpCounters->set_ipv6_to_ipv4_packets(otCounters.mIcmp.m6To4Packets);
+        nat64IcmpCounters->set_ipv6_to_ipv4_bytes(otCounters.mIcmp.m6To4Bytes);
+        nat64UdpCounters->set_ipv4_to_ipv6_packets(otCounters.mUdp.m4To6Packets);
+        nat64UdpCounters->set_ipv4_to_ipv6_bytes(otCounters.mUdp.m4To6Bytes);
+        nat64UdpCounters->set_ipv6_to_ipv4_packets(otCounters.mUdp.m6To4Packets);
+        nat64UdpCounters->set_ipv6_to_ipv4_bytes(otCounters.mUdp.m6To4Bytes);
+        nat64TcpCounters->set_ipv4_to_ipv6_packets(otCounters.mTcp.m4To6Packets);
+        nat64TcpCounters->set_ipv4_to_ipv6_bytes(otCounters.mTcp.m4To6Bytes);
+        nat64TcpCounters->set_ipv6_to_ipv4_packets(otCounters.mTcp.m6To4Packets);
+        nat64TcpCounters->set_ipv6_to_ipv4_bytes(otCounters.mTcp.m6To4Bytes);
+    }
+
+    {
+        auto                 errorCounters = borderRoutingCouters->mutable_nat64_error_counters();
+        otNat64ErrorCounters otCounters;
+        otNat64GetErrorCounters(mInstance, &otCounters);
+
+        errorCounters->mutable_unknown()->set_ipv4_to_ipv6_packets(
+            otCounters.mCount4To6[OT_NAT64_DROP_REASON_UNKNOWN]);
+        errorCounters->mutable_unknown()->set_ipv6_to_ipv4_packets(
+            otCounters.mCount6To4[OT_NAT64_DROP_REASON_UNKNOWN]);
+        errorCounters->mutable_illegal_packet()->set_ipv4_to_ipv6_packets(
+            otCounters.mCount4To6[OT_NAT64_DROP_REASON_ILLEGAL_PACKET]);
+        errorCounters->mutable_illegal_packet()->set_ipv6_to_ipv4_packets(
+            otCounters.mCount6To4[OT_NAT64_DROP_REASON_ILLEGAL_PACKET]);
+        errorCounters->mutable_unsupported_protocol()->set_ipv4_to_ipv6_packets(
+            otCounters.mCount4To6[OT_NAT64_DROP_REASON_UNSUPPORTED_PROTO]);
+        errorCounters->mutable_unsupported_protocol()->set_ipv6_to_ipv4_packets(
+            otCounters.mCount6To4[OT_NAT64_DROP_REASON_UNSUPPORTED_PROTO]);
+        errorCounters->mutable_no_mapping()->set_ipv4_to_ipv6_packets(
+            otCounters.mCount4To6[OT_NAT64_DROP_REASON_NO_MAPPING]);
+        errorCounters->mutable_no_mapping()->set_ipv6_to_ipv4_packets(
+            otCounters.mCount6To4[OT_NAT64_DROP_REASON_NO_MAPPING]);
+    }
 #endif // OTBR_ENABLE_NAT64
-       // End of BorderRoutingCounters section.
+    // End of BorderRoutingCounters section.
 
 #if OTBR_ENABLE_TREL
-        // Begin of TrelInfo section.
-        {
-            auto trelInfo       = wpanBorderRouter->mutable_trel_info();
-            auto otTrelCounters = otTrelGetCounters(mInstance);
-            auto trelCounters   = trelInfo->mutable_counters();
-
-            trelInfo->set_is_trel_enabled(otTrelIsEnabled(mInstance));
-            trelInfo->set_num_trel_peers(otTrelGetNumberOfPeers(mInstance));
-
-            trelCounters->set_trel_tx_packets(otTrelCounters->mTxPackets);
-            trelCounters->set_trel_tx_bytes(otTrelCounters->mTxBytes);
-            trelCounters->set_trel_tx_packets_failed(otTrelCounters->mTxFailure);
-            trelCounters->set_tre_rx_packets(otTrelCounters->mRxPackets);
-            trelCounters->set_trel_rx_bytes(otTrelCounters->mRxBytes);
-        }
-        // End of TrelInfo section.
+    // Begin of TrelInfo section.
+    {
+        auto trelInfo       = wpanBorderRouter->mutable_trel_info();
+        auto otTrelCounters = otTrelGetCounters(mInstance);
+        auto trelCounters   = trelInfo->mutable_counters();
+
+        trelInfo->set_is_trel_enabled(otTrelIsEnabled(mInstance));
+        trelInfo->set_num_trel_peers(otTrelGetNumberOfPeers(mInstance));
+
+        trelCounters->set_trel_tx_packets(otTrelCounters->mTxPackets);
+        trelCounters->set_trel_tx_bytes(otTrelCounters->mTxBytes);
+        trelCounters->set_trel_tx_packets_failed(otTrelCounters->mTxFailure);
+        trelCounters->set_tre_rx_packets(otTrelCounters->mRxPackets);
+        trelCounters->set_trel_rx_bytes(otTrelCounters->mRxBytes);
+    }
+    // End of TrelInfo section.
 #endif // OTBR_ENABLE_TREL
 
 #if OTBR_ENABLE_BORDER_ROUTING
-        // Begin of InfraLinkInfo section.
-        {
-            auto                           infraLinkInfo = wpanBorderRouter->mutable_infra_link_info();
-            otSysInfraNetIfAddressCounters addressCounters;
-            uint32_t                       ifrFlags = otSysGetInfraNetifFlags();
-
-            otSysCountInfraNetifAddresses(&addressCounters);
-
-            infraLinkInfo->set_name(otSysGetInfraNetifName());
-            infraLinkInfo->set_is_up((ifrFlags & IFF_UP) != 0);
-            infraLinkInfo->set_is_running((ifrFlags & IFF_RUNNING) != 0);
-            infraLinkInfo->set_is_multicast((ifrFlags & IFF_MULTICAST) != 0);
-            infraLinkInfo->set_link_local_address_count(addressCounters.mLinkLocalAddresses);
-            infraLinkInfo->set_unique_local_address_count(addressCounters.mUniqueLocalAddresses);
-            infraLinkInfo->set_global_unicast_address_count(addressCounters.mGlobalUnicastAddresses);
-        }
-        // End of InfraLinkInfo section.
+    // Begin of InfraLinkInfo section.
+    {
+        auto                           infraLinkInfo = wpanBorderRouter->mutable_infra_link_info();
+        otSysInfraNetIfAddressCounters addressCounters;
+        uint32_t                       ifrFlags = otSysGetInfraNetifFlags();
+
+        otSysCountInfraNetifAddresses(&addressCounters);
+
+        infraLinkInfo->set_name(otSysGetInfraNetifName());
+        infraLinkInfo->set_is_up((ifrFlags & IFF_UP) != 0);
+        infraLinkInfo->set_is_running((ifrFlags & IFF_RUNNING) != 0);
+        infraLinkInfo->set_is_multicast((ifrFlags & IFF_MULTICAST) != 0);
+        infraLinkInfo->set_link_local_address_count(addressCounters.mLinkLocalAddresses);
+        infraLinkInfo->set_unique_local_address_count(addressCounters.mUniqueLocalAddresses);
+        infraLinkInfo->set_global_unicast_address_count(addressCounters.mGlobalUnicastAddresses);
+    }
+    // End of InfraLinkInfo section.
 #endif
 
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
-        // Begin of SrpServerInfo section.
-        {
-            auto                               srpServer = wpanBorderRouter->mutable_srp_server();
-            otSrpServerLeaseInfo               leaseInfo;
-            const otSrpServerHost             *host             = nullptr;
-            const otSrpServerResponseCounters *responseCounters = otSrpServerGetResponseCounters(mInstance);
+    // Begin of SrpServerInfo section.
+    {
+        auto                               srpServer = wpanBorderRouter->mutable_srp_server();
+        otSrpServerLeaseInfo               leaseInfo;
+        const otSrpServerHost             *host             = nullptr;
+        const otSrpServerResponseCounters *responseCounters = otSrpServerGetResponseCounters(mInstance);
+
+        srpServer->set_state(SrpServerStateFromOtSrpServerState(otSrpServerGetState(mInstance)));
+        srpServer->set_port(otSrpServerGetPort(mInstance));
+        srpServer->set_address_mode(
+            SrpServerAddressModeFromOtSrpServerAddressMode(otSrpServerGetAddressMode(mInstance)));
 
-            srpServer->set_state(SrpServerStateFromOtSrpServerState(otSrpServerGetState(mInstance)));
-            srpServer->set_port(otSrpServerGetPort(mInstance));
-            srpServer->set_address_mode(
-                SrpServerAddressModeFromOtSrpServerAddressMode(otSrpServerGetAddressMode(mInstance)));
+        auto srpServerHosts            = srpServer->mutable_hosts();
+        auto srpServerServices         = srpServer->mutable_services();
+        auto srpServerResponseCounters = srpServer->mutable_response_counters();
 
-            auto srpServerHosts            = srpServer->mutable_hosts();
-            auto srpServerServices         = srpServer->mutable_services();
-            auto srpServerResponseCounters = srpServer->mutable_response_counters();
+        while ((host = otSrpServerGetNextHost(mInstance, host)))
+        {
+            const otSrpServerService *service = nullptr;
 
-            while ((host = otSrpServerGetNextHost(mInstance, host)))
+            if (otSrpServerHostIsDeleted(host))
+            {
+                srpServerHosts->set_deleted_count(srpServerHosts->deleted_count() + 1);
+            }
+            else
             {
-                const otSrpServerService *service = nullptr;
+                srpServerHosts->set_fresh_count(srpServerHosts->fresh_count() + 1);
+                otSrpServerHostGetLeaseInfo(host, &leaseInfo);
+                srpServerHosts->set_lease_time_total_ms(srpServerHosts->lease_time_total_ms() + leaseInfo.mLease);
+                srpServerHosts->set_key_lease_time_total_ms(srpServerHosts->key_lease_time_total_ms() +
+                                                            leaseInfo.mKeyLease);
+                srpServerHosts->set_remaining_lease_time_total_ms(srpServerHosts->remaining_lease_time_total_ms() +
+                                                                  leaseInfo.mRemainingLease);
+                srpServerHosts->set_remaining_key_lease_time_total_ms(
+                    srpServerHosts->remaining_key_lease_time_total_ms() + leaseInfo.mRemainingKeyLease);
+            }
 
-                if (otSrpServerHostIsDeleted(host))
+            while ((service = otSrpServerHostGetNextService(host, service)))
+            {
+                if (otSrpServerServiceIsDeleted(service))
                 {
-                    srpServerHosts->set_deleted_count(srpServerHosts->deleted_count() + 1);
+                    srpServerServices->set_deleted_count(srpServerServices->deleted_count() + 1);
                 }
                 else
                 {
-                    srpServerHosts->set_fresh_count(srpServerHosts->fresh_count() + 1);
-                    otSrpServerHostGetLeaseInfo(host, &leaseInfo);
-                    srpServerHosts->set_lease_time_total_ms(srpServerHosts->lease_time_total_ms() + leaseInfo.mLease);
-                    srpServerHosts->set_key_lease_time_total_ms(srpServerHosts->key_lease_time_total_ms() +
-                                                                leaseInfo.mKeyLease);
-                    srpServerHosts->set_remaining_lease_time_total_ms(srpServerHosts->remaining_lease_time_total_ms() +
-                                                                      leaseInfo.mRemainingLease);
-                    srpServerHosts->set_remaining_key_lease_time_total_ms(
-                        srpServerHosts->remaining_key_lease_time_total_ms() + leaseInfo.mRemainingKeyLease);
-                }
-
-                while ((service = otSrpServerHostGetNextService(host, service)))
-                {
-                    if (otSrpServerServiceIsDeleted(service))
-                    {
-                        srpServerServices->set_deleted_count(srpServerServices->deleted_count() + 1);
-                    }
-                    else
-                    {
-                        srpServerServices->set_fresh_count(srpServerServices->fresh_count() + 1);
-                        otSrpServerServiceGetLeaseInfo(service, &leaseInfo);
-                        srpServerServices->set_lease_time_total_ms(srpServerServices->lease_time_total_ms() +
-                                                                   leaseInfo.mLease);
-                        srpServerServices->set_key_lease_time_total_ms(srpServerServices->key_lease_time_total_ms() +
-                                                                       leaseInfo.mKeyLease);
-                        srpServerServices->set_remaining_lease_time_total_ms(
-                            srpServerServices->remaining_lease_time_total_ms() + leaseInfo.mRemainingLease);
-                        srpServerServices->set_remaining_key_lease_time_total_ms(
-                            srpServerServices->remaining_key_lease_time_total_ms() + leaseInfo.mRemainingKeyLease);
-                    }
+                    srpServerServices->set_fresh_count(srpServerServices->fresh_count() + 1);
+                    otSrpServerServiceGetLeaseInfo(service, &leaseInfo);
+                    srpServerServices->set_lease_time_total_ms(srpServerServices->lease_time_total_ms() +
+                                                               leaseInfo.mLease);
+                    srpServerServices->set_key_lease_time_total_ms(srpServerServices->key_lease_time_total_ms() +
+                                                                   leaseInfo.mKeyLease);
+                    srpServerServices->set_remaining_lease_time_total_ms(
+                        srpServerServices->remaining_lease_time_total_ms() + leaseInfo.mRemainingLease);
+                    srpServerServices->set_remaining_key_lease_time_total_ms(
+                        srpServerServices->remaining_key_lease_time_total_ms() + leaseInfo.mRemainingKeyLease);
                 }
             }
-
-            srpServerResponseCounters->set_success_count(responseCounters->mSuccess);
-            srpServerResponseCounters->set_server_failure_count(responseCounters->mServerFailure);
-            srpServerResponseCounters->set_format_error_count(responseCounters->mFormatError);
-            srpServerResponseCounters->set_name_exists_count(responseCounters->mNameExists);
-            srpServerResponseCounters->set_refused_count(responseCounters->mRefused);
-            srpServerResponseCounters->set_other_count(responseCounters->mOther);
         }
-        // End of SrpServerInfo section.
+
+        srpServerResponseCounters->set_success_count(responseCounters->mSuccess);
+        srpServerResponseCounters->set_server_failure_count(responseCounters->mServerFailure);
+        srpServerResponseCounters->set_format_error_count(responseCounters->mFormatError);
+        srpServerResponseCounters->set_name_exists_count(responseCounters->mNameExists);
+        srpServerResponseCounters->set_refused_count(responseCounters->mRefused);
+        srpServerResponseCounters->set_other_count(responseCounters->mOther);
+    }
+    // End of SrpServerInfo section.
 #endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
 
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
-        // Begin of DnsServerInfo section.
-        {
-            auto            dnsServer                 = wpanBorderRouter->mutable_dns_server();
-            auto            dnsServerResponseCounters = dnsServer->mutable_response_counters();
-            otDnssdCounters otDnssdCounters           = *otDnssdGetCounters(mInstance);
-
-            dnsServerResponseCounters->set_success_count(otDnssdCounters.mSuccessResponse);
-            dnsServerResponseCounters->set_server_failure_count(otDnssdCounters.mServerFailureResponse);
-            dnsServerResponseCounters->set_format_error_count(otDnssdCounters.mFormatErrorResponse);
-            dnsServerResponseCounters->set_name_error_count(otDnssdCounters.mNameErrorResponse);
-            dnsServerResponseCounters->set_not_implemented_count(otDnssdCounters.mNotImplementedResponse);
-            dnsServerResponseCounters->set_other_count(otDnssdCounters.mOtherResponse);
-            // The counters of queries, responses, failures handled by upstream DNS server.
-            dnsServerResponseCounters->set_upstream_dns_queries(otDnssdCounters.mUpstreamDnsCounters.mQueries);
-            dnsServerResponseCounters->set_upstream_dns_responses(otDnssdCounters.mUpstreamDnsCounters.mResponses);
-            dnsServerResponseCounters->set_upstream_dns_failures(otDnssdCounters.mUpstreamDnsCounters.mFailures);
-
-            dnsServer->set_resolved_by_local_srp_count(otDnssdCounters.mResolvedBySrp);
+    // Begin of DnsServerInfo section.
+    {
+        auto            dnsServer                 = wpanBorderRouter->mutable_dns_server();
+        auto            dnsServerResponseCounters = dnsServer->mutable_response_counters();
+        otDnssdCounters otDnssdCounters           = *otDnssdGetCounters(mInstance);
+
+        dnsServerResponseCounters->set_success_count(otDnssdCounters.mSuccessResponse);
+        dnsServerResponseCounters->set_server_failure_count(otDnssdCounters.mServerFailureResponse);
+        dnsServerResponseCounters->set_format_error_count(otDnssdCounters.mFormatErrorResponse);
+        dnsServerResponseCounters->set_name_error_count(otDnssdCounters.mNameErrorResponse);
+        dnsServerResponseCounters->set_not_implemented_count(otDnssdCounters.mNotImplementedResponse);
+        dnsServerResponseCounters->set_other_count(otDnssdCounters.mOtherResponse);
+        // The counters of queries, responses, failures handled by upstream DNS server.
+        dnsServerResponseCounters->set_upstream_dns_queries(otDnssdCounters.mUpstreamDnsCounters.mQueries);
+        dnsServerResponseCounters->set_upstream_dns_responses(otDnssdCounters.mUpstreamDnsCounters.mResponses);
+        dnsServerResponseCounters->set_upstream_dns_failures(otDnssdCounters.mUpstreamDnsCounters.mFailures);
+
+        dnsServer->set_resolved_by_local_srp_count(otDnssdCounters.mResolvedBySrp);
 
 #if OTBR_ENABLE_DNS_UPSTREAM_QUERY
-            dnsServer->set_upstream_dns_query_state(
-                otDnssdUpstreamQueryIsEnabled(mInstance)
-                    ? threadnetwork::TelemetryData::UPSTREAMDNS_QUERY_STATE_ENABLED
-                    : threadnetwork::TelemetryData::UPSTREAMDNS_QUERY_STATE_DISABLED);
+        dnsServer->set_upstream_dns_query_state(
+            otDnssdUpstreamQueryIsEnabled(mInstance)
+                ? threadnetwork::TelemetryData::UPSTREAMDNS_QUERY_STATE_ENABLED
+                : threadnetwork::TelemetryData::UPSTREAMDNS_QUERY_STATE_DISABLED);
 #endif // OTBR_ENABLE_DNS_UPSTREAM_QUERY
-        }
-        // End of DnsServerInfo section.
+    }
+    // End of DnsServerInfo section.
 #endif // OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
 
-        // Start of MdnsInfo section.
-        if (aPublisher != nullptr)
-        {
-            auto                     mdns     = wpanBorderRouter->mutable_mdns();
-            const MdnsTelemetryInfo &mdnsInfo = aPublisher->GetMdnsTelemetryInfo();
-
-            CopyMdnsResponseCounters(mdnsInfo.mHostRegistrations, mdns->mutable_host_registration_responses());
-            CopyMdnsResponseCounters(mdnsInfo.mServiceRegistrations, mdns->mutable_service_registration_responses());
-            CopyMdnsResponseCounters(mdnsInfo.mHostResolutions, mdns->mutable_host_resolution_responses());
-            CopyMdnsResponseCounters(mdnsInfo.mServiceResolutions, mdns->mutable_service_resolution_responses());
-
-            mdns->set_host_registration_ema_latency_ms(mdnsInfo.mHostRegistrationEmaLatency);
-            mdns->set_service_registration_ema_latency_ms(mdnsInfo.mServiceRegistrationEmaLatency);
-            mdns->set_host_resolution_ema_latency_ms(mdnsInfo.mHostResolutionEmaLatency);
-            mdns->set_service_resolution_ema_latency_ms(mdnsInfo.mServiceResolutionEmaLatency);
-        }
-        // End of MdnsInfo section.
+    // Start of MdnsInfo section.
+    if (aPublisher != nullptr)
+    {
+        auto                     mdns     = wpanBorderRouter->mutable_mdns();
+        const MdnsTelemetryInfo &mdnsInfo = aPublisher->GetMdnsTelemetryInfo();
+
+        CopyMdnsResponseCounters(mdnsInfo.mHostRegistrations, mdns->mutable_host_registration_responses());
+        CopyMdnsResponseCounters(mdnsInfo.mServiceRegistrations, mdns->mutable_service_registration_responses());
+        CopyMdnsResponseCounters(mdnsInfo.mHostResolutions, mdns->mutable_host_resolution_responses());
+        CopyMdnsResponseCounters(mdnsInfo.mServiceResolutions, mdns->mutable_service_resolution_responses());
+
+        mdns->set_host_registration_ema_latency_ms(mdnsInfo.mHostRegistrationEmaLatency);
+        mdns->set_service_registration_ema_latency_ms(mdnsInfo.mServiceRegistrationEmaLatency);
+        mdns->set_host_resolution_ema_latency_ms(mdnsInfo.mHostResolutionEmaLatency);
+        mdns->set_service_resolution_ema_latency_ms(mdnsInfo.mServiceResolutionEmaLatency);
+    }
+    // End of MdnsInfo section.
 
 #if OTBR_ENABLE_NAT64
-        // Start of BorderRoutingNat64State section.
-        {
-            auto nat64State = wpanBorderRouter->mutable_nat64_state();
+    // Start of BorderRoutingNat64State section.
+    {
+        auto nat64State = wpanBorderRouter->mutable_nat64_state();
 
-            nat64State->set_prefix_manager_state(Nat64StateFromOtNat64State(otNat64GetPrefixManagerState(mInstance)));
-            nat64State->set_translator_state(Nat64StateFromOtNat64State(otNat64GetTranslatorState(mInstance)));
-        }
-        // End of BorderRoutingNat64State section.
+        nat64State->set_prefix_manager_state(Nat64StateFromOtNat64State(otNat64GetPrefixManagerState(mInstance)));
+        nat64State->set_translator_state(Nat64StateFromOtNat64State(otNat64GetTranslatorState(mInstance)));
+    }
+    // End of BorderRoutingNat64State section.
 
-        // Start of Nat64Mapping section.
+    // Start of Nat64Mapping section.
+    {
+        otNat64AddressMappingIterator iterator;
+        otNat64AddressMapping         otMapping;
+        Sha256::Hash                  hash;
+        Sha256                        sha256;
+
+        otNat64InitAddressMappingIterator(mInstance, &iterator);
+        while (otNat64GetNextAddressMapping(mInstance, &iterator, &otMapping) == OT_ERROR_NONE)
         {
-            otNat64AddressMappingIterator iterator;
-            otNat64AddressMapping         otMapping;
-            Sha256::Hash                  hash;
-            Sha256                        sha256;
+            auto nat64Mapping         = wpanBorderRouter->add_nat64_mappings();
+            auto nat64MappingCounters = nat64Mapping->mutable_counters();
 
-            otNat64InitAddressMappingIterator(mInstance, &iterator);
-            while (otNat64GetNextAddressMapping(mInstance, &iterator, &otMapping) == OT_ERROR_NONE)
-            {
-                auto nat64Mapping         = wpanBorderRouter->add_nat64_mappings();
-                auto nat64MappingCounters = nat64Mapping->mutable_counters();
-
-                nat64Mapping->set_mapping_id(otMapping.mId);
-                CopyNat64TrafficCounters(otMapping.mCounters.mTcp, nat64MappingCounters->mutable_tcp());
-                CopyNat64TrafficCounters(otMapping.mCounters.mUdp, nat64MappingCounters->mutable_udp());
-                CopyNat64TrafficCounters(otMapping.mCounters.mIcmp, nat64MappingCounters->mutable_icmp());
-
-                sha256.Start();
-                sha256.Update(otMapping.mIp6.mFields.m8, sizeof(otMapping.mIp6.mFields.m8));
-                sha256.Update(mNat64PdCommonSalt, sizeof(mNat64PdCommonSalt));
-                sha256.Finish(hash);
-
-                nat64Mapping->mutable_hashed_ipv6_address()->append(reinterpret_cast<const char *>(hash.GetBytes()),
-                                                                    Sha256::Hash::kSize);
-                // Remaining time is not included in the telemetry
-            }
-        }
-        // End of Nat64Mapping section.
-#endif // OTBR_ENABLE_NAT64
-#if OTBR_ENABLE_DHCP6_PD
-        // Start of Dhcp6PdState section.
-        wpanBorderRouter->set_dhcp6_pd_state(Dhcp6PdStateFromOtDhcp6PdState(otBorderRoutingDhcp6PdGetState(mInstance)));
-        // End of Dhcp6PdState section.
+            nat64Mapping->set_mapping_id(otMapping.mId);
+            CopyNat64TrafficCounters(otMapping.mCounters.mTcp, nat64MappingCounters->mutable_tcp());
+            CopyNat64TrafficCounters(otMapping.mCounters.mUdp, nat64MappingCounters->mutable_udp());
+            CopyNat64TrafficCounters(otMapping.mCounters.mIcmp, nat64MappingCounters->mutable_icmp());
 
-        // Start of Hashed PD prefix
-        {
-            otBorderRoutingPrefixTableEntry aPrefixInfo;
-            const uint8_t                  *prefixAddr          = nullptr;
-            const uint8_t                  *truncatedHash       = nullptr;
-            constexpr size_t                kHashPrefixLength   = 6;
-            constexpr size_t                kHashedPrefixLength = 2;
-            std::vector<uint8_t>            hashedPdHeader      = {0x20, 0x01, 0x0d, 0xb8};
-            std::vector<uint8_t>            hashedPdTailer      = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-            std::vector<uint8_t>            hashedPdPrefix;
-            hashedPdPrefix.reserve(16);
-            Sha256       sha256;
-            Sha256::Hash hash;
-
-            otBorderRoutingGetPdOmrPrefix(mInstance, &aPrefixInfo);
-            prefixAddr = aPrefixInfo.mPrefix.mPrefix.mFields.m8;
-
-            // TODO: Put below steps into a reusable function.
             sha256.Start();
-            sha256.Update(prefixAddr, kHashPrefixLength);
-            sha256.Update(mNat64PdCommonSalt, kNat64PdCommonHashSaltLength);
+            sha256.Update(otMapping.mIp6.mFields.m8, sizeof(otMapping.mIp6.mFields.m8));
+            sha256.Update(mNat64PdCommonSalt, sizeof(mNat64PdCommonSalt));
             sha256.Finish(hash);
 
-            // Append hashedPdHeader
-            hashedPdPrefix.insert(hashedPdPrefix.end(), hashedPdHeader.begin(), hashedPdHeader.end());
-
-            // Append the first 2 bytes of the hashed prefix
-            truncatedHash = hash.GetBytes();
-            hashedPdPrefix.insert(hashedPdPrefix.end(), truncatedHash, truncatedHash + kHashedPrefixLength);
-
-            // Append ip[6] and ip[7]
-            hashedPdPrefix.push_back(prefixAddr[6]);
-            hashedPdPrefix.push_back(prefixAddr[7]);
-
-            // Append hashedPdTailer
-            hashedPdPrefix.insert(hashedPdPrefix.end(), hashedPdTailer.begin(), hashedPdTailer.end());
-
-            wpanBorderRouter->mutable_hashed_pd_prefix()->append(reinterpret_cast<const char *>(hashedPdPrefix.data()),
-                                                                 hashedPdPrefix.size());
+            nat64Mapping->mutable_hashed_ipv6_address()->append(reinterpret_cast<const char *>(hash.GetBytes()),
+                                                                Sha256::Hash::kSize);
+            // Remaining time is not included in the telemetry
         }
-        // End of Hashed PD prefix
-        // Start of DHCPv6 PD processed RA Info
-        {
-            auto                pdProcessedRaInfo = wpanBorderRouter->mutable_pd_processed_ra_info();
-            otPdProcessedRaInfo raInfo;
+    }
+    // End of Nat64Mapping section.
+#endif // OTBR_ENABLE_NAT64
+#if OTBR_ENABLE_DHCP6_PD
+    // Start of Dhcp6PdState section.
+    wpanBorderRouter->set_dhcp6_pd_state(Dhcp6PdStateFromOtDhcp6PdState(otBorderRoutingDhcp6PdGetState(mInstance)));
+    // End of Dhcp6PdState section.
 
-            otBorderRoutingGetPdProcessedRaInfo(mInstance, &raInfo);
-            pdProcessedRaInfo->set_num_platform_ra_received(raInfo.mNumPlatformRaReceived);
-            pdProcessedRaInfo->set_num_platform_pio_processed(raInfo.mNumPlatformPioProcessed);
-            pdProcessedRaInfo->set_last_platform_ra_msec(raInfo.mLastPlatformRaMsec);
-        }
-        // End of DHCPv6 PD processed RA Info
+    // Start of Hashed PD prefix
+    {
+        otBorderRoutingPrefixTableEntry aPrefixInfo;
+        const uint8_t                  *prefixAddr          = nullptr;
+        const uint8_t                  *truncatedHash       = nullptr;
+        constexpr size_t                kHashPrefixLength   = 6;
+        constexpr size_t                kHashedPrefixLength = 2;
+        std::vector<uint8_t>            hashedPdHeader      = {0x20, 0x01, 0x0d, 0xb8};
+        std::vector<uint8_t>            hashedPdTailer      = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+        std::vector<uint8_t>            hashedPdPrefix;
+        hashedPdPrefix.reserve(16);
+        Sha256       sha256;
+        Sha256::Hash hash;
+
+        otBorderRoutingGetPdOmrPrefix(mInstance, &aPrefixInfo);
+        prefixAddr = aPrefixInfo.mPrefix.mPrefix.mFields.m8;
+
+        // TODO: Put below steps into a reusable function.
+        sha256.Start();
+        sha256.Update(prefixAddr, kHashPrefixLength);
+        sha256.Update(mNat64PdCommonSalt, kNat64PdCommonHashSaltLength);
+        sha256.Finish(hash);
+
+        // Append hashedPdHeader
+        hashedPdPrefix.insert(hashedPdPrefix.end(), hashedPdHeader.begin(), hashedPdHeader.end());
+
+        // Append the first 2 bytes of the hashed prefix
+        truncatedHash = hash.GetBytes();
+        hashedPdPrefix.insert(hashedPdPrefix.end(), truncatedHash, truncatedHash + kHashedPrefixLength);
+
+        // Append ip[6] and ip[7]
+        hashedPdPrefix.push_back(prefixAddr[6]);
+        hashedPdPrefix.push_back(prefixAddr[7]);
+
+        // Append hashedPdTailer
+        hashedPdPrefix.insert(hashedPdPrefix.end(), hashedPdTailer.begin(), hashedPdTailer.end());
+
+        wpanBorderRouter->mutable_hashed_pd_prefix()->append(reinterpret_cast<const char *>(hashedPdPrefix.data()),
+                                                             hashedPdPrefix.size());
+    }
+    // End of Hashed PD prefix
+    // Start of DHCPv6 PD processed RA Info
+    {
+        auto                pdProcessedRaInfo = wpanBorderRouter->mutable_pd_processed_ra_info();
+        otPdProcessedRaInfo raInfo;
+
+        otBorderRoutingGetPdProcessedRaInfo(mInstance, &raInfo);
+        pdProcessedRaInfo->set_num_platform_ra_received(raInfo.mNumPlatformRaReceived);
+        pdProcessedRaInfo->set_num_platform_pio_processed(raInfo.mNumPlatformPioProcessed);
+        pdProcessedRaInfo->set_last_platform_ra_msec(raInfo.mLastPlatformRaMsec);
+    }
+    // End of DHCPv6 PD processed RA Info
 #endif // OTBR_ENABLE_DHCP6_PD
-       // End of WpanBorderRouter section.
+}
 
-        // Start of WpanRcp section.
-        {
-            auto                        wpanRcp                = telemetryData.mutable_wpan_rcp();
-            const otRadioSpinelMetrics *otRadioSpinelMetrics   = otSysGetRadioSpinelMetrics();
-            auto                        rcpStabilityStatistics = wpanRcp->mutable_rcp_stability_statistics();
+void ThreadHelper::RetrieveWpanRcp(threadnetwork::TelemetryData &aTelemetryData)
+{
+    auto                        wpanRcp                = aTelemetryData.mutable_wpan_rcp();
+    const otRadioSpinelMetrics *otRadioSpinelMetrics   = otSysGetRadioSpinelMetrics();
+    auto                        rcpStabilityStatistics = wpanRcp->mutable_rcp_stability_statistics();
 
-            if (otRadioSpinelMetrics != nullptr)
-            {
-                rcpStabilityStatistics->set_rcp_timeout_count(otRadioSpinelMetrics->mRcpTimeoutCount);
-                rcpStabilityStatistics->set_rcp_reset_count(otRadioSpinelMetrics->mRcpUnexpectedResetCount);
-                rcpStabilityStatistics->set_rcp_restoration_count(otRadioSpinelMetrics->mRcpRestorationCount);
-                rcpStabilityStatistics->set_spinel_parse_error_count(otRadioSpinelMetrics->mSpinelParseErrorCount);
-            }
+    if (otRadioSpinelMetrics != nullptr)
+    {
+        rcpStabilityStatistics->set_rcp_timeout_count(otRadioSpinelMetrics->mRcpTimeoutCount);
+        rcpStabilityStatistics->set_rcp_reset_count(otRadioSpinelMetrics->mRcpUnexpectedResetCount);
+        rcpStabilityStatistics->set_rcp_restoration_count(otRadioSpinelMetrics->mRcpRestorationCount);
+        rcpStabilityStatistics->set_spinel_parse_error_count(otRadioSpinelMetrics->mSpinelParseErrorCount);
+    }
 
-            // TODO: provide rcp_firmware_update_count info.
-            rcpStabilityStatistics->set_thread_stack_uptime(otInstanceGetUptime(mInstance));
+    // TODO: provide rcp_firmware_update_count info.
+    rcpStabilityStatistics->set_thread_stack_uptime(otInstanceGetUptime(mInstance));
 
-            const otRcpInterfaceMetrics *otRcpInterfaceMetrics = otSysGetRcpInterfaceMetrics();
+    const otRcpInterfaceMetrics *otRcpInterfaceMetrics = otSysGetRcpInterfaceMetrics();
 
-            if (otRcpInterfaceMetrics != nullptr)
-            {
-                auto rcpInterfaceStatistics = wpanRcp->mutable_rcp_interface_statistics();
-
-                rcpInterfaceStatistics->set_rcp_interface_type(otRcpInterfaceMetrics->mRcpInterfaceType);
-                rcpInterfaceStatistics->set_transferred_frames_count(otRcpInterfaceMetrics->mTransferredFrameCount);
-                rcpInterfaceStatistics->set_transferred_valid_frames_count(
-                    otRcpInterfaceMetrics->mTransferredValidFrameCount);
-                rcpInterfaceStatistics->set_transferred_garbage_frames_count(
-                    otRcpInterfaceMetrics->mTransferredGarbageFrameCount);
-                rcpInterfaceStatistics->set_rx_frames_count(otRcpInterfaceMetrics->mRxFrameCount);
-                rcpInterfaceStatistics->set_rx_bytes_count(otRcpInterfaceMetrics->mRxFrameByteCount);
-                rcpInterfaceStatistics->set_tx_frames_count(otRcpInterfaceMetrics->mTxFrameCount);
-                rcpInterfaceStatistics->set_tx_bytes_count(otRcpInterfaceMetrics->mTxFrameByteCount);
-            }
-        }
-        // End of WpanRcp section.
+    if (otRcpInterfaceMetrics != nullptr)
+    {
+        auto rcpInterfaceStatistics = wpanRcp->mutable_rcp_interface_statistics();
+
+        rcpInterfaceStatistics->set_rcp_interface_type(otRcpInterfaceMetrics->mRcpInterfaceType);
+        rcpInterfaceStatistics->set_transferred_frames_count(otRcpInterfaceMetrics->mTransferredFrameCount);
+        rcpInterfaceStatistics->set_transferred_valid_frames_count(
+            otRcpInterfaceMetrics->mTransferredValidFrameCount);
+        rcpInterfaceStatistics->set_transferred_garbage_frames_count(
+            otRcpInterfaceMetrics->mTransferredGarbageFrameCount);
+        rcpInterfaceStatistics->set_rx_frames_count(otRcpInterfaceMetrics->mRxFrameCount);
+        rcpInterfaceStatistics->set_rx_bytes_count(otRcpInterfaceMetrics->mRxFrameByteCount);
+        rcpInterfaceStatistics->set_tx_frames_count(otRcpInterfaceMetrics->mTxFrameCount);
+        rcpInterfaceStatistics->set_tx_bytes_count(otRcpInterfaceMetrics->mTxFrameByteCount);
+    }
+}
 
-        // Start of CoexMetrics section.
-        {
-            auto               coexMetrics = telemetryData.mutable_coex_metrics();
-            otRadioCoexMetrics otRadioCoexMetrics;
+otError ThreadHelper::RetrieveCoexMetrics(threadnetwork::TelemetryData &aTelemetryData)
+{
+    otError error = OT_ERROR_NONE;
 
-            if (otPlatRadioGetCoexMetrics(mInstance, &otRadioCoexMetrics) == OT_ERROR_NONE)
-            {
-                coexMetrics->set_count_tx_request(otRadioCoexMetrics.mNumTxRequest);
-                coexMetrics->set_count_tx_grant_immediate(otRadioCoexMetrics.mNumTxGrantImmediate);
-                coexMetrics->set_count_tx_grant_wait(otRadioCoexMetrics.mNumTxGrantWait);
-                coexMetrics->set_count_tx_grant_wait_activated(otRadioCoexMetrics.mNumTxGrantWaitActivated);
-                coexMetrics->set_count_tx_grant_wait_timeout(otRadioCoexMetrics.mNumTxGrantWaitTimeout);
-                coexMetrics->set_count_tx_grant_deactivated_during_request(
-                    otRadioCoexMetrics.mNumTxGrantDeactivatedDuringRequest);
-                coexMetrics->set_tx_average_request_to_grant_time_us(otRadioCoexMetrics.mAvgTxRequestToGrantTime);
-                coexMetrics->set_count_rx_request(otRadioCoexMetrics.mNumRxRequest);
-                coexMetrics->set_count_rx_grant_immediate(otRadioCoexMetrics.mNumRxGrantImmediate);
-                coexMetrics->set_count_rx_grant_wait(otRadioCoexMetrics.mNumRxGrantWait);
-                coexMetrics->set_count_rx_grant_wait_activated(otRadioCoexMetrics.mNumRxGrantWaitActivated);
-                coexMetrics->set_count_rx_grant_wait_timeout(otRadioCoexMetrics.mNumRxGrantWaitTimeout);
-                coexMetrics->set_count_rx_grant_deactivated_during_request(
-                    otRadioCoexMetrics.mNumRxGrantDeactivatedDuringRequest);
-                coexMetrics->set_count_rx_grant_none(otRadioCoexMetrics.mNumRxGrantNone);
-                coexMetrics->set_rx_average_request_to_grant_time_us(otRadioCoexMetrics.mAvgRxRequestToGrantTime);
-            }
-            else
-            {
-                error = OT_ERROR_FAILED;
-            }
-        }
-        // End of CoexMetrics section.
+    auto               coexMetrics = aTelemetryData.mutable_coex_metrics();
+    otRadioCoexMetrics otRadioCoexMetrics;
+
+    if (otPlatRadioGetCoexMetrics(mInstance, &otRadioCoexMetrics) == OT_ERROR_NONE)
+    {
+        coexMetrics->set_count_tx_request(otRadioCoexMetrics.mNumTxRequest);
+        coexMetrics->set_count_tx_grant_immediate(otRadioCoexMetrics.mNumTxGrantImmediate);
+        coexMetrics->set_count_tx_grant_wait(otRadioCoexMetrics.mNumTxGrantWait);
+        coexMetrics->set_count_tx_grant_wait_activated(otRadioCoexMetrics.mNumTxGrantWaitActivated);
+        coexMetrics->set_count_tx_grant_wait_timeout(otRadioCoexMetrics.mNumTxGrantWaitTimeout);
+        coexMetrics->set_count_tx_grant_deactivated_during_request(
+            otRadioCoexMetrics.mNumTxGrantDeactivatedDuringRequest);
+        coexMetrics->set_tx_average_request_to_grant_time_us(otRadioCoexMetrics.mAvgTxRequestToGrantTime);
+        coexMetrics->set_count_rx_request(otRadioCoexMetrics.mNumRxRequest);
+        coexMetrics->set_count_rx_grant_immediate(otRadioCoexMetrics.mNumRxGrantImmediate);
+        coexMetrics->set_count_rx_grant_wait(otRadioCoexMetrics.mNumRxGrantWait);
+        coexMetrics->set_count_rx_grant_wait_activated(otRadioCoexMetrics.mNumRxGrantWaitActivated);
+        coexMetrics->set_count_rx_grant_wait_timeout(otRadioCoexMetrics.mNumRxGrantWaitTimeout);
+        coexMetrics->set_count_rx_grant_deactivated_during_request(
+            otRadioCoexMetrics.mNumRxGrantDeactivatedDuringRequest);
+        coexMetrics->set_count_rx_grant_none(otRadioCoexMetrics.mNumRxGrantNone);
+        coexMetrics->set_rx_average_request_to_grant_time_us(otRadioCoexMetrics.mAvgRxRequestToGrantTime);
+    }
+    else
+    {
+        error = OT_ERROR_FAILED;
     }
 
+    return error;
+}
+
 #if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+void ThreadHelper::RetrieveLowPowerMetrics(threadnetwork::TelemetryData      &aTelemetryData,
+                                           const std::vector<otNeighborInfo> &aNeighborTable)
+{
+    auto lowPowerMetrics = aTelemetryData.mutable_low_power_metrics();
+
+    for (const otNeighborInfo &neighborInfo : aNeighborTable)
     {
-        auto lowPowerMetrics = telemetryData.mutable_low_power_metrics();
-        // Begin of Link Metrics section.
-        for (const otNeighborInfo &neighborInfo : neighborTable)
-        {
-            otError             query_error;
-            otLinkMetricsValues values;
+        otError             query_error;
+        otLinkMetricsValues values;
 
-            query_error = otLinkMetricsManagerGetMetricsValueByExtAddr(mInstance, &neighborInfo.mExtAddress, &values);
-            // Some neighbors don't support Link Metrics Subject feature. So it's expected that some other errors
-            // are returned.
-            if (query_error == OT_ERROR_NONE)
-            {
-                auto linkMetricsStats = lowPowerMetrics->add_link_metrics_entries();
-                linkMetricsStats->set_link_margin(values.mLinkMarginValue);
-                linkMetricsStats->set_rssi(values.mRssiValue);
-            }
+        query_error = otLinkMetricsManagerGetMetricsValueByExtAddr(mInstance, &neighborInfo.mExtAddress, &values);
+        // Some neighbors don't support Link Metrics Subject feature. So it's expected that some other errors
+        // are returned.
+        if (query_error == OT_ERROR_NONE)
+        {
+            auto linkMetricsStats = lowPowerMetrics->add_link_metrics_entries();
+            linkMetricsStats->set_link_margin(values.mLinkMarginValue);
+            linkMetricsStats->set_rssi(values.mRssiValue);
         }
     }
-#endif // OTBR_ENABLE_LINK_METRICS_TELEMETRY
-
-    return error;
 }
+#endif // OTBR_ENABLE_LINK_METRICS_TELEMETRY
 #endif // OTBR_ENABLE_TELEMETRY_DATA_API
 } // namespace agent
 } // namespace otbr
@@ -49,9 +49,12 @@
 #include <openthread/joiner.h>
 #include <openthread/netdata.h>
 #include <openthread/thread.h>
+#include <openthread/thread_ftd.h>
+#include "common/time.hpp"
 #include "mdns/mdns.hpp"
 #if OTBR_ENABLE_TELEMETRY_DATA_API
 #include "proto/thread_telemetry.pb.h"
+#include "utils/telemetry_sampler.hpp"
 #endif
 
 namespace otbr {
@@ -77,6 +80,52 @@ public:
     using UpdateMeshCopTxtHandler = std::function<void(std::map<std::string, std::vector<uint8_t>>)>;
     using DatasetChangeHandler    = std::function<void(const otOperationalDatasetTlvs &)>;
 
+    /**
+     * This structure represents the statistics of active and energy scans.
+     *
+     */
+    struct ScanStats
+    {
+        uint32_t mActiveScans;       ///< The number of active scans performed on the radio.
+        uint32_t mEnergyScans;       ///< The number of energy scans performed on the radio.
+        uint32_t mCoalescedRequests; ///< The number of requests served by a scan already in progress.
+        uint32_t mCachedResponses;   ///< The number of requests served by the results of a recent scan.
+        uint64_t mScanTime;          ///< The total time the radio spent scanning, in milliseconds.
+    };
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    /**
+     * This enumeration represents the sections of the telemetry data, which are selected by a bit mask.
+     *
+     * Each section is one field of `TelemetryData`, see proto/thread_telemetry.proto.
+     *
+     */
+    enum TelemetrySection : uint32_t
+    {
+        kTelemetrySectionWpanStats        = 1 << 0, ///< The `wpan_stats` field.
+        kTelemetrySectionWpanTopoFull     = 1 << 1, ///< The `wpan_topo_full` field.
+        kTelemetrySectionTopoEntries      = 1 << 2, ///< The `topo_entries` field.
+        kTelemetrySectionWpanBorderRouter = 1 << 3, ///< The `wpan_border_router` field.
+        kTelemetrySectionWpanRcp          = 1 << 4, ///< The `wpan_rcp` field.
+        kTelemetrySectionCoexMetrics      = 1 << 5, ///< The `coex_metrics` field.
+        kTelemetrySectionLowPowerMetrics  = 1 << 6, ///< The `low_power_metrics` field.
+    };
+
+    static constexpr uint8_t  kNumTelemetrySections = 7;
+    static constexpr uint32_t kTelemetrySectionsAll = (1u << kNumTelemetrySections) - 1; ///< All telemetry sections.
+
+    /**
+     * This structure represents the cost of retrieving one telemetry section.
+     *
+     */
+    struct TelemetrySectionStats
+    {
+        uint64_t mRetrievals;      ///< The number of times the section was retrieved.
+        uint64_t mTotalDurationUs; ///< The total time spent retrieving the section, in microseconds.
+        uint64_t mMaxDurationUs;   ///< The longest time spent retrieving the section, in microseconds.
+    };
+#endif // OTBR_ENABLE_TELEMETRY_DATA_API
+
     /**
      * The constructor of a Thread helper.
      *
@@ -115,6 +164,9 @@ public:
     /**
      * This method performs a Thread network scan.
      *
+     * Requests made while a scan is in progress are served by that scan, and the results of a scan which completed
+     * within the maximum cache age are reported without scanning again.
+     *
      * @param[in] aHandler  The scan result handler.
      *
      */
@@ -123,12 +175,31 @@ public:
     /**
      * This method performs an IEEE 802.15.4 Energy Scan.
      *
+     * Requests made while an energy scan of at least @p aScanDuration is in progress are served by that scan, and the
+     * results of such a scan which completed within the maximum cache age are reported without scanning again.
+     *
      * @param[in] aScanDuration  The duration for the scan, in milliseconds.
      * @param[in] aHandler       The scan result handler.
      *
      */
     void EnergyScan(uint32_t aScanDuration, EnergyScanHandler aHandler);
 
+    /**
+     * This method sets the maximum age of scan results which are reported instead of scanning again.
+     *
+     * @param[in] aMaxAge  The maximum age, zero to always scan.
+     *
+     */
+    void SetScanCacheMaxAge(Milliseconds aMaxAge) { mScanCacheMaxAge = aMaxAge; }
+
+    /**
+     * This method returns the statistics of active and energy scans.
+     *
+     * @returns The statistics of active and energy scans.
+     *
+     */
+    const ScanStats &GetScanStats(void) const { return mScanStats; }
+
     /**
      * This method attaches the device to the Thread network.
      *
@@ -263,13 +334,62 @@ public:
      * retrieve the remaining telemetries instead of the immediately return. The error code
      * OT_ERRROR_FAILED will be returned if there is one or more error(s) happened in the process.
      *
+     * Only the sections selected by @p aSections are retrieved, the other fields of @p telemetryData are left
+     * untouched.
+     *
      * @param[in] aPublisher     The Mdns::Publisher to provide MDNS telemetry if it is not `nullptr`.
      * @param[in] telemetryData  The telemetry data to be populated.
+     * @param[in] aSections      A bit mask of `TelemetrySection` values.
      *
      * @retval OTBR_ERROR_NONE  There is no error happened in the process.
      * @retval OT_ERRROR_FAILED There is one or more error(s) happened in the process.
      */
-    otError RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadnetwork::TelemetryData &telemetryData);
+    otError RetrieveTelemetryData(Mdns::Publisher              *aPublisher,
+                                  threadnetwork::TelemetryData &telemetryData,
+                                  uint32_t                      aSections = kTelemetrySectionsAll);
+
+    /**
+     * This method returns the cost of retrieving a telemetry section so far.
+     *
+     * The neighbor and child tables are read once per retrieval, and the read is accounted to the first requested
+     * section using them.
+     *
+     * @param[in] aSection  The telemetry section.
+     *
+     * @returns The retrieval statistics of @p aSection.
+     *
+     */
+    const TelemetrySectionStats &GetTelemetrySectionStats(TelemetrySection aSection) const;
+
+    /**
+     * This method converts a telemetry section to its name, which is the name of its `TelemetryData` field.
+     *
+     * @param[in] aSection  The telemetry section.
+     *
+     * @returns The name of @p aSection.
+     *
+     */
+    static const char *TelemetrySectionToString(TelemetrySection aSection);
+
+    /**
+     * This method parses a comma-separated list of telemetry section names, e.g. "wpan_stats,wpan_rcp".
+     *
+     * @param[in]  aNames     The section names.
+     * @param[out] aSections  The bit mask of the sections.
+     *
+     * @retval OT_ERROR_NONE          Successfully parsed the section names.
+     * @retval OT_ERROR_INVALID_ARGS  @p aNames contains an unknown section name.
+     *
+     */
+    static otError ParseTelemetrySections(const std::string &aNames, uint32_t &aSections);
+
+    /**
+     * This method returns the telemetry sampler.
+     *
+     * @returns The telemetry sampler.
+     *
+     */
+    TelemetrySampler &GetTelemetrySampler(void) { return mTelemetrySampler; }
 #endif // OTBR_ENABLE_TELEMETRY_DATA_API
 
     /**
@@ -302,14 +422,48 @@ private:
 
     void ActiveDatasetChangedCallback(void);
 
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    void    ReadNeighborAndChildTables(std::vector<otNeighborInfo> &aNeighborTable,
+                                       std::vector<otChildInfo>    &aChildTable);
+    otError RetrieveWpanStats(threadnetwork::TelemetryData &aTelemetryData);
+    otError RetrieveWpanTopoFull(threadnetwork::TelemetryData      &aTelemetryData,
+                                 const std::vector<otNeighborInfo> &aNeighborTable,
+                                 const std::vector<otChildInfo>    &aChildTable);
+    void    RetrieveTopoEntries(threadnetwork::TelemetryData      &aTelemetryData,
+                                const std::vector<otNeighborInfo> &aNeighborTable,
+                                const std::vector<otChildInfo>    &aChildTable);
+    void    RetrieveWpanBorderRouter(Mdns::Publisher *aPublisher, threadnetwork::TelemetryData &aTelemetryData);
+    void    RetrieveWpanRcp(threadnetwork::TelemetryData &aTelemetryData);
+    otError RetrieveCoexMetrics(threadnetwork::TelemetryData &aTelemetryData);
+#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+    void RetrieveLowPowerMetrics(threadnetwork::TelemetryData      &aTelemetryData,
+                                 const std::vector<otNeighborInfo> &aNeighborTable);
+#endif
+    void UpdateTelemetrySectionStats(uint8_t aIndex, Microseconds aDuration);
+#endif // OTBR_ENABLE_TELEMETRY_DATA_API
+
     otInstance *mInstance;
 
     otbr::Ncp::ControllerOpenThread *mNcp;
 
-    ScanHandler                     mScanHandler;
+    static constexpr auto kDefaultScanCacheMaxAge = Milliseconds(5000);
+
+    // The handlers of requests waiting for the scan in progress, empty if there's no scan in progress.
+    std::vector<ScanHandler>        mScanHandlers;
     std::vector<otActiveScanResult> mScanResults;
-    EnergyScanHandler               mEnergyScanHandler;
+    bool                            mScanResultsValid = false;
+    Timepoint                       mScanStartTime;
+    Timepoint                       mScanEndTime;
+
+    std::vector<EnergyScanHandler>  mEnergyScanHandlers;
     std::vector<otEnergyScanResult> mEnergyScanResults;
+    bool                            mEnergyScanResultsValid = false;
+    uint16_t                        mEnergyScanDuration     = 0;
+    Timepoint                       mEnergyScanStartTime;
+    Timepoint                       mEnergyScanEndTime;
+
+    Milliseconds mScanCacheMaxAge = kDefaultScanCacheMaxAge;
+    ScanStats    mScanStats       = {};
 
     std::vector<DeviceRoleHandler>    mDeviceRoleHandlers;
     std::vector<DatasetChangeHandler> mActiveDatasetChangeHandlers;
@@ -332,6 +486,11 @@ private:
     UpdateMeshCopTxtHandler mUpdateMeshCopTxtHandler;
 #endif
 
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    TelemetrySampler      mTelemetrySampler;
+    TelemetrySectionStats mTelemetrySectionStats[kNumTelemetrySections] = {};
+#endif
+
 #if OTBR_ENABLE_TELEMETRY_DATA_API && (OTBR_ENABLE_NAT64 || OTBR_ENABLE_DHCP6_PD)
     static constexpr uint8_t kNat64PdCommonHashSaltLength = 16;
     uint8_t                  mNat64PdCommonSalt[kNat64PdCommonHashSaltLength];
@@ -0,0 +1,299 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2024, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+# Load benchmark of the otbr-agent REST server and SRP advertising proxy.
+#
+# This script expects a running otbr-agent which has formed a Thread network
+# with its simulated RCP, see `run-benchmark`.
+#
+
+import argparse
+import json
+import os
+import pty
+import select
+import subprocess
+import threading
+import time
+import urllib.error
+import urllib.request
+
+
+class ProcessMonitor(object):
+    """Samples the CPU time and resident memory of a process."""
+
+    SAMPLE_INTERVAL = 0.1
+
+    def __init__(self, pid):
+        self._pid = pid
+        self._stop = threading.Event()
+        self._thread = None
+        self._start_cpu = 0.0
+        self._max_rss_kb = 0
+
+    def _cpu_seconds(self):
+        with open("/proc/{}/stat".format(self._pid)) as f:
+            # Fields after the command name, which may contain spaces.
+            fields = f.read().rsplit(")", 1)[1].split()
+        return (int(fields[11]) + int(fields[12])) / os.sysconf("SC_CLK_TCK")
+
+    def _rss_kb(self):
+        with open("/proc/{}/status".format(self._pid)) as f:
+            for line in f:
+                if line.startswith("VmRSS:"):
+                    return int(line.split()[1])
+        return 0
+
+    def _run(self):
+        while not self._stop.wait(self.SAMPLE_INTERVAL):
+            self._max_rss_kb = max(self._max_rss_kb, self._rss_kb())
+
+    def start(self):
+        self._stop.clear()
+        self._start_cpu = self._cpu_seconds()
+        self._max_rss_kb = self._rss_kb()
+        self._thread = threading.Thread(target=self._run)
+        self._thread.start()
+
+    def stop(self):
+        self._stop.set()
+        self._thread.join()
+        self._max_rss_kb = max(self._max_rss_kb, self._rss_kb())
+        return self._cpu_seconds() - self._start_cpu, self._max_rss_kb
+
+
+def percentile(sorted_values, percent):
+    if not sorted_values:
+        return None
+    index = int(round(percent / 100.0 * (len(sorted_values) - 1)))
+    return sorted_values[index]
+
+
+def make_result(name, clients, latencies, errors, duration, cpu_seconds,
+                max_rss_kb):
+    latencies = sorted(latencies)
+    completed = len(latencies)
+
+    return {
+        "name": name,
+        "clients": clients,
+        "completed": completed,
+        "errors": errors,
+        "duration_s": round(duration, 3),
+        "requests_per_sec": round(completed / duration, 2),
+        "latency_ms": {
+            "p50": round(percentile(latencies, 50) * 1000, 3)
+                   if latencies else None,
+            "p99": round(percentile(latencies, 99) * 1000, 3)
+                   if latencies else None,
+        },
+        "cpu_seconds": round(cpu_seconds, 3),
+        "cpu_percent": round(cpu_seconds / duration * 100, 1),
+        "max_rss_kb": max_rss_kb,
+    }
+
+
+def rest_scenario(monitor, rest_api_addr, path, clients, requests):
+    url = rest_api_addr + path
+    latencies = [[] for _ in range(clients)]
+    errors = [0] * clients
+
+    def client(index):
+        for _ in range(requests):
+            start = time.perf_counter()
+            try:
+                with urllib.request.urlopen(urllib.request.Request(url),
+                                            timeout=10) as response:
+                    response.read()
+                latencies[index].append(time.perf_counter() - start)
+            except (urllib.error.URLError, OSError):
+                errors[index] += 1
+
+    threads = [
+        threading.Thread(target=client, args=(i,)) for i in range(clients)
+    ]
+
+    monitor.start()
+    start = time.perf_counter()
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    duration = time.perf_counter() - start
+    cpu_seconds, max_rss_kb = monitor.stop()
+
+    return make_result("rest" + path.replace("/", "-"), clients,
+                       sum(latencies, []), sum(errors), duration, cpu_seconds,
+                       max_rss_kb)
+
+
+class CliNode(object):
+    """A simulated Thread node running the OpenThread CLI."""
+
+    def __init__(self, ot_cli, node_id):
+        self._master, slave = pty.openpty()
+        self._process = subprocess.Popen([ot_cli, str(node_id)],
+                                         stdin=slave,
+                                         stdout=slave,
+                                         stderr=subprocess.DEVNULL)
+        os.close(slave)
+        self._buffer = ""
+
+    def _read_line(self, deadline):
+        while "\n" not in self._buffer:
+            timeout = deadline - time.monotonic()
+            if timeout <= 0 or not select.select([self._master], [], [],
+                                                 timeout)[0]:
+                raise TimeoutError("CLI node did not respond")
+            self._buffer += os.read(self._master, 1024).decode(errors="ignore")
+        line, self._buffer = self._buffer.split("\n", 1)
+        return line.strip().lstrip("> ")
+
+    def command(self, cmd, timeout=10):
+        os.write(self._master, (cmd + "\n").encode())
+        deadline = time.monotonic() + timeout
+        output = []
+
+        while True:
+            line = self._read_line(deadline)
+            if line == "Done":
+                return output
+            if line.startswith("Error"):
+                raise RuntimeError("{}: {}".format(cmd, line))
+            if line and line != cmd:
+                output.append(line)
+
+    def close(self):
+        self._process.terminate()
+        self._process.wait()
+        os.close(self._master)
+
+
+def srp_scenario(monitor, rest_api_addr, ot_cli, clients, timeout):
+    request = urllib.request.Request(rest_api_addr + "/node/dataset/active",
+                                     headers={"Accept": "text/plain"})
+    dataset = urllib.request.urlopen(request).read().decode().strip()
+    nodes = [CliNode(ot_cli, 2 + i) for i in range(clients)]
+    latencies = []
+
+    try:
+        for node in nodes:
+            node.command("dataset set active " + dataset)
+            node.command("ifconfig up")
+            node.command("thread start")
+
+        deadline = time.monotonic() + timeout
+        for node in nodes:
+            while node.command("state")[0] not in ("child", "router"):
+                if time.monotonic() > deadline:
+                    raise TimeoutError("CLI node did not attach")
+                time.sleep(1)
+
+        monitor.start()
+        start = time.perf_counter()
+        for index, node in enumerate(nodes):
+            name = "otbr-bench-{}".format(index)
+            node.command("srp client host name " + name)
+            node.command("srp client host address auto")
+            node.command("srp client service add {} _otbr-bench._udp {}".format(
+                name, 10000 + index))
+            node.command("srp client autostart enable")
+
+        # The advertising proxy only acknowledges an SRP update once it is
+        # published on the infrastructure link, so this measures publishing.
+        pending = list(nodes)
+        deadline = time.monotonic() + timeout
+        while pending and time.monotonic() < deadline:
+            for node in list(pending):
+                if node.command("srp client host state")[0] == "Registered":
+                    latencies.append(time.perf_counter() - start)
+                    pending.remove(node)
+            time.sleep(0.05)
+        duration = time.perf_counter() - start
+        cpu_seconds, max_rss_kb = monitor.stop()
+    finally:
+        for node in nodes:
+            node.close()
+
+    return make_result("srp-register", clients, latencies, len(pending),
+                       duration, cpu_seconds, max_rss_kb)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Load benchmark of the otbr-agent REST server and SRP "
+        "advertising proxy.")
+    parser.add_argument("--pid",
+                        type=int,
+                        required=True,
+                        help="process ID of otbr-agent")
+    parser.add_argument("--rest-api-addr", default="http://0.0.0.0:8081")
+    parser.add_argument("--ot-cli", default="ot-cli-ftd")
+    parser.add_argument("--rest-clients", type=int, default=20)
+    parser.add_argument("--rest-requests",
+                        type=int,
+                        default=50,
+                        help="requests sent by each REST client")
+    parser.add_argument("--srp-clients", type=int, default=8)
+    parser.add_argument("--srp-timeout", type=float, default=120)
+    parser.add_argument("--output", default="benchmark.json")
+    args = parser.parse_args()
+
+    monitor = ProcessMonitor(args.pid)
+    scenarios = []
+
+    for path in ("/node", "/diagnostics"):
+        scenarios.append(
+            rest_scenario(monitor, args.rest_api_addr, path,
+                          args.rest_clients, args.rest_requests))
+
+    if args.srp_clients > 0:
+        scenarios.append(
+            srp_scenario(monitor, args.rest_api_addr, args.ot_cli,
+                         args.srp_clients, args.srp_timeout))
+
+    report = {
+        "timestamp": int(time.time()),
+        "scenarios": scenarios,
+    }
+
+    with open(args.output, "w") as f:
+        json.dump(report, f, indent=2)
+
+    for scenario in scenarios:
+        print(" {name} : {requests_per_sec} req/s, p50 {p50} ms, p99 {p99} ms, "
+              "errors {errors}, cpu {cpu_percent}%, rss {max_rss_kb} kB".format(
+                  p50=scenario["latency_ms"]["p50"],
+                  p99=scenario["latency_ms"]["p99"],
+                  **scenario))
+
+    assert all(scenario["errors"] == 0 for scenario in scenarios)
+
+
+if __name__ == "__main__":
+    main()
@@ -32,6 +32,8 @@
 #include <string.h>
 
 #include <memory>
+#include <set>
+#include <string>
 
 #include <dbus/dbus.h>
 #include <unistd.h>
@@ -327,9 +329,59 @@ void CheckTelemetryData(ThreadApiDBus *aApi)
 #if OTBR_ENABLE_LINK_METRICS_TELEMETRY
     TEST_ASSERT(telemetryData.low_power_metrics().link_metrics_entries_size() >= 0);
 #endif
+
+    responseTelemetryDataBytes.clear();
+    telemetryData.Clear();
+    TEST_ASSERT(aApi->GetTelemetryData(OTBR_DBUS_TELEMETRY_SECTION_WPAN_STATS, responseTelemetryDataBytes) ==
+                OTBR_ERROR_NONE);
+    TEST_ASSERT(telemetryData.ParseFromString(
+        std::string(responseTelemetryDataBytes.begin(), responseTelemetryDataBytes.end())));
+    TEST_ASSERT(telemetryData.has_wpan_stats());
+    TEST_ASSERT(!telemetryData.has_wpan_topo_full());
+    TEST_ASSERT(telemetryData.topo_entries_size() == 0);
 }
 #endif
 
+void CheckGetProperties(ThreadApiDBus *aApi)
+{
+    uint16_t    channel;
+    uint16_t    channelResult;
+    std::string name;
+    std::string nameResult;
+    uint64_t    extPanId;
+    uint64_t    extPanIdResult;
+
+    TEST_ASSERT(aApi->GetChannel(channel) == OTBR_ERROR_NONE);
+    TEST_ASSERT(aApi->GetNetworkName(name) == OTBR_ERROR_NONE);
+    TEST_ASSERT(aApi->GetExtPanId(extPanId) == OTBR_ERROR_NONE);
+    TEST_ASSERT(aApi->GetProperties({OTBR_DBUS_PROPERTY_CHANNEL, OTBR_DBUS_PROPERTY_NETWORK_NAME,
+                                     OTBR_DBUS_PROPERTY_EXTPANID},
+                                    channelResult, nameResult, extPanIdResult) == OTBR_ERROR_NONE);
+    TEST_ASSERT(channelResult == channel);
+    TEST_ASSERT(nameResult == name);
+    TEST_ASSERT(extPanIdResult == extPanId);
+    TEST_ASSERT(aApi->GetProperties({OTBR_DBUS_PROPERTY_CHANNEL}, channelResult, nameResult) ==
+                ClientError::OT_ERROR_INVALID_ARGS);
+}
+
+void CheckStartupPhases(ThreadApiDBus *aApi)
+{
+    std::vector<otbr::DBus::StartupPhase> phases;
+    std::set<std::string>                 names;
+
+    TEST_ASSERT(aApi->GetStartupPhases(phases) == OTBR_ERROR_NONE);
+    for (const auto &phase : phases)
+    {
+        printf("Startup phase %s: start %u ms, duration %u ms\n", phase.mName.c_str(), phase.mStartTime,
+               phase.mDuration);
+        names.insert(phase.mName);
+    }
+
+    TEST_ASSERT(names.count("ncp") == 1);
+    TEST_ASSERT(names.count("dbus") == 1);
+    TEST_ASSERT(names.count("thread-attach") == 1);
+}
+
 void CheckCapabilities(ThreadApiDBus *aApi)
 {
     std::vector<uint8_t> responseCapabilitiesBytes;
@@ -349,6 +401,64 @@ void CheckCapabilities(ThreadApiDBus *aApi)
     TEST_ASSERT(capabilities.nat64() == OTBR_ENABLE_NAT64);
 }
 
+static void DispatchFor(DBusConnection *aConnection, int aMilliseconds)
+{
+    for (int elapsed = 0; elapsed < aMilliseconds; elapsed += 100)
+    {
+        dbus_connection_read_write_dispatch(aConnection, 100);
+    }
+}
+
+void CheckPropertyCache(ThreadApiDBus &aOtherApi)
+{
+    DBusError                      error;
+    UniqueDBusConnection           connection;
+    std::unique_ptr<ThreadApiDBus> api;
+    std::vector<uint8_t>           datasetChannel11 = {0x00, 0x03, 0x00, 0x00, 0x0b}; // Channel TLV, channel 11
+    std::vector<uint8_t>           datasetChannel12 = {0x00, 0x03, 0x00, 0x00, 0x0c}; // Channel TLV, channel 12
+    std::vector<uint8_t>           originalDataset;
+    std::vector<uint8_t>           dataset;
+
+    // A private connection is only dispatched here, so the signals wait in its queue until `DispatchFor()`.
+    dbus_error_init(&error);
+    connection = UniqueDBusConnection(dbus_bus_get_private(DBUS_BUS_SYSTEM, &error));
+    TEST_ASSERT(connection != nullptr);
+
+    api = std::unique_ptr<ThreadApiDBus>(new ThreadApiDBus(connection.get()));
+    api->SetPropertyCacheEnabled(true);
+
+    TEST_ASSERT(api->GetActiveDatasetTlvs(originalDataset) == OTBR_ERROR_NONE);
+
+    TEST_ASSERT(api->SetActiveDatasetTlvs(datasetChannel11) == OTBR_ERROR_NONE);
+    DispatchFor(connection.get(), 2000);
+    TEST_ASSERT(api->GetActiveDatasetTlvs(dataset) == OTBR_ERROR_NONE);
+    TEST_ASSERT(dataset == datasetChannel11);
+
+    // Another client changes the value. Its signal is not dispatched yet, so the cached value is still served.
+    TEST_ASSERT(aOtherApi.SetActiveDatasetTlvs(datasetChannel12) == OTBR_ERROR_NONE);
+    TEST_ASSERT(api->GetActiveDatasetTlvs(dataset) == OTBR_ERROR_NONE);
+    TEST_ASSERT(dataset == datasetChannel11);
+
+    // The signal updates the cache.
+    DispatchFor(connection.get(), 2000);
+    TEST_ASSERT(api->GetActiveDatasetTlvs(dataset) == OTBR_ERROR_NONE);
+    TEST_ASSERT(dataset == datasetChannel12);
+
+    // Setting a property drops its cached value, so the new value is read back before its signal arrives.
+    TEST_ASSERT(api->SetActiveDatasetTlvs(datasetChannel11) == OTBR_ERROR_NONE);
+    TEST_ASSERT(api->GetActiveDatasetTlvs(dataset) == OTBR_ERROR_NONE);
+    TEST_ASSERT(dataset == datasetChannel11);
+
+    TEST_ASSERT(api->SetActiveDatasetTlvs(originalDataset) == OTBR_ERROR_NONE);
+    DispatchFor(connection.get(), 2000);
+    TEST_ASSERT(api->GetActiveDatasetTlvs(dataset) == OTBR_ERROR_NONE);
+    TEST_ASSERT(dataset == originalDataset);
+
+    api.reset();
+    dbus_connection_close(connection.get());
+    dbus_error_free(&error);
+}
+
 int main()
 {
     DBusError                      error;
@@ -378,6 +488,18 @@ int main()
 
     TEST_ASSERT(api->GetPreferredChannelMask(preferredChannelMask) == ClientError::ERROR_NONE);
 
+    TEST_ASSERT(api->GetPropertyAsync<std::string>(OTBR_DBUS_PROPERTY_RADIO_REGION,
+                                                   [&stepDone](ClientError aError, const std::string &aRegion) {
+                                                       TEST_ASSERT(aError == ClientError::ERROR_NONE);
+                                                       TEST_ASSERT(aRegion == "US");
+                                                       stepDone = true;
+                                                   }) == ClientError::ERROR_NONE);
+    while (!stepDone)
+    {
+        dbus_connection_read_write_dispatch(connection.get(), 0);
+    }
+    stepDone = false;
+
     api->EnergyScan(scanDuration, [&stepDone](const std::vector<EnergyScanResult> &aResult) {
         TEST_ASSERT(!aResult.empty());
         printf("Energy Scan:\n");
@@ -460,10 +582,12 @@ int main()
                             CheckMdnsInfo(api.get());
                             CheckDnssdCounters(api.get());
                             CheckNat64(api.get());
+                            CheckGetProperties(api.get());
 #if OTBR_ENABLE_TELEMETRY_DATA_API
                             CheckTelemetryData(api.get());
 #endif
                             CheckCapabilities(api.get());
+                            CheckStartupPhases(api.get());
                             api->FactoryReset(nullptr);
                             TEST_ASSERT(api->GetNetworkName(name) == OTBR_ERROR_NONE);
                             TEST_ASSERT(rloc16 != 0xffff);
@@ -529,6 +653,8 @@ int main()
         dbus_connection_read_write_dispatch(connection.get(), 0);
     }
 
+    CheckPropertyCache(*api);
+
 exit:
     dbus_error_free(&error);
     return 0;
@@ -0,0 +1,352 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file tests that the native mDNS publisher serves only the backbone interface.
+ *
+ *   It expects two veth pairs which are set up by the test-native-interface script. The publisher runs on the
+ *   backbone side of the first pair and the test sends legacy unicast queries from the peer sides of both pairs.
+ */
+
+#include <arpa/inet.h>
+#include <ifaddrs.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <climits>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/mainloop.hpp"
+#include "common/mainloop_manager.hpp"
+#include "mdns/mdns.hpp"
+
+#include <CppUTest/CommandLineTestRunner.h>
+#include <CppUTest/TestHarness.h>
+
+using namespace otbr;
+using namespace otbr::Mdns;
+
+TEST_GROUP(MdnsNative){};
+
+static constexpr int      kTimeoutSeconds = 3;
+static constexpr uint16_t kTypeAaaa       = 28;
+
+static const char kBackbone[]     = "mdns-bb0";
+static const char kBackbonePeer[] = "mdns-bb1";
+static const char kOther[]        = "mdns-ot0";
+static const char kOtherPeer[]    = "mdns-ot1";
+
+SimpleString StringFrom(const std::set<Ip6Address> &aAddresses)
+{
+    std::string result = "[";
+
+    for (const auto &address : aAddresses)
+    {
+        result += address.ToString() + ",";
+    }
+    result.back() = ']';
+
+    return SimpleString(result.c_str());
+}
+
+/**
+ * This function runs the mainloop for the given time and receives the first message on @p aSocket, if any.
+ *
+ */
+std::vector<uint8_t> RunMainloopUntilTimeout(int aSeconds, int aSocket = -1)
+{
+    std::vector<uint8_t> message;
+    auto                 beginTime = Clock::now();
+
+    while (Clock::now() - beginTime < std::chrono::seconds(aSeconds))
+    {
+        MainloopContext mainloop;
+        int             rval;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {1, 0};
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        MainloopManager::GetInstance().Update(mainloop);
+
+        if (aSocket >= 0 && message.empty())
+        {
+            FD_SET(aSocket, &mainloop.mReadFdSet);
+            mainloop.mMaxFd = std::max(mainloop.mMaxFd, aSocket);
+        }
+
+        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                      &mainloop.mTimeout);
+        VerifyOrDie(rval >= 0, strerror(errno));
+
+        MainloopManager::GetInstance().Process(mainloop);
+
+        if (aSocket >= 0 && message.empty() && FD_ISSET(aSocket, &mainloop.mReadFdSet))
+        {
+            uint8_t buffer[1500];
+            ssize_t length = recv(aSocket, buffer, sizeof(buffer), 0);
+
+            VerifyOrDie(length >= 0, strerror(errno));
+            message.assign(buffer, buffer + length);
+        }
+    }
+
+    return message;
+}
+
+std::unique_ptr<Publisher> CreatePublisher(void)
+{
+    bool                       ready = false;
+    std::unique_ptr<Publisher> publisher{Publisher::Create(
+        [&ready](Publisher::State aState) {
+            if (aState == Publisher::State::kReady)
+            {
+                ready = true;
+            }
+        },
+        kBackbone)};
+
+    publisher->Start();
+    RunMainloopUntilTimeout(kTimeoutSeconds);
+    CHECK_TRUE(ready);
+
+    return publisher;
+}
+
+std::set<Ip6Address> GetNetifAddresses(const char *aNetifName)
+{
+    std::set<Ip6Address> addresses;
+    ifaddrs             *ifAddrs = nullptr;
+
+    VerifyOrDie(getifaddrs(&ifAddrs) == 0, strerror(errno));
+
+    for (ifaddrs *ifAddr = ifAddrs; ifAddr != nullptr; ifAddr = ifAddr->ifa_next)
+    {
+        Ip6Address address;
+
+        if (ifAddr->ifa_addr == nullptr || ifAddr->ifa_addr->sa_family != AF_INET6 ||
+            strcmp(ifAddr->ifa_name, aNetifName) != 0)
+        {
+            continue;
+        }
+
+        address.CopyFrom(reinterpret_cast<const sockaddr_in6 *>(ifAddr->ifa_addr)->sin6_addr);
+        addresses.insert(address);
+    }
+
+    freeifaddrs(ifAddrs);
+
+    return addresses;
+}
+
+std::string GetLocalHostName(void)
+{
+    char        hostName[HOST_NAME_MAX + 1] = "";
+    std::string name;
+
+    gethostname(hostName, sizeof(hostName) - 1);
+    name = hostName;
+    name = name.substr(0, name.find('.'));
+
+    return name.empty() ? "otbr" : name;
+}
+
+size_t SkipName(const std::vector<uint8_t> &aMessage, size_t aOffset)
+{
+    while (aOffset < aMessage.size())
+    {
+        uint8_t length = aMessage[aOffset];
+
+        if (length == 0)
+        {
+            return aOffset + 1;
+        }
+
+        if ((length & 0xc0) == 0xc0)
+        {
+            return aOffset + 2;
+        }
+
+        aOffset += length + 1;
+    }
+
+    return aMessage.size();
+}
+
+uint16_t ReadUint16(const std::vector<uint8_t> &aMessage, size_t aOffset)
+{
+    return static_cast<uint16_t>((aMessage[aOffset] << 8) | aMessage[aOffset + 1]);
+}
+
+/**
+ * This function sends a legacy unicast AAAA query for @p aHostName on @p aNetifName and returns the answered
+ * addresses. The query is not looped back, so it only reaches the peer of @p aNetifName.
+ *
+ */
+std::set<Ip6Address> QueryAddresses(const char *aNetifName, const std::string &aHostName)
+{
+    std::set<Ip6Address> addresses;
+    std::vector<uint8_t> query = {0x12, 0x34, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0};
+    std::vector<uint8_t> response;
+    unsigned int         netifIndex = if_nametoindex(aNetifName);
+    const int            off        = 0;
+    int                  fd;
+    sockaddr_in6         dest;
+    size_t               offset;
+    uint16_t             questionCount;
+    uint16_t             answerCount;
+
+    for (const std::string &label : {aHostName, std::string("local")})
+    {
+        query.push_back(static_cast<uint8_t>(label.size()));
+        query.insert(query.end(), label.begin(), label.end());
+    }
+    query.insert(query.end(), {0, 0, kTypeAaaa, 0, 1});
+
+    fd = socket(AF_INET6, SOCK_DGRAM, IPPROTO_UDP);
+    VerifyOrDie(fd >= 0, strerror(errno));
+    VerifyOrDie(setsockopt(fd, IPPROTO_IPV6, IPV6_MULTICAST_IF, &netifIndex, sizeof(netifIndex)) == 0,
+                strerror(errno));
+    VerifyOrDie(setsockopt(fd, IPPROTO_IPV6, IPV6_MULTICAST_LOOP, &off, sizeof(off)) == 0, strerror(errno));
+
+    memset(&dest, 0, sizeof(dest));
+    dest.sin6_family   = AF_INET6;
+    dest.sin6_port     = htons(5353);
+    dest.sin6_scope_id = netifIndex;
+    inet_pton(AF_INET6, "ff02::fb", &dest.sin6_addr);
+    VerifyOrDie(sendto(fd, query.data(), query.size(), 0, reinterpret_cast<sockaddr *>(&dest), sizeof(dest)) ==
+                    static_cast<ssize_t>(query.size()),
+                strerror(errno));
+
+    response = RunMainloopUntilTimeout(kTimeoutSeconds, fd);
+    close(fd);
+    VerifyOrExit(response.size() >= 12);
+
+    questionCount = ReadUint16(response, 4);
+    answerCount   = ReadUint16(response, 6);
+    offset        = 12;
+
+    for (uint16_t i = 0; i < questionCount; i++)
+    {
+        offset = SkipName(response, offset) + 4;
+    }
+
+    for (uint16_t i = 0; i < answerCount && offset < response.size(); i++)
+    {
+        uint16_t type;
+        uint16_t length;
+
+        offset = SkipName(response, offset);
+        VerifyOrExit(offset + 10 <= response.size());
+        type   = ReadUint16(response, offset);
+        length = ReadUint16(response, offset + 8);
+        offset += 10;
+        VerifyOrExit(offset + length <= response.size());
+
+        if (type == kTypeAaaa && length == sizeof(in6_addr))
+        {
+            Ip6Address address;
+
+            memcpy(address.m8, &response[offset], sizeof(address.m8));
+            addresses.insert(address);
+        }
+
+        offset += length;
+    }
+
+exit:
+    return addresses;
+}
+
+Ip6Address sAddr1;
+
+void SetUp(void)
+{
+    otbrLogInit("test-mdns-native", OTBR_LOG_INFO, true, false);
+    SuccessOrDie(Ip6Address::FromString("2002::1", sAddr1), "");
+}
+
+void PublishTestHost(Publisher &aPublisher)
+{
+    otbrError published = OTBR_ERROR_ABORTED;
+
+    aPublisher.PublishHost("test-host", Publisher::AddressList{sAddr1},
+                           [&published](otbrError aError) { published = aError; });
+    RunMainloopUntilTimeout(kTimeoutSeconds);
+    CHECK_EQUAL(OTBR_ERROR_NONE, published);
+}
+
+TEST(MdnsNative, AnswerOnBackboneInterface)
+{
+    std::unique_ptr<Publisher> pub = CreatePublisher();
+
+    PublishTestHost(*pub);
+
+    CHECK_EQUAL(std::set<Ip6Address>{sAddr1}, QueryAddresses(kBackbonePeer, "test-host"));
+}
+
+TEST(MdnsNative, IgnoreQueryOnOtherInterface)
+{
+    std::unique_ptr<Publisher> pub = CreatePublisher();
+
+    PublishTestHost(*pub);
+
+    CHECK_TRUE(QueryAddresses(kOtherPeer, "test-host").empty());
+}
+
+TEST(MdnsNative, PublishOnlyBackboneAddresses)
+{
+    std::unique_ptr<Publisher> pub       = CreatePublisher();
+    std::set<Ip6Address>       addresses = QueryAddresses(kBackbonePeer, GetLocalHostName());
+
+    CHECK_FALSE(addresses.empty());
+    CHECK_EQUAL(GetNetifAddresses(kBackbone), addresses);
+
+    for (const Ip6Address &address : GetNetifAddresses(kOther))
+    {
+        CHECK_TRUE(addresses.count(address) == 0);
+    }
+}
+
+int main(int argc, const char *argv[])
+{
+    SetUp();
+
+    return RUN_ALL_TESTS(argc, argv);
+}
@@ -47,6 +47,26 @@ def get_data_from_url(url, result, index):
     result[index] = data
 
 
+def get_events_from_url(url, result, index):
+    expected_events = [
+        "state", "network-name", "leader-data", "dataset-active",
+        "dataset-pending"
+    ]
+    response = urllib.request.urlopen(urllib.request.Request(url), timeout=5)
+    events = {}
+    name = None
+
+    while not all(event in events for event in expected_events):
+        line = response.readline().decode().rstrip("\n")
+        if line.startswith("event: "):
+            name = line[len("event: "):]
+        elif line.startswith("data: "):
+            events[name] = json.loads(line[len("data: "):])
+
+    response.close()
+    result[index] = events
+
+
 def get_error_from_url(url, result, index):
     try:
         urllib.request.urlopen(urllib.request.Request(url))
@@ -296,6 +316,17 @@ def node_ext_panid_check(data):
     return True
 
 
+def events_check(data):
+    assert data is not None
+
+    assert (type(data["state"]) == str)
+    assert (type(data["network-name"]) == str)
+    assert (data["leader-data"] is None or
+            node_leader_data_check(data["leader-data"]))
+
+    return True
+
+
 def node_test(thread_num):
     url = rest_api_addr + "/node"
 
@@ -428,6 +459,129 @@ def diagnostics_test(thread_num):
         thread_num, has_content, valid))
 
 
+def events_test(thread_num):
+    url = rest_api_addr + "/events"
+
+    response_data = [None] * thread_num
+
+    create_multi_thread(get_events_from_url, url, thread_num, response_data)
+
+    valid = [events_check(data) for data in response_data].count(True)
+
+    print(" /events : all {}, valid {} ".format(thread_num, valid))
+
+
+def not_modified_test(path):
+    url = rest_api_addr + path
+
+    response = urllib.request.urlopen(urllib.request.Request(url))
+    etag = response.headers["ETag"]
+    assert etag is not None
+
+    try:
+        urllib.request.urlopen(
+            urllib.request.Request(url, headers={"If-None-Match": etag}))
+        assert False
+
+    except urllib.error.HTTPError as e:
+        assert (e.code == 304)
+        assert (e.headers["ETag"] == etag)
+
+    print(" {} : not modified, valid".format(path))
+
+
+def metrics_test():
+    url = rest_api_addr + "/metrics"
+
+    response = urllib.request.urlopen(urllib.request.Request(url))
+    assert response.headers["Content-Type"].startswith("text/plain")
+
+    samples = {}
+    for line in response.read().decode().splitlines():
+        if line and not line.startswith("#"):
+            name, value = line.rsplit(" ", 1)
+            samples[name] = float(value)
+
+    assert samples["otbr_thread_role"] == 4
+    assert samples["otbr_uptime_milliseconds"] > 0
+    assert samples["otbr_rest_worker_threads"] >= 1
+    assert samples['otbr_rest_worker_connections{worker="0"}'] >= 0
+
+    print(" /metrics : all {}, valid".format(len(samples)))
+
+
+def get_collection_page(path, query):
+    response = urllib.request.urlopen(
+        urllib.request.Request(rest_api_addr + path + "?" + query))
+    assert response.headers["Transfer-Encoding"] == "chunked"
+
+    return json.loads(response.read().decode())
+
+
+def bad_collection_query_check(path, query):
+    try:
+        urllib.request.urlopen(
+            urllib.request.Request(rest_api_addr + path + "?" + query))
+        assert False
+
+    except urllib.error.HTTPError as e:
+        assert (e.code == 400)
+
+
+def collection_test(path):
+    data = get_collection_page(path, "limit=10&fields=Rloc16")
+    assert len(data["Items"]) <= 10
+    assert all(list(item.keys()) == ["Rloc16"] for item in data["Items"])
+
+    # Follow the cursors one entry at a time, every entry must be returned
+    # exactly once.
+    expected = sorted(item["ExtAddress"]
+                      for item in get_collection_page(path, "fields=ExtAddress")
+                      ["Items"])
+    paged = []
+    page = get_collection_page(path, "limit=1&fields=ExtAddress")
+
+    while True:
+        assert len(page["Items"]) <= 1
+        paged += [item["ExtAddress"] for item in page["Items"]]
+        if "Next" not in page:
+            break
+        page = get_collection_page(
+            path, "limit=1&fields=ExtAddress&cursor=" + page["Next"])
+
+    assert len(paged) == len(set(paged))
+    assert sorted(paged) == expected
+
+    bad_collection_query_check(path, "limit=0")
+    bad_collection_query_check(path, "cursor=abc")
+    bad_collection_query_check(path, "cursor=4294967296")
+    bad_collection_query_check(path, "fields=Rloc16,NoSuchField")
+    bad_collection_query_check(path, "fields=")
+
+    print(" {} : all {}, valid".format(path, len(expected)))
+
+
+def neighbors_paging_test():
+    # The router neighbors follow the children, page through both kinds.
+    kinds = []
+    page = get_collection_page("/node/neighbors", "limit=1&fields=IsChild")
+
+    while True:
+        kinds += [item["IsChild"] for item in page["Items"]]
+        if "Next" not in page:
+            break
+        page = get_collection_page("/node/neighbors",
+                                   "limit=1&fields=IsChild&cursor=" + page["Next"])
+
+    assert True in kinds and False in kinds
+    assert kinds == sorted(kinds, reverse=True)
+
+    bad_collection_query_check("/node/neighbors", "cursor=65536")
+
+    print(" /node/neighbors : {} children and {} routers paged, valid".format(
+        kinds.count(True), kinds.count(False)))
+
+
 def error_test(thread_num):
     url = rest_api_addr + "/hello"
 
@@ -451,6 +605,14 @@ def main():
     node_num_of_router_test(200)
     node_ext_panid_test(200)
     diagnostics_test(20)
+    events_test(20)
+    not_modified_test("/node")
+    not_modified_test("/node/leader-data")
+    not_modified_test("/node/dataset/active")
+    metrics_test()
+    collection_test("/node/children")
+    collection_test("/node/neighbors")
+    neighbors_paging_test()
     error_test(10)
 
     return 0
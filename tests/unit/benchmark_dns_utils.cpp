@@ -0,0 +1,145 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/dns_utils.hpp"
+
+#include <chrono>
+
+#include <stdio.h>
+
+#include <CppUTest/TestHarness.h>
+
+#include "utils/string_utils.hpp"
+
+TEST_GROUP(DnsUtilsBenchmark){};
+
+// The implementation of `SplitFullDnsName()` before `ParseFullDnsName()`, as the baseline of the benchmark.
+static DnsNameInfo LegacySplitFullDnsName(const std::string &aName)
+{
+    size_t      transportPos;
+    DnsNameInfo nameInfo;
+    std::string fullName = aName;
+
+    if (fullName.empty() || fullName.back() != '.')
+    {
+        fullName += '.';
+    }
+
+    transportPos = fullName.rfind("._udp.");
+
+    if (transportPos == std::string::npos)
+    {
+        transportPos = fullName.rfind("._tcp.");
+    }
+
+    if (transportPos == std::string::npos)
+    {
+        size_t dotPos = fullName.find_first_of('.');
+
+        nameInfo.mHostName = fullName.substr(0, dotPos);
+        nameInfo.mDomain   = fullName.substr(dotPos + 1, fullName.length() - dotPos - 1);
+    }
+    else
+    {
+        size_t dotPos = transportPos > 0 ? fullName.find_last_of('.', transportPos - 1) : std::string::npos;
+
+        nameInfo.mDomain = fullName.substr(transportPos + 6);
+
+        if (dotPos == std::string::npos)
+        {
+            nameInfo.mServiceName = fullName.substr(0, transportPos + 5);
+        }
+        else
+        {
+            nameInfo.mInstanceName = fullName.substr(0, dotPos);
+            nameInfo.mServiceName  = fullName.substr(dotPos + 1, transportPos + 4 - dotPos);
+        }
+    }
+
+    if (nameInfo.mDomain.empty() || nameInfo.mDomain.back() != '.')
+    {
+        nameInfo.mDomain += '.';
+    }
+
+    return nameInfo;
+}
+
+TEST(DnsUtilsBenchmark, ParseFullDnsName)
+{
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr int kIterations = 20000;
+
+    const char *names[] = {
+        "Living Room Light._matter._tcp.default.service.arpa.",
+        "_meshcop._udp.default.service.arpa.",
+        "ot-host-1234abcd.default.service.arpa.",
+        "Printer._ipps._tcp.local.",
+    };
+    constexpr size_t kNumNames = sizeof(names) / sizeof(names[0]);
+
+    size_t            legacyMatches = 0;
+    size_t            matches       = 0;
+    Clock::time_point start;
+    Clock::duration   legacyTime;
+    Clock::duration   time;
+
+    // Matches each name against a service type as the Discovery Proxy does for each query.
+    start = Clock::now();
+    for (int i = 0; i < kIterations; i++)
+    {
+        for (const char *name : names)
+        {
+            DnsNameInfo info = LegacySplitFullDnsName(name);
+
+            legacyMatches += otbr::StringUtils::EqualCaseInsensitive(info.mServiceName, "_MATTER._tcp");
+        }
+    }
+    legacyTime = Clock::now() - start;
+
+    start = Clock::now();
+    for (int i = 0; i < kIterations; i++)
+    {
+        for (const char *name : names)
+        {
+            DnsNameParts parts = ParseFullDnsName(name);
+
+            matches += parts.mServiceName.EqualsCaseInsensitive(DnsNameView("_MATTER._tcp"));
+        }
+    }
+    time = Clock::now() - start;
+
+    // Only the results are checked, the figures depend on the host.
+    CHECK_EQUAL(legacyMatches, matches);
+
+    printf("\nSplitFullDnsName: %lld ns/name, ParseFullDnsName: %lld ns/name\n",
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(legacyTime).count() /
+                                  (kIterations * kNumNames)),
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(time).count() /
+                                  (kIterations * kNumNames)));
+}
@@ -0,0 +1,172 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "utils/hex.hpp"
+
+#include <chrono>
+
+#include <stdio.h>
+#include <string.h>
+
+#include <CppUTest/TestHarness.h>
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr int kIterations = 2000;
+
+TEST_GROUP(HexBenchmark){};
+
+// The implementation of `Bytes2Hex()` before the table-driven encoder, as the baseline of the benchmark.
+static size_t LegacyBytes2Hex(const uint8_t *aBytes, const uint16_t aBytesLength, char *aHex)
+{
+    char byteHex[3];
+
+    aHex[0] = '\0';
+
+    for (int i = 0; i < aBytesLength; i++)
+    {
+        snprintf(byteHex, sizeof(byteHex), "%02X", aBytes[i]);
+        strcat(aHex, byteHex);
+    }
+
+    return strlen(aHex);
+}
+
+// The implementation of `Hex2Bytes()` before the table-driven decoder, as the baseline of the benchmark.
+static int LegacyHex2Bytes(const char *aHex, uint8_t *aBytes, uint16_t aBytesLength)
+{
+    size_t      hexLength = strlen(aHex);
+    const char *hexEnd    = aHex + hexLength;
+    uint8_t    *cur       = aBytes;
+    uint8_t     numChars  = hexLength & 1;
+    uint8_t     byte      = 0;
+
+    if ((hexLength + 1) / 2 > aBytesLength)
+    {
+        return -1;
+    }
+
+    while (aHex < hexEnd)
+    {
+        if ('A' <= *aHex && *aHex <= 'F')
+        {
+            byte |= 10 + (*aHex - 'A');
+        }
+        else if ('a' <= *aHex && *aHex <= 'f')
+        {
+            byte |= 10 + (*aHex - 'a');
+        }
+        else if ('0' <= *aHex && *aHex <= '9')
+        {
+            byte |= *aHex - '0';
+        }
+        else
+        {
+            return -1;
+        }
+
+        aHex++;
+        numChars++;
+
+        if (numChars >= 2)
+        {
+            numChars = 0;
+            *cur++   = byte;
+            byte     = 0;
+        }
+        else
+        {
+            byte <<= 4;
+        }
+    }
+
+    return static_cast<int>(cur - aBytes);
+}
+
+static long long NanosecondsPerIteration(Clock::duration aDuration)
+{
+    return static_cast<long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(aDuration).count() /
+                                  kIterations);
+}
+
+TEST(HexBenchmark, Bytes2HexAndHex2Bytes)
+{
+    uint8_t           tlvs[254]; // The size of an Operational Dataset.
+    uint8_t           legacyBytes[sizeof(tlvs)];
+    uint8_t           bytes[sizeof(tlvs)];
+    char              legacyHex[2 * sizeof(tlvs) + 1];
+    char              hex[2 * sizeof(tlvs) + 1];
+    Clock::time_point start;
+    Clock::duration   legacyEncodeTime;
+    Clock::duration   encodeTime;
+    Clock::duration   legacyDecodeTime;
+    Clock::duration   decodeTime;
+
+    for (size_t i = 0; i < sizeof(tlvs); i++)
+    {
+        tlvs[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    start = Clock::now();
+    for (int i = 0; i < kIterations; i++)
+    {
+        LegacyBytes2Hex(tlvs, sizeof(tlvs), legacyHex);
+    }
+    legacyEncodeTime = Clock::now() - start;
+
+    start = Clock::now();
+    for (int i = 0; i < kIterations; i++)
+    {
+        otbr::Utils::Bytes2Hex(tlvs, sizeof(tlvs), hex);
+    }
+    encodeTime = Clock::now() - start;
+
+    start = Clock::now();
+    for (int i = 0; i < kIterations; i++)
+    {
+        LegacyHex2Bytes(legacyHex, legacyBytes, sizeof(legacyBytes));
+    }
+    legacyDecodeTime = Clock::now() - start;
+
+    start = Clock::now();
+    for (int i = 0; i < kIterations; i++)
+    {
+        otbr::Utils::Hex2Bytes(hex, bytes, sizeof(bytes));
+    }
+    decodeTime = Clock::now() - start;
+
+    // Only the results are checked, the figures depend on the host.
+    STRCMP_EQUAL(legacyHex, hex);
+    MEMCMP_EQUAL(tlvs, legacyBytes, sizeof(tlvs));
+    MEMCMP_EQUAL(tlvs, bytes, sizeof(tlvs));
+
+    printf("\nBytes2Hex of %zu bytes: legacy %lld ns, table-driven %lld ns\n", sizeof(tlvs),
+           NanosecondsPerIteration(legacyEncodeTime), NanosecondsPerIteration(encodeTime));
+    printf("Hex2Bytes of %zu bytes: legacy %lld ns, table-driven %lld ns\n", sizeof(tlvs),
+           NanosecondsPerIteration(legacyDecodeTime), NanosecondsPerIteration(decodeTime));
+}
@@ -32,6 +32,8 @@
 
 #include <CppUTest/TestHarness.h>
 
+#include "utils/dns_utils.hpp"
+
 TEST_GROUP(DnsUtils){};
 
 static void CheckSplitFullDnsName(const std::string &aFullName,
@@ -66,6 +68,20 @@ static void CheckSplitFullDnsName(const std::string &aFullName,
     CHECK_EQUAL(aServiceName, info.mServiceName);
     CHECK_EQUAL(aHostName, info.mHostName);
     CHECK_EQUAL(aDomain, info.mDomain);
+
+    for (const std::string &name : {aFullName, aFullName + "."})
+    {
+        DnsNameParts parts = ParseFullDnsName(name.c_str());
+
+        CHECK_EQUAL(aIsServiceInstance, parts.IsServiceInstance());
+        CHECK_EQUAL(aIsService, parts.IsService());
+        CHECK_EQUAL(aIsHost, parts.IsHost());
+        CHECK_EQUAL(aInstanceName, parts.mInstanceName.ToString());
+        CHECK_EQUAL(aServiceName, parts.mServiceName.ToString());
+        CHECK_EQUAL(aHostName, parts.mHostName.ToString());
+        CHECK_EQUAL(aDomain, parts.GetDomainWithDot());
+        CHECK(parts.mDomain.IsEmpty() || parts.mDomain.GetData()[parts.mDomain.GetLength() - 1] != '.');
+    }
 }
 
 TEST(DnsUtils, TestSplitFullDnsName)
@@ -95,3 +111,65 @@ TEST(DnsUtils, TestSplitFullDnsName)
     CheckSplitFullDnsName("com", false, false, true, "", "", "com", ".");
     CheckSplitFullDnsName("", false, false, true, "", "", "", ".");
 }
+
+TEST(DnsUtils, TestDnsNameViewEqualsCaseInsensitive)
+{
+    DnsNameParts parts = ParseFullDnsName("My-Instance._IPPS._tcp.Default.Service.Arpa.");
+
+    CHECK_TRUE(parts.mInstanceName.EqualsCaseInsensitive(std::string("my-instance")));
+    CHECK_TRUE(parts.mServiceName.EqualsCaseInsensitive(std::string("_ipps._TCP")));
+    CHECK_TRUE(parts.mDomain.EqualsCaseInsensitive(DnsNameView("DEFAULT.service.arpa")));
+    CHECK_FALSE(parts.mDomain.EqualsCaseInsensitive(DnsNameView("default.service.arpa.")));
+    CHECK_FALSE(parts.mServiceName.EqualsCaseInsensitive(std::string("_ipps._udp")));
+    CHECK_TRUE(DnsNameView().EqualsCaseInsensitive(parts.mHostName));
+}
+
+TEST(DnsUtils, TestUnescapeInstanceName)
+{
+    std::string escaped = "Living\\ Room\\.\\065\\";
+    char        buffer[32];
+    size_t      length;
+
+    length = otbr::DnsUtils::UnescapeInstanceName(escaped, buffer);
+
+    CHECK_EQUAL(std::string("Living Room.A\\"), std::string(buffer, length));
+    CHECK_EQUAL(std::string("Living Room.A\\"), otbr::DnsUtils::UnescapeInstanceName(escaped));
+}
+
+TEST(DnsUtils, TestParseFullDnsNameTable)
+{
+    struct Split
+    {
+        const char *mFullName;
+        const char *mInstanceName;
+        const char *mServiceName;
+        const char *mHostName;
+        const char *mDomain;
+    };
+
+    static const Split kSplits[] = {
+        {"Living Room Light._matter._tcp.default.service.arpa.", "Living Room Light", "_matter._tcp", "",
+         "default.service.arpa."},
+        {"_meshcop._udp.default.service.arpa.", "", "_meshcop._udp", "", "default.service.arpa."},
+        {"ot-host-1234abcd.default.service.arpa.", "", "", "ot-host-1234abcd", "default.service.arpa."},
+        {"Printer._ipps._tcp.local.", "Printer", "_ipps._tcp", "", "local."},
+        {"_tcp.local", "", "", "_tcp", "local."},
+        {".", "", "", "", "."},
+    };
+
+    for (const Split &split : kSplits)
+    {
+        DnsNameParts parts = ParseFullDnsName(split.mFullName);
+        DnsNameInfo  info  = SplitFullDnsName(split.mFullName);
+
+        CHECK_EQUAL(std::string(split.mInstanceName), parts.mInstanceName.ToString());
+        CHECK_EQUAL(std::string(split.mServiceName), parts.mServiceName.ToString());
+        CHECK_EQUAL(std::string(split.mHostName), parts.mHostName.ToString());
+        CHECK_EQUAL(std::string(split.mDomain), parts.GetDomainWithDot());
+
+        CHECK_EQUAL(info.mInstanceName, parts.mInstanceName.ToString());
+        CHECK_EQUAL(info.mServiceName, parts.mServiceName.ToString());
+        CHECK_EQUAL(info.mHostName, parts.mHostName.ToString());
+        CHECK_EQUAL(info.mDomain, parts.GetDomainWithDot());
+    }
+}
@@ -0,0 +1,120 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "utils/hex.hpp"
+
+#include <string.h>
+
+#include <CppUTest/TestHarness.h>
+
+#include "common/types.hpp"
+
+TEST_GROUP(Hex){};
+
+TEST(Hex, TestBytes2Hex)
+{
+    const uint8_t bytes[] = {0x00, 0x1f, 0xa0, 0xff, 0x5c};
+    char          hex[2 * sizeof(bytes) + 1];
+
+    CHECK_EQUAL(10, otbr::Utils::Bytes2Hex(bytes, sizeof(bytes), hex));
+    STRCMP_EQUAL("001FA0FF5C", hex);
+    CHECK_EQUAL(10, otbr::Utils::Bytes2LowercaseHex(bytes, sizeof(bytes), hex));
+    STRCMP_EQUAL("001fa0ff5c", hex);
+    CHECK_EQUAL(std::string("001FA0FF5C"), otbr::Utils::Bytes2Hex(bytes, sizeof(bytes)));
+    CHECK_EQUAL(std::string(""), otbr::Utils::Bytes2Hex(bytes, 0));
+}
+
+TEST(Hex, TestLong2Hex)
+{
+    char hex[17];
+
+    CHECK_EQUAL(16, otbr::Utils::Long2Hex(0x0123456789abcdefULL, hex));
+    STRCMP_EQUAL("EFCDAB8967452301", hex);
+}
+
+TEST(Hex, TestHex2Bytes)
+{
+    uint8_t bytes[4];
+
+    CHECK_EQUAL(3, otbr::Utils::Hex2Bytes("001fA0", bytes, sizeof(bytes)));
+    CHECK_EQUAL(0x00, bytes[0]);
+    CHECK_EQUAL(0x1f, bytes[1]);
+    CHECK_EQUAL(0xa0, bytes[2]);
+
+    CHECK_EQUAL(2, otbr::Utils::Hex2Bytes("abc", bytes, sizeof(bytes)));
+    CHECK_EQUAL(0x0a, bytes[0]);
+    CHECK_EQUAL(0xbc, bytes[1]);
+
+    CHECK_EQUAL(0, otbr::Utils::Hex2Bytes("", bytes, sizeof(bytes)));
+    CHECK_EQUAL(-1, otbr::Utils::Hex2Bytes("0011223344", bytes, sizeof(bytes)));
+    CHECK_EQUAL(-1, otbr::Utils::Hex2Bytes("00g1", bytes, sizeof(bytes)));
+    CHECK_EQUAL(-1, otbr::Utils::Hex2Bytes("0x11", bytes, sizeof(bytes)));
+}
+
+TEST(Hex, TestAddressToString)
+{
+    const uint8_t    addressBytes[16] = {0xfd, 0x11, 0x22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01};
+    otbr::Ip6Address address(addressBytes);
+    otbr::Ip6Prefix  prefix;
+    otbr::MacAddress macAddress;
+    char             addressString[otbr::Ip6Address::kStringSize];
+    char             prefixString[otbr::Ip6Prefix::kStringSize];
+    char             macAddressString[otbr::MacAddress::kStringSize];
+
+    STRCMP_EQUAL("fd11:2200::1", address.ToString(addressString));
+    CHECK_EQUAL(std::string("fd11:2200::1"), address.ToString());
+
+    prefix.mPrefix = address;
+    prefix.mLength = 128;
+    STRCMP_EQUAL("fd11:2200::1/128", prefix.ToString(prefixString));
+    CHECK_EQUAL(std::string("fd11:2200::1/128"), prefix.ToString());
+
+    memcpy(macAddress.m8, addressBytes, sizeof(macAddress.m8));
+    STRCMP_EQUAL("fd:11:22:00:00:00", macAddress.ToString(macAddressString));
+    CHECK_EQUAL(std::string("fd:11:22:00:00:00"), macAddress.ToString());
+}
+
+TEST(Hex, TestRoundTrip)
+{
+    uint8_t bytes[256];
+    uint8_t decoded[sizeof(bytes)];
+    char    hex[2 * sizeof(bytes) + 1];
+
+    for (size_t i = 0; i < sizeof(bytes); i++)
+    {
+        bytes[i] = static_cast<uint8_t>(i);
+    }
+
+    CHECK_EQUAL(2 * sizeof(bytes), otbr::Utils::Bytes2Hex(bytes, sizeof(bytes), hex));
+    CHECK_EQUAL(static_cast<int>(sizeof(bytes)), otbr::Utils::Hex2Bytes(hex, decoded, sizeof(decoded)));
+    MEMCMP_EQUAL(bytes, decoded, sizeof(bytes));
+
+    CHECK_EQUAL(2 * sizeof(bytes), otbr::Utils::Bytes2LowercaseHex(bytes, sizeof(bytes), hex));
+    CHECK_EQUAL(static_cast<int>(sizeof(bytes)), otbr::Utils::Hex2Bytes(hex, decoded, sizeof(decoded)));
+    MEMCMP_EQUAL(bytes, decoded, sizeof(bytes));
+}
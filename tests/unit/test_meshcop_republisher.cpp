@@ -0,0 +1,155 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "border_agent/meshcop_republisher.hpp"
+
+#include <map>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::MeshCopRepublisher;
+using otbr::Milliseconds;
+using otbr::TaskRunner;
+using otbr::Timepoint;
+
+namespace {
+
+// Runs on a fake clock, a test advances the time and fires the republish when it's due without sleeping.
+class FakeMeshCopRepublisher : public MeshCopRepublisher
+{
+public:
+    FakeMeshCopRepublisher(void)
+        : MeshCopRepublisher([this]() { mNumRepublishes++; })
+        , mNumRepublishes(0)
+        , mNow(otbr::Clock::now())
+        , mNextTaskId(1)
+    {
+    }
+
+    size_t GetNumScheduled(void) const { return mDeadlines.size(); }
+
+    void AdvanceTime(Milliseconds aDuration)
+    {
+        Timepoint end = mNow + aDuration;
+
+        while (!mDeadlines.empty() && mDeadlines.begin()->second <= end)
+        {
+            mNow = mDeadlines.begin()->second;
+            mDeadlines.erase(mDeadlines.begin());
+            HandleRepublishTimer();
+        }
+
+        mNow = end;
+    }
+
+    uint32_t mNumRepublishes;
+
+private:
+    TaskRunner::TaskId ScheduleRepublish(Milliseconds aDelay) override
+    {
+        mDeadlines[mNextTaskId] = mNow + aDelay;
+
+        return mNextTaskId++;
+    }
+
+    void CancelRepublish(TaskRunner::TaskId aTaskId) override { mDeadlines.erase(aTaskId); }
+
+    Timepoint                               mNow;
+    TaskRunner::TaskId                      mNextTaskId;
+    std::map<TaskRunner::TaskId, Timepoint> mDeadlines;
+};
+
+} // namespace
+
+TEST_GROUP(MeshCopRepublisher){};
+
+TEST(MeshCopRepublisher, TestMergeUpdates)
+{
+    FakeMeshCopRepublisher republisher;
+
+    republisher.Update();
+    CHECK_EQUAL(1U, republisher.GetNumScheduled());
+
+    republisher.AdvanceTime(Milliseconds(100));
+    republisher.Update();
+    republisher.Update();
+    CHECK_EQUAL(1U, republisher.GetNumScheduled());
+    CHECK_EQUAL(2U, republisher.GetCounters().mCoalescedUpdates);
+
+    // The window starts with the first update and isn't extended by the merged ones.
+    republisher.AdvanceTime(Milliseconds(99));
+    CHECK_EQUAL(0U, republisher.mNumRepublishes);
+    republisher.AdvanceTime(Milliseconds(1));
+    CHECK_EQUAL(1U, republisher.mNumRepublishes);
+    CHECK_EQUAL(0U, republisher.GetNumScheduled());
+
+    // An update after the window starts a new one.
+    republisher.Update();
+    republisher.AdvanceTime(MeshCopRepublisher::kRepublishDelay);
+    CHECK_EQUAL(2U, republisher.mNumRepublishes);
+    CHECK_EQUAL(2U, republisher.GetCounters().mCoalescedUpdates);
+}
+
+TEST(MeshCopRepublisher, TestCancel)
+{
+    FakeMeshCopRepublisher republisher;
+
+    republisher.Update();
+    republisher.Cancel();
+    CHECK_EQUAL(0U, republisher.GetNumScheduled());
+    republisher.AdvanceTime(Milliseconds(1000));
+    CHECK_EQUAL(0U, republisher.mNumRepublishes);
+
+    // Nothing is pending after a cancel, so the next update isn't merged.
+    republisher.Update();
+    CHECK_EQUAL(0U, republisher.GetCounters().mCoalescedUpdates);
+    republisher.AdvanceTime(Milliseconds(200));
+    CHECK_EQUAL(1U, republisher.mNumRepublishes);
+}
+
+TEST(MeshCopRepublisher, TestDetectChanges)
+{
+    FakeMeshCopRepublisher         republisher;
+    otbr::Mdns::Publisher::TxtData txtData{1, 2, 3};
+
+    CHECK(republisher.ShouldPublish(txtData, 49152));
+    CHECK(!republisher.ShouldPublish(txtData, 49152));
+
+    // The port changes once the Border Agent starts.
+    CHECK(republisher.ShouldPublish(txtData, 49191));
+    CHECK(!republisher.ShouldPublish(txtData, 49191));
+
+    txtData.push_back(4);
+    CHECK(republisher.ShouldPublish(txtData, 49191));
+
+    // A failed publish, an unpublish or a restart of the mDNS publisher forgets the published service.
+    republisher.ForgetPublished();
+    CHECK(republisher.ShouldPublish(txtData, 49191));
+
+    CHECK_EQUAL(4U, republisher.GetCounters().mIssuedRepublishes);
+    CHECK_EQUAL(2U, republisher.GetCounters().mSuppressedRepublishes);
+}
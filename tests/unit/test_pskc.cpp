@@ -62,3 +62,31 @@ TEST(Pskc, Test_TruncatedNetworkNamePskc_OpenThread)
 
     MEMCMP_EQUAL(expected, pskc, OT_PSKC_LENGTH);
 }
+
+TEST(Pskc, TestBatchMatchesSingle)
+{
+    std::vector<otbr::Psk::Pskc::Params> params(8);
+    std::vector<otbr::Psk::Pskc::Value>  pskcs;
+
+    for (size_t i = 0; i < params.size(); i++)
+    {
+        uint8_t extpanid[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, static_cast<uint8_t>(i)};
+
+        memcpy(params[i].mExtPanId, extpanid, sizeof(extpanid));
+        params[i].mNetworkName = "OpenThread";
+        // A 16-byte passphrase is used directly as the AES-CMAC-PRF-128 key, other lengths are derived.
+        params[i].mPassphrase = (i % 2 == 0) ? "123456" : "0123456789abcdef";
+    }
+
+    otbr::Psk::Pskc::ComputePskcs(params, pskcs, 3);
+
+    CHECK_EQUAL(params.size(), pskcs.size());
+
+    for (size_t i = 0; i < params.size(); i++)
+    {
+        const uint8_t *pskc =
+            mPSKc.ComputePskc(params[i].mExtPanId, params[i].mNetworkName.c_str(), params[i].mPassphrase.c_str());
+
+        MEMCMP_EQUAL(pskc, pskcs[i].data(), OT_PSKC_LENGTH);
+    }
+}
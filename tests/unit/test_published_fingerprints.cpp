@@ -0,0 +1,101 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "sdp_proxy/published_fingerprints.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::PublishedFingerprints;
+
+TEST_GROUP(PublishedFingerprints){};
+
+TEST(PublishedFingerprints, TestSkipPublishedOnly)
+{
+    PublishedFingerprints fingerprints;
+
+    CHECK(fingerprints.IsChanged("service", 1));
+    CHECK(!fingerprints.IsChanged("service", 0));
+
+    // A duplicate of a publish in progress is sent again until the mDNS publisher reports success.
+    fingerprints.HandlePublish("service", 1);
+    CHECK(fingerprints.IsChanged("service", 1));
+    CHECK(fingerprints.IsChanged("service", 0));
+
+    fingerprints.HandlePublish("service", 1);
+    fingerprints.HandlePublishResult("service", 1, OTBR_ERROR_NONE);
+    CHECK(!fingerprints.IsChanged("service", 1));
+    CHECK(fingerprints.IsChanged("service", 2));
+    CHECK(fingerprints.IsChanged("service", 0));
+    CHECK(fingerprints.IsChanged("other", 1));
+}
+
+TEST(PublishedFingerprints, TestRetryFailure)
+{
+    PublishedFingerprints fingerprints;
+
+    fingerprints.HandlePublish("service", 1);
+    fingerprints.HandlePublishResult("service", 1, OTBR_ERROR_MDNS);
+    CHECK(fingerprints.IsChanged("service", 1));
+    CHECK(!fingerprints.IsChanged("service", 0));
+}
+
+TEST(PublishedFingerprints, TestIgnoreStaleResult)
+{
+    PublishedFingerprints fingerprints;
+
+    fingerprints.HandlePublish("service", 1);
+    fingerprints.HandlePublish("service", 2);
+
+    // The result of a superseded publish doesn't mark the new one as published, nor drops it.
+    fingerprints.HandlePublishResult("service", 1, OTBR_ERROR_NONE);
+    CHECK(fingerprints.IsChanged("service", 2));
+    fingerprints.HandlePublishResult("service", 1, OTBR_ERROR_MDNS);
+    CHECK(fingerprints.IsChanged("service", 0));
+
+    fingerprints.HandlePublishResult("service", 2, OTBR_ERROR_NONE);
+    CHECK(!fingerprints.IsChanged("service", 2));
+}
+
+TEST(PublishedFingerprints, TestUnpublishAndClear)
+{
+    PublishedFingerprints fingerprints;
+
+    fingerprints.HandlePublish("service", 1);
+    fingerprints.HandlePublishResult("service", 1, OTBR_ERROR_NONE);
+    fingerprints.HandleUnpublish("service");
+    CHECK(!fingerprints.IsChanged("service", 0));
+
+    // A late result of the publish doesn't bring the service back.
+    fingerprints.HandlePublishResult("service", 1, OTBR_ERROR_NONE);
+    CHECK(fingerprints.IsChanged("service", 1));
+
+    fingerprints.HandlePublish("host", 3);
+    fingerprints.HandlePublishResult("host", 3, OTBR_ERROR_NONE);
+    fingerprints.Clear();
+    CHECK(fingerprints.IsChanged("host", 3));
+    CHECK(!fingerprints.IsChanged("host", 0));
+}
@@ -0,0 +1,153 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "utils/snapshot.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::Utils::Snapshot;
+
+TEST_GROUP(Snapshot)
+{
+    char mPath[32];
+
+    void setup()
+    {
+        int fd;
+
+        strcpy(mPath, "/tmp/otbr-snapshot-XXXXXX");
+        fd = mkstemp(mPath);
+        CHECK(fd >= 0);
+        close(fd);
+    }
+
+    void teardown() { unlink(mPath); }
+};
+
+TEST(Snapshot, TestSaveAndLoad)
+{
+    const uint8_t        bytes[] = {0x01, 0x02, 0x03};
+    Snapshot             snapshot;
+    Snapshot             loaded;
+    Snapshot::Writer     writer;
+    uint8_t              value8;
+    uint16_t             value16;
+    uint32_t             value32;
+    std::vector<uint8_t> valueBytes;
+    std::string          valueString;
+
+    writer.WriteUint8(0xab);
+    writer.WriteUint16(0x1234);
+    writer.WriteUint32(0xdeadbeef);
+    writer.WriteBytes(bytes, sizeof(bytes));
+    writer.WriteString("wlan0");
+    snapshot.SetSection(Snapshot::kSectionTrelPeers, writer.GetData());
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Save(mPath));
+    CHECK_EQUAL(OTBR_ERROR_NONE, loaded.Load(mPath));
+    CHECK(loaded.GetSection(Snapshot::kSectionTrelPeers) != nullptr);
+
+    {
+        Snapshot::Reader reader(*loaded.GetSection(Snapshot::kSectionTrelPeers));
+
+        CHECK_EQUAL(OTBR_ERROR_NONE, reader.ReadUint8(value8));
+        CHECK_EQUAL(0xab, value8);
+        CHECK_EQUAL(OTBR_ERROR_NONE, reader.ReadUint16(value16));
+        CHECK_EQUAL(0x1234, value16);
+        CHECK_EQUAL(OTBR_ERROR_NONE, reader.ReadUint32(value32));
+        CHECK_EQUAL(0xdeadbeef, value32);
+        CHECK_EQUAL(OTBR_ERROR_NONE, reader.ReadBytes(valueBytes));
+        CHECK_EQUAL(sizeof(bytes), valueBytes.size());
+        MEMCMP_EQUAL(bytes, valueBytes.data(), sizeof(bytes));
+        CHECK_EQUAL(OTBR_ERROR_NONE, reader.ReadString(valueString));
+        CHECK_EQUAL(std::string("wlan0"), valueString);
+        CHECK(reader.IsEnd());
+        CHECK_EQUAL(OTBR_ERROR_PARSE, reader.ReadUint8(value8));
+    }
+}
+
+TEST(Snapshot, TestLoadCorrupted)
+{
+    const uint8_t value[] = {0x00, 0x01, 0x02, 0x03};
+    Snapshot      snapshot;
+    Snapshot      loaded;
+    FILE         *file;
+
+    snapshot.SetSection(Snapshot::kSectionTrelPeers, std::vector<uint8_t>(value, value + sizeof(value)));
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Save(mPath));
+
+    // Flip the last byte of the payload.
+    file = fopen(mPath, "r+b");
+    CHECK(file != nullptr);
+    CHECK_EQUAL(0, fseek(file, -1, SEEK_END));
+    CHECK_EQUAL(0x03, fgetc(file));
+    CHECK_EQUAL(0, fseek(file, -1, SEEK_END));
+    CHECK_EQUAL(0x04, fputc(0x04, file));
+    fclose(file);
+
+    CHECK_EQUAL(OTBR_ERROR_PARSE, loaded.Load(mPath));
+    CHECK(loaded.GetSection(Snapshot::kSectionTrelPeers) == nullptr);
+
+    unlink(mPath);
+    CHECK_EQUAL(OTBR_ERROR_ERRNO, loaded.Load(mPath));
+}
+
+TEST(Snapshot, TestWriteTooLong)
+{
+    std::vector<uint8_t> bytes(UINT16_MAX + 1, 0xab);
+    Snapshot::Writer     writer;
+
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, writer.WriteBytes(bytes.data(), bytes.size()));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, writer.WriteString(std::string(bytes.begin(), bytes.end())));
+    CHECK(writer.GetData().empty());
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, writer.WriteBytes(bytes.data(), UINT16_MAX));
+    CHECK_EQUAL(sizeof(uint16_t) + UINT16_MAX, writer.GetData().size());
+}
+
+TEST(Snapshot, TestSaveFailure)
+{
+    const uint8_t value[] = {0x00, 0x01};
+    Snapshot      snapshot;
+    std::string   tmpPath = std::string(mPath) + ".tmp";
+
+    snapshot.SetSection(Snapshot::kSectionTrelPeers, std::vector<uint8_t>(value, value + sizeof(value)));
+
+    // A directory can't be replaced by the temporary file.
+    unlink(mPath);
+    CHECK_EQUAL(0, mkdir(mPath, 0700));
+    CHECK_EQUAL(OTBR_ERROR_ERRNO, snapshot.Save(mPath));
+    CHECK(access(tmpPath.c_str(), F_OK) != 0);
+    CHECK_EQUAL(0, rmdir(mPath));
+}
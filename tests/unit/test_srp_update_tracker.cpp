@@ -0,0 +1,262 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sdp_proxy/srp_update_tracker.hpp"
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::Milliseconds;
+using otbr::SrpUpdateTracker;
+using otbr::TaskRunner;
+using otbr::Timepoint;
+
+namespace {
+
+// Runs on a fake clock, a test advances the time and fires the timeouts which are due without sleeping.
+class FakeSrpUpdateTracker : public SrpUpdateTracker
+{
+public:
+    typedef std::pair<otSrpServerServiceUpdateId, otError> Result;
+
+    FakeSrpUpdateTracker(void)
+        : SrpUpdateTracker(
+              [this](otSrpServerServiceUpdateId aId, otError aError) { mResults.emplace_back(aId, aError); })
+        , mNow(otbr::Clock::now())
+        , mNextTaskId(1)
+    {
+    }
+
+    size_t GetNumTimeouts(void) const { return mTimeouts.size(); }
+
+    void AdvanceTime(Milliseconds aDuration)
+    {
+        Timepoint end = mNow + aDuration;
+
+        while (true)
+        {
+            auto due = mTimeouts.end();
+
+            for (auto it = mTimeouts.begin(); it != mTimeouts.end(); ++it)
+            {
+                if (it->second.second <= end && (due == mTimeouts.end() || it->second.second < due->second.second))
+                {
+                    due = it;
+                }
+            }
+
+            if (due == mTimeouts.end())
+            {
+                break;
+            }
+
+            otSrpServerServiceUpdateId id = due->second.first;
+
+            mNow = due->second.second;
+            mTimeouts.erase(due);
+            HandleTimeout(id);
+        }
+
+        mNow = end;
+    }
+
+    std::vector<Result> mResults;
+
+private:
+    Timepoint Now(void) const override { return mNow; }
+
+    TaskRunner::TaskId ScheduleTimeout(otSrpServerServiceUpdateId aId, Milliseconds aDelay) override
+    {
+        mTimeouts[mNextTaskId] = std::make_pair(aId, mNow + aDelay);
+
+        return mNextTaskId++;
+    }
+
+    void CancelTimeout(TaskRunner::TaskId aTaskId) override { mTimeouts.erase(aTaskId); }
+
+    // The ID of the update and the deadline of each timeout.
+    typedef std::pair<otSrpServerServiceUpdateId, Timepoint> Timeout;
+
+    Timepoint                             mNow;
+    TaskRunner::TaskId                    mNextTaskId;
+    std::map<TaskRunner::TaskId, Timeout> mTimeouts;
+};
+
+} // namespace
+
+TEST_GROUP(SrpUpdateTracker){};
+
+TEST(SrpUpdateTracker, TestCompleteBeforeDeadline)
+{
+    FakeSrpUpdateTracker tracker;
+
+    tracker.Add(1);
+    tracker.SetPendingResults(1, "host", 2);
+    tracker.WaitForResults(1, OTBR_ERROR_NONE, Milliseconds(5000));
+    CHECK_EQUAL(1U, tracker.GetCounters().mOutstandingUpdates);
+    CHECK_EQUAL(1U, tracker.GetNumTimeouts());
+
+    tracker.AdvanceTime(Milliseconds(100));
+    tracker.HandlePublishResult(1, OTBR_ERROR_NONE);
+    CHECK(tracker.mResults.empty());
+
+    tracker.AdvanceTime(Milliseconds(100));
+    tracker.HandlePublishResult(1, OTBR_ERROR_NONE);
+    CHECK_EQUAL(1U, tracker.mResults.size());
+    CHECK_EQUAL(1U, tracker.mResults[0].first);
+    CHECK_EQUAL(OT_ERROR_NONE, tracker.mResults[0].second);
+
+    // The deadline is cancelled once the update completes.
+    CHECK_EQUAL(0U, tracker.GetNumTimeouts());
+    tracker.AdvanceTime(Milliseconds(10000));
+    CHECK_EQUAL(1U, tracker.mResults.size());
+
+    CHECK_EQUAL(0U, tracker.GetCounters().mOutstandingUpdates);
+    CHECK_EQUAL(1U, tracker.GetCounters().mCompletedUpdates);
+    CHECK_EQUAL(0U, tracker.GetCounters().mFailedUpdates);
+    CHECK_EQUAL(0U, tracker.GetCounters().mTimedOutUpdates);
+    CHECK_EQUAL(200U, tracker.GetCounters().mUpdateEmaLatency);
+}
+
+TEST(SrpUpdateTracker, TestTimeout)
+{
+    FakeSrpUpdateTracker tracker;
+
+    tracker.Add(2);
+    tracker.SetPendingResults(2, "host", 2);
+    tracker.WaitForResults(2, OTBR_ERROR_NONE, Milliseconds(1000));
+    tracker.HandlePublishResult(2, OTBR_ERROR_NONE);
+
+    tracker.AdvanceTime(Milliseconds(999));
+    CHECK(tracker.mResults.empty());
+
+    tracker.AdvanceTime(Milliseconds(1));
+    CHECK_EQUAL(1U, tracker.mResults.size());
+    CHECK_EQUAL(2U, tracker.mResults[0].first);
+    CHECK_EQUAL(OT_ERROR_RESPONSE_TIMEOUT, tracker.mResults[0].second);
+    CHECK_EQUAL(0U, tracker.GetCounters().mOutstandingUpdates);
+    CHECK_EQUAL(1U, tracker.GetCounters().mTimedOutUpdates);
+
+    // A result arriving after the deadline is ignored.
+    tracker.HandlePublishResult(2, OTBR_ERROR_NONE);
+    CHECK_EQUAL(1U, tracker.mResults.size());
+    CHECK_EQUAL(0U, tracker.GetCounters().mCompletedUpdates);
+    CHECK_EQUAL(0U, tracker.GetCounters().mFailedUpdates);
+    CHECK_EQUAL(0U, tracker.GetCounters().mUpdateEmaLatency);
+}
+
+TEST(SrpUpdateTracker, TestFailure)
+{
+    FakeSrpUpdateTracker tracker;
+
+    tracker.Add(3);
+    tracker.SetPendingResults(3, "host", 3);
+    tracker.WaitForResults(3, OTBR_ERROR_NONE, Milliseconds(1000));
+
+    // The first failed result fails the update.
+    tracker.HandlePublishResult(3, OTBR_ERROR_DUPLICATED);
+    CHECK_EQUAL(1U, tracker.mResults.size());
+    CHECK_EQUAL(OT_ERROR_DUPLICATED, tracker.mResults[0].second);
+    CHECK_EQUAL(0U, tracker.GetNumTimeouts());
+
+    tracker.HandlePublishResult(3, OTBR_ERROR_NONE);
+    tracker.AdvanceTime(Milliseconds(1000));
+    CHECK_EQUAL(1U, tracker.mResults.size());
+    CHECK_EQUAL(0U, tracker.GetCounters().mOutstandingUpdates);
+    CHECK_EQUAL(1U, tracker.GetCounters().mFailedUpdates);
+    CHECK_EQUAL(0U, tracker.GetCounters().mTimedOutUpdates);
+}
+
+TEST(SrpUpdateTracker, TestCompleteWithoutWaiting)
+{
+    FakeSrpUpdateTracker tracker;
+
+    // The results may arrive before the publishing returns.
+    tracker.Add(4);
+    tracker.SetPendingResults(4, "host", 1);
+    tracker.HandlePublishResult(4, OTBR_ERROR_NONE);
+    tracker.WaitForResults(4, OTBR_ERROR_NONE, Milliseconds(1000));
+
+    // There is nothing to publish.
+    tracker.Add(5);
+    tracker.SetPendingResults(5, "host", 0);
+    tracker.WaitForResults(5, OTBR_ERROR_NONE, Milliseconds(1000));
+
+    // The publishing fails to start.
+    tracker.Add(6);
+    tracker.WaitForResults(6, OTBR_ERROR_INVALID_ARGS, Milliseconds(1000));
+
+    CHECK_EQUAL(0U, tracker.GetNumTimeouts());
+    CHECK_EQUAL(3U, tracker.mResults.size());
+    CHECK_EQUAL(OT_ERROR_NONE, tracker.mResults[0].second);
+    CHECK_EQUAL(OT_ERROR_NONE, tracker.mResults[1].second);
+    CHECK_EQUAL(OT_ERROR_INVALID_ARGS, tracker.mResults[2].second);
+    CHECK_EQUAL(0U, tracker.GetCounters().mOutstandingUpdates);
+    CHECK_EQUAL(2U, tracker.GetCounters().mCompletedUpdates);
+    CHECK_EQUAL(1U, tracker.GetCounters().mFailedUpdates);
+}
+
+TEST(SrpUpdateTracker, TestEmaLatency)
+{
+    FakeSrpUpdateTracker tracker;
+
+    tracker.Add(7);
+    tracker.SetPendingResults(7, "host", 1);
+    tracker.WaitForResults(7, OTBR_ERROR_NONE, Milliseconds(1000));
+    tracker.AdvanceTime(Milliseconds(200));
+    tracker.HandlePublishResult(7, OTBR_ERROR_NONE);
+    CHECK_EQUAL(200U, tracker.GetCounters().mUpdateEmaLatency);
+
+    tracker.Add(8);
+    tracker.SetPendingResults(8, "host", 1);
+    tracker.WaitForResults(8, OTBR_ERROR_NONE, Milliseconds(1000));
+    tracker.AdvanceTime(Milliseconds(100));
+    tracker.HandlePublishResult(8, OTBR_ERROR_NONE);
+    CHECK_EQUAL(150U, tracker.GetCounters().mUpdateEmaLatency);
+}
+
+TEST(SrpUpdateTracker, TestClear)
+{
+    FakeSrpUpdateTracker tracker;
+
+    tracker.Add(9);
+    tracker.SetPendingResults(9, "host", 1);
+    tracker.WaitForResults(9, OTBR_ERROR_NONE, Milliseconds(1000));
+    tracker.Clear();
+
+    CHECK_EQUAL(0U, tracker.GetNumTimeouts());
+    CHECK_EQUAL(0U, tracker.GetCounters().mOutstandingUpdates);
+
+    // Cleared updates are not reported.
+    tracker.HandlePublishResult(9, OTBR_ERROR_NONE);
+    tracker.AdvanceTime(Milliseconds(1000));
+    CHECK(tracker.mResults.empty());
+}
@@ -0,0 +1,131 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <vector>
+
+#include "utils/crc16.hpp"
+#include "utils/steering_data.hpp"
+
+TEST_GROUP(SteeringData){};
+
+static uint16_t BitwiseCrc16(uint16_t aPolynomial, const uint8_t *aBytes, size_t aLength)
+{
+    uint16_t crc = 0;
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        crc ^= static_cast<uint16_t>(aBytes[i] << 8);
+
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x8000) ? static_cast<uint16_t>(crc << 1) ^ aPolynomial : static_cast<uint16_t>(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+TEST(SteeringData, TestCrc16CheckValues)
+{
+    const uint8_t kCheckInput[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    otbr::Crc16   ccitt(otbr::Crc16::kCcitt);
+    otbr::Crc16   ansi(otbr::Crc16::kAnsi);
+
+    ccitt.Update(kCheckInput, sizeof(kCheckInput));
+    ansi.Update(kCheckInput, sizeof(kCheckInput));
+
+    CHECK_EQUAL(0x31c3, ccitt.Get());
+    CHECK_EQUAL(0xfee8, ansi.Get());
+}
+
+TEST(SteeringData, TestCrc16SlicingMatchesBitwise)
+{
+    uint8_t bytes[67];
+
+    for (size_t i = 0; i < sizeof(bytes); i++)
+    {
+        bytes[i] = static_cast<uint8_t>(i * 37 + 5);
+    }
+
+    for (size_t length = 0; length <= sizeof(bytes); length++)
+    {
+        otbr::Crc16 ccitt(otbr::Crc16::kCcitt);
+        otbr::Crc16 ansi(otbr::Crc16::kAnsi);
+        otbr::Crc16 ansiByByte(otbr::Crc16::kAnsi);
+
+        ccitt.Update(bytes, length);
+        ansi.Update(bytes, length);
+
+        for (size_t i = 0; i < length; i++)
+        {
+            ansiByByte.Update(bytes[i]);
+        }
+
+        CHECK_EQUAL(BitwiseCrc16(otbr::Crc16::kCcitt, bytes, length), ccitt.Get());
+        CHECK_EQUAL(BitwiseCrc16(otbr::Crc16::kAnsi, bytes, length), ansi.Get());
+        CHECK_EQUAL(ansi.Get(), ansiByByte.Get());
+    }
+}
+
+TEST(SteeringData, TestBatchMatchesSingleJoiner)
+{
+    // Few enough joiners to leave the 128-bit filter sparse, so that a mismatch would show.
+    std::vector<otbr::SteeringData::Eui64> eui64s(16);
+    otbr::SteeringData                     single;
+    otbr::SteeringData                     batch;
+    otbr::SteeringData                     parallel;
+    bool                                   allOnes = true;
+
+    single.Init(otbr::SteeringData::kMaxSizeOfBloomFilter);
+    batch.Init(otbr::SteeringData::kMaxSizeOfBloomFilter);
+    parallel.Init(otbr::SteeringData::kMaxSizeOfBloomFilter);
+
+    for (size_t i = 0; i < eui64s.size(); i++)
+    {
+        uint8_t joinerId[otbr::SteeringData::kSizeJoinerId];
+
+        eui64s[i] = {0x18, 0xb4, 0x30, 0x00, 0x00, 0x00, static_cast<uint8_t>(i >> 8), static_cast<uint8_t>(i)};
+
+        otbr::SteeringData::ComputeJoinerId(eui64s[i].data(), joinerId);
+        single.ComputeBloomFilter(joinerId);
+    }
+
+    for (uint8_t i = 0; i < otbr::SteeringData::kMaxSizeOfBloomFilter; i++)
+    {
+        allOnes = allOnes && (single.GetBloomFilter()[i] == 0xff);
+    }
+    CHECK(!allOnes);
+
+    batch.ComputeBloomFilter(eui64s);
+    parallel.ComputeBloomFilter(eui64s, 4);
+
+    MEMCMP_EQUAL(single.GetBloomFilter(), batch.GetBloomFilter(), otbr::SteeringData::kMaxSizeOfBloomFilter);
+    MEMCMP_EQUAL(single.GetBloomFilter(), parallel.GetBloomFilter(), otbr::SteeringData::kMaxSizeOfBloomFilter);
+}
@@ -0,0 +1,185 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "openthread-br/config.h"
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+
+#include <CppUTest/TestHarness.h>
+
+#include "utils/telemetry_sampler.hpp"
+
+using otbr::Milliseconds;
+using otbr::Timepoint;
+using otbr::agent::TelemetrySampler;
+
+namespace {
+
+// Runs on a fake clock, a test advances the time and takes the samples which are due without sleeping.
+class FakeTelemetrySampler : public TelemetrySampler
+{
+public:
+    FakeTelemetrySampler(void)
+        : TelemetrySampler(nullptr)
+        , mMacTxTotal(0)
+        , mNow(otbr::Clock::now())
+        , mPending(false)
+    {
+    }
+
+    bool IsPending(void) const { return mPending; }
+
+    Milliseconds GetPendingDelay(void) const { return std::chrono::duration_cast<Milliseconds>(mDeadline - mNow); }
+
+    void AdvanceTime(Milliseconds aDuration)
+    {
+        Timepoint end = mNow + aDuration;
+
+        while (mPending && mDeadline <= end)
+        {
+            mNow     = mDeadline;
+            mPending = false;
+            HandleSampleTimer();
+        }
+
+        mNow = end;
+    }
+
+    uint64_t mMacTxTotal;
+
+private:
+    void ReadCounters(Values &aValues) const override
+    {
+        aValues.fill(0);
+        aValues[kMacTxTotal] = mMacTxTotal;
+    }
+
+    Timepoint Now(void) const override { return mNow; }
+
+    void ScheduleSample(Milliseconds aDelay) override
+    {
+        mPending  = true;
+        mDeadline = mNow + aDelay;
+    }
+
+    void CancelSample(void) override { mPending = false; }
+
+    Timepoint mNow;
+    Timepoint mDeadline;
+    bool      mPending;
+};
+
+} // namespace
+
+TEST_GROUP(TelemetrySampler){};
+
+TEST(TelemetrySampler, TestRejectShortInterval)
+{
+    FakeTelemetrySampler sampler;
+
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, sampler.SetInterval(Milliseconds(1)));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, sampler.SetInterval(TelemetrySampler::kMinInterval - Milliseconds(1)));
+    CHECK(sampler.GetInterval() == Milliseconds(0));
+    CHECK(!sampler.IsPending());
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, sampler.SetInterval(TelemetrySampler::kMinInterval));
+    CHECK(sampler.GetInterval() == TelemetrySampler::kMinInterval);
+
+    // A rejected interval keeps sampling at the previous one.
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, sampler.SetInterval(Milliseconds(10)));
+    CHECK(sampler.GetInterval() == TelemetrySampler::kMinInterval);
+    CHECK(sampler.IsPending());
+    CHECK(sampler.GetPendingDelay() == TelemetrySampler::kMinInterval);
+}
+
+TEST(TelemetrySampler, TestStartAndStop)
+{
+    FakeTelemetrySampler                       sampler;
+    std::vector<TelemetrySampler::DeltaSample> series;
+
+    CHECK_EQUAL(0U, sampler.GetLatestSequence());
+    CHECK(!sampler.HasChangedSince(0));
+
+    sampler.mMacTxTotal = 5;
+    CHECK_EQUAL(OTBR_ERROR_NONE, sampler.SetInterval(TelemetrySampler::kMinInterval));
+    sampler.AdvanceTime(TelemetrySampler::kMinInterval - Milliseconds(1));
+    CHECK_EQUAL(0U, sampler.GetLatestSequence());
+    sampler.AdvanceTime(Milliseconds(1));
+
+    CHECK_EQUAL(1U, sampler.GetLatestSequence());
+    CHECK(sampler.HasChangedSince(0));
+    CHECK(!sampler.HasChangedSince(1));
+    CHECK(sampler.GetPendingDelay() == TelemetrySampler::kMinInterval);
+
+    sampler.GetDeltaSeries(0, series);
+    CHECK_EQUAL(1U, series.size());
+    CHECK_EQUAL(5, series[0].mValues[TelemetrySampler::kMacTxTotal]);
+
+    // Stopping cancels the pending sample.
+    CHECK_EQUAL(OTBR_ERROR_NONE, sampler.SetInterval(Milliseconds(0)));
+    CHECK(sampler.GetInterval() == Milliseconds(0));
+    CHECK(!sampler.IsPending());
+    sampler.AdvanceTime(TelemetrySampler::kMinInterval * 10);
+    CHECK_EQUAL(1U, sampler.GetLatestSequence());
+}
+
+TEST(TelemetrySampler, TestChangeInterval)
+{
+    FakeTelemetrySampler                       sampler;
+    std::vector<TelemetrySampler::DeltaSample> series;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, sampler.SetInterval(Milliseconds(5000)));
+    CHECK(sampler.GetPendingDelay() == Milliseconds(5000));
+    sampler.AdvanceTime(Milliseconds(2000));
+
+    // A shorter interval reschedules the pending sample.
+    CHECK_EQUAL(OTBR_ERROR_NONE, sampler.SetInterval(TelemetrySampler::kMinInterval));
+    CHECK(sampler.GetInterval() == TelemetrySampler::kMinInterval);
+    CHECK(sampler.GetPendingDelay() == TelemetrySampler::kMinInterval);
+
+    sampler.mMacTxTotal = 3;
+    sampler.AdvanceTime(TelemetrySampler::kMinInterval);
+    sampler.mMacTxTotal = 10;
+    sampler.AdvanceTime(TelemetrySampler::kMinInterval);
+    CHECK_EQUAL(2U, sampler.GetLatestSequence());
+
+    sampler.GetDeltaSeries(0, series);
+    CHECK_EQUAL(2U, series.size());
+    CHECK_EQUAL(3, series[0].mValues[TelemetrySampler::kMacTxTotal]);
+    CHECK_EQUAL(7, series[1].mValues[TelemetrySampler::kMacTxTotal]);
+    CHECK_EQUAL(static_cast<uint64_t>(TelemetrySampler::kMinInterval.count()),
+                series[1].mTimestamp - series[0].mTimestamp);
+    CHECK(sampler.HasChangedSince(1));
+
+    // An unchanged sample is buffered but reports no change.
+    sampler.AdvanceTime(TelemetrySampler::kMinInterval);
+    CHECK_EQUAL(3U, sampler.GetLatestSequence());
+    CHECK(!sampler.HasChangedSince(2));
+}
+
+#endif // OTBR_ENABLE_TELEMETRY_DATA_API
@@ -0,0 +1,173 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "trel_dnssd/peer_snapshot.hpp"
+
+#include <string.h>
+
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::Milliseconds;
+using otbr::Timepoint;
+using otbr::TrelDnssd::PeerSnapshot;
+using otbr::Utils::Snapshot;
+
+namespace {
+
+// Runs on a fake clock, a test advances the time and fires the expiries which are due without sleeping.
+class FakePeerSnapshot : public PeerSnapshot
+{
+public:
+    FakePeerSnapshot(void)
+        : PeerSnapshot([this]() { mNumExpiries++; })
+        , mNumExpiries(0)
+        , mNow(otbr::Clock::now())
+    {
+    }
+
+    size_t GetNumScheduled(void) const { return mDeadlines.size(); }
+
+    void AdvanceTime(Milliseconds aDuration)
+    {
+        Timepoint end = mNow + aDuration;
+
+        while (!mDeadlines.empty() && mDeadlines.front() <= end)
+        {
+            mNow = mDeadlines.front();
+            mDeadlines.erase(mDeadlines.begin());
+            HandleExpiry();
+        }
+
+        mNow = end;
+    }
+
+    uint32_t mNumExpiries;
+
+private:
+    void ScheduleExpiry(Milliseconds aDelay) override { mDeadlines.push_back(mNow + aDelay); }
+
+    Timepoint              mNow;
+    std::vector<Timepoint> mDeadlines;
+};
+
+PeerSnapshot::SavedPeer MakePeer(const char *aInstanceName, uint8_t aAddressByte, uint16_t aPort)
+{
+    PeerSnapshot::SavedPeer peer;
+
+    peer.mInstanceName = aInstanceName;
+    peer.mTxtData      = {2, 'x', 'a'};
+    memset(&peer.mSockAddr, 0, sizeof(peer.mSockAddr));
+    peer.mSockAddr.mAddress.mFields.m8[0]  = 0xfe;
+    peer.mSockAddr.mAddress.mFields.m8[1]  = 0x80;
+    peer.mSockAddr.mAddress.mFields.m8[15] = aAddressByte;
+    peer.mSockAddr.mPort                   = aPort;
+
+    return peer;
+}
+
+void CheckPeer(const PeerSnapshot::SavedPeer &aExpected, const PeerSnapshot::SavedPeer &aActual)
+{
+    CHECK_EQUAL(aExpected.mInstanceName, aActual.mInstanceName);
+    CHECK(aExpected.mTxtData == aActual.mTxtData);
+    MEMCMP_EQUAL(aExpected.mSockAddr.mAddress.mFields.m8, aActual.mSockAddr.mAddress.mFields.m8,
+                 sizeof(aExpected.mSockAddr.mAddress.mFields.m8));
+    CHECK_EQUAL(aExpected.mSockAddr.mPort, aActual.mSockAddr.mPort);
+}
+
+} // namespace
+
+TEST_GROUP(TrelPeerSnapshot){};
+
+TEST(TrelPeerSnapshot, TestRestoreAndExpire)
+{
+    std::vector<PeerSnapshot::SavedPeer> peers = {MakePeer("peer1", 1, 1000), MakePeer("peer2", 2, 2000)};
+    std::vector<PeerSnapshot::SavedPeer> restoredPeers;
+    Snapshot                             snapshot;
+    FakePeerSnapshot                     peerSnapshot;
+
+    PeerSnapshot::Save(snapshot, "wlan0", peers);
+    CHECK_EQUAL(OTBR_ERROR_NONE, peerSnapshot.Restore(snapshot));
+    CHECK_EQUAL(0U, peerSnapshot.GetNumScheduled());
+
+    restoredPeers = peerSnapshot.TakeRestoredPeers("wlan0");
+    CHECK_EQUAL(2U, restoredPeers.size());
+    CheckPeer(peers[0], restoredPeers[0]);
+    CheckPeer(peers[1], restoredPeers[1]);
+
+    // The restored peers which are not discovered again are removed after 30 seconds.
+    CHECK_EQUAL(1U, peerSnapshot.GetNumScheduled());
+    peerSnapshot.AdvanceTime(Milliseconds(PeerSnapshot::kRestoredPeerTimeoutMs - 1));
+    CHECK_EQUAL(0U, peerSnapshot.mNumExpiries);
+    peerSnapshot.AdvanceTime(Milliseconds(1));
+    CHECK_EQUAL(1U, peerSnapshot.mNumExpiries);
+
+    // The restored peers are taken only once.
+    CHECK(peerSnapshot.TakeRestoredPeers("wlan0").empty());
+    CHECK_EQUAL(0U, peerSnapshot.GetNumScheduled());
+}
+
+TEST(TrelPeerSnapshot, TestNetifMismatch)
+{
+    Snapshot         snapshot;
+    FakePeerSnapshot peerSnapshot;
+
+    PeerSnapshot::Save(snapshot, "wlan0", {MakePeer("peer1", 1, 1000)});
+    CHECK_EQUAL(OTBR_ERROR_NONE, peerSnapshot.Restore(snapshot));
+
+    // The peers of another netif are dropped without starting the expiry.
+    CHECK(peerSnapshot.TakeRestoredPeers("eth0").empty());
+    CHECK_EQUAL(0U, peerSnapshot.GetNumScheduled());
+    CHECK(peerSnapshot.TakeRestoredPeers("wlan0").empty());
+    peerSnapshot.AdvanceTime(Milliseconds(PeerSnapshot::kRestoredPeerTimeoutMs));
+    CHECK_EQUAL(0U, peerSnapshot.mNumExpiries);
+}
+
+TEST(TrelPeerSnapshot, TestRestoreInvalid)
+{
+    Snapshot                snapshot;
+    FakePeerSnapshot        peerSnapshot;
+    std::vector<uint8_t>    section;
+    PeerSnapshot::SavedPeer oversizedPeer = MakePeer("peer2", 2, 2000);
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, peerSnapshot.Restore(snapshot));
+    CHECK(peerSnapshot.TakeRestoredPeers("wlan0").empty());
+
+    // A peer which can't be encoded is skipped.
+    oversizedPeer.mTxtData.resize(UINT16_MAX + 1);
+    PeerSnapshot::Save(snapshot, "wlan0", {MakePeer("peer1", 1, 1000), oversizedPeer});
+    CHECK_EQUAL(OTBR_ERROR_NONE, peerSnapshot.Restore(snapshot));
+    CHECK_EQUAL(1U, peerSnapshot.TakeRestoredPeers("wlan0").size());
+
+    // A truncated peer invalidates all peers.
+    section = *snapshot.GetSection(Snapshot::kSectionTrelPeers);
+    section.pop_back();
+    snapshot.SetSection(Snapshot::kSectionTrelPeers, section);
+    CHECK_EQUAL(OTBR_ERROR_PARSE, peerSnapshot.Restore(snapshot));
+    CHECK(peerSnapshot.TakeRestoredPeers("wlan0").empty());
+}
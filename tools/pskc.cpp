@@ -31,8 +31,15 @@
  *   This file implements a simple tool to compute pskc.
  */
 
+#include <algorithm>
+#include <chrono>
+#include <errno.h>
+#include <limits.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string>
 #include <sysexits.h>
+#include <vector>
 
 #include "common/code_utils.hpp"
 #include "utils/hex.hpp"
@@ -46,6 +53,8 @@ enum
     kMaxNetworkName = 16,
     kMaxPassphrase  = 255,
     kSizeExtPanId   = 8,
+    kMaxLineLength  = 512,
+    kMaxThreads     = 256,
 };
 
 void help(void)
@@ -53,18 +62,35 @@ void help(void)
     printf("pskc - compute PSKc\n"
            "SYNTAX:\n"
            "    pskc <PASSPHRASE> <EXTPANID> <NETWORK_NAME>\n"
+           "    pskc -f <FILE> [THREADS]\n"
+           "    pskc -b [COUNT]\n"
+           "OPTIONS:\n"
+           "    -f  Read one `<PASSPHRASE> <EXTPANID> <NETWORK_NAME>` tuple per line from FILE, or from stdin\n"
+           "        if FILE is `-`, and print one PSKc per line. THREADS (1 to 256) defaults to the number of CPU\n"
+           "        cores.\n"
+           "    -b  Benchmark COUNT (default 64) computations with the single-shot and the batch paths.\n"
            "EXAMPLE:\n"
-           "    pskc 654321 1122334455667788 OpenThread\n");
+           "    pskc 654321 1122334455667788 OpenThread\n"
+           "    pskc -f networks.txt\n");
 }
 
-int printPSKc(const char *aPassphrase, const char *aExtPanId, const char *aNetworkName)
+bool parseCount(const char *aString, unsigned long aMax, unsigned long &aCount)
 {
-    uint8_t extpanid[kSizeExtPanId];
-    size_t  length;
-    int     ret = -1;
+    char *end;
+
+    errno  = 0;
+    aCount = strtoul(aString, &end, 10);
 
-    otbr::Psk::Pskc pskcComputer;
-    const uint8_t  *pskc;
+    return aString[0] != '-' && end != aString && *end == '\0' && errno == 0 && aCount > 0 && aCount <= aMax;
+}
+
+int parseParams(const char              *aPassphrase,
+                const char              *aExtPanId,
+                const char              *aNetworkName,
+                otbr::Psk::Pskc::Params &aParams)
+{
+    size_t length;
+    int    ret = -1;
 
     length = strlen(aPassphrase);
     VerifyOrExit(length > 0, printf("PASSPHRASE must not be empty.\n"));
@@ -79,19 +105,185 @@ int printPSKc(const char *aPassphrase, const char *aExtPanId, const char *aNetwo
                          (aExtPanId[i] <= 'F' && aExtPanId[i] >= 'A'),
                      printf("EXTPANID must be encoded in hex.\n"));
     }
-    otbr::Utils::Hex2Bytes(aExtPanId, extpanid, sizeof(extpanid));
+    otbr::Utils::Hex2Bytes(aExtPanId, aParams.mExtPanId, sizeof(aParams.mExtPanId));
 
     length = strlen(aNetworkName);
     VerifyOrExit(length > 0, printf("NETWORK_NAME must not be empty.\n"));
     VerifyOrExit(length <= kMaxNetworkName,
                  printf("NETWOR_KNAME length must be no more than %d bytes.\n", kMaxNetworkName));
 
-    pskc = pskcComputer.ComputePskc(extpanid, aNetworkName, aPassphrase);
-    for (int i = 0; i < 16; i++)
+    aParams.mPassphrase  = aPassphrase;
+    aParams.mNetworkName = aNetworkName;
+    ret                  = 0;
+
+exit:
+    return ret;
+}
+
+void printPskcValue(const uint8_t *aPskc)
+{
+    for (int i = 0; i < OT_PSKC_LENGTH; i++)
     {
-        printf("%02x", pskc[i]);
+        printf("%02x", aPskc[i]);
     }
     printf("\n");
+}
+
+int printPSKc(const char *aPassphrase, const char *aExtPanId, const char *aNetworkName)
+{
+    int                     ret = -1;
+    otbr::Psk::Pskc::Params params;
+    otbr::Psk::Pskc         pskcComputer;
+
+    SuccessOrExit(parseParams(aPassphrase, aExtPanId, aNetworkName, params));
+    printPskcValue(pskcComputer.ComputePskc(params.mExtPanId, aNetworkName, aPassphrase));
+    ret = 0;
+
+exit:
+    return ret;
+}
+
+int printPSKcBatch(const char *aPath, unsigned aNumThreads)
+{
+    int                                  ret  = -1;
+    FILE                                *file = (strcmp(aPath, "-") == 0) ? stdin : fopen(aPath, "r");
+    char                                 line[kMaxLineLength];
+    int                                  lineNumber = 0;
+    std::vector<otbr::Psk::Pskc::Params> params;
+    std::vector<otbr::Psk::Pskc::Value>  pskcs;
+
+    VerifyOrExit(file != nullptr, fprintf(stderr, "Failed to open %s\n", aPath));
+
+    while (fgets(line, sizeof(line), file) != nullptr)
+    {
+        const char             *passphrase  = strtok(line, " \t\r\n");
+        const char             *extPanId    = strtok(nullptr, " \t\r\n");
+        const char             *networkName = strtok(nullptr, "\r\n");
+        otbr::Psk::Pskc::Params param;
+
+        lineNumber++;
+
+        if (passphrase == nullptr || passphrase[0] == '#')
+        {
+            continue;
+        }
+
+        VerifyOrExit(extPanId != nullptr && networkName != nullptr,
+                     fprintf(stderr, "Line %d: expected <PASSPHRASE> <EXTPANID> <NETWORK_NAME>\n", lineNumber));
+        networkName += strspn(networkName, " \t");
+        VerifyOrExit(parseParams(passphrase, extPanId, networkName, param) == 0,
+                     fprintf(stderr, "Line %d: invalid input\n", lineNumber));
+        params.push_back(param);
+    }
+
+    otbr::Psk::Pskc::ComputePskcs(params, pskcs, aNumThreads);
+
+    for (const otbr::Psk::Pskc::Value &pskc : pskcs)
+    {
+        printPskcValue(pskc.data());
+    }
+
+    ret = 0;
+
+exit:
+    if (file != nullptr && file != stdin)
+    {
+        fclose(file);
+    }
+
+    return ret;
+}
+
+/**
+ * This function computes the PSKc the way `Pskc::ComputePskc()` did before it cached the AES-CMAC key schedule,
+ * calling `mbedtls_aes_cmac_prf_128()` for every PBKDF2 iteration. It's the baseline of the benchmark.
+ *
+ */
+void computePskcSingleShot(const otbr::Psk::Pskc::Params &aParams, uint8_t *aPskc)
+{
+    const uint8_t *passphrase = reinterpret_cast<const uint8_t *>(aParams.mPassphrase.c_str());
+    uint8_t        salt[OT_PBKDF2_SALT_MAX_LENGTH + 4];
+    size_t         saltLen = 0;
+    uint8_t        prfInput[MBEDTLS_CIPHER_BLKSIZE_MAX];
+    uint8_t        prfOutput[MBEDTLS_CIPHER_BLKSIZE_MAX];
+
+    memcpy(salt, "Thread", 6);
+    saltLen += 6;
+    memcpy(salt + saltLen, aParams.mExtPanId, OT_EXTENDED_PAN_ID_LENGTH);
+    saltLen += OT_EXTENDED_PAN_ID_LENGTH;
+    memcpy(salt + saltLen, aParams.mNetworkName.data(),
+           std::min(aParams.mNetworkName.size(), OT_PBKDF2_SALT_MAX_LENGTH - saltLen));
+    saltLen += std::min(aParams.mNetworkName.size(), OT_PBKDF2_SALT_MAX_LENGTH - saltLen);
+    memset(salt + saltLen, 0, 3);
+    salt[saltLen + 3] = 1;
+
+    mbedtls_aes_cmac_prf_128(passphrase, aParams.mPassphrase.size(), salt, saltLen + 4, prfOutput);
+    memcpy(aPskc, prfOutput, OT_PSKC_LENGTH);
+
+    for (uint32_t i = 1; i < OT_ITERATION_COUNTS; i++)
+    {
+        memcpy(prfInput, prfOutput, sizeof(prfInput));
+        mbedtls_aes_cmac_prf_128(passphrase, aParams.mPassphrase.size(), prfInput, sizeof(prfInput), prfOutput);
+
+        for (uint32_t j = 0; j < OT_PSKC_LENGTH; j++)
+        {
+            aPskc[j] ^= prfOutput[j];
+        }
+    }
+}
+
+int benchmark(size_t aCount)
+{
+    using Clock = std::chrono::steady_clock;
+
+    int                                  ret = -1;
+    std::vector<otbr::Psk::Pskc::Params> params(aCount);
+    std::vector<otbr::Psk::Pskc::Value>  expected(aCount);
+    std::vector<otbr::Psk::Pskc::Value>  pskcs;
+    otbr::Psk::Pskc                      pskcComputer;
+    Clock::time_point                    start;
+    double                               singleShotSeconds;
+    double                               cachedSeconds;
+    double                               batchSeconds;
+
+    for (size_t i = 0; i < aCount; i++)
+    {
+        for (size_t j = 0; j < kSizeExtPanId; j++)
+        {
+            params[i].mExtPanId[j] = static_cast<uint8_t>(i >> (8 * (j % sizeof(size_t))));
+        }
+        params[i].mNetworkName = "OpenThread-" + std::to_string(i % 1000);
+        params[i].mPassphrase  = "J01NME-" + std::to_string(i);
+    }
+
+    start = Clock::now();
+    for (size_t i = 0; i < aCount; i++)
+    {
+        computePskcSingleShot(params[i], expected[i].data());
+    }
+    singleShotSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    start = Clock::now();
+    for (size_t i = 0; i < aCount; i++)
+    {
+        const uint8_t *pskc = pskcComputer.ComputePskc(params[i].mExtPanId, params[i].mNetworkName.c_str(),
+                                                       params[i].mPassphrase.c_str());
+
+        VerifyOrExit(memcmp(pskc, expected[i].data(), OT_PSKC_LENGTH) == 0,
+                     fprintf(stderr, "PSKc mismatch at %zu\n", i));
+    }
+    cachedSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    start = Clock::now();
+    otbr::Psk::Pskc::ComputePskcs(params, pskcs, 0);
+    batchSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+    VerifyOrExit(pskcs == expected, fprintf(stderr, "PSKc mismatch in batch\n"));
+
+    printf("%-32s %10.1f PSKc/s\n", "single-shot (per-iteration key)", aCount / singleShotSeconds);
+    printf("%-32s %10.1f PSKc/s (x%.2f)\n", "cached key schedule", aCount / cachedSeconds,
+           singleShotSeconds / cachedSeconds);
+    printf("%-32s %10.1f PSKc/s (x%.2f)\n", "batch, all cores", aCount / batchSeconds,
+           singleShotSeconds / batchSeconds);
     ret = 0;
 
 exit:
@@ -102,6 +294,27 @@ int main(int argc, char *argv[])
 {
     int ret = 0;
 
+    if (argc >= 2 && strcmp(argv[1], "-f") == 0)
+    {
+        unsigned long numThreads = 0;
+
+        VerifyOrExit(argc == 3 || argc == 4, help(), ret = EX_USAGE);
+        VerifyOrExit(argc == 3 || parseCount(argv[3], kMaxThreads, numThreads), help(), ret = EX_USAGE);
+        ret = printPSKcBatch(argv[2], static_cast<unsigned>(numThreads));
+        ExitNow(ret = (ret == 0) ? EX_OK : EX_DATAERR);
+    }
+
+    if (argc >= 2 && strcmp(argv[1], "-b") == 0)
+    {
+        unsigned long count = 64;
+
+        VerifyOrExit(argc <= 3, help(), ret = EX_USAGE);
+        VerifyOrExit(argc <= 2 || parseCount(argv[2], ULONG_MAX, count), help(), ret = EX_USAGE);
+
+        ret = benchmark(count);
+        ExitNow(ret = (ret == 0) ? EX_OK : EX_SOFTWARE);
+    }
+
     VerifyOrExit(argc == 4, help(), ret = EX_USAGE);
     ret = printPSKc(argv[1], argv[2], argv[3]);
 
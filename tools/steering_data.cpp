@@ -35,6 +35,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <sysexits.h>
+#include <thread>
+#include <vector>
 
 #include "common/code_utils.hpp"
 #include "utils/hex.hpp"
@@ -45,26 +47,68 @@ void help(void)
     printf("steering-data - compute steering data\n"
            "SYNTAX:\n"
            "    steering-data [LENGTH] <JOINER_ID> ...\n"
+           "    steering-data [LENGTH] -f <EUI64_FILE>\n"
+           "    EUI64_FILE contains one EUI64 per line, empty lines and lines starting with '#' are ignored.\n"
            "EXAMPLE:\n"
            "    steering-data 18b4300000000001\n"
            "    steering-data 15 18b4300000000001\n"
-           "    steering-data 18b4300000000001 18b4300000000002\n");
+           "    steering-data 18b4300000000001 18b4300000000002\n"
+           "    steering-data 16 -f joiners.txt\n");
 }
 
-int ComputeJoinerId(const char *aEui64, uint8_t *aJoinerId)
+int ParseEui64(const char *aEui64, otbr::SteeringData::Eui64 &aResult)
 {
     int ret = -1;
 
-    VerifyOrExit(strlen(aEui64) == otbr::SteeringData::kSizeJoinerId * 2);
-    VerifyOrExit(otbr::Utils::Hex2Bytes(aEui64, aJoinerId, otbr::SteeringData::kSizeJoinerId) ==
-                 otbr::SteeringData::kSizeJoinerId);
-    otbr::SteeringData::ComputeJoinerId(aJoinerId, aJoinerId);
+    VerifyOrExit(strlen(aEui64) == otbr::SteeringData::kSizeEui64 * 2);
+    VerifyOrExit(otbr::Utils::Hex2Bytes(aEui64, aResult.data(), aResult.size()) == otbr::SteeringData::kSizeEui64);
     ret = 0;
 
 exit:
-    if (ret != 0)
+    return ret;
+}
+
+int ReadEui64File(const char *aPath, std::vector<otbr::SteeringData::Eui64> &aEui64s)
+{
+    int   ret  = -1;
+    FILE *file = fopen(aPath, "r");
+    char  line[128];
+    int   lineNumber = 0;
+
+    VerifyOrExit(file != nullptr, fprintf(stderr, "Failed to open %s\n", aPath));
+
+    while (fgets(line, sizeof(line), file) != nullptr)
+    {
+        char                     *begin = line;
+        char                     *end;
+        otbr::SteeringData::Eui64 eui64;
+
+        lineNumber++;
+
+        while (*begin == ' ' || *begin == '\t')
+        {
+            begin++;
+        }
+
+        end  = begin + strcspn(begin, " \t\r\n#");
+        *end = '\0';
+
+        if (*begin == '\0')
+        {
+            continue;
+        }
+
+        VerifyOrExit(ParseEui64(begin, eui64) == 0,
+                     fprintf(stderr, "Invalid EUI64 at %s:%d : %s\n", aPath, lineNumber, begin));
+        aEui64s.push_back(eui64);
+    }
+
+    ret = 0;
+
+exit:
+    if (file != nullptr)
     {
-        fprintf(stderr, "Invalid EUI64: %s", aEui64);
+        fclose(file);
     }
 
     return ret;
@@ -72,17 +116,18 @@ exit:
 
 int main(int argc, char *argv[])
 {
-    otbr::SteeringData computer;
-    int                ret    = EX_USAGE;
-    int                length = 16;
-    int                i      = 1;
+    otbr::SteeringData                     computer;
+    std::vector<otbr::SteeringData::Eui64> eui64s;
+    int                                    ret    = EX_USAGE;
+    int                                    length = 16;
+    int                                    i      = 1;
 
     if (argc < 2)
     {
         ExitNow(help());
     }
 
-    if (strlen(argv[i]) != otbr::SteeringData::kSizeJoinerId * 2)
+    if (strcmp(argv[i], "-f") != 0 && strlen(argv[i]) != otbr::SteeringData::kSizeEui64 * 2)
     {
         length = atoi(argv[i]);
         VerifyOrExit(length > 0 && length <= otbr::SteeringData::kMaxSizeOfBloomFilter,
@@ -93,14 +138,24 @@ int main(int argc, char *argv[])
 
     computer.Init(static_cast<uint8_t>(length));
 
-    for (; i < argc; ++i)
+    if (i < argc && strcmp(argv[i], "-f") == 0)
     {
-        uint8_t joinerId[otbr::SteeringData::kSizeJoinerId];
+        VerifyOrExit(i + 2 == argc, help());
+        VerifyOrExit(ReadEui64File(argv[i + 1], eui64s) == 0, ret = EX_DATAERR);
+    }
+    else
+    {
+        for (; i < argc; ++i)
+        {
+            otbr::SteeringData::Eui64 eui64;
 
-        VerifyOrExit(ComputeJoinerId(argv[i], joinerId) == 0, fprintf(stderr, "Invalid EUI64 : %s\n", argv[i]));
-        computer.ComputeBloomFilter(joinerId);
+            VerifyOrExit(ParseEui64(argv[i], eui64) == 0, fprintf(stderr, "Invalid EUI64 : %s\n", argv[i]));
+            eui64s.push_back(eui64);
+        }
     }
 
+    computer.ComputeBloomFilter(eui64s, std::thread::hardware_concurrency());
+
     for (i = 0; i < length; i++)
     {
         printf("%02x", computer.GetBloomFilter()[i]);